@@ -20,6 +20,7 @@ package com.tencent.kuikly.compose.container
 import com.tencent.kuikly.compose.ui.ExperimentalComposeUiApi
 import com.tencent.kuikly.compose.ui.InternalComposeUiApi
 import com.tencent.kuikly.compose.ui.geometry.Offset
+import com.tencent.kuikly.compose.ui.input.pointer.HistoricalChange
 import com.tencent.kuikly.compose.ui.input.pointer.PointerEventType
 import com.tencent.kuikly.compose.ui.input.pointer.PointerId
 import com.tencent.kuikly.compose.ui.input.pointer.PointerType
@@ -30,6 +31,7 @@ import com.tencent.kuikly.compose.ui.scene.ComposeScene
 import com.tencent.kuikly.compose.ui.scene.ComposeScenePointer
 import com.tencent.kuikly.compose.scroller.TouchActivityTracker
 import com.tencent.kuikly.core.base.Attr.StyleConst
+import com.tencent.kuikly.core.base.event.HistoricalPoint
 import com.tencent.kuikly.core.base.event.Touch
 import com.tencent.kuikly.core.views.DivEvent
 import com.tencent.kuikly.core.views.DivView
@@ -52,6 +54,10 @@ class SuperTouchManager {
         this.container = container
         this.scene = scene
         this.container.getViewAttr().superTouch(true)
+        if (container.getPager().pageData.isOhOs) {
+            // 同一帧内的 move 由渲染层合并，被合并掉的采样点作为 historical 交给速度计算
+            this.container.getViewAttr().coalesceTouchMove(true)
+        }
         this.container.getViewEvent().run {
             setTouchDown(true)
             setTouchMove(useSyncMove)
@@ -87,7 +93,9 @@ class SuperTouchManager {
 
     internal fun DivEvent.setTouchMove(isSync: Boolean) {
         touchMove(isSync) {
-            val result = touchesDelegate.onTouchesEvent(it.touches, PointerEventType.Move, it.timestamp, it.consumed)
+            val result = touchesDelegate.onTouchesEvent(
+                it.touches, PointerEventType.Move, it.timestamp, it.consumed, it.historicalPoints
+            )
             if (!it.consumed) {
                 if (result.anyMovementConsumed) {
                     container.getViewAttr().preventTouch(true)
@@ -168,19 +176,29 @@ class SuperTouchManager {
         object : InteractionView.Delegate {
             override fun pointInside(x: Float, y: Float): Boolean = true
             override fun onTouchesEvent(touches: List<Touch>, type: PointerEventType, timestamp: Long,
-                                        isConsumeByNative: Boolean): ProcessResult {
+                                        isConsumeByNative: Boolean,
+                                        historicalPoints: List<HistoricalPoint>): ProcessResult {
                 // because density may change by sizeChange Event on ohos
                 // here need to fetch the density realtime
                 val pageDensity = container.getPager().pagerDensity()
                 return scene.sendPointerEvent(
                     eventType = type,
-                    pointers = touches.map { touch ->
+                    pointers = touches.mapIndexed { index, touch ->
                         val position = Offset(touch.x * pageDensity, touch.y * pageDensity)
+                        // 渲染层只回传主指针（touches[0]）被合并掉的采样点
+                        val historical = if (index == 0) {
+                            historicalPoints.map { point ->
+                                HistoricalChange(point.timestamp, Offset(point.x * pageDensity, point.y * pageDensity))
+                            }
+                        } else {
+                            emptyList()
+                        }
                         ComposeScenePointer(
                             id = PointerId(touch.pointerId),
                             position = position,
                             pressed = (type != PointerEventType.Release),
                             type = PointerType.Touch,
+                            historical = historical,
                         )
                     },
                     timeMillis = timestamp,
@@ -17,6 +17,7 @@ package com.tencent.kuikly.compose.ui.platform
 
 import com.tencent.kuikly.compose.ui.input.pointer.PointerEventType
 import com.tencent.kuikly.compose.ui.input.pointer.ProcessResult
+import com.tencent.kuikly.core.base.event.HistoricalPoint
 import com.tencent.kuikly.core.base.event.Touch
 
 internal class InteractionView {
@@ -31,7 +32,8 @@ internal class InteractionView {
             touches: List<Touch>,
             type: PointerEventType,
             timestamp: Long,
-            isConsumeByNative: Boolean = false
+            isConsumeByNative: Boolean = false,
+            historicalPoints: List<HistoricalPoint> = emptyList()
         ): ProcessResult
     }
 }
\ No newline at end of file
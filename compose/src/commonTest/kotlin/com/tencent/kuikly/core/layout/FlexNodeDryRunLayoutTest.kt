@@ -0,0 +1,111 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2026 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.tencent.kuikly.core.layout
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertTrue
+
+// core 没有测试源集，FlexNode 的试算布局放在这里验证
+class FlexNodeDryRunLayoutTest {
+
+    // 文本式测量：固定总宽度 600 的内容按约束宽度折行，每行高 20
+    private class TextMeasure(var contentWidth: Float) : MeasureFunction {
+        val constraints = mutableListOf<Float>()
+
+        override fun measure(node: FlexNode, width: Float, height: Float, measureOutput: MeasureOutput) {
+            constraints.add(width)
+            val lines = kotlin.math.ceil(contentWidth / width)
+            measureOutput.width = minOf(contentWidth, width)
+            measureOutput.height = lines * 20f
+        }
+    }
+
+    private class RecordingCollector : MeasureCollector {
+        val requests = mutableListOf<Pair<FlexNode, Float>>()
+
+        override fun collect(node: FlexNode, width: Float, height: Float, measureOutput: MeasureOutput) {
+            requests.add(node to width)
+            measureOutput.width = 0f
+            measureOutput.height = 0f
+        }
+    }
+
+    private class Tree(contentWidths: List<Float>) {
+        val root = FlexNode()
+        val texts = contentWidths.map { TextMeasure(it) }
+        val leaves = texts.map { measure -> FlexNode().also { it.measureFunction = measure } }
+        var frameChanges = 0
+
+        init {
+            root.styleWidth = 300f
+            root.setPadding(StyleSpace.Type.ALL, 10f)
+            root.layoutFrameDidChangedCallback = { frameChanges++ }
+            leaves.forEachIndexed { index, leaf ->
+                leaf.layoutFrameDidChangedCallback = { frameChanges++ }
+                root.addChildAt(leaf, index)
+            }
+        }
+
+        fun frames(): List<Frame> = listOf(root.layoutFrame) + leaves.map { it.layoutFrame }
+    }
+
+    private val contentWidths = listOf(100f, 600f, 900f, 250f)
+
+    @Test
+    fun collectsTheConstraintsTheRealLayoutUses() {
+        val tree = Tree(contentWidths)
+        val collector = RecordingCollector()
+        tree.root.dryRunLayout(FlexLayoutContext().also { it.measureCollector = collector })
+
+        assertTrue(tree.texts.all { it.constraints.isEmpty() }, "dry run must not call measure functions")
+        assertEquals(0, tree.frameChanges, "dry run must not commit frames")
+        assertTrue(tree.root.isDirty, "dry run must keep the tree dirty")
+
+        tree.root.calculateLayout(null)
+        tree.leaves.forEachIndexed { index, leaf ->
+            val collected = collector.requests.filter { it.first === leaf }.map { it.second }
+            assertEquals(tree.texts[index].constraints.first(), collected.first(), "leaf $index constraint")
+        }
+    }
+
+    @Test
+    fun realLayoutMatchesLayoutWithoutDryRun() {
+        val control = Tree(contentWidths)
+        val tree = Tree(contentWidths)
+        val context = FlexLayoutContext().also { it.measureCollector = RecordingCollector() }
+
+        control.root.calculateLayout(null)
+        tree.root.dryRunLayout(context)
+        tree.root.calculateLayout(null)
+        assertEquals(control.frames(), tree.frames(), "first layout")
+
+        // 只有一段文本变化：未变化的兄弟节点在试算中被重新布局，正式布局的结果与重算范围仍不受影响
+        control.texts[1].contentWidth = 1500f
+        control.leaves[1].markDirty()
+        tree.texts[1].contentWidth = 1500f
+        tree.leaves[1].markDirty()
+        control.root.calculateLayout(null)
+        tree.root.dryRunLayout(context)
+        tree.root.calculateLayout(null)
+        assertEquals(control.frames(), tree.frames(), "relayout after a text change")
+        assertEquals(
+            control.texts.map { it.constraints },
+            tree.texts.map { it.constraints },
+            "same measure calls as without dry run"
+        )
+    }
+}
@@ -65,6 +65,24 @@ KUIKLY_EXPORT bool KRAnyDataIsBool(KRAnyData data);
  */
 KUIKLY_EXPORT bool KRAnyDataIsBytes(KRAnyData data);
 
+/**
+ * 检测是否是一个 float 数组（连续存储，对应 ArkTS Float32Array / Kotlin FloatArray）
+ * @param data 输入的对象
+ */
+KUIKLY_EXPORT bool KRAnyDataIsFloatArray(KRAnyData data);
+
+/**
+ * 检测是否是一个 double 数组（连续存储，对应 ArkTS Float64Array / Kotlin DoubleArray）
+ * @param data 输入的对象
+ */
+KUIKLY_EXPORT bool KRAnyDataIsDoubleArray(KRAnyData data);
+
+/**
+ * 检测是否是一个 int32 数组（连续存储，对应 ArkTS Int32Array / Kotlin IntArray）
+ * @param data 输入的对象
+ */
+KUIKLY_EXPORT bool KRAnyDataIsIntArray(KRAnyData data);
+
 /**
  * 检测是否是一个Array
  * @param data 输入的对象
@@ -160,7 +178,7 @@ KUIKLY_EXPORT int KRAnyDataGetFloat(KRAnyData data, float* value);
 KUIKLY_EXPORT int KRAnyDataGetBool(KRAnyData data, bool* value);
 
 /**
- * @brief 从 KRAnyData 中提取 二进制 值
+ * @brief 从 KRAnyData 中提取 二进制 值（借用，不拷贝，data 销毁前有效）
  * @param data 输入数据句柄，类型为 KRAnyData
  * @param value 用于接收二进制数据的地址
  * @param size 用于接收二进制数据的长度
@@ -168,6 +186,33 @@ KUIKLY_EXPORT int KRAnyDataGetBool(KRAnyData data, bool* value);
  */
 KUIKLY_EXPORT int KRAnyDataGetBytes(KRAnyData data, const char** value, int *size);
 
+/**
+ * @brief 从 KRAnyData 中提取 float 数组（借用，不拷贝，data 销毁前有效）
+ * @param data 输入数据句柄，类型为 KRAnyData
+ * @param value 用于接收数组首地址
+ * @param size 用于接收数组元素个数
+ * @return KRAnDataErrorCode，类型不符时返回 KRANYDATA_TYPE_MISMATCH
+ */
+KUIKLY_EXPORT int KRAnyDataGetFloatArray(KRAnyData data, const float** value, int *size);
+
+/**
+ * @brief 从 KRAnyData 中提取 double 数组（借用，不拷贝，data 销毁前有效）
+ * @param data 输入数据句柄，类型为 KRAnyData
+ * @param value 用于接收数组首地址
+ * @param size 用于接收数组元素个数
+ * @return KRAnDataErrorCode，类型不符时返回 KRANYDATA_TYPE_MISMATCH
+ */
+KUIKLY_EXPORT int KRAnyDataGetDoubleArray(KRAnyData data, const double** value, int *size);
+
+/**
+ * @brief 从 KRAnyData 中提取 int32 数组（借用，不拷贝，data 销毁前有效）
+ * @param data 输入数据句柄，类型为 KRAnyData
+ * @param value 用于接收数组首地址
+ * @param size 用于接收数组元素个数
+ * @return KRAnDataErrorCode，类型不符时返回 KRANYDATA_TYPE_MISMATCH
+ */
+KUIKLY_EXPORT int KRAnyDataGetIntArray(KRAnyData data, const int32_t** value, int *size);
+
 /**
  * @brief 从 KRAnyData 中提取 二进制 值
  * @param data 输入数据句柄，类型为 KRAnyData
@@ -242,6 +287,49 @@ KUIKLY_EXPORT KRAnyData KRAnyDataCreateString(const char* value);
  */
 KUIKLY_EXPORT KRAnyData KRAnyDataCreateBytes(const char* value, int size);
 
+/**
+ * 二进制数据释放回调
+ * @param value 创建时传入的数据地址
+ * @param size 创建时传入的数据长度
+ * @param context 创建时传入的上下文
+ */
+typedef void (*KRAnyDataBytesDeallocator)(const char* value, int size, void* context);
+
+/**
+ * @brief 创建一个新的 KRAnyData 值为 二进制 类型，直接借用 value 指向的存储而不拷贝
+ * @param value 二进制数据地址，在 deallocator 被调用前必须保持有效且不可修改
+ * @param size 二进制数据的长度
+ * @param deallocator 数据不再被引用时的释放回调（可能在任意线程调用），可为 NULL
+ * @param context 透传给 deallocator 的上下文
+ * @return KRAnyData
+ */
+KUIKLY_EXPORT KRAnyData KRAnyDataCreateBytesNoCopy(const char* value, int size,
+                                                   KRAnyDataBytesDeallocator deallocator, void* context);
+
+/**
+ * @brief 创建一个新的 KRAnyData 值为 float 数组类型（拷贝一份连续存储）
+ * @param value 数组首地址
+ * @param size 数组元素个数
+ * @return KRAnyData
+ */
+KUIKLY_EXPORT KRAnyData KRAnyDataCreateFloatArray(const float* value, int size);
+
+/**
+ * @brief 创建一个新的 KRAnyData 值为 double 数组类型（拷贝一份连续存储）
+ * @param value 数组首地址
+ * @param size 数组元素个数
+ * @return KRAnyData
+ */
+KUIKLY_EXPORT KRAnyData KRAnyDataCreateDoubleArray(const double* value, int size);
+
+/**
+ * @brief 创建一个新的 KRAnyData 值为 int32 数组类型（拷贝一份连续存储）
+ * @param value 数组首地址
+ * @param size 数组元素个数
+ * @return KRAnyData
+ */
+KUIKLY_EXPORT KRAnyData KRAnyDataCreateIntArray(const int32_t* value, int size);
+
 /**
  * @brief 创建一个新的 KRAnyData 值为 Array 类型
  * @param size 设置的数组长度
@@ -188,6 +188,31 @@ typedef char *(*KRFontAdapter)(const char *fontFamily, char **fontBuffer, size_t
  */
 KUIKLY_EXPORT void KRRegisterFontAdapter(KRFontAdapter adapter, const char *fontFamily);
 
+struct NativeResourceManager;
+
+/**
+ * @brief 在后台线程预注册一组自定义字体（需已通过KRRegisterFontAdapter注册对应adapter），
+ *        避免页面首次使用该字体排版时同步加载。每个字体在进程内只注册一次，各页面共享。
+ * @param resMgr 资源管理器，加载rawfile字体需要；为空时rawfile字体推迟到首次使用时注册。
+ *               Kuikly不接管其所有权，注册在后台异步完成且没有完成通知，调用方需保证它在进程内一直有效（不要释放）
+ * @param fontFamilies 字体名称数组
+ * @param count 数组长度
+ */
+KUIKLY_EXPORT void KRPreregisterFonts(struct NativeResourceManager *resMgr, const char *const *fontFamilies,
+                                      size_t count);
+
+/**
+ * @brief 设置自定义字体数据的内存预算（字节），超出时注销长时间未使用的字体（需系统支持注销字体）
+ * @param budgetBytes 预算字节数，默认32MB
+ */
+KUIKLY_EXPORT void KRSetFontCacheBudget(size_t budgetBytes);
+
+/**
+ * @brief 设置cacheKey类型快照的内存预算（字节，所有页面共享），超出时按最近最少使用换出，改用快照的png文件展示
+ * @param budgetBytes 预算字节数，默认64MB
+ */
+KUIKLY_EXPORT void KRSetSnapshotCacheBudget(size_t budgetBytes);
+
 /**
  * @brief 一个用于析构KRImageAdapter返回的imageDescriptor或src的回调函数
  * @param imageDescriptor或src
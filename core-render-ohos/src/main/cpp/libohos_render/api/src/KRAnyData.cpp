@@ -16,6 +16,20 @@
 #include "libohos_render/api/include/Kuikly/KRAnyData.h"
 #include "KRAnyDataInternal.h"
 
+// 借用数值数组的连续存储
+template <typename T>
+static int GetNumericArray(bool type_matched, const std::shared_ptr<std::vector<T>> &numbers, const T **value,
+                           int *size) {
+    if (!type_matched) {
+        return KRANYDATA_TYPE_MISMATCH;
+    }
+    *value = numbers->data();
+    if (size != nullptr) {
+        *size = static_cast<int>(numbers->size());
+    }
+    return KRANYDATA_SUCCESS;
+}
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -69,6 +83,30 @@ bool KRAnyDataIsBytes(KRAnyData data) {
     return internal->anyValue->isByteArray();
 }
 
+bool KRAnyDataIsFloatArray(KRAnyData data) {
+    struct KRAnyDataInternal *internal = (struct KRAnyDataInternal *)data;
+    if (internal == nullptr || internal->anyValue == nullptr) {
+        return false;
+    }
+    return internal->anyValue->isFloat32Array();
+}
+
+bool KRAnyDataIsDoubleArray(KRAnyData data) {
+    struct KRAnyDataInternal *internal = (struct KRAnyDataInternal *)data;
+    if (internal == nullptr || internal->anyValue == nullptr) {
+        return false;
+    }
+    return internal->anyValue->isFloat64Array();
+}
+
+bool KRAnyDataIsIntArray(KRAnyData data) {
+    struct KRAnyDataInternal *internal = (struct KRAnyDataInternal *)data;
+    if (internal == nullptr || internal->anyValue == nullptr) {
+        return false;
+    }
+    return internal->anyValue->isInt32Array();
+}
+
 bool KRAnyDataIsArray(KRAnyData data) {
     struct KRAnyDataInternal *internal = (struct KRAnyDataInternal *)data;
     if (internal == nullptr || internal->anyValue == nullptr) {
@@ -196,10 +234,45 @@ int KRAnyDataGetBytes(KRAnyData data, const char** value, int *size) {
     if (internal == nullptr || internal->anyValue == nullptr) {
         return KRANYDATA_NULL_INPUT;
     }
-    auto cValue = internal->anyValue->toCValue();
-    *value = cValue.value.bytesValue;
-    *size = cValue.size; 
-    return 0;
+    // 直接借用底层存储，不经过 toCValue 也不拷贝
+    *value = reinterpret_cast<const char *>(internal->anyValue->bytesData());
+    if (size != nullptr) {
+        *size = static_cast<int>(internal->anyValue->bytesSize());
+    }
+    return KRANYDATA_SUCCESS;
+}
+
+int KRAnyDataGetFloatArray(KRAnyData data, const float** value, int *size) {
+    if (value == nullptr) {
+        return KRANYDATA_NULL_OUTPUT;
+    }
+    struct KRAnyDataInternal *internal = (struct KRAnyDataInternal *)data;
+    if (internal == nullptr || internal->anyValue == nullptr) {
+        return KRANYDATA_NULL_INPUT;
+    }
+    return GetNumericArray(internal->anyValue->isFloat32Array(), internal->anyValue->toFloat32Array(), value, size);
+}
+
+int KRAnyDataGetDoubleArray(KRAnyData data, const double** value, int *size) {
+    if (value == nullptr) {
+        return KRANYDATA_NULL_OUTPUT;
+    }
+    struct KRAnyDataInternal *internal = (struct KRAnyDataInternal *)data;
+    if (internal == nullptr || internal->anyValue == nullptr) {
+        return KRANYDATA_NULL_INPUT;
+    }
+    return GetNumericArray(internal->anyValue->isFloat64Array(), internal->anyValue->toFloat64Array(), value, size);
+}
+
+int KRAnyDataGetIntArray(KRAnyData data, const int32_t** value, int *size) {
+    if (value == nullptr) {
+        return KRANYDATA_NULL_OUTPUT;
+    }
+    struct KRAnyDataInternal *internal = (struct KRAnyDataInternal *)data;
+    if (internal == nullptr || internal->anyValue == nullptr) {
+        return KRANYDATA_NULL_INPUT;
+    }
+    return GetNumericArray(internal->anyValue->isInt32Array(), internal->anyValue->toInt32Array(), value, size);
 }
 
 int KRAnyDataGetStr(KRAnyData data, const char** value) {
@@ -292,6 +365,50 @@ KRAnyData KRAnyDataCreateBytes(const char* value, int size) {
     return data;
 }
 
+KRAnyData KRAnyDataCreateBytesNoCopy(const char* value, int size, KRAnyDataBytesDeallocator deallocator,
+                                     void* context) {
+    auto data = new KRAnyDataInternal();
+    if (value == nullptr || size <= 0) {
+        if (deallocator != nullptr) {
+            deallocator(value, size, context);
+        }
+        data->anyValue = KRRenderValue::Make(std::make_shared<std::vector<uint8_t>>());
+        return data;
+    }
+    KRRenderValue::ExternalBytes bytes;
+    bytes.data = reinterpret_cast<const uint8_t *>(value);
+    bytes.size = static_cast<size_t>(size);
+    // owner 最后一个引用释放时（可能在任意线程）回调 deallocator
+    bytes.owner = std::shared_ptr<const void>(value, [deallocator, size, context](const void *ptr) {
+        if (deallocator != nullptr) {
+            deallocator(static_cast<const char *>(ptr), size, context);
+        }
+    });
+    data->anyValue = KRRenderValue::Make(bytes);
+    return data;
+}
+
+KRAnyData KRAnyDataCreateFloatArray(const float* value, int size) {
+    auto data = new KRAnyDataInternal();
+    auto count = value == nullptr || size <= 0 ? 0 : size;
+    data->anyValue = KRRenderValue::Make(std::make_shared<std::vector<float>>(value, value + count));
+    return data;
+}
+
+KRAnyData KRAnyDataCreateDoubleArray(const double* value, int size) {
+    auto data = new KRAnyDataInternal();
+    auto count = value == nullptr || size <= 0 ? 0 : size;
+    data->anyValue = KRRenderValue::Make(std::make_shared<std::vector<double>>(value, value + count));
+    return data;
+}
+
+KRAnyData KRAnyDataCreateIntArray(const int32_t* value, int size) {
+    auto data = new KRAnyDataInternal();
+    auto count = value == nullptr || size <= 0 ? 0 : size;
+    data->anyValue = KRRenderValue::Make(std::make_shared<std::vector<int32_t>>(value, value + count));
+    return data;
+}
+
 KRAnyData KRAnyDataCreateArray(int size) {
     auto data = new KRAnyDataInternal();
     std::vector<std::shared_ptr<KRRenderValue>> valueArray;
@@ -20,13 +20,17 @@
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "KRAnyDataInternal.h"
 #include "KRTextPostProcessor.h"
 #include "libohos_render/expand/components/image/KRImageAdapterManager.h"
 #include "libohos_render/expand/components/richtext/KRFontAdapterManager.h"
+#include "libohos_render/expand/components/richtext/KRFontRegistry.h"
 #include "libohos_render/export/IKRRenderModuleExport.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/manager/KRSnapshotManager.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -312,6 +316,28 @@ void KRRegisterFontAdapter(KRFontAdapter adapter, const char *fontFamily) {
     KRFontAdapterManager::GetInstance()->RegisterFontAdapter(adapter, fontFamily);
 }
 
+void KRPreregisterFonts(struct NativeResourceManager *resMgr, const char *const *fontFamilies, size_t count) {
+    if (fontFamilies == nullptr) {
+        return;
+    }
+    std::vector<std::string> families;
+    for (size_t i = 0; i < count; i++) {
+        if (fontFamilies[i] != nullptr) {
+            families.emplace_back(fontFamilies[i]);
+        }
+    }
+    KRFontRegistry::GetInstance().PreregisterAsync(resMgr, std::move(families));
+}
+
+void KRSetFontCacheBudget(size_t budgetBytes) {
+    KRFontRegistry::GetInstance().SetBudget(budgetBytes);
+}
+
+void KRSetSnapshotCacheBudget(size_t budgetBytes) {
+    // 快照缓存只在主线程访问
+    KRMainThread::RunOnMainThread([budgetBytes] { KRSnapshotManager::SetMemoryBudget(budgetBytes); });
+}
+
 void KRRegisterImageAdapter(KRImageAdapter adapter) {
     KRImageAdapterManager::GetInstance()->RegisterImageAdapter(adapter);
 }
@@ -51,7 +51,8 @@ enum class KuiklyRenderNativeMethod {
     KuiklyRenderNativeMethodCallShadowMethod = 14,        // "callShadowModule方法"
     KuiklyRenderNativeMethodFireFatalException = 15,      // "fireFatalException"方法
     KuiklyRenderNativeMethodSyncFlushUI = 16,             // "syncFlushUI方法"
-    KuiklyRenderNativeMethodCallTDFNativeMethod = 17      // "callTDFModuleMethod"
+    KuiklyRenderNativeMethodCallTDFNativeMethod = 17,     // "callTDFModuleMethod"
+    KuiklyRenderNativeMethodCalculateRenderViewSizes = 18  // "calculateRenderViewSizes" 批量测量方法
 };
 
 class IKRRenderNativeContextHandler;
@@ -0,0 +1,234 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/context/KRCallNativeRecorder.h"
+
+#include <vector>
+#include "libohos_render/context/KRRenderNativeContextHandlerManager.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/manager/KRRenderManager.h"
+#include "libohos_render/scheduler/KRContextScheduler.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+
+// 编码缓冲超过该大小时写入文件
+static constexpr size_t kFlushThreshold = 64 * 1024;
+
+static int64_t SteadyNowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+KRCallNativeRecorder &KRCallNativeRecorder::GetInstance() {
+    static KRCallNativeRecorder *instance = new KRCallNativeRecorder();
+    return *instance;
+}
+
+bool KRCallNativeRecorder::Start(const std::string &path) {
+    Stop();
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        KR_LOG_ERROR << "KRCallNativeRecorder open failed: " << path;
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    file_ = file;
+    writer_ = std::make_unique<KRCallNativeTraceWriter>();
+    threads_.clear();
+    start_us_.store(SteadyNowUs(), std::memory_order_relaxed);
+    // release：IsRecording 读到 true 的线程一定能看到新的 start_us_
+    recording_.store(true, std::memory_order_release);
+    return true;
+}
+
+void KRCallNativeRecorder::Stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!recording_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    recording_.store(false, std::memory_order_relaxed);
+    FlushLocked();
+    KR_LOG_INFO << "KRCallNativeRecorder stopped, records: " << writer_->RecordCount();
+    fclose(file_);
+    file_ = nullptr;
+    writer_.reset();
+}
+
+int64_t KRCallNativeRecorder::NowUs() const {
+    return SteadyNowUs() - start_us_.load(std::memory_order_relaxed);
+}
+
+void KRCallNativeRecorder::Record(int64_t start_us, const std::string &instance_id, int method,
+                                  const KRRenderCValue *args, const KRRenderCValue &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 加锁前可能已经 Stop
+    if (!recording_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    writer_->Append(start_us, CurrentThreadLocked(), instance_id, method, args, result);
+    if (writer_->BufferSize() >= kFlushThreshold) {
+        FlushLocked();
+    }
+}
+
+uint32_t KRCallNativeRecorder::CurrentThreadLocked() {
+    if (KRMainThread::IsCurrentOnMainThread()) {
+        return kMainThread;
+    }
+    if (KRContextScheduler::IsCurrentOnContextThread()) {
+        return kContextThread;
+    }
+    auto it = threads_.find(std::this_thread::get_id());
+    if (it != threads_.end()) {
+        return it->second;
+    }
+    auto index = static_cast<uint32_t>(threads_.size()) + kContextThread + 1;
+    threads_.emplace(std::this_thread::get_id(), index);
+    return index;
+}
+
+void KRCallNativeRecorder::FlushLocked() {
+    auto buffer = writer_->TakeBuffer();
+    if (!buffer.empty() && fwrite(buffer.data(), 1, buffer.size(), file_) != buffer.size()) {
+        KR_LOG_ERROR << "KRCallNativeRecorder write failed";
+    }
+}
+
+namespace {
+/** 一次回放的状态，在 context 线程上逐步推进 */
+struct KRCallNativeReplayState {
+    std::vector<uint8_t> data;
+    std::unique_ptr<KRCallNativeTraceReader> reader;
+    KRCallNativeTraceRecord record;
+    bool has_pending_record = false;
+    std::string target_instance_id;
+    std::string source_instance_id;
+    bool realtime = false;
+    std::chrono::steady_clock::time_point start_time;
+    KRCallNativeReplayReport report;
+    KRCallNativeReplayer::Callback callback;
+};
+
+void DispatchRecord(KRCallNativeReplayState &state) {
+    const auto &record = state.record;
+    if (state.source_instance_id.empty()) {
+        state.source_instance_id = record.instance_id;
+    }
+    // 其他页面的 view tag 与录制页面的 tag 各自计数，混在一个宿主页面里会互相覆盖
+    if (record.instance_id != state.source_instance_id) {
+        state.report.skipped++;
+        return;
+    }
+    if (KRCallNativeTraceIsReplayStubbed(record.method)) {
+        state.report.stubbed++;
+        return;
+    }
+    KRRenderCValue reserved;
+    auto result = KRRenderNativeContextHandlerManager::GetInstance().DispatchCallNative(
+        state.target_instance_id, record.method, reserved, record.args[0], record.args[1], record.args[2],
+        record.args[3], record.args[4]);
+    state.report.calls++;
+    // 录制时有返回值的即为同步调用
+    if (record.result.type != KRRenderCValue::NULL_VALUE) {
+        state.report.checked++;
+        if (!KRCallNativeTraceValueEquals(result, record.result)) {
+            state.report.mismatched++;
+            KR_LOG_ERROR << "KRCallNativeReplayer result mismatch, call: " << state.report.calls
+                         << ", method: " << record.method;
+        }
+    }
+}
+
+void ReplayStep(const std::shared_ptr<KRCallNativeReplayState> &state) {
+    while (true) {
+        if (!state->has_pending_record) {
+            if (!state->reader->Next(&state->record)) {
+                break;
+            }
+            state->has_pending_record = true;
+        }
+        if (state->realtime) {
+            auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                  std::chrono::steady_clock::now() - state->start_time)
+                                  .count();
+            auto wait_ms = (state->record.time_us - elapsed_us) / 1000;
+            if (wait_ms > 0) {
+                KRContextScheduler::ScheduleTask(static_cast<int>(wait_ms), [state] { ReplayStep(state); });
+                return;
+            }
+        }
+        DispatchRecord(*state);
+        state->has_pending_record = false;
+    }
+    state->report.corrupted = state->reader->HasError();
+    state->report.elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                   std::chrono::steady_clock::now() - state->start_time)
+                                   .count();
+    const auto &report = state->report;
+    KR_LOG_INFO << "KRCallNativeReplayer finished, calls: " << report.calls << ", elapsed_us: " << report.elapsed_us
+                << ", stubbed: " << report.stubbed << ", skipped: " << report.skipped
+                << ", mismatched: " << report.mismatched << "/" << report.checked
+                << ", corrupted: " << report.corrupted;
+    if (state->callback) {
+        KRMainThread::RunOnMainThread([state] { state->callback(state->report); });
+    }
+}
+}  // namespace
+
+void KRCallNativeReplayer::RegisterReplayMode() {
+    auto mode_creator = []() -> std::shared_ptr<KRRenderExecuteMode> {
+        return std::make_shared<KRCallNativeReplayMode>();
+    };
+    auto context_handler_creator = [](const std::shared_ptr<KRRenderContextParams> &context_params)
+        -> std::shared_ptr<IKRRenderNativeContextHandler> {
+        return std::make_shared<KRCallNativeReplayContextHandler>();
+    };
+    KRRenderManager::GetInstance().RegisterExcuteModeCreator(std::make_shared<KRRenderExecuteModeWrapper>(
+        KRCallNativeReplayMode::kMode, mode_creator, context_handler_creator));
+}
+
+bool KRCallNativeReplayer::Replay(const std::string &path, const std::string &target_instance_id,
+                                  const std::string &source_instance_id, bool realtime, const Callback &callback) {
+    auto handler = KRRenderNativeContextHandlerManager::GetInstance().GetContextHandler(target_instance_id);
+    if (dynamic_cast<KRCallNativeReplayContextHandler *>(handler.get()) == nullptr) {
+        KR_LOG_ERROR << "KRCallNativeReplayer target is not a replay page: " << target_instance_id;
+        return false;
+    }
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    auto state = std::make_shared<KRCallNativeReplayState>();
+    uint8_t buffer[64 * 1024];
+    size_t read_length = 0;
+    while ((read_length = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        state->data.insert(state->data.end(), buffer, buffer + read_length);
+    }
+    fclose(file);
+    state->reader = std::make_unique<KRCallNativeTraceReader>(state->data.data(), state->data.size());
+    if (!state->reader->IsValid()) {
+        KR_LOG_ERROR << "KRCallNativeReplayer invalid trace: " << path;
+        return false;
+    }
+    state->target_instance_id = target_instance_id;
+    state->source_instance_id = source_instance_id;
+    state->realtime = realtime;
+    state->callback = callback;
+    KRContextScheduler::ScheduleTask(0, [state] {
+        state->start_time = std::chrono::steady_clock::now();
+        ReplayStep(state);
+    });
+    return true;
+}
@@ -0,0 +1,153 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRCALLNATIVERECORDER_H
+#define CORE_RENDER_OHOS_KRCALLNATIVERECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include "libohos_render/context/IKRRenderNativeContextHandler.h"
+#include "libohos_render/context/KRCallNativeTrace.h"
+#include "libohos_render/context/KRRenderExecuteMode.h"
+
+/**
+ * CallNative 录制器（进程级单例，默认关闭）。
+ *
+ * 开启后 KRRenderNativeContextHandlerManager::DispatchCallNative 把每次调用的实例ID、方法、参数、
+ * 返回值、调用时间与线程写入轨迹文件，用于线下复现线上卡顿页面的完整调用序列。
+ * 关闭时 DispatchCallNative 只多一次 acquire 原子读。
+ */
+class KRCallNativeRecorder {
+ public:
+    /** 轨迹中的线程编号：0 主线程，1 context 线程，其余线程按首次出现顺序从 2 开始编号 */
+    static constexpr uint32_t kMainThread = 0;
+    static constexpr uint32_t kContextThread = 1;
+
+    static KRCallNativeRecorder &GetInstance();
+
+    /** 开始录制到 path（覆盖已有文件），正在录制时先结束上一份 */
+    bool Start(const std::string &path);
+    /** 结束录制并关闭文件 */
+    void Stop();
+
+    bool IsRecording() const {
+        // 与 Start 中的 release 配对，读到 true 时 start_us_ 已可见
+        return recording_.load(std::memory_order_acquire);
+    }
+
+    /** 相对录制开始的时间，仅在 IsRecording() 返回 true 后调用 */
+    int64_t NowUs() const;
+
+    /**
+     * 追加一次调用
+     * @param start_us 调用开始时的 NowUs()
+     * @param args arg1..arg5
+     */
+    void Record(int64_t start_us, const std::string &instance_id, int method, const KRRenderCValue *args,
+                const KRRenderCValue &result);
+
+ private:
+    KRCallNativeRecorder() = default;
+    KRCallNativeRecorder(const KRCallNativeRecorder &) = delete;
+    KRCallNativeRecorder &operator=(const KRCallNativeRecorder &) = delete;
+
+    uint32_t CurrentThreadLocked();
+    void FlushLocked();
+
+    std::atomic<bool> recording_{false};
+    std::mutex mutex_;
+    std::unique_ptr<KRCallNativeTraceWriter> writer_;
+    FILE *file_ = nullptr;
+    // 录制开始时的 steady_clock 时间（微秒），NowUs 在锁外读取
+    std::atomic<int64_t> start_us_{0};
+    std::unordered_map<std::thread::id, uint32_t> threads_;
+};
+
+/**
+ * 回放结果
+ */
+struct KRCallNativeReplayReport {
+    uint64_t calls = 0;       // 回放的调用数
+    uint64_t stubbed = 0;     // 未派发的 module 等有副作用的调用数
+    uint64_t skipped = 0;     // 属于其他录制页面而跳过的调用数
+    uint64_t checked = 0;     // 校验了返回值的同步调用数
+    uint64_t mismatched = 0;  // 返回值与录制不一致的调用数
+    int64_t elapsed_us = 0;   // 回放耗时
+    bool corrupted = false;   // 轨迹文件是否损坏（损坏处之前的调用已回放）
+};
+
+/**
+ * 回放宿主页面的运行模式：不加载 Kotlin，页面只承载回放进来的调用。
+ * ArkTS 侧以 KRCallNativeReplayMode.Replay 作为 executeMode 创建页面。
+ */
+class KRCallNativeReplayMode : public KRRenderExecuteMode {
+ public:
+    static constexpr int kMode = 100;
+
+    KRCallNativeReplayMode() : KRRenderExecuteMode(kMode) {}
+    bool IsContextSyncInit() override {
+        return true;
+    }
+    int ModeToCoreValue() override {
+        return 4;
+    }
+};
+
+/**
+ * 回放宿主页面的 context handler：没有 Kotlin 上下文，渲染层发往 Kotlin 的事件与回调全部丢弃
+ */
+class KRCallNativeReplayContextHandler : public IKRRenderNativeContextHandler {
+ public:
+    void CallKotlinMethod(const KuiklyRenderContextMethod &method, const std::shared_ptr<KRRenderValue> &arg0,
+                          const std::shared_ptr<KRRenderValue> &arg1, const std::shared_ptr<KRRenderValue> &arg2,
+                          const std::shared_ptr<KRRenderValue> &arg3, const std::shared_ptr<KRRenderValue> &arg4,
+                          const std::shared_ptr<KRRenderValue> &arg5) override {}
+};
+
+/**
+ * CallNative 回放器：在 context 线程把轨迹重新送入 DispatchCallNative，驱动完整的 KRRenderCore 渲染流程。
+ * 可按录制节奏回放以复现卡顿，也可尽可能快地回放作为吞吐基准。
+ *
+ * 录制中的 view tag 只在录制页面内有效，因此只回放一个录制页面的调用，且目标必须是 KRCallNativeReplayMode
+ * 创建的空页面，不会与任何页面自己的 Kotlin tag 冲突。module 调用与 fireFatalException 只计数不派发
+ * （见 KRCallNativeTraceIsReplayStubbed）。
+ */
+class KRCallNativeReplayer {
+ public:
+    using Callback = std::function<void(const KRCallNativeReplayReport &report)>;
+
+    /** 注册回放宿主页面的运行模式，napi 模块初始化时调用 */
+    static void RegisterReplayMode();
+
+    /**
+     * @param path 轨迹文件
+     * @param target_instance_id 回放到的实例，必须以 KRCallNativeReplayMode 创建
+     * @param source_instance_id 回放的录制页面，为空时取轨迹中第一个调用的页面
+     * @param realtime true 按录制时的调用间隔回放，false 尽可能快地回放
+     * @param callback 回放结束后在主线程回调
+     * @return 文件无法读取、格式不对或目标实例不是回放宿主页面时返回 false
+     */
+    static bool Replay(const std::string &path, const std::string &target_instance_id,
+                       const std::string &source_instance_id, bool realtime, const Callback &callback);
+};
+
+#endif  // CORE_RENDER_OHOS_KRCALLNATIVERECORDER_H
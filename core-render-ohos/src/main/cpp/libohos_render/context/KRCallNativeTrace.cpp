@@ -0,0 +1,403 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/context/KRCallNativeTrace.h"
+
+#include <cstring>
+
+namespace {
+constexpr char kTraceMagic[4] = {'K', 'R', 'C', 'N'};
+constexpr uint8_t kTraceVersion = 1;
+constexpr size_t kTraceHeaderSize = sizeof(kTraceMagic) + 1;
+// 嵌套数组的最大深度，防止损坏数据导致递归过深
+constexpr int kMaxValueDepth = 32;
+
+uint64_t ZigZag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t UnZigZag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+size_t NumberArrayElementSize(int type) {
+    switch (type) {
+        case KRRenderCValue::FLOAT32_ARRAY:
+            return sizeof(float);
+        case KRRenderCValue::FLOAT64_ARRAY:
+            return sizeof(double);
+        case KRRenderCValue::INT32_ARRAY:
+            return sizeof(int32_t);
+        default:
+            return 0;
+    }
+}
+
+const void *NumberArrayData(const KRRenderCValue &value) {
+    switch (value.type) {
+        case KRRenderCValue::FLOAT32_ARRAY:
+            return value.value.float32ArrayValue;
+        case KRRenderCValue::FLOAT64_ARRAY:
+            return value.value.float64ArrayValue;
+        case KRRenderCValue::INT32_ARRAY:
+            return value.value.int32ArrayValue;
+        default:
+            return nullptr;
+    }
+}
+}  // namespace
+
+KRCallNativeTraceWriter::KRCallNativeTraceWriter() {
+    buffer_.append(kTraceMagic, sizeof(kTraceMagic));
+    buffer_.push_back(static_cast<char>(kTraceVersion));
+}
+
+void KRCallNativeTraceWriter::Append(int64_t time_us, uint32_t thread, const std::string &instance_id, int method,
+                                     const KRRenderCValue *args, const KRRenderCValue &result) {
+    // 多线程录制时调用方按完成顺序追加，时间可能轻微回退，增量按 0 处理
+    WriteVarint(time_us > last_time_us_ ? static_cast<uint64_t>(time_us - last_time_us_) : 0);
+    if (time_us > last_time_us_) {
+        last_time_us_ = time_us;
+    }
+    WriteVarint(thread);
+    auto it = instance_ids_.find(instance_id);
+    if (it != instance_ids_.end()) {
+        WriteVarint(it->second);
+    } else {
+        auto index = static_cast<uint32_t>(instance_ids_.size());
+        instance_ids_.emplace(instance_id, index);
+        WriteVarint(index);
+        WriteVarint(instance_id.size());
+        buffer_.append(instance_id);
+    }
+    WriteVarint(ZigZag(method));
+    for (int i = 0; i < kKRCallNativeTraceArgCount; i++) {
+        WriteValue(args[i], 0);
+    }
+    WriteValue(result, 0);
+    record_count_++;
+}
+
+std::string KRCallNativeTraceWriter::TakeBuffer() {
+    std::string out;
+    out.swap(buffer_);
+    return out;
+}
+
+void KRCallNativeTraceWriter::WriteVarint(uint64_t value) {
+    while (value >= 0x80) {
+        buffer_.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer_.push_back(static_cast<char>(value));
+}
+
+void KRCallNativeTraceWriter::WriteValue(const KRRenderCValue &value, int depth) {
+    int type = value.type;
+    if (type > KRRenderCValue::INT32_ARRAY || depth >= kMaxValueDepth) {
+        type = KRRenderCValue::NULL_VALUE;
+    }
+    buffer_.push_back(static_cast<char>(type));
+    int32_t size = value.size > 0 ? value.size : 0;
+    switch (type) {
+        case KRRenderCValue::INT:
+            WriteVarint(ZigZag(value.value.intValue));
+            break;
+        case KRRenderCValue::LONG:
+            WriteVarint(ZigZag(value.value.longValue));
+            break;
+        case KRRenderCValue::FLOAT:
+            buffer_.append(reinterpret_cast<const char *>(&value.value.floatValue), sizeof(float));
+            break;
+        case KRRenderCValue::DOUBLE:
+            buffer_.append(reinterpret_cast<const char *>(&value.value.doubleValue), sizeof(double));
+            break;
+        case KRRenderCValue::BOOL:
+            buffer_.push_back(value.value.boolValue ? 1 : 0);
+            break;
+        case KRRenderCValue::STRING:
+            // 长度 + 1，0 表示空指针
+            if (value.value.stringValue == nullptr) {
+                WriteVarint(0);
+            } else {
+                size_t length = std::strlen(value.value.stringValue);
+                WriteVarint(length + 1);
+                buffer_.append(value.value.stringValue, length);
+            }
+            break;
+        case KRRenderCValue::BYTES:
+            size = value.value.bytesValue ? size : 0;
+            WriteVarint(size);
+            buffer_.append(value.value.bytesValue ? value.value.bytesValue : "", size);
+            break;
+        case KRRenderCValue::ARRAY:
+            size = value.value.arrayValue ? size : 0;
+            WriteVarint(size);
+            for (int32_t i = 0; i < size; i++) {
+                WriteValue(value.value.arrayValue[i], depth + 1);
+            }
+            break;
+        case KRRenderCValue::FLOAT32_ARRAY:
+        case KRRenderCValue::FLOAT64_ARRAY:
+        case KRRenderCValue::INT32_ARRAY: {
+            const void *data = NumberArrayData(value);
+            size = data ? size : 0;
+            WriteVarint(size);
+            buffer_.append(static_cast<const char *>(data ? data : ""), size * NumberArrayElementSize(type));
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+KRCallNativeTraceReader::KRCallNativeTraceReader(const uint8_t *data, size_t size) : data_(data), size_(size) {
+    valid_ = data != nullptr && size >= kTraceHeaderSize && std::memcmp(data, kTraceMagic, sizeof(kTraceMagic)) == 0 &&
+             data[sizeof(kTraceMagic)] == kTraceVersion;
+    offset_ = kTraceHeaderSize;
+    error_ = !valid_;
+}
+
+bool KRCallNativeTraceReader::Next(KRCallNativeTraceRecord *record) {
+    if (error_ || offset_ >= size_) {
+        return false;
+    }
+    record->bytes_storage.clear();
+    record->array_storage.clear();
+    uint64_t delta = 0;
+    uint64_t thread = 0;
+    uint64_t id_index = 0;
+    uint64_t method = 0;
+    if (!ReadVarint(&delta) || !ReadVarint(&thread) || !ReadVarint(&id_index)) {
+        error_ = true;
+        return false;
+    }
+    if (id_index == instance_ids_.size()) {
+        uint64_t length = 0;
+        if (!ReadVarint(&length) || length > size_ - offset_) {
+            error_ = true;
+            return false;
+        }
+        instance_ids_.emplace_back(reinterpret_cast<const char *>(data_ + offset_), length);
+        offset_ += length;
+    } else if (id_index > instance_ids_.size()) {
+        error_ = true;
+        return false;
+    }
+    if (!ReadVarint(&method)) {
+        error_ = true;
+        return false;
+    }
+    time_us_ += static_cast<int64_t>(delta);
+    record->time_us = time_us_;
+    record->thread = static_cast<uint32_t>(thread);
+    record->instance_id = instance_ids_[id_index];
+    record->method = static_cast<int>(UnZigZag(method));
+    for (int i = 0; i < kKRCallNativeTraceArgCount; i++) {
+        if (!ReadValue(&record->args[i], record, 0)) {
+            error_ = true;
+            return false;
+        }
+    }
+    if (!ReadValue(&record->result, record, 0)) {
+        error_ = true;
+        return false;
+    }
+    return true;
+}
+
+bool KRCallNativeTraceReader::ReadVarint(uint64_t *value) {
+    uint64_t result = 0;
+    for (int shift = 0; shift < 64 && offset_ < size_; shift += 7) {
+        uint8_t byte = data_[offset_++];
+        result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool KRCallNativeTraceReader::ReadBytes(void *out, size_t size) {
+    if (size > size_ - offset_) {
+        return false;
+    }
+    std::memcpy(out, data_ + offset_, size);
+    offset_ += size;
+    return true;
+}
+
+bool KRCallNativeTraceReader::ReadValue(KRRenderCValue *value, KRCallNativeTraceRecord *record, int depth) {
+    uint8_t type = 0;
+    if (depth >= kMaxValueDepth || !ReadBytes(&type, 1) || type > KRRenderCValue::INT32_ARRAY) {
+        return false;
+    }
+    *value = KRRenderCValue();
+    value->type = static_cast<KRRenderCValue::Type>(type);
+    uint64_t number = 0;
+    switch (type) {
+        case KRRenderCValue::NULL_VALUE:
+            return true;
+        case KRRenderCValue::INT:
+            if (!ReadVarint(&number)) {
+                return false;
+            }
+            value->value.intValue = static_cast<int32_t>(UnZigZag(number));
+            return true;
+        case KRRenderCValue::LONG:
+            if (!ReadVarint(&number)) {
+                return false;
+            }
+            value->value.longValue = UnZigZag(number);
+            return true;
+        case KRRenderCValue::FLOAT:
+            return ReadBytes(&value->value.floatValue, sizeof(float));
+        case KRRenderCValue::DOUBLE:
+            return ReadBytes(&value->value.doubleValue, sizeof(double));
+        case KRRenderCValue::BOOL: {
+            uint8_t flag = 0;
+            if (!ReadBytes(&flag, 1)) {
+                return false;
+            }
+            value->value.boolValue = flag;
+            return true;
+        }
+        default:
+            break;
+    }
+    if (!ReadVarint(&number) || number > size_ - offset_ || number > INT32_MAX) {
+        // 每个元素至少占 1 个字节，元素个数不可能超过剩余长度
+        return false;
+    }
+    if (type == KRRenderCValue::STRING && number == 0) {
+        value->value.stringValue = nullptr;
+        return true;
+    }
+    if (type == KRRenderCValue::ARRAY) {
+        auto size = static_cast<int32_t>(number);
+        auto array = std::make_unique<KRRenderCValue[]>(size);
+        for (int32_t i = 0; i < size; i++) {
+            if (!ReadValue(&array[i], record, depth + 1)) {
+                return false;
+            }
+        }
+        value->value.arrayValue = array.get();
+        value->size = size;
+        record->array_storage.push_back(std::move(array));
+        return true;
+    }
+    size_t length = static_cast<size_t>(number);
+    size_t element_size = NumberArrayElementSize(type);
+    if (type == KRRenderCValue::STRING) {
+        length -= 1;
+    } else if (element_size > 0) {
+        if (length > (size_ - offset_) / element_size) {
+            return false;
+        }
+        length *= element_size;
+    }
+    // 字符串多留一个结尾 0
+    auto bytes = std::make_unique<char[]>(length + 1);
+    if (!ReadBytes(bytes.get(), length)) {
+        return false;
+    }
+    bytes[length] = '\0';
+    switch (type) {
+        case KRRenderCValue::STRING:
+            value->value.stringValue = bytes.get();
+            value->size = 0;
+            break;
+        case KRRenderCValue::BYTES:
+            value->value.bytesValue = bytes.get();
+            value->size = static_cast<int32_t>(number);
+            break;
+        case KRRenderCValue::FLOAT32_ARRAY:
+            value->value.float32ArrayValue = reinterpret_cast<float *>(bytes.get());
+            value->size = static_cast<int32_t>(number);
+            break;
+        case KRRenderCValue::FLOAT64_ARRAY:
+            value->value.float64ArrayValue = reinterpret_cast<double *>(bytes.get());
+            value->size = static_cast<int32_t>(number);
+            break;
+        default:
+            value->value.int32ArrayValue = reinterpret_cast<int32_t *>(bytes.get());
+            value->size = static_cast<int32_t>(number);
+            break;
+    }
+    record->bytes_storage.push_back(std::move(bytes));
+    return true;
+}
+
+bool KRCallNativeTraceValueEquals(const KRRenderCValue &lhs, const KRRenderCValue &rhs) {
+    if (lhs.type != rhs.type) {
+        return false;
+    }
+    switch (lhs.type) {
+        case KRRenderCValue::NULL_VALUE:
+            return true;
+        case KRRenderCValue::INT:
+            return lhs.value.intValue == rhs.value.intValue;
+        case KRRenderCValue::LONG:
+            return lhs.value.longValue == rhs.value.longValue;
+        case KRRenderCValue::FLOAT:
+            // 按位比较，NaN 与自身相等
+            return std::memcmp(&lhs.value.floatValue, &rhs.value.floatValue, sizeof(float)) == 0;
+        case KRRenderCValue::DOUBLE:
+            return std::memcmp(&lhs.value.doubleValue, &rhs.value.doubleValue, sizeof(double)) == 0;
+        case KRRenderCValue::BOOL:
+            return (lhs.value.boolValue != 0) == (rhs.value.boolValue != 0);
+        case KRRenderCValue::STRING:
+            if (lhs.value.stringValue == nullptr || rhs.value.stringValue == nullptr) {
+                return lhs.value.stringValue == rhs.value.stringValue;
+            }
+            return std::strcmp(lhs.value.stringValue, rhs.value.stringValue) == 0;
+        case KRRenderCValue::ARRAY:
+            if (lhs.size != rhs.size) {
+                return false;
+            }
+            for (int32_t i = 0; i < lhs.size; i++) {
+                if (!KRCallNativeTraceValueEquals(lhs.value.arrayValue[i], rhs.value.arrayValue[i])) {
+                    return false;
+                }
+            }
+            return true;
+        case KRRenderCValue::BYTES:
+        case KRRenderCValue::FLOAT32_ARRAY:
+        case KRRenderCValue::FLOAT64_ARRAY:
+        case KRRenderCValue::INT32_ARRAY: {
+            if (lhs.size != rhs.size) {
+                return false;
+            }
+            size_t element_size = lhs.type == KRRenderCValue::BYTES ? 1 : NumberArrayElementSize(lhs.type);
+            const void *l = lhs.type == KRRenderCValue::BYTES ? lhs.value.bytesValue : NumberArrayData(lhs);
+            const void *r = rhs.type == KRRenderCValue::BYTES ? rhs.value.bytesValue : NumberArrayData(rhs);
+            return lhs.size <= 0 || (l && r && std::memcmp(l, r, lhs.size * element_size) == 0);
+        }
+        default:
+            return false;
+    }
+}
+
+bool KRCallNativeTraceIsReplayStubbed(int method) {
+    switch (method) {
+        case 8:   // callModuleMethod
+        case 15:  // fireFatalException
+        case 17:  // callTDFModuleMethod
+            return true;
+        default:
+            return false;
+    }
+}
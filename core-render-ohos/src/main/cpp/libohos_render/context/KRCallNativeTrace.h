@@ -0,0 +1,122 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRCALLNATIVETRACE_H
+#define CORE_RENDER_OHOS_KRCALLNATIVETRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "libohos_render/foundation/type/KRRenderCValue.h"
+
+/** CallNative 的业务参数个数（arg1..arg5，arg0 为保留位不记录） */
+constexpr int kKRCallNativeTraceArgCount = 5;
+
+/**
+ * 轨迹中的一次 CallNative 调用，参数中的字符串/数组数据由记录自身持有
+ */
+struct KRCallNativeTraceRecord {
+    int64_t time_us = 0;  // 相对轨迹开始的调用时间
+    uint32_t thread = 0;  // 调用线程编号，由录制方分配
+    std::string instance_id;
+    int method = 0;
+    KRRenderCValue args[kKRCallNativeTraceArgCount];
+    KRRenderCValue result;  // 同步调用的返回值，无返回值时为 NULL_VALUE
+
+    std::vector<std::unique_ptr<char[]>> bytes_storage;
+    std::vector<std::unique_ptr<KRRenderCValue[]>> array_storage;
+};
+
+/**
+ * CallNative 轨迹编码（纯 C++，可在 host 上单测）。
+ *
+ * 格式：magic "KRCN" + 版本号，之后逐条记录：时间增量、线程编号、实例ID（字符串表下标，首次出现时附带内容）、
+ * 方法ID、5 个参数与返回值。整数使用 varint，数值数组按原始字节写入，
+ * 一条 setViewProp 除属性名与属性值字符串外只占十来个字节。
+ * 编码结果累积在内存中，由调用方决定何时取走写入文件。
+ */
+class KRCallNativeTraceWriter {
+ public:
+    KRCallNativeTraceWriter();
+
+    void Append(int64_t time_us, uint32_t thread, const std::string &instance_id, int method,
+                const KRRenderCValue *args, const KRRenderCValue &result);
+
+    /** 取走已编码的数据（首次取走的数据包含文件头） */
+    std::string TakeBuffer();
+    size_t BufferSize() const {
+        return buffer_.size();
+    }
+    uint64_t RecordCount() const {
+        return record_count_;
+    }
+
+ private:
+    void WriteVarint(uint64_t value);
+    void WriteValue(const KRRenderCValue &value, int depth);
+
+    std::string buffer_;
+    std::unordered_map<std::string, uint32_t> instance_ids_;
+    int64_t last_time_us_ = 0;
+    uint64_t record_count_ = 0;
+};
+
+/**
+ * CallNative 轨迹解码，逐条读取
+ */
+class KRCallNativeTraceReader {
+ public:
+    KRCallNativeTraceReader(const uint8_t *data, size_t size);
+
+    /** 文件头是否合法 */
+    bool IsValid() const {
+        return valid_;
+    }
+    /**
+     * 读取下一条记录
+     * @return 到达末尾或数据损坏时返回 false，可通过 HasError 区分
+     */
+    bool Next(KRCallNativeTraceRecord *record);
+    bool HasError() const {
+        return error_;
+    }
+
+ private:
+    bool ReadVarint(uint64_t *value);
+    bool ReadBytes(void *out, size_t size);
+    bool ReadValue(KRRenderCValue *value, KRCallNativeTraceRecord *record, int depth);
+
+    const uint8_t *data_;
+    size_t size_;
+    size_t offset_ = 0;
+    bool valid_ = false;
+    bool error_ = false;
+    int64_t time_us_ = 0;
+    std::vector<std::string> instance_ids_;
+};
+
+/** 深比较两个值，用于回放时校验同步调用的返回值 */
+bool KRCallNativeTraceValueEquals(const KRRenderCValue &lhs, const KRRenderCValue &rhs);
+
+/**
+ * 回放时只计数不派发的调用：module 调用会访问网络、文件、存储等页面之外的状态，且录制中的回调ID已失效；
+ * fireFatalException 会触发异常上报
+ */
+bool KRCallNativeTraceIsReplayStubbed(int method);
+
+#endif  // CORE_RENDER_OHOS_KRCALLNATIVETRACE_H
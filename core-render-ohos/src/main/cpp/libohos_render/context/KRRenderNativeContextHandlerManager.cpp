@@ -16,6 +16,7 @@
 #include "libohos_render/context/KRRenderNativeContextHandlerManager.h"
 
 #include "libohos_render/context/DefaultRenderNativeContextHandler.h"
+#include "libohos_render/context/KRCallNativeRecorder.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
 
 extern CallKotlin callKotlin_;
@@ -57,6 +58,11 @@ void KRRenderNativeContextHandlerManager::UnregisterContextHandler(const std::st
     context_handler_map_.Erase(instanceId);
 }
 
+std::shared_ptr<IKRRenderNativeContextHandler>
+KRRenderNativeContextHandlerManager::GetContextHandler(const std::string &instanceId) {
+    return context_handler_map_.Get(instanceId);
+}
+
 void KRRenderNativeContextHandlerManager::ScheduleDeallocRenderValues(
     std::shared_ptr<KRRenderValue> will_dealloc_render_value) {
     {
@@ -110,6 +116,9 @@ KRRenderCValue KRRenderNativeContextHandlerManager::DispatchCallNative(
     // 避免每次调用都构造一个 std::string 并分配 shared_ptr。
     // 如未来需要恢复 instanceId 传递，请先同步修改 IKRRenderNativeContextHandler.h 中
     // ICallNativeCallback::OnCallNative 的契约注释，再改本处构造逻辑，避免形成静默约定。
+    auto &recorder = KRCallNativeRecorder::GetInstance();
+    bool recording = recorder.IsRecording();
+    int64_t record_start_us = recording ? recorder.NowUs() : 0;
     auto cv0 = KRRenderValue::MakeNull();
     auto cv1 = MakeFromCValue(arg1);
     auto cv2 = MakeFromCValue(arg2);
@@ -120,10 +129,18 @@ KRRenderCValue KRRenderNativeContextHandlerManager::DispatchCallNative(
     auto return_value =
         handler->OnCallNative(static_cast<KuiklyRenderNativeMethod>(methodId), cv0, cv1, cv2, cv3, cv4, cv5);
     if (return_value == nullptr || return_value->isNull()) {
+        if (recording) {
+            const KRRenderCValue args[] = {arg1, arg2, arg3, arg4, arg5};
+            recorder.Record(record_start_us, instanceId, methodId, args, KRRenderCValue{});
+        }
         // 同上：值初始化，避免 union value / size 字段残留未初始化字节
         // 经 napi C ABI 传出导致 UB。
         return KRRenderCValue{};
     }
     ScheduleDeallocRenderValues(return_value);
+    if (recording) {
+        const KRRenderCValue args[] = {arg1, arg2, arg3, arg4, arg5};
+        recorder.Record(record_start_us, instanceId, methodId, args, return_value->toCValue());
+    }
     return return_value->toCValue();
 }
@@ -63,6 +63,7 @@ class KRRenderNativeContextHandlerManager {
     void RegisterContextHandler(const std::string &instanceId,
                                 const std::shared_ptr<IKRRenderNativeContextHandler> &contextHandler);
     void UnregisterContextHandler(const std::string &instanceId);
+    std::shared_ptr<IKRRenderNativeContextHandler> GetContextHandler(const std::string &instanceId);
     KRRenderCValue DispatchCallNative(const std::string &instanceId, int methodId, const KRRenderCValue &arg0,
                                       const KRRenderCValue &arg1, const KRRenderCValue &arg2,
                                       const KRRenderCValue &arg3, const KRRenderCValue &arg4,
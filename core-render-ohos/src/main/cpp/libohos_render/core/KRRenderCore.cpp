@@ -69,6 +69,14 @@ static void PerformTaskOnContextQueue(int delayMs, const KRSchedulerTask &task)
     KRContextScheduler::ScheduleTask(delayMs, task);
 }
 
+/**
+ * 参数中以 view 为目标的 module（如按 node id 截图），页面不可见时与 view 操作一起按序暂存，
+ * 避免先于它所作用的 view 执行
+ */
+static bool IsViewTargetedModule(const std::string &module_name) {
+    return module_name == "KRSnapshotModule";
+}
+
 KRRenderCore::KRRenderCore(std::weak_ptr<IKRRenderView> renderView, std::shared_ptr<KRRenderContextParams> context)
     : ICallNativeCallback() {
     renderView_ = renderView;
@@ -100,6 +108,10 @@ bool KRRenderCore::IsCallbackKeepAlive(const KRAnyValue &params) {
 }
 
 void KRRenderCore::DidInit() {
+    // 开启首帧回放时，先把上次记录的首帧上屏，再创建页面实例
+    if (auto handler = std::dynamic_pointer_cast<KRRenderLayerHandler>(renderLayerHandler_)) {
+        handler->ReplayFirstFrame();
+    }
     // createInstance to kotlin
     auto sync = context_->ExecuteMode()->IsContextSyncInit();
     KRContextScheduler::DirectRunOnMainThread(sync, [strongSelf = shared_from_this(), sync] {
@@ -176,6 +188,9 @@ void KRRenderCore::WillDealloc(const std::string &instanceId) {
         self->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodDestroyInstance, nullValue, nullValue,
                                nullValue, nullValue, nullValue);
         self->contextHandler_->OnDestroy();
+        // 页面即将销毁，不可见期间积攒的操作不再下发
+        self->uiFlushPaused_ = false;
+        self->pendingUIOps_.Clear();
         self->uiScheduler_->AddTaskToMainQueueWithTask([self, id] {
             self->OnDestroy();
             KRRenderManager::GetInstance().DestroyRenderViewCallBack(id);
@@ -217,21 +232,119 @@ KRRenderCore::OnCallNative(const KuiklyRenderNativeMethod &method, std::shared_p
             return defaultNullValue_;
         }
         std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
-        uiScheduler_->AddTaskToMainQueueWithTask([weakSelf, method, arg1, arg2, arg3, arg4, arg5] {
+        KRSchedulerTask task = [weakSelf, method, arg1, arg2, arg3, arg4, arg5] {
             if (auto locked = weakSelf.lock()) {
                 locked->PerformNativeCallback(method, arg1, arg2, arg3, arg4, arg5, false);
             }
-        });
+        };
+        KRPendingUIOp op;
+        switch (method) {
+        case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCreateRenderView:
+            op.kind = KRPendingUIOp::Kind::kCreate;
+            op.tag = arg1->toInt();
+            break;
+        case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodRemoveRenderView:
+            op.kind = KRPendingUIOp::Kind::kRemove;
+            op.tag = arg1->toInt();
+            break;
+        case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodInsertSubRenderView:
+            op.kind = KRPendingUIOp::Kind::kInsert;
+            op.parent_tag = arg1->toInt();
+            op.tag = arg2->toInt();
+            break;
+        case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetViewProp:
+            op.kind = arg4->toInt() == 1 ? KRPendingUIOp::Kind::kEvent : KRPendingUIOp::Kind::kProp;
+            op.tag = arg1->toInt();
+            op.key = arg2->toString();
+            break;
+        case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetRenderViewFrame:
+            op.kind = KRPendingUIOp::Kind::kProp;
+            op.tag = arg1->toInt();
+            op.key = "frame";
+            break;
+        case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallViewMethod:
+            op.kind = KRPendingUIOp::Kind::kViewCall;
+            op.tag = arg1->toInt();
+            if (uiFlushPaused_ && !arg4->isNull() && !arg4->toString().empty()) {
+                // view 在暂存期间被创建又移除时调用被抵消，仍以失败结果回调 Kotlin
+                op.drop_task = [weakSelf, arg4] {
+                    if (auto locked = weakSelf.lock()) {
+                        locked->FireDroppedCallback(arg4);
+                    }
+                };
+            }
+            break;
+        case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallModuleMethod:
+            if (IsViewTargetedModule(arg1->toString())) {
+                op.kind = KRPendingUIOp::Kind::kOther;
+                break;
+            }
+            // 与 view 无关的 module 调用不暂停（如后台页面的网络请求）
+            uiScheduler_->AddTaskToMainQueueWithTask(task);
+            return defaultNullValue_;
+        default:
+            uiScheduler_->AddTaskToMainQueueWithTask(task);
+            return defaultNullValue_;
+        }
+        op.task = std::move(task);
+        AddViewTaskToMainQueue(std::move(op));
     }
     return defaultNullValue_;
 }
 
+void KRRenderCore::FireDroppedCallback(const KRAnyValue &callback_id) {
+    KRRenderValueMap result;
+    result["code"] = KRRenderValue::Make(-1);
+    result["message"] = KRRenderValue::Make("view removed before the call ran");
+    auto res = KRRenderValue::Make(result);
+    std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
+    PerformTaskOnContextQueue(0, [weakSelf, callback_id, res] {
+        if (auto locked = weakSelf.lock()) {
+            locked->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback, callback_id, res,
+                                     locked->defaultNullValue_, locked->defaultNullValue_, locked->defaultNullValue_);
+        }
+    });
+}
+
+void KRRenderCore::AddViewTaskToMainQueue(KRPendingUIOp op) {
+    if (uiFlushPaused_) {
+        pendingUIOps_.Add(std::move(op));
+    } else {
+        uiScheduler_->AddTaskToMainQueueWithTask(op.task);
+    }
+}
+
+void KRRenderCore::SetPageVisible(bool visible) {
+    KRContextScheduler::ScheduleTask(0, [self = shared_from_this(), visible] { self->SetUIFlushPaused(!visible); });
+}
+
+void KRRenderCore::SetUIFlushPaused(bool paused) {
+    if (!context_ || !context_->Config()->GetPauseUIFlushWhenHiddenEnabled() || uiFlushPaused_ == paused) {
+        return;
+    }
+    uiFlushPaused_ = paused;
+    if (paused || pendingUIOps_.Empty()) {
+        return;
+    }
+    auto pending = pendingUIOps_.Size();
+    auto tasks = std::make_shared<std::vector<KRSchedulerTask>>(pendingUIOps_.Drain());
+    KR_LOG_INFO << "resume ui flush, pending: " << pending << ", apply: " << tasks->size()
+                << ", coalesced total: " << pendingUIOps_.CoalescedCount();
+    // 合并后的操作放进同一个任务，保证在一批主线程任务内执行完
+    uiScheduler_->AddTaskToMainQueueWithTask([tasks] {
+        for (auto &task : *tasks) {
+            task();
+        }
+    });
+}
+
 // 判断事件是否需要同步调用
 bool KRRenderCore::ShouldSyncCallMethod(const KuiklyRenderNativeMethod &method, std::shared_ptr<KRRenderValue> &arg5) {
     if (method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallModuleMethod) {
         return IsSyncCallback(arg5);
     }
     return method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCalculateRenderViewSize ||
+           method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCalculateRenderViewSizes ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCreateShadow ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodRemoveShadow ||
            method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetShadowProp ||
@@ -256,6 +369,18 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodInsertSubRenderView: {
         renderLayerHandler_->InsertSubRenderView(arg1->toInt(), arg2->toInt(), arg3->toInt());
+        if (!firstFrameAttached_ && arg1->toInt() == -1) {
+            // 根节点第一次挂载内容所在的这一批主线程任务即为首帧
+            firstFrameAttached_ = true;
+            std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
+            uiScheduler_->PerformTaskWhenDidEnd([weakSelf] {
+                if (auto lock = weakSelf.lock()) {
+                    if (auto handler = std::dynamic_pointer_cast<KRRenderLayerHandler>(lock->renderLayerHandler_)) {
+                        handler->DidEndFirstFrame();
+                    }
+                }
+            });
+        }
         break;
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetViewProp: {
@@ -313,6 +438,11 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
         auto sizeStr = renderLayerHandler_->CalculateRenderViewSize(arg1->toInt(), arg2->toDouble(), arg3->toDouble());
         return KRRenderValue::Make(sizeStr);
     }
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCalculateRenderViewSizes: {
+        // arg1: Int32Array 视图 ID 列表，arg2: Float32Array 约束 [w0, h0, w1, h1, ...]
+        auto sizes = renderLayerHandler_->CalculateRenderViewSizes(*arg1->toInt32Array(), *arg2->toFloat32Array());
+        return KRRenderValue::Make(std::make_shared<std::vector<float>>(std::move(sizes)));
+    }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallViewMethod: {
         auto callbackId = arg4->toString();
         KRRenderCallback callback = nullptr;
@@ -380,14 +510,20 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
         }
         auto task = shadow->TaskToMainQueueWhenWillSetShadowToView();
         std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
-        uiScheduler_->AddTaskToMainQueueWithTask([task, weakSelf, tag, shadow] {
+        KRPendingUIOp op;
+        // 同一 view 只需要最后一次排版结果；'#' 不会出现在 kotlin 侧属性名中
+        op.kind = KRPendingUIOp::Kind::kProp;
+        op.tag = tag;
+        op.key = "#shadow";
+        op.task = [task, weakSelf, tag, shadow] {
             if (task) {
                 task();
             }
             if (auto lock = weakSelf.lock()) {
                 lock->renderLayerHandler_->SetShadow(tag, shadow);
             }
-        });
+        };
+        AddViewTaskToMainQueue(std::move(op));
         return defaultNullValue_;
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetTimeout: {
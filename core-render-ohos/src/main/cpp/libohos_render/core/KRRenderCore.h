@@ -23,6 +23,7 @@
 #include "libohos_render/context/IKRRenderNativeContextHandler.h"
 #include "libohos_render/context/KRRenderContextParams.h"
 #include "libohos_render/layer/IKRRenderLayer.h"
+#include "libohos_render/scheduler/KRPendingUIOps.h"
 #include "libohos_render/scheduler/KRUIScheduler.h"
 #include "libohos_render/view/IKRRenderView.h"
 
@@ -76,6 +77,12 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
     void SendEvent(std::string event_name, const std::string &json_data);
     void SendEvent(std::string event_name, const std::string &json_data, bool need_sync);
 
+    /**
+     * 设置页面可见性（切到 context 线程生效），不可见且开启暂停时暂存合并 UI 操作，可见时作为一批下发
+     * @param visible 是否可见
+     */
+    void SetPageVisible(bool visible);
+
     /**
      * 获取渲染节点视图（要求在主线程调用）
      * @param tag 所在tag
@@ -143,6 +150,12 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
     std::shared_ptr<KRRenderValue> defaultNullValue_;
     /** 正在从主线程同步任务到context线程 */
     bool syncingPerformTaskMainThreadToContextThread = false;
+    /** 首帧内容是否已经挂载到根节点，只在主线程访问 */
+    bool firstFrameAttached_ = false;
+    /** 页面不可见时暂停向主线程下发 UI 操作，只在 context 线程访问 */
+    bool uiFlushPaused_ = false;
+    /** 暂停期间积攒并合并的 UI 操作，只在 context 线程访问 */
+    KRPendingUIOps pendingUIOps_;
 
     /** callback 是否为同步方法 */
     bool IsSyncCallback(const KRAnyValue &params);
@@ -155,6 +168,15 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
     KRAnyValue PerformNativeCallback(const KuiklyRenderNativeMethod &method, const KRAnyValue &arg1, const KRAnyValue &arg2,
                                      const KRAnyValue &arg3, const KRAnyValue &arg4, const KRAnyValue &arg5, bool sync);
     bool ShouldSyncCallMethod(const KuiklyRenderNativeMethod &method, std::shared_ptr<KRRenderValue> &arg5);
+    /**
+     * 下发只作用于 view 的 UI 任务（context 线程），页面不可见且开启暂停时先暂存合并
+     * @param op 任务及其所作用的 view 信息
+     */
+    void AddViewTaskToMainQueue(KRPendingUIOp op);
+    /** 以失败结果回调被抵消的 view 方法调用（主线程），回调在 context 线程送达 Kotlin */
+    void FireDroppedCallback(const KRAnyValue &callback_id);
+    /** 页面可见性变化（context 线程），可见时把暂存的操作作为一批下发 */
+    void SetUIFlushPaused(bool paused);
 
     void OnDestroy();
 };
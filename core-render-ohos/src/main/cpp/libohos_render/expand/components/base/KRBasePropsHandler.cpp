@@ -17,6 +17,7 @@
 
 #include <multimedia/image_framework/image/image_common.h>
 #include <cfloat>
+#include "libohos_render/expand/components/base/animation/KRNodeAnimationBatch.h"
 #include "libohos_render/foundation/KRConfig.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/utils/KREventUtil.h"
@@ -57,6 +58,8 @@ bool KRBasePropsHandler::SetProp(const std::string &prop_key, const KRAnyValue &
     if (tryAddCurrentAnimationOperation(prop_key, prop_value)) {
         return true;
     }
+    // 同属性还有合批中未提交的动画时先提交，避免直接设置的值被动画终值覆盖
+    KRNodeAnimationBatch::GetInstance().FlushIfPending(this, prop_key);
 
     return SetPropWithoutAnimation(prop_key, prop_value, event_call_back);
 }
@@ -321,6 +324,11 @@ bool KRBasePropsHandler::RemoveAnimation(const std::shared_ptr<IKRNodeAnimation>
 }
 
 void KRBasePropsHandler::RemoveAllAnimations() {
+    // View复用前提交合批中的动画，保持与之前逐个 animateTo 相同的顺序
+    auto &batch = KRNodeAnimationBatch::GetInstance();
+    if (batch.HasPending()) {
+        batch.Flush();
+    }
     // 遍历动画队列，停止所有动画
     for (auto &animation : animationQueue) {
         IKRNodeAnimation *item = animation.get();
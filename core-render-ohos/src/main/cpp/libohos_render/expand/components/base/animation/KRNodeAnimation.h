@@ -18,6 +18,7 @@
 
 #include "libohos_render/expand/components/base/KRBasePropsHandler.h"
 #include "libohos_render/expand/components/base/animation/IKRNodeAnimation.h"
+#include "libohos_render/expand/components/base/animation/KRNodeAnimationSpec.h"
 #include "libohos_render/expand/components/base/animation/KRNodePlainAnimation.h"
 #include "libohos_render/expand/components/base/animation/KRNodeSpringAnimation.h"
 #include "libohos_render/utils/KRConvertUtil.h"
@@ -59,25 +60,35 @@ class KRNodeAnimation : public IKRNodeAnimation {
     // 动画key
     std::string animationKey = "";
 
-    std::unordered_map<std::string, KRNodeAnimationHandlerCreator> supportAnimationHandlerCreator;
+    // 按动画类型共享的处理器创建表，不支持的类型为 nullptr
+    const std::unordered_map<std::string, KRNodeAnimationHandlerCreator> *supportAnimationHandlerCreator = nullptr;
     std::unordered_map<std::string, std::shared_ptr<KRNodeAnimationHandler>> animationOperationMap;
 
     bool animationCommit = false;
 
     ~KRNodeAnimation() {
         weakView.reset();
-        supportAnimationHandlerCreator.clear();
+        supportAnimationHandlerCreator = nullptr;
         animationOperationMap.clear();
         operationCallback_ = nullptr;
         onAnimationEndCallback = nullptr;
     }
 
-    KRNodeAnimation(const std::string &animationStr, std::weak_ptr<IKRRenderViewExport> view) {
+    /**
+     * @param spec 由 [KRNodeAnimationSpecCache] 驻留的动画配置，为 nullptr 时不支持任何属性动画
+     * @param view 动画作用的view
+     */
+    KRNodeAnimation(const std::shared_ptr<const KRNodeAnimationSpec> &spec, std::weak_ptr<IKRRenderViewExport> view) {
         weakView = view;
-        parseAnimation(animationStr);
-        setupAnimationHandler();
+        if (spec != nullptr) {
+            applySpec(*spec);
+            setupAnimationHandler();
+        }
     }
 
+    KRNodeAnimation(const std::string &animationStr, std::weak_ptr<IKRRenderViewExport> view)
+        : KRNodeAnimation(KRNodeAnimationSpecCache::GetInstance().Intern(animationStr), view) {}
+
     /**
      * 判断propKey是否支持动画，目前支持以下属性动画类型：
      * 1.[PROP_KEY_FRAME] KRNodePlainFrameAnimationHandler | KRNodeSpringFrameAnimationHandler
@@ -89,7 +100,8 @@ class KRNodeAnimation : public IKRNodeAnimation {
      * @ret 该propKey是否支持动画
      */
     bool isPropSupportAnimation(const std::string &propKey) override {
-        return supportAnimationHandlerCreator.find(propKey) != supportAnimationHandlerCreator.end();
+        return supportAnimationHandlerCreator != nullptr &&
+               supportAnimationHandlerCreator->find(propKey) != supportAnimationHandlerCreator->end();
     }
 
     /**
@@ -102,12 +114,15 @@ class KRNodeAnimation : public IKRNodeAnimation {
      * @param finalValue 动画最终值
      */
     void addAnimationOperation(const std::string &propKey, const KRAnyValue &prop_value) override {
-        auto handlerCreator = supportAnimationHandlerCreator[propKey];
-        if (handlerCreator == nullptr) {
+        if (supportAnimationHandlerCreator == nullptr) {
+            return;
+        }
+        auto it = supportAnimationHandlerCreator->find(propKey);
+        if (it == supportAnimationHandlerCreator->end()) {
             return;
         }
 
-        std::shared_ptr<KRNodeAnimationHandler> handler = handlerCreator();
+        std::shared_ptr<KRNodeAnimationHandler> handler = it->second();
         handler->propKey = propKey;
         handler->finalValue = prop_value;
         animationOperationMap[propKey] = handler;
@@ -208,64 +223,48 @@ class KRNodeAnimation : public IKRNodeAnimation {
 #endif
 
  private:
-    // 动画配置字符串中各个属性的位置索引，空格分割
-    static const int ANIMATION_TYPE_INDEX = 0;
-    static const int TIMING_FUNC_TYPE_INDEX = 1;
-    static const int DURATION_INDEX = 2;
-    static const int DAMPING_INDEX = 3;
-    static const int VELOCITY_INDEX = 4;
-    static const int DELAY_INDEX = 5;
-    static const int REPEAT_INDEX = 6;
-    static const int ANIMATION_KEY_INDEX = 7;
-
     KRNodeAnimationOperationEndCallback operationCallback_;
 
     /**
-     * 解析字符串中的动画属性，并设置动画属性
-     * @param animation
+     * 拷贝动画配置中的属性
+     * @param spec
      */
-    void parseAnimation(const std::string &animation) {
-        std::vector<std::string> animationSpilt = kuikly::util::ConvertSplit(animation, " ");
-        animationType = std::stoi(animationSpilt[ANIMATION_TYPE_INDEX]);
-        timingFuncType = std::stoi(animationSpilt[TIMING_FUNC_TYPE_INDEX]);
-        duration = std::stof(animationSpilt[DURATION_INDEX]);
-        damping = std::stof(animationSpilt[DAMPING_INDEX]);
-        velocity = std::stof(animationSpilt[VELOCITY_INDEX]);
-        // 兼容旧版本
-        if (animationSpilt.size() > DELAY_INDEX) {
-            delay = std::stof(animationSpilt[DELAY_INDEX]);
-        }
-        if (animationSpilt.size() > REPEAT_INDEX) {
-            repeatForever = std::stoi(animationSpilt[REPEAT_INDEX]) == 1;
-        }
-        if (animationSpilt.size() > ANIMATION_KEY_INDEX) {
-            animationKey = animationSpilt[ANIMATION_KEY_INDEX];
-        }
+    void applySpec(const KRNodeAnimationSpec &spec) {
+        animationType = spec.animationType;
+        timingFuncType = spec.timingFuncType;
+        duration = spec.duration;
+        damping = spec.damping;
+        velocity = spec.velocity;
+        delay = spec.delay;
+        repeatForever = spec.repeatForever;
+        animationKey = spec.animationKey;
     }
 
     /**
      * 初始化目前支持的属性动画
      */
     void setupAnimationHandler() {
+        static const std::unordered_map<std::string, KRNodeAnimationHandlerCreator> springCreators = {
+            {PROP_KEY_FRAME, []() { return std::make_shared<KRNodeSpringFrameAnimationHandler>(); }},
+            {PROP_KEY_OPACITY, []() { return std::make_shared<KRNodeSpringOpacityAnimationHandler>(); }},
+            {PROP_KEY_TRANSFORM, []() { return std::make_shared<KRNodeSpringTransformAnimationHandler>(); }},
+            {PROP_KEY_BACKGROUND_COLOR,
+             []() { return std::make_shared<KRNodeSpringBackgroundColorAnimationHandler>(); }},
+        };
+        static const std::unordered_map<std::string, KRNodeAnimationHandlerCreator> plainCreators = {
+            {PROP_KEY_FRAME, []() { return std::make_shared<KRNodePlainFrameAnimationHandler>(); }},
+            {PROP_KEY_OPACITY, []() { return std::make_shared<KRNodePlainOpacityAnimationHandler>(); }},
+            {PROP_KEY_TRANSFORM, []() { return std::make_shared<KRNodePlainTransformAnimationHandler>(); }},
+            {PROP_KEY_BACKGROUND_COLOR,
+             []() { return std::make_shared<KRNodePlainBackgroundColorAnimationHandler>(); }},
+        };
         switch (animationType) {
         case ANIMATION_TYPE_SPRING: {
-            supportAnimationHandlerCreator = {
-                {PROP_KEY_FRAME, []() { return std::make_shared<KRNodeSpringFrameAnimationHandler>(); }},
-                {PROP_KEY_OPACITY, []() { return std::make_shared<KRNodeSpringOpacityAnimationHandler>(); }},
-                {PROP_KEY_TRANSFORM, []() { return std::make_shared<KRNodeSpringTransformAnimationHandler>(); }},
-                {PROP_KEY_BACKGROUND_COLOR,
-                 []() { return std::make_shared<KRNodeSpringBackgroundColorAnimationHandler>(); }},
-            };
+            supportAnimationHandlerCreator = &springCreators;
             break;
         }
         case ANIMATION_TYPE_PLAIN: {
-            supportAnimationHandlerCreator = {
-                {PROP_KEY_FRAME, []() { return std::make_shared<KRNodePlainFrameAnimationHandler>(); }},
-                {PROP_KEY_OPACITY, []() { return std::make_shared<KRNodePlainOpacityAnimationHandler>(); }},
-                {PROP_KEY_TRANSFORM, []() { return std::make_shared<KRNodePlainTransformAnimationHandler>(); }},
-                {PROP_KEY_BACKGROUND_COLOR,
-                 []() { return std::make_shared<KRNodePlainBackgroundColorAnimationHandler>(); }},
-            };
+            supportAnimationHandlerCreator = &plainCreators;
             break;
         }
         default: {
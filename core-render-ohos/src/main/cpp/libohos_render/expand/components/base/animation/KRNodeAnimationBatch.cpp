@@ -0,0 +1,102 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/base/animation/KRNodeAnimationBatch.h"
+
+#include "libohos_render/expand/components/base/animation/KRNodeAnimationHandler.h"
+#include "libohos_render/utils/KRThreadChecker.h"
+#include "libohos_render/utils/animate/KRAnimation.h"
+
+KRNodeAnimationBatch &KRNodeAnimationBatch::GetInstance() {
+    static KRNodeAnimationBatch instance;
+    return instance;
+}
+
+void KRNodeAnimationBatch::Begin() {
+    KREnsureMainThread();
+    depth_++;
+}
+
+void KRNodeAnimationBatch::End() {
+    KREnsureMainThread();
+    if (depth_ > 0 && --depth_ == 0) {
+        Flush();
+    }
+}
+
+void KRNodeAnimationBatch::Add(ArkUI_ContextHandle context, const std::shared_ptr<KRAnimateOption> &option,
+                               const std::shared_ptr<KRNodeAnimationHandler> &handler,
+                               const KRBasePropsHandler *target) {
+    KREnsureMainThread();
+    if (depth_ == 0) {
+        StartGroup({{context, option}, {handler}});
+        return;
+    }
+    // 同一 view 同一属性在本轮内被再次动画，先提交之前的，保证后设置的终值生效
+    if (queue_.Contains(target, handler->propKey)) {
+        Flush();
+    }
+    queue_.Push({context, option}, handler, target, handler->propKey);
+}
+
+void KRNodeAnimationBatch::FlushIfPending(const KRBasePropsHandler *target, const std::string &prop_key) {
+    if (!queue_.Empty() && queue_.Contains(target, prop_key)) {
+        Flush();
+    }
+}
+
+void KRNodeAnimationBatch::Flush() {
+    KREnsureMainThread();
+    // StartGroup 中设置属性可能再次触发合批，先取出当前批次
+    auto groups = queue_.Take();
+    for (const auto &group : groups) {
+        StartGroup(group);
+    }
+}
+
+void KRNodeAnimationBatch::StartGroup(const Queue::Group &group) {
+    std::vector<std::shared_ptr<KRNodeAnimationHandler>> live_handlers;
+    live_handlers.reserve(group.items.size());
+    for (const auto &handler : group.items) {
+        // 提交前 view 已销毁的动画直接丢弃，同时避免使用已失效的 UIContext
+        if (!handler->weakView.expired()) {
+            live_handlers.push_back(handler);
+        }
+    }
+    if (live_handlers.empty()) {
+        return;
+    }
+
+    std::vector<std::weak_ptr<KRNodeAnimationHandler>> handlers(live_handlers.begin(), live_handlers.end());
+    auto animation = std::make_shared<KRAnimation>(group.key.context, group.key.option, [handlers]() {
+        for (const auto &weak : handlers) {
+            if (auto handler = weak.lock()) {
+                handler->applyFinalValue();
+            }
+        }
+    });
+    animation->SetCompleteCallback(ArkUI_FinishCallbackType::ARKUI_FINISH_CALLBACK_LOGICALLY, [handlers]() {
+        for (const auto &weak : handlers) {
+            if (auto handler = weak.lock()) {
+                handler->onAnimateFinished();
+            }
+        }
+    });
+    // KRAnimation 由各处理器持有，任意一个动画存活期间完成回调都能送达
+    for (const auto &handler : live_handlers) {
+        handler->animation_ = animation;
+    }
+    animation->Start();
+}
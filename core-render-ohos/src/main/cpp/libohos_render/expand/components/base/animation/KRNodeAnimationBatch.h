@@ -0,0 +1,87 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRNODEANIMATIONBATCH_H
+#define CORE_RENDER_OHOS_KRNODEANIMATIONBATCH_H
+
+#include <arkui/native_type.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "libohos_render/expand/components/base/animation/KRNodeAnimationBatchQueue.h"
+#include "libohos_render/utils/animate/KRAnimateOption.h"
+
+class KRBasePropsHandler;
+class KRNodeAnimationHandler;
+
+/**
+ * 一轮主线程任务内提交的属性动画合批器。
+ * 相邻加入、同一 UIContext 下使用同一份缓存 option（即同一动画配置）的动画合并为一次 animateTo，
+ * 在 animateTo 的闭包中依次设置各 view 的终值，各次 animateTo 按动画加入的顺序提交；
+ * 不在批处理中时退化为逐个立即执行。
+ * 只在主线程访问。
+ */
+class KRNodeAnimationBatch {
+ public:
+    static KRNodeAnimationBatch &GetInstance();
+
+    /**
+     * 开始合批，可嵌套；最外层 End 时统一提交
+     */
+    void Begin();
+    void End();
+
+    /**
+     * 加入一个待执行的属性动画
+     * @param context 动画所在的 UIContext
+     * @param option 动画参数，需来自 KRAnimateOptionCache 才能与其他动画合并
+     * @param handler 动画处理器
+     * @param target 动画作用的 view，用于判断同一属性的先后顺序
+     */
+    void Add(ArkUI_ContextHandle context, const std::shared_ptr<KRAnimateOption> &option,
+             const std::shared_ptr<KRNodeAnimationHandler> &handler, const KRBasePropsHandler *target);
+
+    bool HasPending() const {
+        return !queue_.Empty();
+    }
+
+    /**
+     * target 的 prop_key 还有待提交的动画时先行提交，保证后续直接设置的值覆盖动画终值
+     */
+    void FlushIfPending(const KRBasePropsHandler *target, const std::string &prop_key);
+
+    void Flush();
+
+ private:
+    struct GroupKey {
+        ArkUI_ContextHandle context = nullptr;
+        std::shared_ptr<KRAnimateOption> option;
+
+        bool operator==(const GroupKey &other) const {
+            return context == other.context && option == other.option;
+        }
+    };
+
+    using Queue = KRNodeAnimationBatchQueue<GroupKey, std::shared_ptr<KRNodeAnimationHandler>>;
+
+    KRNodeAnimationBatch() = default;
+
+    static void StartGroup(const Queue::Group &group);
+
+    int depth_ = 0;
+    Queue queue_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRNODEANIMATIONBATCH_H
@@ -0,0 +1,84 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRNODEANIMATIONBATCHQUEUE_H
+#define CORE_RENDER_OHOS_KRNODEANIMATIONBATCHQUEUE_H
+
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * KRNodeAnimationBatch 的待提交队列，不依赖 ArkUI，便于单测。
+ * 只有与上一组 key 相同的动画才并入该组，各组按加入顺序排列，提交时动画的启动顺序与加入顺序一致。
+ * 同时记录队列中的 (view, 属性)，供调用方在同一属性再次设置前先行提交。
+ */
+template <typename Key, typename Item>
+class KRNodeAnimationBatchQueue {
+ public:
+    struct Group {
+        Key key;
+        std::vector<Item> items;
+    };
+
+    bool Empty() const {
+        return groups_.empty();
+    }
+
+    /** target 的 prop_key 是否还有未提交的动画 */
+    bool Contains(const void *target, const std::string &prop_key) const {
+        return pending_props_.count({target, prop_key}) > 0;
+    }
+
+    void Push(const Key &key, Item item, const void *target, const std::string &prop_key) {
+        pending_props_.insert({target, prop_key});
+        if (!groups_.empty() && groups_.back().key == key) {
+            groups_.back().items.push_back(std::move(item));
+            return;
+        }
+        groups_.push_back({key, {std::move(item)}});
+    }
+
+    /** 取出全部分组并清空队列 */
+    std::vector<Group> Take() {
+        auto groups = std::move(groups_);
+        groups_.clear();
+        pending_props_.clear();
+        return groups;
+    }
+
+ private:
+    struct PendingProp {
+        const void *target;
+        std::string prop_key;
+
+        bool operator==(const PendingProp &other) const {
+            return target == other.target && prop_key == other.prop_key;
+        }
+    };
+
+    struct PendingPropHash {
+        size_t operator()(const PendingProp &prop) const {
+            return std::hash<const void *>()(prop.target) ^ (std::hash<std::string>()(prop.prop_key) << 1);
+        }
+    };
+
+    std::vector<Group> groups_;
+    std::unordered_set<PendingProp, PendingPropHash> pending_props_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRNODEANIMATIONBATCHQUEUE_H
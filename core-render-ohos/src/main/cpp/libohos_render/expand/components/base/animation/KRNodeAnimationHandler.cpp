@@ -15,6 +15,7 @@
 
 #include "libohos_render/expand/components/base/animation/KRNodeAnimationHandler.h"
 
+#include "libohos_render/expand/components/base/animation/KRNodeAnimationBatch.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
 
 void KRNodeAnimationHandler::start(std::weak_ptr<KRBasePropsHandler> target,
@@ -22,7 +23,6 @@ void KRNodeAnimationHandler::start(std::weak_ptr<KRBasePropsHandler> target,
     KR_LOG_DEBUG << "[KRNodeAnimationHandler] start: propKey=" << this->propKey;
 
     end_callback_ = endCallback;
-    auto view = weakView;
     auto strongView = weakView.lock();
     if (strongView == nullptr) {
         return;
@@ -31,32 +31,29 @@ void KRNodeAnimationHandler::start(std::weak_ptr<KRBasePropsHandler> target,
     if (propsHandler == nullptr) {
         return;
     }
-    auto context = propsHandler->GetUIContext();
-    auto propKey = this->propKey;
-    auto propVal = this->finalValue;
 
     currentAnimateOption = buildAnimateOption();
+    playing_ = true;
+    KRNodeAnimationBatch::GetInstance().Add(propsHandler->GetUIContext(), currentAnimateOption, shared_from_this(),
+                                            propsHandler.get());
+}
 
-    animation_ = std::make_shared<KRAnimation>(context, currentAnimateOption, [view, propKey, propVal]() {
-        auto selfView = view.lock();
-        if (selfView == nullptr) {
-            return;
-        }
-        if (auto handler = selfView->GetBasePropsHandler()) {
-            handler->SetPropWithoutAnimation(propKey, propVal, nullptr);
-        }
-    });
-    std::weak_ptr<KRNodeAnimationHandler> weakSelf = shared_from_this();
-    animation_->SetCompleteCallback(ArkUI_FinishCallbackType::ARKUI_FINISH_CALLBACK_LOGICALLY,
-                                    [view, weakSelf, propKey]() {
-                                        auto strongView = view.lock();
-                                        auto self = weakSelf.lock();
-                                        if (strongView != nullptr && self != nullptr) {
-                                            self->playing_ = false;
-                                            self->end_callback_(self->getFinishValue(false), propKey);
-                                        }
-                                    });
-    animation_->Start();
+void KRNodeAnimationHandler::applyFinalValue() {
+    auto strongView = weakView.lock();
+    if (strongView == nullptr) {
+        return;
+    }
+    if (auto handler = strongView->GetBasePropsHandler()) {
+        handler->SetPropWithoutAnimation(propKey, finalValue, nullptr);
+    }
+}
 
-    playing_ = true;
+void KRNodeAnimationHandler::onAnimateFinished() {
+    if (weakView.expired()) {
+        return;
+    }
+    playing_ = false;
+    if (end_callback_) {
+        end_callback_(getFinishValue(false), propKey);
+    }
 }
@@ -24,6 +24,7 @@
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/animate/KRAnimateOption.h"
+#include "libohos_render/utils/animate/KRAnimateOptionCache.h"
 #include "libohos_render/utils/animate/KRAnimation.h"
 
 static const int32_t UNIT_S_TO_MS = 1000;             // s->ms 单位转换
@@ -74,11 +75,21 @@ class KRNodeAnimationHandler : public std::enable_shared_from_this<KRNodeAnimati
     }
 
     /**
-     * 启动动画
+     * 启动动画。动画交由 [KRNodeAnimationBatch] 提交，同一轮任务内相邻且配置相同的动画合并为一次 animateTo
      * @param target 动画作用的view
      * @param endCallback 动画结束回调
      */
     void start(std::weak_ptr<KRBasePropsHandler> target, const KRNodeAnimationOperationEndCallback &endCallback);
+
+    /**
+     * 在 animateTo 闭包内设置属性终值
+     */
+    void applyFinalValue();
+
+    /**
+     * animateTo 完成回调
+     */
+    void onAnimateFinished();
 #if 0  // implementation moved to cpp file
     {
         KR_LOG_DEBUG << "[KRNodeAnimationHandler] start: propKey=" << this->propKey;
@@ -124,7 +135,22 @@ class KRNodeAnimationHandler : public std::enable_shared_from_this<KRNodeAnimati
         return !isCancel;
     }
 
+ protected:
+    int32_t durationMs() const {
+        return static_cast<int32_t>(durationS * UNIT_S_TO_MS);
+    }
+
+    int32_t delayMs() const {
+        return static_cast<int32_t>(delayS * UNIT_S_TO_MS);
+    }
+
+    int32_t iterations() const {
+        return repeatForever ? -1 : 1;
+    }
+
  private:
+    friend class KRNodeAnimationBatch;
+
     bool playing_ = false;
     std::shared_ptr<KRAnimation> animation_;
     KRNodeAnimationOperationEndCallback end_callback_;
@@ -0,0 +1,175 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRNODEANIMATIONSPEC_H
+#define CORE_RENDER_OHOS_KRNODEANIMATIONSPEC_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/**
+ * 解析后的动画配置，只读，可在多个 view / 多次设置之间共享。
+ * 配置字符串格式为空格分割："type timingFunc duration damping velocity [delay] [repeat] [animationKey]"
+ */
+struct KRNodeAnimationSpec {
+    int animationType = 0;
+    int timingFuncType = 0;
+    float duration = 0;
+    float damping = 0;
+    float velocity = 0;
+    float delay = 0;
+    bool repeatForever = false;
+    std::string animationKey;
+
+    /**
+     * 解析动画配置字符串，字段缺失或数值非法时返回 false
+     */
+    static bool Parse(const std::string &str, KRNodeAnimationSpec *out) {
+        // 动画配置字符串中各个属性的位置索引，空格分割
+        enum { TYPE, TIMING_FUNC, DURATION, DAMPING, VELOCITY, DELAY, REPEAT, KEY, FIELD_COUNT };
+        KRNodeAnimationSpec spec;
+        size_t start = 0;
+        int field = 0;
+        while (field < FIELD_COUNT && start <= str.size()) {
+            size_t end = str.find(' ', start);
+            if (end == std::string::npos) {
+                end = str.size();
+            }
+            const char *begin = str.c_str() + start;
+            size_t length = end - start;
+            bool ok = true;
+            switch (field) {
+            case TYPE: ok = ParseInt(begin, length, &spec.animationType); break;
+            case TIMING_FUNC: ok = ParseInt(begin, length, &spec.timingFuncType); break;
+            case DURATION: ok = ParseFloat(begin, length, &spec.duration); break;
+            case DAMPING: ok = ParseFloat(begin, length, &spec.damping); break;
+            case VELOCITY: ok = ParseFloat(begin, length, &spec.velocity); break;
+            case DELAY: ok = ParseFloat(begin, length, &spec.delay); break;
+            case REPEAT: {
+                int repeat = 0;
+                ok = ParseInt(begin, length, &repeat);
+                spec.repeatForever = repeat == 1;
+                break;
+            }
+            default: spec.animationKey.assign(begin, length); break;
+            }
+            if (!ok) {
+                return false;
+            }
+            field++;
+            start = end + 1;
+        }
+        // 兼容旧版本：delay / repeat / animationKey 可缺省
+        if (field <= VELOCITY) {
+            return false;
+        }
+        *out = std::move(spec);
+        return true;
+    }
+
+ private:
+    // 与 std::stoi / std::stof 一致：只要求数字前缀合法
+    static bool ParseInt(const char *begin, size_t length, int *out) {
+        if (length == 0) {
+            return false;
+        }
+        char *end = nullptr;
+        long value = std::strtol(begin, &end, 10);
+        if (end == begin) {
+            return false;
+        }
+        *out = static_cast<int>(value);
+        return true;
+    }
+
+    static bool ParseFloat(const char *begin, size_t length, float *out) {
+        if (length == 0) {
+            return false;
+        }
+        char *end = nullptr;
+        float value = std::strtof(begin, &end);
+        if (end == begin) {
+            return false;
+        }
+        *out = value;
+        return true;
+    }
+};
+
+/**
+ * 动画配置驻留表：相同的配置字符串只解析一次，返回同一份只读配置。
+ * 列表滚动时大量 cell 会设置完全相同的入场动画，驻留后每次只需一次哈希查找。
+ * 只在主线程访问；超过容量时整体清空，已被动画持有的配置不受影响。
+ */
+class KRNodeAnimationSpecCache {
+ public:
+    static KRNodeAnimationSpecCache &GetInstance() {
+        static KRNodeAnimationSpecCache instance;
+        return instance;
+    }
+
+    /**
+     * 获取配置字符串对应的解析结果，字符串非法时返回 nullptr（不缓存）
+     */
+    std::shared_ptr<const KRNodeAnimationSpec> Intern(const std::string &str) {
+        auto it = specs_.find(str);
+        if (it != specs_.end()) {
+            hits_++;
+            return it->second;
+        }
+        misses_++;
+        auto spec = std::make_shared<KRNodeAnimationSpec>();
+        if (!KRNodeAnimationSpec::Parse(str, spec.get())) {
+            return nullptr;
+        }
+        if (specs_.size() >= kMaxEntries) {
+            specs_.clear();
+        }
+        specs_.emplace(str, spec);
+        return spec;
+    }
+
+    size_t Size() const {
+        return specs_.size();
+    }
+
+    uint64_t Hits() const {
+        return hits_;
+    }
+
+    uint64_t Misses() const {
+        return misses_;
+    }
+
+    void Clear() {
+        specs_.clear();
+        hits_ = 0;
+        misses_ = 0;
+    }
+
+    static constexpr size_t kMaxEntries = 256;
+
+ private:
+    KRNodeAnimationSpecCache() = default;
+
+    std::unordered_map<std::string, std::shared_ptr<const KRNodeAnimationSpec>> specs_;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRNODEANIMATIONSPEC_H
@@ -44,11 +44,10 @@ class KRNodePlainAnimationHandler : public KRNodeAnimationHandler {
  public:
     int timingFuncType = TIMING_FUNC_TYPE_LINEAR;
 
+    // 相同参数的 option 跨 view 共享
     std::shared_ptr<KRAnimateOption> buildAnimateOption() override {
-        auto option = KRNodeAnimationHandler::buildAnimateOption();
         auto curve = TIME_FUNC_2_ARKUI_CURVE_MAP[timingFuncType];
-        option->SetCurve(curve);
-        return option;
+        return KRAnimateOptionCache::GetInstance().GetPlainOption(durationMs(), delayMs(), iterations(), curve);
     }
 };
 
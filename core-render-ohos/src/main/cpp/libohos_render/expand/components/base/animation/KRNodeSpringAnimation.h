@@ -27,30 +27,11 @@ class KRNodeSpringAnimationHandler : public KRNodeAnimationHandler {
  public:
     float damping = 0;
     float velocity = 0;
-    ArkUI_CurveHandle curveHandle = nullptr;
 
+    // 曲线句柄与 option 按 (velocity, damping) 缓存，跨 view 共享
     std::shared_ptr<KRAnimateOption> buildAnimateOption() override {
-        auto option = KRNodeAnimationHandler::buildAnimateOption();
-        /**
-         * mass 0.2 调参对齐iOS 、Android
-         * stiffness 1.2 调参对齐iOS 、Android
-         */
-        auto curve = OH_ArkUI_Curve_CreateSpringCurve(velocity, 0.2, 1.2, damping);
-        option->SetSpringCurve(curve);
-        SetCurHandle(curve);
-        return option;
-    }
-
-    void SetCurHandle(ArkUI_CurveHandle curve) {
-        if (curveHandle) {
-            OH_ArkUI_Curve_DisposeCurve(curveHandle);
-            curveHandle = nullptr;
-        }
-        curveHandle = curve;
-    }
-
-    ~KRNodeSpringAnimationHandler() {
-        SetCurHandle(nullptr);
+        return KRAnimateOptionCache::GetInstance().GetSpringOption(durationMs(), delayMs(), iterations(), velocity,
+                                                                   damping);
     }
 };
 
@@ -420,7 +420,7 @@ void KRCanvasView::DrawText(std::string params, std::string_view type) {
         const char *fontFamilies[] = {fontFamilyPtr};
         OH_Drawing_SetTextStyleFontFamilies(txtStyle, 1, fontFamilies);
         auto nativeResMgr = rootView->GetNativeResourceManager();
-        KRFontCollectionWrapper::GetInstance().RegisterCustomFont(nativeResMgr, text_feature_.fontFamily);
+        font_usage_.Use(nativeResMgr, text_feature_.fontFamily);
     }
 
     OH_Drawing_TypographyStyle *typoStyle = OH_Drawing_CreateTypographyStyle();
@@ -96,6 +96,7 @@ class KRCanvasView : public KRView {
     std::vector<std::pair<std::string, std::string>> ops_;
     std::unordered_set<std::string_view> cachable_methods_;
     TextFeature text_feature_;
+    KRFontUsage font_usage_;  // 画布存活期间绘制过的字体不被淘汰
 };
 
 #endif  // CORE_RENDER_OHOS_KRCANVASVIEW_H
@@ -39,10 +39,8 @@ bool KRForwardArkTSView::ToSetBaseProp(const std::string &prop_key, const KRAnyV
     bool handled = IKRRenderViewExport::ToSetBaseProp(prop_key, prop_value, event_call_back);
     if (handled) {
         if (prop_key == kBackgroundColor || prop_key == kBackgroundImage) {
-            KRArkTSManager::GetInstance().CallArkTSMethod(GetInstanceId(), KRNativeCallArkTSMethod::SetViewProp,
-                                                          KRRenderValue::Make(GetViewTag()),
-                                                          KRRenderValue::Make(prop_key), prop_value,
-                                                          nullptr, nullptr, nullptr);
+            KRArkTSManager::GetInstance().EnqueueViewOp(GetInstanceId(), KRNativeCallArkTSMethod::SetViewProp,
+                                                        GetViewTag(), KRRenderValue::Make(prop_key), prop_value);
         }
     }
     return handled;
@@ -53,25 +51,20 @@ bool KRForwardArkTSView::SetProp(const std::string &prop_key, const KRAnyValue &
     if (event_call_back) {  // is event
         event_registry_[prop_key] = event_call_back;
         // 设置事件
-        KRArkTSManager::GetInstance().CallArkTSMethod(GetInstanceId(), KRNativeCallArkTSMethod::SetViewEvent,
-                                                      KRRenderValue::Make(GetViewTag()),
-                                                      KRRenderValue::Make(prop_key), nullptr, nullptr,
-                                                      nullptr, nullptr);
+        KRArkTSManager::GetInstance().EnqueueViewOp(GetInstanceId(), KRNativeCallArkTSMethod::SetViewEvent,
+                                                    GetViewTag(), KRRenderValue::Make(prop_key), nullptr);
     } else {  // is prop
         // 设置属性
-        KRArkTSManager::GetInstance().CallArkTSMethod(GetInstanceId(), KRNativeCallArkTSMethod::SetViewProp,
-                                                      KRRenderValue::Make(GetViewTag()),
-                                                      KRRenderValue::Make(prop_key), prop_value, nullptr,
-                                                      nullptr, nullptr);
+        KRArkTSManager::GetInstance().EnqueueViewOp(GetInstanceId(), KRNativeCallArkTSMethod::SetViewProp,
+                                                    GetViewTag(), KRRenderValue::Make(prop_key), prop_value);
     }
     return true;
 }
 
 void KRForwardArkTSView::SetRenderViewFrame(const KRRect &frame) {
-    KRArkTSManager::GetInstance().CallArkTSMethod(
-        GetInstanceId(), KRNativeCallArkTSMethod::SetViewSize,
-        KRRenderValue::Make(GetViewTag()), KRRenderValue::Make(frame.width),
-        KRRenderValue::Make(frame.height), nullptr, nullptr, nullptr);
+    KRArkTSManager::GetInstance().EnqueueViewOp(GetInstanceId(), KRNativeCallArkTSMethod::SetViewSize, GetViewTag(),
+                                                KRRenderValue::Make(frame.width),
+                                                KRRenderValue::Make(frame.height));
 }
 
 /**
@@ -112,6 +112,7 @@ bool KRImageView::ReuseEnable() {
 
 void KRImageView::OnDestroy() {
     ResetMaskLinearGradientNode();
+    ReleaseCachedSnapshot();
     // 释放本实例生命周期内累计创建的所有 OH_Drawing_Lattice 对象：
     // ArkUI setAttribute 阶段不能立即销毁（会崩），因此既不在下发位置销毁、
     // 也不在处理 cap insets 变更时销毁旧 lattice，而是累到 lattice_pool_ 里，到
@@ -172,6 +173,7 @@ bool KRImageView::ResetProp(const std::string &prop_key) {
         original_image_size_ = {};
         source_size_applied_ = false;
         kuikly::util::ResetArkUIImageSrc(GetNode());
+        ReleaseCachedSnapshot();
         didHanded = true;
     } else if (kuikly::util::isEqual(prop_key, kPropNameResize)) {
         SetResizeMode(NewKRRenderValue(kResizeModeCover));
@@ -263,6 +265,7 @@ bool KRImageView::SetImageSrc(const KRAnyValue &value) {
     }
 
     kuikly::util::ResetArkUIImageSrc(GetNode());
+    ReleaseCachedSnapshot();
     image_src_ = src;
     has_loaded_image_ = false;
     loaded_image_size_ = {};
@@ -729,6 +732,13 @@ void KRImageView::LoadFromSrc(const std::string image_src) {
     }
 }
 
+void KRImageView::ReleaseCachedSnapshot() {
+    // 节点不再展示快照，释放对 drawableDescriptor 的引用，已被换出的快照此时才真正 Dispose
+    if (auto root = GetRootView().lock()) {
+        root->GetSnapshotManager()->ReleaseSnapshotFromNode(GetNode());
+    }
+}
+
 void KRImageView::LoadFromBase64(const std::shared_ptr<KRImageLoadOption> image_option) {
     if (image_src_.rfind("data:image_Md5_Pixelmap", 0) == 0) {
         if (auto root = GetRootView().lock()) {
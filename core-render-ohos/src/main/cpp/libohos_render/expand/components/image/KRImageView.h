@@ -79,6 +79,7 @@ class KRImageView : public IKRRenderViewExport {
     void FireOnImageErrorEvent(ArkUI_NodeEvent *event);
     std::shared_ptr<KRImageLoadOption> ToImageLoadOption(const std::string &src);
     void LoadFromSrc(const std::string image_src);
+    void ReleaseCachedSnapshot();
     void LoadFromNetwork(const std::shared_ptr<KRImageLoadOption> image_option);
     void LoadFromBase64(const std::shared_ptr<KRImageLoadOption> image_option);
     void LoadFromFile(const std::shared_ptr<KRImageLoadOption> image_option);
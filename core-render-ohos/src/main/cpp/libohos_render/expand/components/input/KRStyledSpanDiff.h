@@ -0,0 +1,209 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRSTYLEDSPANDIFF_H
+#define CORE_RENDER_OHOS_KRSTYLEDSPANDIFF_H
+
+// 输入框增量写入使用的差分算法，纯 C++，不依赖 ArkUI，可在 host 上单测。
+//
+// 偏移口径与 ArkUI TextEditor 一致：UTF-16 code unit；image span 在 flat 文本中固定占 1 个单位。
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "libohos_render/api/src/KRTextPostProcessor.h"
+
+namespace kuikly {
+namespace text_editor {
+
+// 一次编辑的变化区间：旧文本 [start, old_end) 被替换为新文本 [start, new_end)
+struct KRTextEditRange {
+    uint32_t start = 0;
+    uint32_t old_end = 0;
+    uint32_t new_end = 0;
+
+    bool IsEmpty() const {
+        return start == old_end && start == new_end;
+    }
+
+    // 把旧文本上的偏移（光标 / 选区端点）映射到新文本：
+    //   * 变化区间之前：不变；
+    //   * 变化区间之后（含纯插入点本身）：随长度差平移；
+    //   * 落在被替换的区间内：移到新内容末尾。
+    uint32_t MapOffset(uint32_t old_offset) const {
+        if (old_offset < start) {
+            return old_offset;
+        }
+        if (old_offset >= old_end) {
+            return old_offset - old_end + new_end;
+        }
+        return new_end;
+    }
+};
+
+// span 序列差分结果
+struct KRStyledSpanDiff {
+    size_t head_spans = 0;  // 开头完全相同、可直接复用的 span 数
+    size_t tail_spans = 0;  // 结尾完全相同、可直接复用的 span 数（与 head 不重叠）
+    KRTextEditRange range;  // flat 文本上的变化区间，已细化到边界 text span 内部的字符
+    bool identical = false;
+};
+
+namespace styled_span_diff {
+
+inline bool IsUtf8Continuation(char c) {
+    return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+
+// 与 GetUTF16Length 同口径：4 字节 UTF-8 字符占 2 个 UTF-16 code unit
+inline uint32_t Utf16Length(const char *data, size_t size) {
+    uint32_t length = 0;
+    for (size_t i = 0; i < size; i++) {
+        unsigned char c = static_cast<unsigned char>(data[i]);
+        if ((c & 0xC0) == 0x80) {
+            continue;
+        }
+        length += (c & 0xF8) == 0xF0 ? 2 : 1;
+    }
+    return length;
+}
+
+// 公共前缀字节数，回退到字符边界，避免把一个多字节字符拆成两半
+inline size_t CommonPrefix(const char *a, size_t a_size, const char *b, size_t b_size) {
+    size_t limit = std::min(a_size, b_size);
+    size_t n = 0;
+    while (n < limit && a[n] == b[n]) {
+        n++;
+    }
+    while (n > 0 && ((n < a_size && IsUtf8Continuation(a[n])) || (n < b_size && IsUtf8Continuation(b[n])))) {
+        n--;
+    }
+    return n;
+}
+
+// 公共后缀字节数，同样保证后缀从字符起始字节开始
+inline size_t CommonSuffix(const char *a, size_t a_size, const char *b, size_t b_size) {
+    size_t limit = std::min(a_size, b_size);
+    size_t n = 0;
+    while (n < limit && a[a_size - 1 - n] == b[b_size - 1 - n]) {
+        n++;
+    }
+    while (n > 0 && IsUtf8Continuation(a[a_size - n])) {
+        n--;
+    }
+    return n;
+}
+
+inline bool SpanEquals(const kuikly::text::KRTextPostProcessSpan &a, const kuikly::text::KRTextPostProcessSpan &b) {
+    return a.type == b.type && a.text_or_src == b.text_or_src && a.raw_literal == b.raw_literal &&
+           a.width == b.width && a.height == b.height;
+}
+
+inline bool IsText(const kuikly::text::KRTextPostProcessSpan &span) {
+    return span.type == kuikly::text::KRTextPostProcessSpan::Type::kText;
+}
+
+inline uint32_t FlatLength(const kuikly::text::KRTextPostProcessSpan &span) {
+    return IsText(span) ? Utf16Length(span.text_or_src.data(), span.text_or_src.size()) : 1;
+}
+
+}  // namespace styled_span_diff
+
+// 两段 UTF-8 文本的差分（公共前缀 + 公共后缀），偏移为 UTF-16 code unit
+inline KRTextEditRange DiffText(const std::string &old_text, const std::string &new_text) {
+    using namespace styled_span_diff;
+    size_t prefix = CommonPrefix(old_text.data(), old_text.size(), new_text.data(), new_text.size());
+    size_t suffix = CommonSuffix(old_text.data() + prefix, old_text.size() - prefix, new_text.data() + prefix,
+                                 new_text.size() - prefix);
+    KRTextEditRange range;
+    range.start = Utf16Length(old_text.data(), prefix);
+    range.old_end = range.start + Utf16Length(old_text.data() + prefix, old_text.size() - prefix - suffix);
+    range.new_end = range.start + Utf16Length(new_text.data() + prefix, new_text.size() - prefix - suffix);
+    return range;
+}
+
+// span 序列差分：先按整段比较求出首尾可复用的 span，再在边界处的 text span 内部按字符细化变化区间。
+// 复杂度 O(span 数 + 边界 text span 长度)，与全文长度无关的部分只做整段比较。
+inline KRStyledSpanDiff DiffStyledSpans(const std::vector<kuikly::text::KRTextPostProcessSpan> &old_spans,
+                                        const std::vector<kuikly::text::KRTextPostProcessSpan> &new_spans) {
+    using namespace styled_span_diff;
+    KRStyledSpanDiff diff;
+    size_t old_count = old_spans.size();
+    size_t new_count = new_spans.size();
+    size_t head = 0;
+    uint32_t head_length = 0;
+    while (head < old_count && head < new_count && SpanEquals(old_spans[head], new_spans[head])) {
+        head_length += FlatLength(old_spans[head]);
+        head++;
+    }
+    diff.head_spans = head;
+    if (head == old_count && head == new_count) {
+        diff.identical = true;
+        diff.range = {head_length, head_length, head_length};
+        return diff;
+    }
+    size_t tail = 0;
+    size_t tail_limit = std::min(old_count, new_count) - head;
+    while (tail < tail_limit && SpanEquals(old_spans[old_count - 1 - tail], new_spans[new_count - 1 - tail])) {
+        tail++;
+    }
+    diff.tail_spans = tail;
+
+    // 中间不可复用的区段：old [head, old_mid_end)，new [head, new_mid_end)
+    size_t old_mid_end = old_count - tail;
+    size_t new_mid_end = new_count - tail;
+    uint32_t old_mid_length = 0;
+    uint32_t new_mid_length = 0;
+    for (size_t i = head; i < old_mid_end; i++) {
+        old_mid_length += FlatLength(old_spans[i]);
+    }
+    for (size_t i = head; i < new_mid_end; i++) {
+        new_mid_length += FlatLength(new_spans[i]);
+    }
+
+    // 细化：区段首尾都是 text span 时，把 span 内部相同的字符排除在变化区间外
+    size_t head_bytes_old = 0;
+    size_t head_bytes_new = 0;
+    uint32_t head_extra = 0;
+    if (head < old_mid_end && head < new_mid_end && IsText(old_spans[head]) && IsText(new_spans[head])) {
+        const std::string &a = old_spans[head].text_or_src;
+        const std::string &b = new_spans[head].text_or_src;
+        head_bytes_old = head_bytes_new = CommonPrefix(a.data(), a.size(), b.data(), b.size());
+        head_extra = Utf16Length(a.data(), head_bytes_old);
+    }
+    uint32_t tail_extra = 0;
+    if (head < old_mid_end && head < new_mid_end && IsText(old_spans[old_mid_end - 1]) &&
+        IsText(new_spans[new_mid_end - 1])) {
+        const std::string &a = old_spans[old_mid_end - 1].text_or_src;
+        const std::string &b = new_spans[new_mid_end - 1].text_or_src;
+        // 与 head 细化落在同一个 span 上时，后缀只能在前缀之后的部分里找
+        size_t a_skip = old_mid_end - 1 == head ? head_bytes_old : 0;
+        size_t b_skip = new_mid_end - 1 == head ? head_bytes_new : 0;
+        size_t suffix = CommonSuffix(a.data() + a_skip, a.size() - a_skip, b.data() + b_skip, b.size() - b_skip);
+        tail_extra = Utf16Length(a.data() + a.size() - suffix, suffix);
+    }
+
+    diff.range.start = head_length + head_extra;
+    diff.range.old_end = head_length + old_mid_length - tail_extra;
+    diff.range.new_end = head_length + new_mid_length - tail_extra;
+    return diff;
+}
+
+}  // namespace text_editor
+}  // namespace kuikly
+
+#endif  // CORE_RENDER_OHOS_KRSTYLEDSPANDIFF_H
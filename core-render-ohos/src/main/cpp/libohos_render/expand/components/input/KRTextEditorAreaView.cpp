@@ -554,6 +554,7 @@ bool KRTextEditorAreaView::ApplyValues(const KRAnyValue &prop_value) {
             state_.image_spans_.clear();
             OH_ArkUI_TextEditorStyledStringController_SetStyledString(state_.controller_, desc);
             OH_ArkUI_StyledString_Descriptor_Destroy(desc);
+            kuikly::text_editor::MarkStyledTextOutOfSync(state_);
             state_.cached_text_ = plain_text;
             has_values_content_ = true;
             auto final_selection = std::min<uint32_t>(selection_start, kuikly::text_editor::GetUTF16Length(plain_text));
@@ -39,6 +39,8 @@
 
 #include "libohos_render/expand/components/input/KRTextEditorCommon.h"
 
+#include <cstdio>
+
 #if KUIKLY_TEXT_EDITOR_AVAILABLE
 namespace kuikly {
 namespace text_editor {
@@ -305,6 +307,7 @@ void SetPlainStyledText(KRTextEditorState &state, const std::string &text) {
     if (!state.controller_) {
         return;
     }
+    MarkStyledTextOutOfSync(state);
     OH_ArkUI_TextStyle *text_style = nullptr;
     OH_ArkUI_SpanStyle *span_style = nullptr;
     OH_ArkUI_ParagraphStyle *para_style = nullptr;
@@ -318,6 +321,45 @@ void SetPlainStyledText(KRTextEditorState &state, const std::string &text) {
     DestroyTextSpanResources(text_style, span_style, para_style, line_height_style);
 }
 
+// ----------------------------------------------------------------------
+// KRSpanDescriptor / 增量写入辅助
+// ----------------------------------------------------------------------
+KRTextEditorState::KRSpanDescriptor::~KRSpanDescriptor() {
+    if (desc) {
+        OH_ArkUI_StyledString_Descriptor_Destroy(desc);
+    }
+    DestroyTextSpanResources(text_style, span_style, para_style, line_height_style);
+}
+
+namespace {
+// text span descriptor 内嵌了这些样式，任一变化后缓存的 descriptor 都不能再复用。
+// image span 的兜底尺寸取 font_size_，同样包含在内。
+std::string BuildSpanStyleKey(const KRTextEditorState &state) {
+    char buf[96];
+    std::snprintf(buf, sizeof(buf), "%08x|%a|%d|%d|%a", state.font_color_, state.font_size_,
+                  static_cast<int>(state.font_weight_), static_cast<int>(state.text_align_),
+                  ResolveLineHeightVp(state));
+    return buf;
+}
+
+// 构建单个 span 的 descriptor。空文本 span 与构建失败的 image span 返回 desc 为空的条目，
+// 拼装时跳过（与原先"空文本不 append / image 构建失败跳过"的行为一致），但仍占位以保持下标对应。
+std::unique_ptr<KRTextEditorState::KRSpanDescriptor> BuildSpanDescriptor(
+    const KRTextEditorState &state, const kuikly::text::KRTextPostProcessSpan &span) {
+    auto entry = std::make_unique<KRTextEditorState::KRSpanDescriptor>();
+    if (span.type == kuikly::text::KRTextPostProcessSpan::Type::kText) {
+        if (!span.text_or_src.empty()) {
+            entry->desc = BuildPlainTextDescriptor(state, span.text_or_src, &entry->text_style,
+                                                   &entry->span_style, &entry->para_style,
+                                                   &entry->line_height_style);
+        }
+    } else {
+        entry->desc = BuildImageSpanDescriptor(span.text_or_src, span.width, span.height, state.font_size_);
+    }
+    return entry;
+}
+}  // namespace
+
 // ----------------------------------------------------------------------
 // SetStyledText（迁自 KRTextEditorCommon.h 原行 643~831）
 // ----------------------------------------------------------------------
@@ -326,11 +368,6 @@ void SetStyledText(KRTextEditorState &state, const std::string &text) {
         return;
     }
 
-    // 入口处先清空 image_spans_：本函数是「权威映射」的唯一构建点，无论走 adapter
-    // 路径还是纯文本旧路径，都需要保证 image_spans_ 与 ArkUI 节点中的 image span
-    // 一一对应。adapter 未命中时纯文本无 image，image_spans_ 维持空即可。
-    state.image_spans_.clear();
-
     // ---- TextPostProcessor 分支：业务侧把原始文本切为 [Text/Image Span ...] ----
     // 业务在 adapter 中负责：
     //   1) 识别自定义短码（如 [smile]）；
@@ -339,94 +376,27 @@ void SetStyledText(KRTextEditorState &state, const std::string &text) {
     {
         std::vector<kuikly::text::KRTextPostProcessSpan> spans;
         if (kuikly::text::RunTextPostProcessor(kTextPostProcessorNameInput, text, spans)) {
-            ArkUI_StyledString_Descriptor *root_desc = nullptr;
-            // 跟踪 build segment 期间的临时资源，统一在尾部一次性 Destroy。
-            // descriptor 在 AppendStyledString / SetStyledString 后即释放，保持与纯文本路径一致。
-            std::vector<OH_ArkUI_TextStyle *> temp_text_styles;
-            std::vector<OH_ArkUI_SpanStyle *> temp_span_styles;
-            std::vector<OH_ArkUI_ParagraphStyle *> temp_para_styles;
-            std::vector<OH_ArkUI_LineHeightStyle *> temp_lh_styles;
-
-            auto append_text_span = [&](const std::string &seg) {
-                // 长度为 0 的 text span 仅在"image 居首需要建空 root"场景使用，外部跳过；
-                // 这里允许空字符串落到 BuildPlainTextDescriptor，让 SDK 走与外层旧路径
-                // 一致的"必须带 span"语义。
-                OH_ArkUI_TextStyle *ts = nullptr;
-                OH_ArkUI_SpanStyle *ss = nullptr;
-                OH_ArkUI_ParagraphStyle *ps = nullptr;
-                OH_ArkUI_LineHeightStyle *ls = nullptr;
-                ArkUI_StyledString_Descriptor *seg_desc =
-                    BuildPlainTextDescriptor(state, seg, &ts, &ss, &ps, &ls);
-                if (seg_desc) {
-                    if (!root_desc) {
-                        root_desc = seg_desc;
-                    } else {
-                        OH_ArkUI_StyledString_Descriptor_AppendStyledString(root_desc, seg_desc);
-                        OH_ArkUI_StyledString_Descriptor_Destroy(seg_desc);
-                    }
-                }
-                if (ts) {
-                    temp_text_styles.push_back(ts);
-                }
-                if (ss) {
-                    temp_span_styles.push_back(ss);
-                }
-                if (ps) {
-                    temp_para_styles.push_back(ps);
-                }
-                if (ls) {
-                    temp_lh_styles.push_back(ls);
-                }
-            };
-
-            auto append_image_span = [&](const std::string &uri, float w, float h) {
-                ArkUI_StyledString_Descriptor *img_desc =
-                    BuildImageSpanDescriptor(uri, w, h, state.font_size_);
-                if (!img_desc) {
-                    return;
-                }
-                if (!root_desc) {
-                    // 文本以 image 开头：root 必须是个 string descriptor 才能被 Append
-                    // 成功——为安全起见先建一个空文本 descriptor 作为 root。
-                    OH_ArkUI_TextStyle *ts = nullptr;
-                    OH_ArkUI_SpanStyle *ss = nullptr;
-                    OH_ArkUI_ParagraphStyle *ps = nullptr;
-                    OH_ArkUI_LineHeightStyle *ls = nullptr;
-                    root_desc = BuildPlainTextDescriptor(state, "", &ts, &ss, &ps, &ls);
-                    if (ts) {
-                        temp_text_styles.push_back(ts);
-                    }
-                    if (ss) {
-                        temp_span_styles.push_back(ss);
-                    }
-                    if (ps) {
-                        temp_para_styles.push_back(ps);
-                    }
-                    if (ls) {
-                        temp_lh_styles.push_back(ls);
-                    }
-                }
-                if (root_desc) {
-                    OH_ArkUI_StyledString_Descriptor_AppendStyledString(root_desc, img_desc);
-                }
-                OH_ArkUI_StyledString_Descriptor_Destroy(img_desc);
-            };
+            // 与上次写入的 span 序列差分：样式未变时首尾相同的 span 复用已构建的 descriptor。
+            std::string style_key = BuildSpanStyleKey(state);
+            bool reusable = style_key == state.styled_style_key_ &&
+                            state.span_descs_.size() == state.styled_spans_.size();
+            KRStyledSpanDiff diff;
+            if (reusable) {
+                diff = DiffStyledSpans(state.styled_spans_, spans);
+            }
 
-            // image_spans_ 维护：随 spans 顺序遍历，跟踪每段在 ArkUI flat 字节流中
-            // 的当前偏移（byte）以及 UTF-16 code unit 偏移；image 段在 flat 中占
-            // 1 个 ASCII 空格（见 BuildImageSpanDescriptor / kArkUIImageSpanPlaceholder），
+            // image_spans_ 是「权威映射」，本函数是其唯一构建点：随 spans 顺序遍历，跟踪每段在
+            // ArkUI flat 字节流中的当前偏移（byte）以及 UTF-16 code unit 偏移；image 段在 flat 中
+            // 占 1 个 ASCII 空格（见 BuildImageSpanDescriptor / kArkUIImageSpanPlaceholder），
             // text 段按 UTF-8 字节 / UTF-16 code unit 原样占据。
+            state.image_spans_.clear();
             size_t flat_byte_cursor = 0;
             uint32_t flat_utf16_cursor = 0;
             for (const auto &span : spans) {
                 if (span.type == kuikly::text::KRTextPostProcessSpan::Type::kText) {
-                    if (!span.text_or_src.empty()) {
-                        append_text_span(span.text_or_src);
-                        flat_byte_cursor += span.text_or_src.size();
-                        flat_utf16_cursor += static_cast<uint32_t>(GetUTF16Length(span.text_or_src));
-                    }
+                    flat_byte_cursor += span.text_or_src.size();
+                    flat_utf16_cursor += static_cast<uint32_t>(GetUTF16Length(span.text_or_src));
                 } else {
-                    append_image_span(span.text_or_src, span.width, span.height);
                     KRTextEditorState::KRImageSpanRecord rec;
                     rec.flat_offset = flat_byte_cursor;
                     rec.utf16_offset = flat_utf16_cursor;
@@ -437,27 +407,53 @@ void SetStyledText(KRTextEditorState &state, const std::string &text) {
                 }
             }
 
-            if (root_desc) {
-                OH_ArkUI_TextEditorStyledStringController_SetStyledString(state.controller_, root_desc);
-                OH_ArkUI_StyledString_Descriptor_Destroy(root_desc);
+            // 节点内容与上次写入一致且 span 完全相同：不重写，光标 / 输入法组合态保持不动。
+            if (reusable && diff.identical && state.styled_in_sync_) {
+                state.cached_text_ = text;
+                return;
             }
-            // Style 临时资源安全 Destroy（与原实现同等条件）。
-            for (auto *ts : temp_text_styles) {
-                OH_ArkUI_TextStyle_Destroy(ts);
+
+            // 首尾复用、中间重建。复用的条目从旧缓存中移出，剩余旧条目随 span_descs_ 覆盖释放。
+            size_t head = diff.head_spans;
+            size_t tail = diff.tail_spans;
+            size_t old_count = state.span_descs_.size();
+            std::vector<std::unique_ptr<KRTextEditorState::KRSpanDescriptor>> descs;
+            descs.reserve(spans.size());
+            for (size_t i = 0; i < head; i++) {
+                descs.push_back(std::move(state.span_descs_[i]));
             }
-            for (auto *ss : temp_span_styles) {
-                OH_ArkUI_SpanStyle_Destroy(ss);
+            for (size_t i = head; i + tail < spans.size(); i++) {
+                descs.push_back(BuildSpanDescriptor(state, spans[i]));
             }
-            for (auto *ps : temp_para_styles) {
-                OH_ArkUI_ParagraphStyle_Destroy(ps);
+            for (size_t i = old_count - tail; i < old_count; i++) {
+                descs.push_back(std::move(state.span_descs_[i]));
             }
-            for (auto *ls : temp_lh_styles) {
-                OH_ArkUI_LineHeightStyle_Destroy(ls);
+
+            // root 每次新建一个空文本 descriptor 再逐段 Append（Append 拷贝内容，缓存的分段
+            // descriptor 不被修改，可继续复用）。空 root 与原"image 居首"路径的处理一致。
+            KRTextEditorState::KRSpanDescriptor root;
+            root.desc = BuildPlainTextDescriptor(state, "", &root.text_style, &root.span_style,
+                                                 &root.para_style, &root.line_height_style);
+            if (root.desc) {
+                for (const auto &entry : descs) {
+                    if (entry->desc) {
+                        OH_ArkUI_StyledString_Descriptor_AppendStyledString(root.desc, entry->desc);
+                    }
+                }
+                OH_ArkUI_TextEditorStyledStringController_SetStyledString(state.controller_, root.desc);
             }
+
+            state.span_descs_ = std::move(descs);
+            state.styled_spans_ = std::move(spans);
+            state.styled_style_key_ = std::move(style_key);
+            state.styled_in_sync_ = root.desc != nullptr;
             state.cached_text_ = text;
             return;
         }
     }
+    // 纯文本路径不维护分段缓存，节点内容与缓存不再对应。
+    state.image_spans_.clear();
+    MarkStyledTextOutOfSync(state);
     // ---- 旧路径：纯文本（adapter 未注册或返回空 span） ----
     // 计算 UTF-16 长度（与 SDK SpanStyle_SetLength 的口径一致）
     int32_t u16_len = GetUTF16Length(text);
@@ -773,9 +769,22 @@ std::string RebuildRawAfterUserEdit(KRTextEditorState &state,
                                                  new_flat, new_flat_selection_start,
                                                  new_flat_selection_end, new_spans);
     state.image_spans_ = std::move(new_spans);
+    // 用户编辑后节点内容已偏离上次 SetStyledText 写入的 span 序列
+    MarkStyledTextOutOfSync(state);
     return new_raw;
 }
 
+// ----------------------------------------------------------------------
+// MapFlatOffsetThroughEdit — flat 旧偏移 → raw 旧偏移 → raw 新偏移 → flat 新偏移
+// ----------------------------------------------------------------------
+uint32_t MapFlatOffsetThroughEdit(const KRTextEditorState &state,
+                                  const std::vector<KRTextEditorState::KRImageSpanRecord> &old_image_spans,
+                                  const std::string &old_raw, const std::string &new_raw, uint32_t old_flat_offset) {
+    uint32_t old_raw_offset = FlatUtf16ToRawUtf16(old_image_spans, old_flat_offset);
+    uint32_t new_raw_offset = DiffText(old_raw, new_raw).MapOffset(old_raw_offset);
+    return RawUtf16ToFlatUtf16(state.image_spans_, new_raw_offset);
+}
+
 // ----------------------------------------------------------------------
 // FlatUtf16ToRawUtf16（迁自 KRTextEditorCommon.h 原行 1107~1125）
 // ----------------------------------------------------------------------
@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -248,6 +249,7 @@ ArkUI_ErrorCode OH_ArkUI_TextEditorChangeEvent_GetRangeBefore(
 // ============================================================================
 
 #include "libohos_render/api/src/KRTextPostProcessor.h"
+#include "libohos_render/expand/components/input/KRStyledSpanDiff.h"
 #include "libohos_render/foundation/KRCommon.h"
 #include "libohos_render/utils/KRConvertUtil.h"
 #include "libohos_render/utils/KRURIHelper.h"
@@ -403,6 +405,35 @@ struct KRTextEditorState {
     };
     std::vector<KRImageSpanRecord> image_spans_;
 
+    // ===== 增量写入缓存（仅 TextPostProcessor 路径） =====
+    //
+    // styled_spans_ 为上次 SetStyledText 写入节点的 span 序列，span_descs_ 与之一一对应，
+    // 保存每段已构建好的 descriptor 及其样式资源。下次写入时用 DiffStyledSpans 求出首尾
+    // 未变的 span，只为中间变化区段重建 descriptor，其余直接 Append 复用——emoji 等
+    // image attachment 的构建不再随全文长度重复发生。
+    //
+    // styled_in_sync_ 表示节点内容仍与 styled_spans_ 一致（期间没有用户编辑或其他路径直接
+    // SetStyledString），此时 span 完全相同可跳过 SetStyledString，保留光标与输入法组合态。
+    // styled_style_key_ 记录构建时的样式，样式变化后缓存整体失效。
+#if KUIKLY_TEXT_EDITOR_AVAILABLE
+    struct KRSpanDescriptor {
+        ArkUI_StyledString_Descriptor *desc = nullptr;
+        OH_ArkUI_TextStyle *text_style = nullptr;
+        OH_ArkUI_SpanStyle *span_style = nullptr;
+        OH_ArkUI_ParagraphStyle *para_style = nullptr;
+        OH_ArkUI_LineHeightStyle *line_height_style = nullptr;
+
+        KRSpanDescriptor() = default;
+        KRSpanDescriptor(const KRSpanDescriptor &) = delete;
+        KRSpanDescriptor &operator=(const KRSpanDescriptor &) = delete;
+        ~KRSpanDescriptor();
+    };
+    std::vector<std::unique_ptr<KRSpanDescriptor>> span_descs_;
+#endif
+    std::vector<kuikly::text::KRTextPostProcessSpan> styled_spans_;
+    std::string styled_style_key_;
+    bool styled_in_sync_ = false;
+
     // returnKeyType 上一次设置值的原始字符串，用于 OnSubmit 回调时回传 ime_action。
     ArkUI_EnterKeyType enter_key_type_ = ARKUI_ENTER_KEY_TYPE_DONE;
 
@@ -554,8 +585,24 @@ void DestroyTextSpanResources(OH_ArkUI_TextStyle *text_style, OH_ArkUI_SpanStyle
 //     交给业务侧 adapter 处理，拿到 [TextSpan/ImageSpan ...] 序列，按段构建 descriptor
 //     再 OH_ArkUI_StyledString_Descriptor_AppendStyledString 串接。
 //     adapter 未注册或返回空段时走原有最快路径，零回归。
+//   * 增量写入（adapter 路径）：与上次写入的 span 序列做 DiffStyledSpans，首尾未变的 span
+//     复用缓存的 descriptor，只重建中间变化区段；span 完全相同且节点未被编辑时不再写入。
+//     SDK 只提供整段 SetStyledString，最终仍是一次整体写入。
 void SetStyledText(KRTextEditorState &state, const std::string &text);
 
+// 节点内容被 SetStyledText 以外的路径改写（用户编辑 / 纯文本写入 / values 富文本）后调用，
+// 使下一次 SetStyledText 不再跳过写入；已缓存的 descriptor 仍可复用。
+inline void MarkStyledTextOutOfSync(KRTextEditorState &state) {
+    state.styled_in_sync_ = false;
+}
+
+// 文本由 old_raw 变为 new_raw 时，把旧的 flat 光标 / 选区端点映射到新 flat 文本上：
+// 变化区间之前的位置不变，之后的位置随长度差平移，落在被替换区间内的移到新内容末尾。
+// old_image_spans 为写入前的 image span 映射表，新映射表取 state.image_spans_。
+uint32_t MapFlatOffsetThroughEdit(const KRTextEditorState &state,
+                                  const std::vector<KRTextEditorState::KRImageSpanRecord> &old_image_spans,
+                                  const std::string &old_raw, const std::string &new_raw, uint32_t old_flat_offset);
+
 // 按纯文本写入 controller，不运行 TextPostProcessor。仅用于复制导出前临时把
 // image span 还原为 raw shortcode 文本，随后应恢复为 SetStyledText 写入的 rich 内容。
 void SetPlainStyledText(KRTextEditorState &state, const std::string &text);
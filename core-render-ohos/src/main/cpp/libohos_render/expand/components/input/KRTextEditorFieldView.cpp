@@ -449,9 +449,30 @@ void KRTextEditorFieldView::SetContentText(const std::string &text) {
     if (state_.cached_text_ == text) {
         return;  // 幂等：内容未变，不写入也不回调
     }
+    // 写入前记录光标与旧映射表：SetStyledString 后 SDK 会把光标重置到末尾，
+    // 这里按新旧文本差分把光标映射回编辑点附近，业务局部改写文本（如插入 @提及）时不跳到末尾。
+    uint32_t old_caret = GetSelectionStartPosition();
+    auto old_image_spans = state_.image_spans_;
+    std::string old_text = state_.cached_text_;
     kuikly::text_editor::SetStyledText(state_, text);
     // 重新应用 typing style 保证后续键入继承样式
     kuikly::text_editor::ApplyTypingStyle(state_);
+    uint32_t new_caret =
+        kuikly::text_editor::MapFlatOffsetThroughEdit(state_, old_image_spans, old_text, text, old_caret);
+    uint32_t new_end = kuikly::text_editor::RawUtf16ToFlatUtf16(
+        state_.image_spans_, static_cast<uint32_t>(kuikly::text_editor::GetUTF16Length(text)));
+    if (new_caret < new_end) {
+        // 与 SetTextInputStateInternal 相同：推迟到下一帧设置，绕过 SDK 的光标重置
+        KRMainThread::RunOnMainThreadForNextLoop([weakSelf = weak_from_this(), new_caret] {
+            auto strongSelf = std::dynamic_pointer_cast<KRTextEditorFieldView>(weakSelf.lock());
+            if (!strongSelf || !strongSelf->state_.controller_) {
+                return;
+            }
+            strongSelf->state_.is_setting_text_input_state_ = true;
+            kuikly::text_editor::SetCaretOffset(strongSelf->state_, static_cast<int32_t>(new_caret));
+            strongSelf->state_.is_setting_text_input_state_ = false;
+        });
+    }
     // 主动补发一次 textDidChange，对齐老 KRTextFieldView 行为：
     // ARKUI_NODE_TEXT_EDITOR 通过 styled string controller 写入不会反弹 ON_DID_CHANGE，
     // 因此必须在此手工触发一次。
@@ -16,6 +16,7 @@
 #ifndef CORE_RENDER_OHOS_KRFONTADAPTERMANAGER_H
 #define CORE_RENDER_OHOS_KRFONTADAPTERMANAGER_H
 #include <mutex>
+#include <string>
 #include <unordered_map>
 
 #include "libohos_render/api/include/Kuikly/Kuikly.h"
@@ -27,6 +28,11 @@ class KRFontAdapterManager final {
 
     std::unordered_map<std::string, KRFontAdapter> AllAdapters();
 
+    /**
+     * 获取指定字体的 adapter，没有时返回 nullptr（避免每次拷贝整个表）
+     */
+    KRFontAdapter GetFontAdapter(const std::string &fontFamily);
+
  private:
     KRFontAdapterManager() = default;
     ~KRFontAdapterManager() = delete;
@@ -0,0 +1,257 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/richtext/KRFontRegistry.h"
+
+#include <native_drawing/drawing_font_collection.h>
+#include <native_drawing/drawing_register_font.h>
+#include <rawfile/raw_file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstring>
+#include <memory>
+
+#include "libohos_render/expand/components/richtext/KRFontAdapterManager.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// Remove this declaration if compatable api is raised to 14 and above
+extern OH_Drawing_FontCollection *OH_Drawing_GetFontCollectionGlobalInstance(void) __attribute__((weak));
+// 注销字体接口的弱符号声明（低版本系统该符号为 nullptr，此时不做淘汰）
+extern uint32_t OH_Drawing_UnregisterFont(OH_Drawing_FontCollection *fontCollection,
+                                          const char *fontFamily) __attribute__((weak));
+#ifdef __cplusplus
+};
+#endif
+
+constexpr char kRawFilePrefix[] = "rawfile:";
+
+static int64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+KRFontRegistry &KRFontRegistry::GetInstance() {
+    static KRFontRegistry instance;
+    return instance;
+}
+
+KRFontRegistry::KRFontRegistry() {
+    // 优先使用全局实例（API >= 14），否则创建共享实例
+    if (OH_Drawing_GetFontCollectionGlobalInstance) {
+        font_collection_ = OH_Drawing_GetFontCollectionGlobalInstance();
+        is_global_instance_ = true;
+    } else {
+        font_collection_ = OH_Drawing_CreateSharedFontCollection();
+        is_global_instance_ = false;
+    }
+}
+
+KRFontRegistry::~KRFontRegistry() {
+    if (font_collection_ && !is_global_instance_) {
+        OH_Drawing_DestroyFontCollection(font_collection_);
+    }
+    font_collection_ = nullptr;
+}
+
+void KRFontRegistry::EnsureRegistered(NativeResourceManager *resMgr, const std::string &fontFamily) {
+    if (fontFamily.empty()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (index_.Touch(fontFamily, NowMs())) {
+        return;
+    }
+    auto adapter = KRFontAdapterManager::GetInstance()->GetFontAdapter(fontFamily);
+    if (adapter == nullptr) {
+        return;
+    }
+    loaded_cv_.wait(lock, [this, &fontFamily] { return busy_.find(fontFamily) == busy_.end(); });
+    // 等待期间可能已被其他线程注册（失败时由本线程重试）
+    if (index_.Touch(fontFamily, NowMs())) {
+        return;
+    }
+    busy_.insert(fontFamily);
+    lock.unlock();
+
+    size_t bytes = 0;
+    bool registered = LoadAndRegister(adapter, resMgr, fontFamily, &bytes);
+
+    lock.lock();
+    busy_.erase(fontFamily);
+    std::vector<std::string> evicted;
+    if (registered) {
+        auto now = NowMs();
+        index_.Add(fontFamily, bytes, now);
+        if (OH_Drawing_UnregisterFont) {
+            evicted = index_.CollectEvictions(now);
+            // 注销完成前其他线程不能重新注册
+            busy_.insert(evicted.begin(), evicted.end());
+        }
+    }
+    lock.unlock();
+    loaded_cv_.notify_all();
+    if (evicted.empty()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> register_lock(register_mutex_);
+        for (const auto &family : evicted) {
+            OH_Drawing_UnregisterFont(font_collection_, family.c_str());
+            KR_LOG_INFO << "font evicted: " << family;
+        }
+    }
+    lock.lock();
+    for (const auto &family : evicted) {
+        busy_.erase(family);
+    }
+    lock.unlock();
+    loaded_cv_.notify_all();
+}
+
+void KRFontRegistry::PreregisterAsync(NativeResourceManager *resMgr, std::vector<std::string> fontFamilies) {
+    if (fontFamilies.empty()) {
+        return;
+    }
+    KRGCDQueue::GetInstance().DispatchAsync([this, resMgr, families = std::move(fontFamilies)] {
+        for (const auto &family : families) {
+            EnsureRegistered(resMgr, family);
+        }
+    });
+}
+
+void KRFontRegistry::SetBudget(size_t budgetBytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.SetBudget(budgetBytes);
+}
+
+void KRFontRegistry::Retain(const std::string &fontFamily) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.Retain(fontFamily);
+}
+
+void KRFontRegistry::Release(const std::string &fontFamily) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.Release(fontFamily);
+}
+
+bool KRFontRegistry::LoadAndRegister(KRFontAdapter adapter, NativeResourceManager *resMgr,
+                                     const std::string &fontFamily, size_t *bytes) {
+    char *fontBuffer = nullptr;
+    size_t len = 0;
+    KRFontDataDeallocator deallocator = nullptr;
+    char *fontSrc = adapter(fontFamily.c_str(), &fontBuffer, &len, &deallocator);
+    uint32_t error = 1;
+    if (fontSrc) {
+        std::string src(fontSrc);
+        if (deallocator) {
+            deallocator(fontSrc);
+        }
+        if (src.find(kRawFilePrefix) == 0) {
+            error = RegisterRawFile(resMgr, fontFamily, src.substr(strlen(kRawFilePrefix)), bytes);
+        } else {
+            {
+                std::lock_guard<std::mutex> register_lock(register_mutex_);
+                error = OH_Drawing_RegisterFont(font_collection_, fontFamily.c_str(), src.c_str());
+            }
+            struct stat file_stat;
+            if (stat(src.c_str(), &file_stat) == 0) {
+                *bytes = static_cast<size_t>(file_stat.st_size);
+            }
+        }
+    } else if (fontBuffer != nullptr && len > 0) {
+        error = RegisterBuffer(fontFamily, reinterpret_cast<uint8_t *>(fontBuffer), len);
+        *bytes = len;
+        if (deallocator) {
+            deallocator(fontBuffer);
+        }
+    }
+    if (error != 0) {
+        KR_LOG_ERROR << "register font failed: " << fontFamily << ", error: " << error;
+    }
+    return error == 0;
+}
+
+uint32_t KRFontRegistry::RegisterRawFile(NativeResourceManager *resMgr, const std::string &fontFamily,
+                                         const std::string &path, size_t *bytes) {
+    if (resMgr == nullptr) {
+        return 1;
+    }
+    RawFile *rawFile = OH_ResourceManager_OpenRawFile(resMgr, path.c_str());
+    if (rawFile == nullptr) {
+        return 1;
+    }
+    uint32_t error = 1;
+    bool mapped = false;
+    // 未压缩的 rawfile 可以直接拿到 hap 内的 fd 与偏移，mmap 后注册，省去一次整体拷贝
+    RawFileDescriptor descriptor;
+    if (OH_ResourceManager_GetRawFileDescriptorData(rawFile, &descriptor)) {
+        auto page_size = static_cast<long>(sysconf(_SC_PAGESIZE));
+        auto aligned_start = descriptor.start / page_size * page_size;
+        auto delta = static_cast<size_t>(descriptor.start - aligned_start);
+        auto map_len = static_cast<size_t>(descriptor.length) + delta;
+        void *addr = mmap(nullptr, map_len, PROT_READ, MAP_PRIVATE, descriptor.fd, aligned_start);
+        if (addr != MAP_FAILED) {
+            error = RegisterBuffer(fontFamily, static_cast<const uint8_t *>(addr) + delta,
+                                   static_cast<size_t>(descriptor.length));
+            *bytes = static_cast<size_t>(descriptor.length);
+            munmap(addr, map_len);
+            mapped = true;
+        }
+        OH_ResourceManager_ReleaseRawFileDescriptorData(&descriptor);
+    }
+    if (!mapped) {
+        long len = OH_ResourceManager_GetRawFileSize(rawFile);
+        if (len > 0) {
+            std::unique_ptr<uint8_t[]> data = std::make_unique<uint8_t[]>(len);
+            if (OH_ResourceManager_ReadRawFile(rawFile, data.get(), len) == len) {
+                error = RegisterBuffer(fontFamily, data.get(), static_cast<size_t>(len));
+                *bytes = static_cast<size_t>(len);
+            }
+        }
+    }
+    OH_ResourceManager_CloseRawFile(rawFile);
+    return error;
+}
+
+uint32_t KRFontRegistry::RegisterBuffer(const std::string &fontFamily, const uint8_t *data, size_t len) {
+    std::lock_guard<std::mutex> register_lock(register_mutex_);
+    // 接口只读取数据，注册时拷贝
+    return OH_Drawing_RegisterFontBuffer(font_collection_, fontFamily.c_str(), const_cast<uint8_t *>(data), len);
+}
+
+KRFontUsage::~KRFontUsage() {
+    auto &registry = KRFontRegistry::GetInstance();
+    for (const auto &family : families_) {
+        registry.Release(family);
+    }
+}
+
+void KRFontUsage::Use(NativeResourceManager *resMgr, const std::string &fontFamily) {
+    if (fontFamily.empty()) {
+        return;
+    }
+    auto &registry = KRFontRegistry::GetInstance();
+    if (families_.insert(fontFamily).second) {
+        registry.Retain(fontFamily);
+    }
+    registry.EnsureRegistered(resMgr, fontFamily);
+}
@@ -0,0 +1,125 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRFONTREGISTRY_H
+#define CORE_RENDER_OHOS_KRFONTREGISTRY_H
+
+#include <native_drawing/drawing_text_declaration.h>
+#include <rawfile/raw_file_manager.h>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "libohos_render/api/include/Kuikly/Kuikly.h"
+#include "libohos_render/expand/components/richtext/KRFontRegistryIndex.h"
+
+/**
+ * 进程级自定义字体注册表。富文本、画布、StyledString 共用同一个字体集合，每个字体只加载注册一次：
+ * - rawfile 字体通过 mmap 读取后注册，不再整体拷贝到堆上
+ * - 同一字体并发请求时只有一个线程加载，其余线程等待结果
+ * - 支持在后台线程按声明的字体列表预注册，避免页面首次排版时同步加载
+ * - 按内存预算淘汰长时间未使用且不再被引用的字体（系统支持注销字体时生效）
+ */
+class KRFontRegistry {
+ public:
+    static KRFontRegistry &GetInstance();
+
+    KRFontRegistry(const KRFontRegistry &) = delete;
+    KRFontRegistry &operator=(const KRFontRegistry &) = delete;
+
+    /**
+     * 共享的字体集合（用于创建 Typography / StyledString）
+     */
+    OH_Drawing_FontCollection *FontCollection() const {
+        return font_collection_;
+    }
+
+    /**
+     * 确保字体已注册（任意线程），已注册时只刷新使用时间；没有对应 font adapter 时直接返回
+     * @param resMgr 资源管理器，rawfile 字体需要
+     * @param fontFamily 字体名称
+     */
+    void EnsureRegistered(NativeResourceManager *resMgr, const std::string &fontFamily);
+
+    /**
+     * 在后台线程预注册一组字体
+     * @param resMgr 资源管理器，为空时 rawfile 字体留到首次使用时注册。不转移所有权，
+     *               后台任务执行完之前调用方不能释放（没有完成通知，应传入进程内一直持有的资源管理器）
+     * @param fontFamilies 字体名称
+     */
+    void PreregisterAsync(NativeResourceManager *resMgr, std::vector<std::string> fontFamilies);
+
+    /**
+     * 设置已注册字体数据的内存预算（字节）
+     */
+    void SetBudget(size_t budgetBytes);
+
+    /**
+     * 增加/减少字体引用（任意线程），仍被引用的字体不会被淘汰
+     */
+    void Retain(const std::string &fontFamily);
+    void Release(const std::string &fontFamily);
+
+ private:
+    KRFontRegistry();
+    ~KRFontRegistry();
+
+    /**
+     * 通过 adapter 取字体数据并注册到字体集合
+     * @param[out] bytes 字体数据大小
+     * @return 是否注册成功
+     */
+    bool LoadAndRegister(KRFontAdapter adapter, NativeResourceManager *resMgr, const std::string &fontFamily,
+                         size_t *bytes);
+    uint32_t RegisterRawFile(NativeResourceManager *resMgr, const std::string &fontFamily, const std::string &path,
+                             size_t *bytes);
+    uint32_t RegisterBuffer(const std::string &fontFamily, const uint8_t *data, size_t len);
+
+    OH_Drawing_FontCollection *font_collection_ = nullptr;
+    bool is_global_instance_ = false;  // 全局实例不需要销毁
+    std::mutex mutex_;
+    std::condition_variable loaded_cv_;
+    // 正在加载或注销中的字体，其他线程需等待
+    std::unordered_set<std::string> busy_;
+    KRFontRegistryIndex index_;
+    std::mutex register_mutex_;  // 字体集合的注册/注销串行执行
+};
+
+/**
+ * 一个排版对象（shadow、段落）所用的自定义字体，存活期间这些字体不会被淘汰。
+ * 页面长时间不重新排版时，已排版的文字仍在绘制，只靠使用时间判断会误淘汰。
+ * 不加锁，同一时刻只在一个线程使用
+ */
+class KRFontUsage {
+ public:
+    KRFontUsage() = default;
+    ~KRFontUsage();
+    KRFontUsage(const KRFontUsage &) = delete;
+    KRFontUsage &operator=(const KRFontUsage &) = delete;
+
+    /**
+     * 确保字体已注册并记录引用
+     * @param resMgr 资源管理器，rawfile 字体需要
+     * @param fontFamily 字体名称
+     */
+    void Use(NativeResourceManager *resMgr, const std::string &fontFamily);
+
+ private:
+    std::unordered_set<std::string> families_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRFONTREGISTRY_H
@@ -0,0 +1,140 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRFONTREGISTRYINDEX_H
+#define CORE_RENDER_OHOS_KRFONTREGISTRYINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * 已注册自定义字体的内存预算索引（不加锁，由 KRFontRegistry 在锁内使用）。
+ *
+ * 按最近使用时间维护 LRU，总字节数超出预算时从最久未用的字体开始淘汰；
+ * 仍被引用（Retain）的字体与最近 min_idle_ms 内用过的字体不淘汰，因此总量可以暂时超出预算。
+ */
+class KRFontRegistryIndex {
+ public:
+    static constexpr size_t kDefaultBudgetBytes = 32 * 1024 * 1024;
+    static constexpr int64_t kDefaultMinIdleMs = 60 * 1000;
+
+    explicit KRFontRegistryIndex(size_t budget_bytes = kDefaultBudgetBytes, int64_t min_idle_ms = kDefaultMinIdleMs)
+        : budget_bytes_(budget_bytes), min_idle_ms_(min_idle_ms) {}
+
+    void SetBudget(size_t budget_bytes) {
+        budget_bytes_ = budget_bytes;
+    }
+
+    size_t Budget() const {
+        return budget_bytes_;
+    }
+
+    /**
+     * 字体已注册时刷新使用时间并返回 true
+     */
+    bool Touch(const std::string &family, int64_t now_ms) {
+        auto it = entries_.find(family);
+        if (it == entries_.end()) {
+            return false;
+        }
+        it->second.last_use_ms = now_ms;
+        lru_.splice(lru_.end(), lru_, it->second.lru_it);
+        return true;
+    }
+
+    /**
+     * 记录一个注册成功的字体
+     * @param bytes 字体数据大小，未知时传 0
+     */
+    void Add(const std::string &family, size_t bytes, int64_t now_ms) {
+        if (Touch(family, now_ms)) {
+            return;
+        }
+        auto lru_it = lru_.insert(lru_.end(), family);
+        entries_.emplace(family, Entry{bytes, now_ms, lru_it});
+        total_bytes_ += bytes;
+    }
+
+    /**
+     * 增加字体引用（字体可以尚未注册），引用期间不淘汰
+     */
+    void Retain(const std::string &family) {
+        retain_counts_[family]++;
+    }
+
+    void Release(const std::string &family) {
+        auto it = retain_counts_.find(family);
+        if (it != retain_counts_.end() && --it->second == 0) {
+            retain_counts_.erase(it);
+        }
+    }
+
+    /**
+     * 取出需要淘汰的字体并从索引中移除，调用方负责从字体集合中注销
+     */
+    std::vector<std::string> CollectEvictions(int64_t now_ms) {
+        std::vector<std::string> evicted;
+        auto lru_it = lru_.begin();
+        while (total_bytes_ > budget_bytes_ && lru_it != lru_.end()) {
+            if (retain_counts_.find(*lru_it) != retain_counts_.end()) {
+                ++lru_it;
+                continue;
+            }
+            auto it = entries_.find(*lru_it);
+            if (now_ms - it->second.last_use_ms < min_idle_ms_) {
+                // 之后未被引用的字体用得更近，都不满足
+                break;
+            }
+            evicted.push_back(*lru_it);
+            total_bytes_ -= it->second.bytes;
+            entries_.erase(it);
+            lru_it = lru_.erase(lru_it);
+        }
+        return evicted;
+    }
+
+    bool Contains(const std::string &family) const {
+        return entries_.find(family) != entries_.end();
+    }
+
+    size_t Count() const {
+        return entries_.size();
+    }
+
+    size_t TotalBytes() const {
+        return total_bytes_;
+    }
+
+ private:
+    struct Entry {
+        size_t bytes;
+        int64_t last_use_ms;
+        std::list<std::string>::iterator lru_it;
+    };
+
+    size_t budget_bytes_;
+    int64_t min_idle_ms_;
+    size_t total_bytes_ = 0;
+    // 头部为最久未使用
+    std::list<std::string> lru_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::unordered_map<std::string, int> retain_counts_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRFONTREGISTRYINDEX_H
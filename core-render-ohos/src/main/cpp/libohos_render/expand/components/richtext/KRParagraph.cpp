@@ -19,7 +19,7 @@
 #include <native_drawing/drawing_register_font.h>
 #include <native_drawing/drawing_shader_effect.h>
 
-#include "libohos_render/expand/components/richtext/KRFontAdapterManager.h"
+#include "libohos_render/expand/components/richtext/KRFontRegistry.h"
 #include "libohos_render/expand/components/richtext/KRParagraph.h"
 #include "libohos_render//foundation/KRCommon.h"
 #include "libohos_render/foundation/KRConfig.h"
@@ -30,18 +30,12 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
-// Remove this declaration if compatable api is raised to 14 and above
-extern OH_Drawing_FontCollection *OH_Drawing_GetFontCollectionGlobalInstance(void) __attribute__((weak));
 // 垂直对齐接口的弱符号声明（系统 API 20+ 提供，低版本系统该符号为 nullptr）
 extern void OH_Drawing_SetTypographyVerticalAlignment(OH_Drawing_TypographyStyle* style,
                                                       OH_Drawing_TextVerticalAlignment alignment) __attribute__((weak));
 #ifdef __cplusplus
 };
 #endif
-constexpr char kRawFilePrefix[] = "rawfile:";
-
-static bool isRawFilePath(const std::string &src) { return src.find(kRawFilePrefix) == 0; }
-
 constexpr int SHADER_EFFECT_DESTROY_API_LEVEL = 19;
 static void KRSafeCall_OH_Drawing_ShaderEffectDestroy(OH_Drawing_ShaderEffect *shaderEffect) {
     // OH_Drawing_ShaderEffectDestroy has known issues:
@@ -56,77 +50,6 @@ static void KRSafeCall_OH_Drawing_ShaderEffectDestroy(OH_Drawing_ShaderEffect *s
     }
 }
 
-class KRFontCollectionManager final {
-  public:
-    static std::shared_ptr<KRFontCollectionManager> &GetInstance() {
-        static std::shared_ptr<KRFontCollectionManager> instance_ = nullptr;
-        static std::once_flag flag;
-        std::call_once(flag, []() { instance_ = std::make_shared<KRFontCollectionManager>(); });
-        return instance_;
-    }
-
-    KRFontCollectionManager() {
-        if (OH_Drawing_GetFontCollectionGlobalInstance) {
-            collection_ = OH_Drawing_GetFontCollectionGlobalInstance();
-        } else {
-            collection_ = OH_Drawing_CreateSharedFontCollection();
-        }
-    }
-
-    void LoadCustomFont(const std::string &fontFamily, NativeResourceManager *resMgr) {
-        if (fontFamily.empty() || resMgr == nullptr) {
-            return;
-        }
-        auto fontAdapters = KRFontAdapterManager::GetInstance()->AllAdapters();
-        if (auto adapter = fontAdapters.find(fontFamily); adapter != fontAdapters.end()) {
-            if (registered_.find(fontFamily) == registered_.end()) {
-                char *fontBuffer = nullptr;
-                size_t len = 0;
-                KRFontDataDeallocator deallocator = nullptr;
-                char *fontSrc = adapter->second(fontFamily.c_str(), &fontBuffer, &len, &deallocator);
-                if (fontSrc) {
-                    uint32_t error = 0;
-                    auto fontStrString = std::string(fontSrc);
-                    if (isRawFilePath(std::string(fontSrc))) {
-                        auto newRawPath = fontStrString.substr(strlen(kRawFilePrefix));
-                        RawFile *rawFile = OH_ResourceManager_OpenRawFile(resMgr, newRawPath.c_str());
-                        long len = OH_ResourceManager_GetRawFileSize(rawFile);
-                        std::unique_ptr<uint8_t[]> data = std::make_unique<uint8_t[]>(len);
-                        int res = OH_ResourceManager_ReadRawFile(rawFile, data.get(), len);
-                        OH_ResourceManager_CloseRawFile(rawFile);
-
-                        error = OH_Drawing_RegisterFontBuffer(collection_, fontFamily.c_str(), data.get(), len);
-                    } else {
-                        error = OH_Drawing_RegisterFont(collection_, fontFamily.c_str(), fontSrc);
-                    }
-                    if (error == 0) {
-                        registered_.emplace(fontFamily);
-                    }
-
-                    if (deallocator) {
-                        deallocator(fontSrc);
-                    }
-                } else if (fontBuffer != nullptr && len > 0) {
-                    uint32_t error =
-                      OH_Drawing_RegisterFontBuffer(collection_, fontFamily.c_str(), (uint8_t *)fontBuffer, len);
-                    if (error == 0) {
-                        registered_.emplace(fontFamily);
-                    }
-                    if (deallocator) {
-                        deallocator(fontBuffer);
-                    }
-                }
-            }
-        }
-    }
-
-    OH_Drawing_FontCollection *SharedFontCollection() { return collection_; }
-
-  private:
-    OH_Drawing_FontCollection *collection_;
-    std::unordered_set<std::string> registered_;
-};
-
 static KRAnyValue GetKTValue(const char *key, const KRRenderValue::Map &map0, const KRRenderValue::Map &map1) {
     auto it = map0.find(key);
     if (it != map0.end()) {
@@ -335,7 +258,7 @@ void KRParagraph::AddSpanToStyledString(const KRRenderValue::Map &spanMap, ArkUI
         const char *fontFamilyPtr = fontFamily.c_str();
         const char *fontFamilies[] = {fontFamilyPtr};
         OH_Drawing_SetTextStyleFontFamilies(txtStyle, 1, fontFamilies);
-        KRFontCollectionManager::GetInstance()->LoadCustomFont(fontFamily, resource_manager_);
+        font_usage_.Use(resource_manager_, fontFamily);
     }
 
     // Push text style
@@ -376,6 +299,7 @@ ArkUI_StyledString *KRParagraph::BuildStyledString(float width, float height) {
     spanIndex = 0;
     placeholder_count = 0;
     span_offsets_.clear();
+    span_hit_index_.Clear();
     placeholder_index_map_.clear();
 
     // create OH_Drawing_TypographyStyle
@@ -383,7 +307,7 @@ ArkUI_StyledString *KRParagraph::BuildStyledString(float width, float height) {
 
     // Create styled string
     styled_string =
-      OH_ArkUI_StyledString_Create(typography_style, KRFontCollectionManager::GetInstance()->SharedFontCollection());
+      OH_ArkUI_StyledString_Create(typography_style, KRFontRegistry::GetInstance().FontCollection());
 
     // add text spans
     std::for_each(spans_.begin(), spans_.end(),
@@ -415,35 +339,33 @@ std::tuple<float, float, float, float> KRParagraph::SpanRect(int spanIndex) {
 
 
 int KRParagraph::SpanIndexAt(float spanX, float spanY) {
-    int resultIndex = -1;
     if (typography_ == nullptr) {
-        return resultIndex;
+        return -1;
+    }
+    if (!span_hit_index_.IsBuilt()) {
+        KRBuildSpanHitIndex(typography_, span_offsets_, KRConfig::GetDpi(), span_hit_index_);
     }
-    for (int index = 0; index < span_offsets_.size(); ++index) {
-        int lastSpanIndex = std::get<0>(span_offsets_[index]);
-        int lastSpanBegin = std::get<1>(span_offsets_[index]);
-        int lastSpanEnd = std::get<2>(span_offsets_[index]);
-        OH_Drawing_TextBox *box = OH_Drawing_TypographyGetRectsForRange(typography_, lastSpanBegin, lastSpanEnd,
-                                                                        RECT_HEIGHT_STYLE_MAX, RECT_WIDTH_STYLE_MAX);
-        int n = OH_Drawing_GetSizeOfTextBox(box);
-        auto dpi = KRConfig::GetDpi();
-        for (int boxIndex = 0; boxIndex < n; ++boxIndex) {
-            float left = OH_Drawing_GetLeftFromTextBox(box, boxIndex) / dpi;
-            float right = OH_Drawing_GetRightFromTextBox(box, boxIndex) / dpi;
-            float top = OH_Drawing_GetTopFromTextBox(box, boxIndex) / dpi;
-            float bottom = OH_Drawing_GetBottomFromTextBox(box, boxIndex) / dpi;
-            if (spanX < left || spanX >= right || spanY < top || spanY >= bottom) {
-                continue;
+    return span_hit_index_.SpanAt(spanX, spanY);
+}
+
+void KRBuildSpanHitIndex(OH_Drawing_Typography *typography, const std::vector<std::tuple<int, int, int>> &span_offsets,
+                         float density, KRSpanHitIndex &index) {
+    std::vector<KRSpanBox> boxes;
+    if (typography != nullptr && density > 0) {
+        for (const auto &[span_index, begin, end] : span_offsets) {
+            OH_Drawing_TextBox *box =
+                OH_Drawing_TypographyGetRectsForRange(typography, begin, end, RECT_HEIGHT_STYLE_MAX, RECT_WIDTH_STYLE_MAX);
+            int n = OH_Drawing_GetSizeOfTextBox(box);
+            for (int box_index = 0; box_index < n; ++box_index) {
+                boxes.push_back({span_index, OH_Drawing_GetLeftFromTextBox(box, box_index) / density,
+                                 OH_Drawing_GetTopFromTextBox(box, box_index) / density,
+                                 OH_Drawing_GetRightFromTextBox(box, box_index) / density,
+                                 OH_Drawing_GetBottomFromTextBox(box, box_index) / density});
             }
-            resultIndex = lastSpanIndex;
-            break;
-        }
-        OH_Drawing_TypographyDestroyTextBox(box);
-        if (resultIndex != -1) {
-            break;
+            OH_Drawing_TypographyDestroyTextBox(box);
         }
     }
-    return resultIndex;
+    index.Build(span_offsets, std::move(boxes));
 }
 
 OH_Drawing_ShaderEffect *KRParagraph::CreateShaderEffect(std::shared_ptr<kuikly::util::KRLinearGradientParser> linearGradient) {
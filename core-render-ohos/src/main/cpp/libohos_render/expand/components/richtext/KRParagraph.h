@@ -18,9 +18,20 @@
 #include <arkui/styled_string.h>
 #include <tuple>
 
+#include "libohos_render/expand/components/richtext/KRFontRegistry.h"
+#include "libohos_render/expand/components/richtext/KRSpanHitIndex.h"
 #include "libohos_render/foundation/type/KRRenderValue.h"
 #include "libohos_render/utils/KRLinearGradientParser.h"
 
+/**
+ * 按 span 区间从 typography 中取出各 span 的矩形，构建点击命中索引（每次排版后构建一次）
+ * @param typography 排版结果
+ * @param span_offsets (spanIndex, begin, end) 列表
+ * @param density 屏幕密度，矩形坐标会换算为 vp
+ * @param index 输出索引
+ */
+void KRBuildSpanHitIndex(OH_Drawing_Typography *typography, const std::vector<std::tuple<int, int, int>> &span_offsets,
+                         float density, KRSpanHitIndex &index);
 
 class KRParagraph final {
   public:
@@ -31,6 +42,10 @@ class KRParagraph final {
 
     std::pair<float, float> Measure(float max_width_pt);
     ArkUI_StyledString *GetStyledString();
+    /**
+     * 点击坐标对应的 span 下标，未命中返回 -1。
+     * span 索引不在 Measure 时构建：Measure 只清空旧索引，首次查询时才按当前 typography 懒构建。
+     */
     int SpanIndexAt(float spanX, float spanY);
     std::tuple<float, float, float, float> SpanRect(int spanIndex);
 
@@ -54,6 +69,7 @@ class KRParagraph final {
     int spanIndex = 0;
     std::unordered_map<int, int> placeholder_index_map_;
     std::vector<std::tuple<int, int, int>> span_offsets_; // span, begin, end
+    KRSpanHitIndex span_hit_index_;  // Measure 时清空，首次点击查询时按当前 typography 构建
 
     ArkUI_StyledString *styled_string_ = nullptr;
     OH_Drawing_Typography *typography_ = nullptr;
@@ -62,6 +78,7 @@ class KRParagraph final {
     float measured_height_ = 0;
 
     NativeResourceManager *resource_manager_ = nullptr;
+    KRFontUsage font_usage_;  // 段落存活期间所用字体不被淘汰
 };
 
 #endif // CORE_RENDER_HARMONY_KRPARAGRAPH_H
@@ -34,8 +34,10 @@
 
 #include "libohos_render/api/src/KRTextPostProcessor.h"
 #include "libohos_render/expand/components/richtext/KRCustomEmojiPixmapCache.h"
+#include "libohos_render/expand/components/richtext/KRFontRegistry.h"
 #include "libohos_render/expand/components/richtext/KRParagraph.h"
 #include "libohos_render/expand/components/richtext/KRRichTextShadow.h"
+#include "libohos_render/foundation/thread/KRIdleTaskQueue.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/utils/KRConvertUtil.h"
 #include "libohos_render/utils/KRLinearGradientParser.h"
@@ -45,8 +47,6 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
-// Remove this declaration if compatable api is raised to 14 and above
-extern OH_Drawing_FontCollection* OH_Drawing_GetFontCollectionGlobalInstance(void) __attribute__((weak));
 extern OH_Drawing_Array* OH_Drawing_TypographyGetTextLines(OH_Drawing_Typography* typography) __attribute__((weak));
 extern void OH_Drawing_DestroyTextLines(OH_Drawing_Array* lines) __attribute__((weak));
 // 垂直对齐接口的弱符号声明（系统 API 20+ 提供，低版本系统该符号为 nullptr）
@@ -63,12 +63,6 @@ template <class Facet> struct deletable_facet : Facet {
     ~deletable_facet() {}
 };
 
-constexpr char kRawFilePrefix[] = "rawfile:";
-
-static bool isRawFilePath(const std::string &src) {
-    return src.find(kRawFilePrefix) == 0;
-}
-
 KRRichTextShadow::~KRRichTextShadow() {
     DestroyCachedTextLines();
     // 不再手动调 OH_Drawing_DestroyTypography：shared_ptr 的 deleter 会在
@@ -147,8 +141,9 @@ KRSize KRRichTextShadow::CalculateRenderViewSizeWithStyledString(double constrai
                 //
                 // We need to dispatch it back to main thread to avoid destructing it on context thread,
                 // in case `rootView` variable is the last holding onto the root render view.
+                // Releasing it is housekeeping, so it waits for the idle slice of a frame.
                 //
-                KRMainThread::RunOnMainThread([theRootView]{
+                KRIdleTaskQueue::PostIdleTask([theRootView]{
                     theRootView.get();
                 });
             }
@@ -199,8 +194,10 @@ KRSchedulerTask KRRichTextShadow::TaskToMainQueueWhenWillSetShadowToView() {
     auto offsetX = context_thread_drawOffsetX_;
     auto measure_size = context_measure_size_;
     auto text_align = context_thread_text_align_;
-    return [self, typography, offsetY, offsetX, measure_size, text_align] {
+    auto span_offsets = span_offsets_;
+    return [self, typography, offsetY, offsetX, measure_size, text_align, span_offsets] {
         KRRichTextShadow *shadow = reinterpret_cast<KRRichTextShadow *>(self.get());
+        shadow->main_thread_span_offsets_ = span_offsets;
         shadow->SetMainThreadTypography(typography);
         shadow->main_thread_drawOffsetY_ = offsetY;
         shadow->main_thread_drawOffsetX_ = offsetX;
@@ -221,79 +218,20 @@ static KRAnyValue GetKRValue(const char *key, const KRRenderValue::Map &map0, co
     return KRRenderValue::Make(nullptr);
 }
 
-KRFontCollectionWrapper::KRFontCollectionWrapper() {
-    // 优先使用全局实例（API >= 14），否则创建共享实例
-    if (OH_Drawing_GetFontCollectionGlobalInstance) {
-        fontCollection_ = OH_Drawing_GetFontCollectionGlobalInstance();
-        isGlobalInstance_ = true;
-    } else {
-        fontCollection_ = OH_Drawing_CreateSharedFontCollection();
-        isGlobalInstance_ = false;
-    }
-}
-
-KRFontCollectionWrapper::~KRFontCollectionWrapper() {
-    // 只有非全局实例需要销毁
-    if (fontCollection_ && !isGlobalInstance_) {
-        OH_Drawing_DestroyFontCollection(fontCollection_);
+bool KRRichTextShadow::CanCalculateRenderViewSizeConcurrently() {
+    if (StyledStringEnabled()) {
+        return false;
     }
-    fontCollection_ = nullptr;
+    return GetKRValue("textPostProcessor", props_, props_)->toString().empty();
 }
 
 OH_Drawing_FontCollection* KRFontCollectionWrapper::GetFontCollection() {
-    return fontCollection_;
-}
-
-bool KRFontCollectionWrapper::IsFontRegistered(const std::string& fontFamily) const {
-    return registered_.find(fontFamily) != registered_.end();
-}
-
-void KRFontCollectionWrapper::MarkFontRegistered(const std::string& fontFamily) {
-    registered_.emplace(fontFamily);
+    return KRFontRegistry::GetInstance().FontCollection();
 }
 
 void KRFontCollectionWrapper::RegisterCustomFont(NativeResourceManager *resMgr,
                                                   const std::string &fontFamily) {
-    auto fontAdapters = KRFontAdapterManager::GetInstance()->AllAdapters();
-    auto adapter = fontAdapters.find(fontFamily);
-    if (adapter != fontAdapters.end() && !IsFontRegistered(fontFamily)) {
-        char *fontBuffer = nullptr;
-        size_t len = 0;
-        KRFontDataDeallocator deallocator = nullptr;
-        char *fontSrc = adapter->second(fontFamily.c_str(), &fontBuffer, &len, &deallocator);
-        if (fontSrc) {
-            uint32_t error = 0;
-            auto fontStrString = std::string(fontSrc);
-            if (isRawFilePath(std::string(fontSrc))) {
-                auto newRawPath = fontStrString.substr(strlen(kRawFilePrefix));
-                RawFile *rawFile = OH_ResourceManager_OpenRawFile(resMgr, newRawPath.c_str());
-                long len = OH_ResourceManager_GetRawFileSize(rawFile);
-                std::unique_ptr<uint8_t[]> data = std::make_unique<uint8_t[]>(len);
-                int res = OH_ResourceManager_ReadRawFile(rawFile, data.get(), len);
-                OH_ResourceManager_CloseRawFile(rawFile);
-                error = OH_Drawing_RegisterFontBuffer(fontCollection_, fontFamily.c_str(), data.get(), len);
-            } else {
-                error = OH_Drawing_RegisterFont(fontCollection_, fontFamily.c_str(), fontSrc);
-            }
-            if (error == 0) {
-                MarkFontRegistered(fontFamily);
-            }
-
-            if (deallocator) {
-                deallocator(fontSrc);
-            }
-        } else if (fontBuffer != nullptr && len > 0) {
-            uint32_t error =
-                OH_Drawing_RegisterFontBuffer(fontCollection_, fontFamily.c_str(),
-                                              reinterpret_cast<uint8_t *>(fontBuffer), len);
-            if (error == 0) {
-                MarkFontRegistered(fontFamily);
-            }
-            if (deallocator) {
-                deallocator(fontBuffer);
-            }
-        }
-    }
+    KRFontRegistry::GetInstance().EnsureRegistered(resMgr, fontFamily);
 }
 
 OH_Drawing_TypographyCreate* CreateTypographyHandler(OH_Drawing_TypographyStyle* typoStyle) {
@@ -316,8 +254,9 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
                 //
                 // We need to dispatch it back to main thread to avoid destructing it on context thread,
                 // in case `rootView` variable is the last holding onto the root render view.
+                // Releasing it is housekeeping, so it waits for the idle slice of a frame.
                 //
-                KRMainThread::RunOnMainThread([theRootView] { theRootView.get(); });
+                KRIdleTaskQueue::PostIdleTask([theRootView] { theRootView.get(); });
             }
         }
 
@@ -555,7 +494,7 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
             auto rootView = GetRootView();
             auto rootViewLock = rootView.lock();
             auto nativeResMgr = rootViewLock->GetNativeResourceManager();
-            KRFontCollectionWrapper::GetInstance().RegisterCustomFont(nativeResMgr, fontFamily);
+            font_usage_.Use(nativeResMgr, fontFamily);
         }
 
         // 需要在fontFamily设置后设置
@@ -779,43 +718,26 @@ KRAnyValue KRRichTextShadow::SpanRect(int spanIndex) {
     return NewKRRenderValue("0 0 0 0");
 }
 
+std::shared_ptr<const KRSpanHitIndex> KRRichTextShadow::MainThreadSpanHitIndex() {
+    if (main_thread_span_hit_index_ == nullptr) {
+        // 同上，拿到强引用后再使用裸指针调 OH 接口。
+        KRTypographyHandle main_typo = main_thread_typography_;
+        auto index = std::make_shared<KRSpanHitIndex>();
+        KRBuildSpanHitIndex(main_typo ? main_typo.get() : nullptr, main_thread_span_offsets_, KRConfig::GetDpi(),
+                            *index);
+        main_thread_span_hit_index_ = index;
+    }
+    return main_thread_span_hit_index_;
+}
+
 int KRRichTextShadow::SpanIndexAt(float spanX, float spanY) {
-    int paragraphResultIndex = -1;
     if(auto paragraph = GetParagraph()){
-        paragraphResultIndex = paragraph->SpanIndexAt(spanX, spanY);
-        return paragraphResultIndex;
-    }
-    int resultIndex = -1;
-    // 同上，拿到强引用后再使用裸指针调 OH 接口。
-    KRTypographyHandle main_typo = main_thread_typography_;
-    OH_Drawing_Typography *main_typo_raw = main_typo ? main_typo.get() : nullptr;
-    if (main_typo_raw == nullptr) {
-        return resultIndex;
-    }
-    for (int index = 0; index < span_offsets_.size(); ++index) {
-        int lastSpanIndex = std::get<0>(span_offsets_[index]);
-        int lastSpanBegin = std::get<1>(span_offsets_[index]);
-        int lastSpanEnd = std::get<2>(span_offsets_[index]);
-        OH_Drawing_TextBox *box = OH_Drawing_TypographyGetRectsForRange(
-            main_typo_raw, lastSpanBegin, lastSpanEnd, RECT_HEIGHT_STYLE_MAX, RECT_WIDTH_STYLE_MAX);
-        int n = OH_Drawing_GetSizeOfTextBox(box);
-        auto dpi = KRConfig::GetDpi();
-        for (int boxIndex = 0; boxIndex < n; ++boxIndex) {
-            float left = OH_Drawing_GetLeftFromTextBox(box, boxIndex) / dpi;
-            float right = OH_Drawing_GetRightFromTextBox(box, boxIndex) / dpi;
-            float top = OH_Drawing_GetTopFromTextBox(box, boxIndex) / dpi;
-            float bottom = OH_Drawing_GetBottomFromTextBox(box, boxIndex) / dpi;
-            if (spanX < left || spanX >= right || spanY < top || spanY >= bottom) {
-                continue;
-            }
-            resultIndex = lastSpanIndex;
-            break;
-        }
-        if (resultIndex != -1) {
-            break;
-        }
+        return paragraph->SpanIndexAt(spanX, spanY);
+    }
+    if (main_thread_typography_ == nullptr) {
+        return -1;
     }
-    return resultIndex;
+    return MainThreadSpanHitIndex()->SpanAt(spanX, spanY);
 }
 
 KRAnyValue KRRichTextShadow::BuildEventParams(KRAnyValue res) {
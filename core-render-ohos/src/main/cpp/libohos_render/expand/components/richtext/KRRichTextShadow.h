@@ -29,6 +29,7 @@
 #include <unordered_set>
 #include <vector>
 #include "libohos_render/expand/components/richtext/KRFontAdapterManager.h"
+#include "libohos_render/expand/components/richtext/KRFontRegistry.h"
 #include "libohos_render/expand/components/richtext/KRParagraph.h"
 #include "libohos_render/utils/KRScopedSpinLock.h"
 #include "libohos_render/utils/KRRenderLoger.h"
@@ -87,34 +88,20 @@ public:
 
     /**
      * 获取 FontCollection（用于注册自定义字体和创建 Typography）
-     * 使用全局实例（如果可用），否则使用共享实例
+     * 与 StyledString 等共用 KRFontRegistry 的进程级字体集合
      */
     OH_Drawing_FontCollection* GetFontCollection();
 
     /**
-     * 注册自定义字体（如果适用）
+     * 注册自定义字体（如果适用），同一字体进程内只加载一次
      * @param resMgr 资源管理器
      * @param fontFamily 字体名称
      */
     void RegisterCustomFont(NativeResourceManager *resMgr, const std::string &fontFamily);
 
 private:
-    KRFontCollectionWrapper();
-    ~KRFontCollectionWrapper();
-
-    /**
-     * 检查字体是否已注册
-     */
-    bool IsFontRegistered(const std::string& fontFamily) const;
-
-    /**
-     * 标记字体为已注册
-     */
-    void MarkFontRegistered(const std::string& fontFamily);
-
-    OH_Drawing_FontCollection* fontCollection_ = nullptr;
-    bool isGlobalInstance_ = false;  // 标记是否为全局实例（全局实例不需要销毁）
-    std::unordered_set<std::string> registered_;
+    KRFontCollectionWrapper() = default;
+    ~KRFontCollectionWrapper() = default;
 };
 
 class KRRichTextShadow : public IKRRenderShadowExport {
@@ -144,6 +131,13 @@ class KRRichTextShadow : public IKRRenderShadowExport {
      */
     KRSize CalculateRenderViewSize(double constraint_width, double constraint_height) override;
 
+    /**
+     * 批量测量时是否可并行计算尺寸
+     * 只有 OH_Drawing 排版路径可以并行；StyledString 路径与业务注册的 textPostProcessor 不保证线程安全
+     * @return
+     */
+    bool CanCalculateRenderViewSizeConcurrently() override;
+
     /**
      * 完成对某个Span对应TextStyle
      * @param textStyle
@@ -212,9 +206,15 @@ class KRRichTextShadow : public IKRRenderShadowExport {
         // 否则它会自然延后到最后一个持有者析构时再销毁，从而避免任何
         // "release-after-use" 的窗口。
         main_thread_typography_ = std::move(typography);
+        main_thread_span_hit_index_ = nullptr;
         DestroyCachedTextLines();
     }
 
+    /**
+     * 主线程 typography 对应的 span 命中索引，首次查询时构建，typography 替换后失效重建
+     */
+    std::shared_ptr<const KRSpanHitIndex> MainThreadSpanHitIndex();
+
     std::shared_ptr<KRParagraph> GetParagraph(){
         KRScopedSpinLock lock(&paragraph_lock_);
         return paragraph_;
@@ -296,9 +296,12 @@ class KRRichTextShadow : public IKRRenderShadowExport {
     KRSize main_measure_size_;
     std::unordered_map<int, int> placeholder_index_map_;
     std::vector<std::tuple<int, int, int>> span_offsets_;  // span, begin, end
+    std::vector<std::tuple<int, int, int>> main_thread_span_offsets_;  // 与 main_thread_typography_ 对应的 span_offsets_
+    std::shared_ptr<const KRSpanHitIndex> main_thread_span_hit_index_;
     std::shared_ptr<KRParagraph> paragraph_;
     KRSpinLock paragraph_lock_;
     std::shared_ptr<kuikly::util::KRLinearGradientParser> text_linearGradient_;
+    KRFontUsage font_usage_;  // shadow 存活期间排版用过的字体不被淘汰
 
     // ===== Phase 4: image span 绘制相关 =====
     // image_draw_records_ 仅由 BuildTextTypography 在 context 线程构造，主线程读取（OnForegroundDraw）。
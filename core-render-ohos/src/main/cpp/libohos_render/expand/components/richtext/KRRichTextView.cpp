@@ -15,6 +15,7 @@
 
 #include "libohos_render/expand/components/richtext/KRRichTextView.h"
 
+#include <algorithm>
 #include <codecvt>
 #include <locale>
 #include <multimedia/image_framework/image/pixelmap_native.h>
@@ -381,7 +382,7 @@ void KRRichTextView::ClearSelection() {
 }
 
 void KRRichTextView::SetSelectionAll() {
-    KRParagraphInfo info = GetParagraphInfo();
+    const KRParagraphInfo &info = GetParagraphInfo();
     selection_rects_ = info.GetSelectionRectsAll();
     SetSelected(true);
     SetNeedsDisplay();
@@ -392,14 +393,14 @@ const KRParagraphSelectionInfo &KRRichTextView::GetSelectionInfo() {
 }
 
 const KRParagraphSelectionInfo &KRRichTextView::SetSelection(KRPoint start, KRPoint end, int type) {
-    KRParagraphInfo info = GetParagraphInfo();
+    const KRParagraphInfo &info = GetParagraphInfo();
     selection_rects_ = info.GetSelectionRects2(start, end, type);
     SetSelected(true);
     SetNeedsDisplay();
     return selection_rects_;
 }
 
-static int GetOffsetInLine(KRLineInfo &info, KRPoint point_in, SelectionStrategy &which_part, bool &first_in_line,
+static int GetOffsetInLine(const KRLineInfo &info, KRPoint point_in, SelectionStrategy &which_part, bool &first_in_line,
                            bool &last_in_line) {
     float density = KRConfig::GetDpi();
     KRPoint point(point_in.x * density, point_in.y * density);
@@ -436,21 +437,37 @@ std::pair<int, int> KRParagraphInfo::GetParagraphBoundary(int offset) {
 }
 
 // Returns the half-open interval [begin, end) of the span that contains `offset`.
-// span_offsets_ entries are tuples of (span_index, begin_offset, end_offset) where
-// end_offset is exclusive. When no span contains `offset`, returns an empty range
-// (offset, offset) so callers can treat span_start == span_end as "no span found".
-std::pair<int, int> KRParagraphInfo::GetSpanBoundary(int offset) {
-    for (const auto &span_off : span_offsets_) {
-        int begin = std::get<1>(span_off);
-        int end = std::get<2>(span_off);
-        if (offset >= begin && offset < end) {
-            return std::make_pair(begin, end);
-        }
-    }
-    return std::make_pair(offset, offset);
+// When no span contains `offset`, returns an empty range (offset, offset) so callers
+// can treat span_start == span_end as "no span found".
+std::pair<int, int> KRParagraphInfo::GetSpanBoundary(int offset) const {
+    int begin = offset;
+    int end = offset;
+    if (span_hit_index_ == nullptr || span_hit_index_->SpanAtOffset(offset, &begin, &end) < 0) {
+        return std::make_pair(offset, offset);
+    }
+    return std::make_pair(begin, end);
+}
+
+// Lines are laid out top to bottom, so their centers are sorted: binary search the
+// line whose center is closest to `y` (ties go to the upper line, as the old linear scan did).
+int KRParagraphInfo::NearestLine(float y) const {
+    auto it = std::lower_bound(line_info_list_.begin(), line_info_list_.end(), y,
+                               [](const KRLineInfo &line, float value) {
+                                   return line.line_metrics_.y + line.line_metrics_.height / 2 < value;
+                               });
+    if (it == line_info_list_.begin()) {
+        return 0;
+    }
+    if (it == line_info_list_.end()) {
+        return static_cast<int>(line_info_list_.size()) - 1;
+    }
+    auto prev = it - 1;
+    float prev_distance = std::fabs(prev->line_metrics_.y + prev->line_metrics_.height / 2 - y);
+    float distance = std::fabs(it->line_metrics_.y + it->line_metrics_.height / 2 - y);
+    return static_cast<int>((distance < prev_distance ? it : prev) - line_info_list_.begin());
 }
 
-KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRectsAll() {
+KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRectsAll() const {
     float density = KRConfig::GetDpi();
     std::vector<KRRect> selected_rect_list;
 
@@ -473,25 +490,16 @@ KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRectsAll() {
     return info;
 }
 
-KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRects2(KRPoint p0, KRPoint p1, int type) {
+KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRects2(KRPoint p0, KRPoint p1, int type) const {
+    if (line_info_list_.empty()) {
+        return KRParagraphSelectionInfo();
+    }
     float density = KRConfig::GetDpi();
     auto points = std::array{p0, p1};
     int line_numbers[2];
     int point_index = 0;
     for (auto p : points) {
-        KRPoint point(p.x * density, p.y * density);
-        float min_distance = 100000;
-        int which_line = -1;
-        for (size_t line_index = 0; line_index < line_info_list_.size(); ++line_index) {
-            const KRLineInfo &line_info = line_info_list_[line_index];
-            float center = line_info.line_metrics_.y + line_info.line_metrics_.height / 2;
-            float distance = std::fabs(center - point.y);
-            if (distance < min_distance) {
-                min_distance = distance;
-                which_line = static_cast<int>(line_index);
-            }
-        }
-        line_numbers[point_index] = which_line >= 0 ? which_line : 0;
+        line_numbers[point_index] = NearestLine(p.y * density);
         ++point_index;
     }
 
@@ -510,7 +518,7 @@ KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRects2(KRPoint p0, KRPoint
     SelectionStrategy which_part_of_last_line_text = SelectionStrategy::Trailing;
     std::vector<KRRect> rects;
     {
-        auto line_info = line_info_list_[line_numbers[0]];
+        const auto &line_info = line_info_list_[line_numbers[0]];
         KRPoint first_point(points[0].x * density, points[0].y * density);
         if (first_point.y < line_info_list_[line_numbers[0]].line_metrics_.y) {
             first_line_text_offset = line_info_list_[line_numbers[0]].line_metrics_.startIndex;
@@ -521,7 +529,7 @@ KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRects2(KRPoint p0, KRPoint
     }
 
     {
-        auto line_info = line_info_list_[line_numbers[1]];
+        const auto &line_info = line_info_list_[line_numbers[1]];
         KRPoint last_point(points[1].x * density, points[1].y * density);
         if (last_point.y > line_info_list_[line_numbers[1]].line_metrics_.y +
                               line_info_list_[line_numbers[1]].line_metrics_.height) {
@@ -597,14 +605,14 @@ KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRects2(KRPoint p0, KRPoint
     if (line_numbers[0] == line_numbers[1]) {
         if (last_line_text_is_first_in_line && first_line_text_is_first_in_line &&
             which_part_of_last_line_text == which_part_of_first_line_text) {
-            auto line_info = line_info_list_[line_numbers[0]];
+            const auto &line_info = line_info_list_[line_numbers[0]];
             const KRRect &start_rect = line_info.Get(first_line_text_offset);
             KRRect result(start_rect.x / density, line_info.line_metrics_.y / density, 0,
                           line_info.line_metrics_.height / density);
             rects.push_back(result);
             first_char_width = start_rect.width;
         } else {
-            auto line_info = line_info_list_[line_numbers[0]];
+            const auto &line_info = line_info_list_[line_numbers[0]];
             const KRRect start_rect = line_info.Get(first_line_text_offset);
             const KRRect end_rect = line_info.Get(last_line_text_offset);
             KRRect result(start_rect.x / density, line_info.line_metrics_.y / density,
@@ -616,7 +624,7 @@ KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRects2(KRPoint p0, KRPoint
         }
     } else {
         if (!(first_line_text_is_last_in_line && which_part_of_first_line_text == SelectionStrategy::Trailing)) {
-            auto line_info = line_info_list_[line_numbers[0]];
+            const auto &line_info = line_info_list_[line_numbers[0]];
             const KRRect &start_rect = line_info.Get(first_line_text_offset);
             const KRRect &end_rect = line_info.Back();
             KRRect result(start_rect.x / density, line_info.line_metrics_.y / density,
@@ -625,7 +633,7 @@ KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRects2(KRPoint p0, KRPoint
             rects.push_back(result);
             first_char_width = start_rect.width;
         } else {
-            auto line_info = line_info_list_[line_numbers[0]];
+            const auto &line_info = line_info_list_[line_numbers[0]];
             const KRRect &end_rect = line_info.Back();
             KRRect result((end_rect.x + end_rect.width) / density, line_info.line_metrics_.y / density, 0,
                           line_info.line_metrics_.height / density);
@@ -633,7 +641,7 @@ KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRects2(KRPoint p0, KRPoint
             first_char_width = end_rect.width;
         }
         for (int i = line_numbers[0] + 1; i < line_numbers[1]; ++i) {
-            auto line_info = line_info_list_[i];
+            const auto &line_info = line_info_list_[i];
             KRRect result(line_info.line_metrics_.x / density, line_info.line_metrics_.y / density,
                           line_info.line_metrics_.width / density, line_info.line_metrics_.height / density);
             rects.push_back(result);
@@ -644,7 +652,7 @@ KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRects2(KRPoint p0, KRPoint
             }
         }
         if (!(last_line_text_is_first_in_line && which_part_of_last_line_text == SelectionStrategy::Leading)) {
-            auto line_info = line_info_list_[line_numbers[1]];
+            const auto &line_info = line_info_list_[line_numbers[1]];
             const KRRect &end_rect = line_info.Get(last_line_text_offset);
             const KRRect &start_rect = line_info.Front();
             KRRect result(start_rect.x / density, line_info.line_metrics_.y / density,
@@ -653,7 +661,7 @@ KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRects2(KRPoint p0, KRPoint
             rects.push_back(result);
             last_char_width = end_rect.width;
         } else {
-            auto line_info = line_info_list_[line_numbers[1]];
+            const auto &line_info = line_info_list_[line_numbers[1]];
             const KRRect &end_rect = line_info.Get(last_line_text_offset);
             const KRRect &start_rect = line_info.Front();
             KRRect result(start_rect.x / density, line_info.line_metrics_.y / density, 0,
@@ -673,30 +681,28 @@ KRParagraphSelectionInfo KRParagraphInfo::GetSelectionRects2(KRPoint p0, KRPoint
     return info;
 }
 
-KRParagraphInfo KRRichTextView::GetParagraphInfo() {
-    KRParagraphInfo paragraph_info;
-    auto richTextShadow = reinterpret_cast<KRRichTextShadow *>(shadow_.get());
-    if (richTextShadow) {
-        OH_Drawing_Typography *textTypo = richTextShadow->MainThreadTypography();
-        paragraph_info.typography_ = textTypo;
-    }
-
+const KRParagraphInfo &KRRichTextView::GetParagraphInfo() {
     auto textShadow = std::dynamic_pointer_cast<KRRichTextShadow>(shadow_);
-    if (!textShadow) {
-        return paragraph_info;
-    }
-    OH_Drawing_Typography *textTypo = textShadow->MainThreadTypography();
+    KRTypographyHandle typography = textShadow ? textShadow->MainThreadTypographyHandle() : nullptr;
+    auto frame = GetFrame();
+    if (typography != nullptr && typography == paragraph_info_typography_.lock()) {
+        // 排版没有变化，行/字形信息直接复用，拖动选区时只需重新计算选区矩形
+        paragraph_info_.width_ = frame.width;
+        paragraph_info_.height_ = frame.height;
+        return paragraph_info_;
+    }
+    paragraph_info_ = KRParagraphInfo();
+    paragraph_info_typography_ = typography;
+    OH_Drawing_Typography *textTypo = typography ? typography.get() : nullptr;
+    paragraph_info_.typography_ = textTypo;
     if (textTypo == nullptr) {
-        return paragraph_info;
+        return paragraph_info_;
     }
 
-    auto frame = GetFrame();
-    paragraph_info.width_ = frame.width;
-    paragraph_info.height_ = frame.height;
-
-    std::string text_content = textShadow->GetTextContent();
-    paragraph_info.text_content_ = text_content;
-    paragraph_info.span_offsets_ = textShadow->span_offsets_;
+    paragraph_info_.width_ = frame.width;
+    paragraph_info_.height_ = frame.height;
+    paragraph_info_.text_content_ = textShadow->GetTextContent();
+    paragraph_info_.span_hit_index_ = textShadow->MainThreadSpanHitIndex();
     size_t lineCount = OH_Drawing_TypographyGetLineCount(textTypo);
     for (size_t i = 0; i < lineCount; ++i) {
         KRLineInfo line_info;
@@ -746,10 +752,10 @@ KRParagraphInfo KRRichTextView::GetParagraphInfo() {
                 OH_Drawing_TypographyDestroyTextBox(boxes);
             }
         }
-        paragraph_info.line_info_list_.emplace_back(line_info);
+        paragraph_info_.line_info_list_.emplace_back(line_info);
     }
 
-    return paragraph_info;
+    return paragraph_info_;
 }
 
 std::string KRRichTextView::GetSelectedContent(std::string &pre, std::string &post) {
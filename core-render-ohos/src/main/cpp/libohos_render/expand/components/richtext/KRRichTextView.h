@@ -72,15 +72,15 @@ class KRLineInfo {
     int Size() const {
         return rects_.size();
     }
-    void ForEach(std::function<void(int, KRRect)> visitor) {
+    void ForEach(std::function<void(int, KRRect)> visitor) const {
         for (const auto &it : rects_) {
             visitor(it.first, it.second);
         }
     }
-    int FrontIndex() {
+    int FrontIndex() const {
         return rects_.begin() == rects_.end() ? 0 : rects_.begin()->first;
     }
-    int BackIndex() {
+    int BackIndex() const {
         return rects_.begin() == rects_.end() ? 0 : rects_.rbegin()->first;
     }
 
@@ -106,20 +106,21 @@ enum SelectionStrategy {
 
 class KRParagraphInfo {
  public:
-    KRParagraphSelectionInfo GetSelectionRects2(KRPoint start, KRPoint end, int type);
-    KRParagraphSelectionInfo GetSelectionRectsAll();
+    KRParagraphSelectionInfo GetSelectionRects2(KRPoint start, KRPoint end, int type) const;
+    KRParagraphSelectionInfo GetSelectionRectsAll() const;
 
     std::vector<KRLineInfo> line_info_list_;
     std::string text_content_;
     OH_Drawing_Typography *typography_ = nullptr;
     float width_ = 0;
     float height_ = 0;
-    std::vector<std::tuple<int, int, int>> span_offsets_;  // (spanIndex, begin, end)
+    std::shared_ptr<const KRSpanHitIndex> span_hit_index_;  // offset -> span 二分查找
 
  private:
+    int NearestLine(float y) const;
     std::pair<int, int> GetSentenceBoundary(int offset);
     std::pair<int, int> GetParagraphBoundary(int offset);
-    std::pair<int, int> GetSpanBoundary(int offset);
+    std::pair<int, int> GetSpanBoundary(int offset) const;
 };
 
 class KRRichTextView : public IKRRenderViewExport {
@@ -149,7 +150,10 @@ class KRRichTextView : public IKRRenderViewExport {
     const KRParagraphSelectionInfo &SetSelection(KRPoint start, KRPoint end, int type);
     const KRParagraphSelectionInfo &GetSelectionInfo();
 
-    KRParagraphInfo GetParagraphInfo();
+    /**
+     * 当前排版的行/字形信息，按主线程 typography 缓存，拖动选区时不重复逐字查询
+     */
+    const KRParagraphInfo &GetParagraphInfo();
     KRRect FirstSelectionRect() {
         return selection_rects_.selection_rects.empty() ? KRRect() : *selection_rects_.selection_rects.begin();
     }
@@ -172,6 +176,8 @@ class KRRichTextView : public IKRRenderViewExport {
     float last_draw_frame_width_ = -1.0;
     float line_break_margin_ = 0;
     KRParagraphSelectionInfo selection_rects_;
+    KRParagraphInfo paragraph_info_;
+    std::weak_ptr<OH_Drawing_Typography> paragraph_info_typography_;  // paragraph_info_ 对应的 typography
     void OnForegroundDraw(ArkUI_NodeCustomEvent *event);
 };
 
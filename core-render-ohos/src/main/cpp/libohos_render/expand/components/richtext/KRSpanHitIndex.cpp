@@ -0,0 +1,108 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/richtext/KRSpanHitIndex.h"
+
+#include <algorithm>
+
+void KRSpanHitIndex::Build(const std::vector<std::tuple<int, int, int>> &span_offsets, std::vector<KRSpanBox> boxes) {
+    Clear();
+    ranges_.reserve(span_offsets.size());
+    for (const auto &[span_index, begin, end] : span_offsets) {
+        if (begin < end) {
+            ranges_.push_back({begin, end, span_index});
+        }
+    }
+    // span 按文本顺序产生，通常已经有序，stable_sort 保证相同 begin 时仍是先出现的优先
+    std::stable_sort(ranges_.begin(), ranges_.end(),
+                     [](const Range &a, const Range &b) { return a.begin < b.begin; });
+
+    boxes_.reserve(boxes.size());
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const auto &box = boxes[i];
+        if (box.right > box.left && box.bottom > box.top) {
+            boxes_.push_back({box, i, box.right});
+        }
+    }
+    std::stable_sort(boxes_.begin(), boxes_.end(), [](const Box &a, const Box &b) { return a.rect.top < b.rect.top; });
+    // 纵向有重叠的矩形视为同一行
+    size_t line_begin = 0;
+    while (line_begin < boxes_.size()) {
+        Line line{boxes_[line_begin].rect.top, boxes_[line_begin].rect.bottom, line_begin, line_begin + 1};
+        while (line.last < boxes_.size() && boxes_[line.last].rect.top < line.bottom) {
+            line.bottom = std::max(line.bottom, boxes_[line.last].rect.bottom);
+            line.last++;
+        }
+        std::stable_sort(boxes_.begin() + line.first, boxes_.begin() + line.last,
+                         [](const Box &a, const Box &b) { return a.rect.left < b.rect.left; });
+        for (size_t i = line.first + 1; i < line.last; i++) {
+            boxes_[i].max_right = std::max(boxes_[i].rect.right, boxes_[i - 1].max_right);
+        }
+        lines_.push_back(line);
+        line_begin = line.last;
+    }
+    built_ = true;
+}
+
+void KRSpanHitIndex::Clear() {
+    ranges_.clear();
+    boxes_.clear();
+    lines_.clear();
+    built_ = false;
+}
+
+int KRSpanHitIndex::SpanAtOffset(int offset, int *begin, int *end) const {
+    auto it = std::upper_bound(ranges_.begin(), ranges_.end(), offset,
+                               [](int value, const Range &range) { return value < range.begin; });
+    if (it == ranges_.begin()) {
+        return -1;
+    }
+    --it;
+    if (offset >= it->end) {
+        return -1;
+    }
+    if (begin) {
+        *begin = it->begin;
+    }
+    if (end) {
+        *end = it->end;
+    }
+    return it->span_index;
+}
+
+int KRSpanHitIndex::SpanAt(float x, float y) const {
+    auto line_it = std::upper_bound(lines_.begin(), lines_.end(), y,
+                                    [](float value, const Line &line) { return value < line.top; });
+    if (line_it == lines_.begin()) {
+        return -1;
+    }
+    --line_it;
+    if (y >= line_it->bottom) {
+        return -1;
+    }
+    auto first = boxes_.begin() + line_it->first;
+    auto last = boxes_.begin() + line_it->last;
+    auto box_it = std::upper_bound(first, last, x, [](float value, const Box &box) { return value < box.rect.left; });
+    const Box *hit = nullptr;
+    // 之前的矩形 left 更小，只要前缀最大 right 仍大于 x 就可能包含该点
+    while (box_it != first && (box_it - 1)->max_right > x) {
+        --box_it;
+        const auto &rect = box_it->rect;
+        if (x < rect.right && y >= rect.top && y < rect.bottom && (hit == nullptr || box_it->order < hit->order)) {
+            hit = &*box_it;
+        }
+    }
+    return hit ? hit->rect.span_index : -1;
+}
@@ -0,0 +1,105 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRSPANHITINDEX_H
+#define CORE_RENDER_OHOS_KRSPANHITINDEX_H
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+/**
+ * span 在排版结果中的一个矩形区域（同一个 span 折行后会有多个）
+ */
+struct KRSpanBox {
+    int span_index = -1;
+    float left = 0;
+    float top = 0;
+    float right = 0;
+    float bottom = 0;
+};
+
+/**
+ * 富文本 span 命中索引（不依赖 OHOS 运行时，可在 host 上单测）。
+ *
+ * 每次排版后构建一次：
+ *   - 字符区间按起始 offset 排序，offset -> span 二分查找；
+ *   - span 矩形按纵向重叠合并成行，行按 top 排序，行内矩形按 left 排序，
+ *     点 -> span 先二分定位行，再从 left <= x 的最后一个矩形向前逐个判定，
+ *     行内前缀最大 right 不超过 x 时停止。
+ * 高矩形（行内图片）会把上下两行合并成一行，此时同一行内的矩形可能分属不同的文本行，
+ * 因此不能只判定 left 最大的那个。普通文本行内矩形互不重叠，只判定一个矩形，查询仍是 O(log n)。
+ * 语义与逐个 span 调用 OH_Drawing_TypographyGetRectsForRange 线性扫描一致：
+ * 多个矩形命中时取输入顺序最靠前的。
+ */
+class KRSpanHitIndex {
+ public:
+    /**
+     * 构建索引
+     * @param span_offsets (spanIndex, begin, end) 列表，end 不包含
+     * @param boxes 各 span 的矩形，坐标单位需与查询时一致
+     */
+    void Build(const std::vector<std::tuple<int, int, int>> &span_offsets, std::vector<KRSpanBox> boxes);
+
+    void Clear();
+
+    bool IsBuilt() const {
+        return built_;
+    }
+
+    /**
+     * 查找包含字符 offset 的 span
+     * @param offset 字符 offset
+     * @param begin 输出 span 起始 offset（可为空）
+     * @param end 输出 span 结束 offset，不包含（可为空）
+     * @return span 下标，找不到返回 -1
+     */
+    int SpanAtOffset(int offset, int *begin = nullptr, int *end = nullptr) const;
+
+    /**
+     * 查找包含坐标点的 span，矩形按左闭右开、上闭下开判定
+     * @return span 下标，找不到返回 -1
+     */
+    int SpanAt(float x, float y) const;
+
+    size_t LineCount() const {
+        return lines_.size();
+    }
+
+ private:
+    struct Range {
+        int begin;
+        int end;
+        int span_index;
+    };
+    struct Box {
+        KRSpanBox rect;
+        size_t order;     // 在输入中的顺序
+        float max_right;  // 行内 [行首, 当前] 矩形的最大 right
+    };
+    struct Line {
+        float top;
+        float bottom;
+        size_t first;  // boxes_ 中的起始下标
+        size_t last;   // boxes_ 中的结束下标，不包含
+    };
+
+    std::vector<Range> ranges_;     // 按 begin 排序
+    std::vector<Box> boxes_;        // 按行分组，行内按 left 排序
+    std::vector<Line> lines_;       // 按 top 排序，互不重叠
+    bool built_ = false;
+};
+
+#endif  // CORE_RENDER_OHOS_KRSPANHITINDEX_H
@@ -0,0 +1,218 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRSCROLLVISIBLERANGETRACKER_H
+#define CORE_RENDER_OHOS_KRSCROLLVISIBLERANGETRACKER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+/**
+ * 主轴方向上的一段子节点区间 [first, last]，下标为子节点按主轴起点排序后的序号
+ */
+struct KRScrollIndexRange {
+    int first = -1;
+    int last = -1;
+
+    bool IsEmpty() const {
+        return first < 0 || last < first;
+    }
+
+    bool operator==(const KRScrollIndexRange &other) const {
+        return first == other.first && last == other.last;
+    }
+
+    bool operator!=(const KRScrollIndexRange &other) const {
+        return !(*this == other);
+    }
+};
+
+/**
+ * 滚动容器子节点在主轴上的占位
+ */
+struct KRScrollItemExtent {
+    float start = 0;
+    float end = 0;
+    int tag = -1;  // 子节点 view tag，便于 kotlin 侧对应到具体 item
+};
+
+/**
+ * 在 native 侧计算可见区间与预取区间，仅当区间变化时才通知 kotlin，
+ * 避免 kotlin 在每一帧滚动事件里自行遍历子节点判断可见性。
+ * 纯数据结构，不依赖 ArkUI，只在主线程使用。
+ */
+class KRScrollVisibleRangeTracker {
+ public:
+    // 与 ArkUI Scroll 的默认摩擦系数及 FrictionMotion 的衰减系数保持一致
+    static constexpr float kDefaultFriction = 0.6f;
+    static constexpr float kFrictionScale = 4.2f;
+    // 未配置预取距离时，默认向滚动方向多看一屏
+    static constexpr float kDefaultLookaheadViewports = 1.0f;
+
+    enum ChangeFlag {
+        kNoneChanged = 0,
+        kVisibleChanged = 1 << 0,
+        kPrefetchChanged = 1 << 1,
+    };
+
+    /**
+     * 按指数衰减模型预测 fling 停止时的偏移：v(t) = v0 * e^(-k t)，总位移为 v0 / k
+     * @param offset 当前偏移
+     * @param velocity 当前速度，px/s
+     * @param friction 摩擦系数，<= 0 时视为无法预测，直接返回当前偏移
+     */
+    static float PredictFlingStop(float offset, float velocity, float friction = kDefaultFriction) {
+        if (friction <= 0 || velocity == 0) {
+            return offset;
+        }
+        return offset + velocity / (friction * kFrictionScale);
+    }
+
+    /**
+     * 重新设置子节点占位，内部按主轴起点排序并建立前缀最大终点，代价 O(n log n)。
+     * 调用方应只在布局变化后重建，滚动过程中的 Update 查询为 O(log n)
+     */
+    void SetItems(std::vector<KRScrollItemExtent> items) {
+        items_ = std::move(items);
+        auto by_start = [](const KRScrollItemExtent &lhs, const KRScrollItemExtent &rhs) {
+            return lhs.start < rhs.start;
+        };
+        if (!std::is_sorted(items_.begin(), items_.end(), by_start)) {
+            std::stable_sort(items_.begin(), items_.end(), by_start);
+        }
+        max_end_.resize(items_.size());
+        float max_end = -INFINITY;
+        for (size_t i = 0; i < items_.size(); i++) {
+            max_end = std::max(max_end, items_[i].end);
+            max_end_[i] = max_end;
+        }
+    }
+
+    size_t ItemCount() const {
+        return items_.size();
+    }
+
+    const KRScrollItemExtent &ItemAt(int index) const {
+        return items_[index];
+    }
+
+    /**
+     * 与 [lo, hi) 相交的子节点区间，两端的节点一定相交；子节点互相重叠时区间内部可能夹带个别不相交的节点
+     */
+    KRScrollIndexRange RangeIntersecting(float lo, float hi) const {
+        KRScrollIndexRange range;
+        if (items_.empty() || hi <= lo) {
+            return range;
+        }
+        auto first = std::upper_bound(max_end_.begin(), max_end_.end(), lo) - max_end_.begin();
+        auto last = std::lower_bound(items_.begin(), items_.end(), hi,
+                                     [](const KRScrollItemExtent &item, float value) { return item.start < value; }) -
+                    items_.begin() - 1;
+        if (first >= static_cast<std::ptrdiff_t>(items_.size()) || last < first) {
+            return range;
+        }
+        // 重叠时末尾可能是早已结束的短节点，回退到真正相交的节点；first 自身相交，回退一定会停下
+        while (items_[last].end <= lo) {
+            last--;
+        }
+        range.first = static_cast<int>(first);
+        range.last = static_cast<int>(last);
+        return range;
+    }
+
+    /**
+     * 根据当前滚动状态刷新可见/预取区间
+     * @param offset 主轴偏移
+     * @param viewport 主轴视口长度
+     * @param velocity 主轴速度，px/s，正值表示向内容尾部滚动
+     * @param lookahead 预取距离，< 0 时取 kDefaultLookaheadViewports 个视口
+     * @return ChangeFlag 组合，表示哪些区间发生了变化
+     */
+    int Update(float offset, float viewport, float velocity, float lookahead) {
+        if (lookahead < 0) {
+            lookahead = viewport * kDefaultLookaheadViewports;
+        }
+        predicted_stop_ = PredictFlingStop(offset, velocity);
+        float lo = offset;
+        float hi = offset + viewport;
+        if (velocity > 0) {
+            hi = std::max(hi + lookahead, predicted_stop_ + viewport);
+        } else if (velocity < 0) {
+            lo = std::min(lo - lookahead, predicted_stop_);
+        } else {
+            lo -= lookahead;
+            hi += lookahead;
+        }
+        prefetch_lo_ = std::max(lo, 0.0f);
+        prefetch_hi_ = hi;
+
+        int changed = kNoneChanged;
+        auto visible = RangeIntersecting(offset, offset + viewport);
+        if (visible != visible_) {
+            visible_ = visible;
+            changed |= kVisibleChanged;
+        }
+        auto prefetch = RangeIntersecting(prefetch_lo_, prefetch_hi_);
+        if (prefetch != prefetch_) {
+            prefetch_ = prefetch;
+            changed |= kPrefetchChanged;
+        }
+        return changed;
+    }
+
+    const KRScrollIndexRange &VisibleRange() const {
+        return visible_;
+    }
+
+    const KRScrollIndexRange &PrefetchRange() const {
+        return prefetch_;
+    }
+
+    float PredictedStop() const {
+        return predicted_stop_;
+    }
+
+    float PrefetchStart() const {
+        return prefetch_lo_;
+    }
+
+    float PrefetchEnd() const {
+        return prefetch_hi_;
+    }
+
+    /**
+     * 清空上次通知过的区间，下次 Update 会重新上报
+     */
+    void Reset() {
+        visible_ = KRScrollIndexRange();
+        prefetch_ = KRScrollIndexRange();
+        predicted_stop_ = 0;
+        prefetch_lo_ = 0;
+        prefetch_hi_ = 0;
+    }
+
+ private:
+    std::vector<KRScrollItemExtent> items_;
+    std::vector<float> max_end_;
+    KRScrollIndexRange visible_;
+    KRScrollIndexRange prefetch_;
+    float predicted_stop_ = 0;
+    float prefetch_lo_ = 0;
+    float prefetch_hi_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRSCROLLVISIBLERANGETRACKER_H
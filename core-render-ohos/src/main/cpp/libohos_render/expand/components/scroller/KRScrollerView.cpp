@@ -53,6 +53,7 @@ constexpr char kPropNameShowScrollerIndicator[] = "showScrollerIndicator";
 constexpr char kPropNameNestedScroll[] = "nestedScroll";
 constexpr char kPropNameFlingEnable[] = "flingEnable";
 constexpr char kPropNameFlingSpeedLimit[] = "flingSpeedLimit";
+constexpr char kPropNamePrefetchDistance[] = "prefetchDistance";
 constexpr char kPropKeyNestedScrollForward[] = "forward";
 constexpr char kPropKeyNestedScrollBackward[] = "backward";
 
@@ -61,6 +62,8 @@ constexpr char kEventNameDragBegin[] = "dragBegin";
 constexpr char kEventNameWillDragEnd[] = "willDragEnd";
 constexpr char kEventNameDragEnd[] = "dragEnd";
 constexpr char kEventNameScrollEnd[] = "scrollEnd";
+constexpr char kEventNameVisibleRangeChanged[] = "visibleRangeChanged";
+constexpr char kEventNamePrefetchRange[] = "prefetchRange";
 constexpr char kEventKeyOffsetX[] = "offsetX";
 constexpr char kEventKeyOffsetY[] = "offsetY";
 constexpr char kEventKeyContentWidth[] = "contentWidth";
@@ -70,6 +73,14 @@ constexpr char kEventKeyViewHeight[] = "viewHeight";
 constexpr char kEventKeyIsDragging[] = "isDragging";
 constexpr char kEventKeyVelocityX[] = "velocityX";
 constexpr char kEventKeyVelocityY[] = "velocityY";
+constexpr char kEventKeyFirstIndex[] = "firstIndex";
+constexpr char kEventKeyLastIndex[] = "lastIndex";
+constexpr char kEventKeyFirstTag[] = "firstTag";
+constexpr char kEventKeyLastTag[] = "lastTag";
+constexpr char kEventKeyPrefetchStart[] = "start";
+constexpr char kEventKeyPrefetchEnd[] = "end";
+constexpr char kEventKeyVelocity[] = "velocity";
+constexpr char kEventKeyPredictedOffset[] = "predictedOffset";
 
 constexpr char kMethodNameContentOffset[] = "contentOffset";
 constexpr char kMethodNameContentInset[] = "contentInset";
@@ -208,6 +219,12 @@ bool KRScrollerView::SetProp(const std::string &prop_key, const KRAnyValue &prop
         didHanded = SetFlingEnable(prop_value->toBool());
     } else if (kuikly::util::isEqual(prop_key, kPropNameFlingSpeedLimit)) {
         didHanded = SetFlingSpeedLimit(prop_value);
+    } else if (kuikly::util::isEqual(prop_key, kEventNameVisibleRangeChanged)) {
+        didHanded = RegisterVisibleRangeChangedEvent(event_call_back);
+    } else if (kuikly::util::isEqual(prop_key, kEventNamePrefetchRange)) {
+        didHanded = RegisterPrefetchRangeEvent(event_call_back);
+    } else if (kuikly::util::isEqual(prop_key, kPropNamePrefetchDistance)) {
+        didHanded = SetPrefetchDistance(prop_value);
     }
     return didHanded;
 }
@@ -231,6 +248,9 @@ bool KRScrollerView::ResetProp(const std::string &prop_key) {
             if (IsFlingSpeedLimitApiAvailable()) {
                 kuikly::util::GetNodeApi()->resetAttribute(GetNode(), kScrollFlingSpeedLimitAttr);
             }
+        } else if (prop_key == kPropNamePrefetchDistance) {
+            didHanded = true;
+            prefetch_distance_ = -1;
         }
     }
     return didHanded;
@@ -277,6 +297,7 @@ void KRScrollerView::FireOnScrollEvent(ArkUI_NodeEvent *event) {
     last_fired_scroll_y_ = point.y;
     // 分发滚动事件
     DispatchDidScrollToObservers(point);
+    UpdateVisibleRange(point, GetEffectiveVelocity());
     if (!on_scroll_callback_) {
         return;
     }
@@ -319,9 +340,11 @@ void KRScrollerView::DidInsertSubRenderView(const std::shared_ptr<IKRRenderViewE
     }
 
     content_view_ = std::dynamic_pointer_cast<KRScrollerContentView>(sub_render_view);
+    visible_range_layout_version_ = kInvalidLayoutVersion;
 }
 
 void KRScrollerView::OnDestroy() {
+    EndScrollFrameSession();
     if (!content_view_) {
         return;
     }
@@ -365,6 +388,8 @@ bool KRScrollerView::SetScrollEnabled(const KRAnyValue &value) {
 
 bool KRScrollerView::SetScrollDirection(const KRAnyValue &value) {
     direction_row_ = value->toBool();
+    visible_range_tracker_.Reset();
+    visible_range_layout_version_ = kInvalidLayoutVersion;
     kuikly::util::SetArkUIScrollDirection(GetNode(), direction_row_);
     return true;
 }
@@ -418,6 +443,26 @@ bool KRScrollerView::RegisterWillDragEndEvent(const KRRenderCallback event_callb
     on_will_drag_end_callback_ = event_callback;
     return true;
 }
+
+bool KRScrollerView::RegisterVisibleRangeChangedEvent(const KRRenderCallback event_callback) {
+    RegisterEvent(NODE_SCROLL_EVENT_ON_SCROLL);
+    on_visible_range_changed_callback_ = event_callback;
+    // 新的监听需要收到一次当前区间
+    visible_range_tracker_.Reset();
+    return true;
+}
+
+bool KRScrollerView::RegisterPrefetchRangeEvent(const KRRenderCallback event_callback) {
+    RegisterEvent(NODE_SCROLL_EVENT_ON_SCROLL);
+    on_prefetch_range_callback_ = event_callback;
+    visible_range_tracker_.Reset();
+    return true;
+}
+
+bool KRScrollerView::SetPrefetchDistance(const KRAnyValue &value) {
+    prefetch_distance_ = value->toFloat();
+    return true;
+}
 /**
  *     NSArray<NSString *> *points = [params componentsSeparatedByString:@" "];
     BOOL animated = [points count] > 2 ? [points[2] boolValue] : NO;
@@ -584,6 +629,9 @@ void KRScrollerView::OnScrollStop(ArkUI_NodeEvent *event) {
         OnWillDragEnd(event);
     }
     FireEndScrollEvent(event);
+    // 停止后预取区间收敛为视口前后各 lookahead
+    UpdateVisibleRange(GetContentOffset(), KRPoint());
+    EndScrollFrameSession();
     if (auto handler = weak_super_touch_handler_.lock()) {
         handler->ClearNativeTouchConsumer(shared_from_this());
     }
@@ -598,6 +646,7 @@ void KRScrollerView::OnWillScroll(ArkUI_NodeEvent *event) {
     }
     if (IsIdeaStateToDraggingState(new_scroll_state) || IsFlingStateToDraggingState(new_scroll_state)) {
         is_dragging_ = true;
+        BeginScrollFrameSession();
         FireBeginDragEvent(event);
     } else if (is_dragging_ &&
         (IsDraggingStateToFlingState(new_scroll_state) || IsDraggingStateToIdeaState(new_scroll_state))) {
@@ -624,6 +673,30 @@ void KRScrollerView::OnWillDragEnd(ArkUI_NodeEvent *event) {
 
 void KRScrollerView::OnScrollStart(ArkUI_NodeEvent *event) {}
 
+void KRScrollerView::BeginScrollFrameSession() {
+    if (in_scroll_frame_session_) {  // fling 中再次拖拽仍属于同一次滚动会话
+        return;
+    }
+    if (auto root_view = GetRootView().lock()) {
+        if (auto performance_manager = root_view->GetPerformanceManager()) {
+            in_scroll_frame_session_ = true;
+            performance_manager->OnScrollBegin();
+        }
+    }
+}
+
+void KRScrollerView::EndScrollFrameSession() {
+    if (!in_scroll_frame_session_) {
+        return;
+    }
+    in_scroll_frame_session_ = false;
+    if (auto root_view = GetRootView().lock()) {
+        if (auto performance_manager = root_view->GetPerformanceManager()) {
+            performance_manager->OnScrollEnd();
+        }
+    }
+}
+
 void KRScrollerView::OnScrollReachStart(ArkUI_NodeEvent *event) {
     if (!limit_header_bounces_) {
         return;
@@ -668,6 +741,13 @@ std::shared_ptr<KRRenderValue> KRScrollerView::GetCommonScrollParams() {
     }
     map[kEventKeyIsDragging] = NewKRRenderValue(is_dragging_ ? 1 : 0);
 
+    auto velocity = GetEffectiveVelocity();
+    map[kEventKeyVelocityX] = NewKRRenderValue(velocity.x);
+    map[kEventKeyVelocityY] = NewKRRenderValue(velocity.y);
+    return NewKRRenderValue(std::move(map));
+}
+
+KRPoint KRScrollerView::GetEffectiveVelocity() {
     // 统一计算有效速度：基于最后位移的 stale 检测 + 最小阈值过滤
     auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::system_clock::now().time_since_epoch()).count();
@@ -687,9 +767,7 @@ std::shared_ptr<KRRenderValue> KRScrollerView::GetCommonScrollParams() {
         effective_vy = 0;
     }
 
-    map[kEventKeyVelocityX] = NewKRRenderValue(effective_vx);
-    map[kEventKeyVelocityY] = NewKRRenderValue(effective_vy);
-    return NewKRRenderValue(std::move(map));
+    return KRPoint{effective_vx, effective_vy};
 }
 
 void KRScrollerView::ApplyContentInsetWhenDragEnd() {
@@ -734,6 +812,61 @@ void KRScrollerView::DispatchDidScrollToObservers(KRPoint point) {
     }
 }
 
+static void PutRangeParams(KRRenderValueMap &map, const KRScrollVisibleRangeTracker &tracker,
+                           const KRScrollIndexRange &range) {
+    map[kEventKeyFirstIndex] = NewKRRenderValue(range.first);
+    map[kEventKeyLastIndex] = NewKRRenderValue(range.last);
+    map[kEventKeyFirstTag] = NewKRRenderValue(range.IsEmpty() ? -1 : tracker.ItemAt(range.first).tag);
+    map[kEventKeyLastTag] = NewKRRenderValue(range.IsEmpty() ? -1 : tracker.ItemAt(range.last).tag);
+}
+
+void KRScrollerView::CollectVisibleRangeItems() {
+    std::vector<KRScrollItemExtent> items;
+    if (content_view_) {
+        items.reserve(content_view_->sub_render_views_.size());
+        for (const auto &sub_view : content_view_->sub_render_views_) {
+            const auto &frame = sub_view->GetFrame();
+            if (direction_row_) {
+                items.push_back({frame.x, frame.x + frame.width, sub_view->GetViewTag()});
+            } else {
+                items.push_back({frame.y, frame.y + frame.height, sub_view->GetViewTag()});
+            }
+        }
+    }
+    visible_range_tracker_.SetItems(std::move(items));
+}
+
+void KRScrollerView::UpdateVisibleRange(KRPoint point, KRPoint velocity) {
+    if (!on_visible_range_changed_callback_ && !on_prefetch_range_callback_) {
+        return;
+    }
+    // content view 的子节点帧或列表变化时才重建排序索引（O(n log n)），纯滚动事件只做 O(log n) 查询
+    auto layout_version = content_view_ ? content_view_->ChildrenLayoutVersion() : 0;
+    if (layout_version != visible_range_layout_version_) {
+        CollectVisibleRangeItems();
+        visible_range_layout_version_ = layout_version;
+    }
+    const auto &frame = GetFrame();
+    float main_velocity = direction_row_ ? velocity.x : velocity.y;
+    auto changed = visible_range_tracker_.Update(direction_row_ ? point.x : point.y,
+                                                 direction_row_ ? frame.width : frame.height, main_velocity,
+                                                 prefetch_distance_);
+    if ((changed & KRScrollVisibleRangeTracker::kVisibleChanged) && on_visible_range_changed_callback_) {
+        KRRenderValueMap map;
+        PutRangeParams(map, visible_range_tracker_, visible_range_tracker_.VisibleRange());
+        on_visible_range_changed_callback_(NewKRRenderValue(std::move(map)));
+    }
+    if ((changed & KRScrollVisibleRangeTracker::kPrefetchChanged) && on_prefetch_range_callback_) {
+        KRRenderValueMap map;
+        PutRangeParams(map, visible_range_tracker_, visible_range_tracker_.PrefetchRange());
+        map[kEventKeyPrefetchStart] = NewKRRenderValue(visible_range_tracker_.PrefetchStart());
+        map[kEventKeyPrefetchEnd] = NewKRRenderValue(visible_range_tracker_.PrefetchEnd());
+        map[kEventKeyVelocity] = NewKRRenderValue(main_velocity);
+        map[kEventKeyPredictedOffset] = NewKRRenderValue(visible_range_tracker_.PredictedStop());
+        on_prefetch_range_callback_(NewKRRenderValue(std::move(map)));
+    }
+}
+
 KRPoint KRScrollerView::GetContentOffset() {
     return kuikly::util::GetArkUIScrollContentOffset(GetNode());
 }
@@ -796,6 +929,8 @@ bool KRScrollerView::SetFlingSpeedLimit(const KRAnyValue &value) {
 
 void KRScrollerView::TryApplyPendingFireOnScroll() {
     FireOnScrollEvent(nullptr);
+    // 偏移未变时滚动事件会被去重，但内容区重新布局后区间仍可能变化
+    UpdateVisibleRange(GetContentOffset(), GetEffectiveVelocity());
 }
 
 // Clear transient native state for Compose DSL reuse (not the native reuse pool).
@@ -818,6 +953,8 @@ void KRScrollerView::PrepareForComposeReuse() {
     last_move_time_ = 0;
     velocity_x_ = 0;
     velocity_y_ = 0;
+    // Re-report visible/prefetch ranges for the restored content
+    visible_range_tracker_.Reset();
 }
 
 void KRScrollerView::AbortContentOffsetAnimate() {
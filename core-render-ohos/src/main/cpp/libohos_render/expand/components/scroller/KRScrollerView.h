@@ -18,6 +18,7 @@
 
 #include <unordered_set>
 #include "KRScrollerContentInset.h"
+#include "KRScrollVisibleRangeTracker.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
 #include "libohos_render/foundation/KRPoint.h"
 #include "libohos_render/foundation/KRRect.h"
@@ -109,6 +110,9 @@ class KRScrollerView : public IKRRenderViewExport {
     bool RegisterOnDragEndEvent(const KRRenderCallback event_callback);
     bool RegisterOnScrollEndEvent(const KRRenderCallback event_callback);
     bool RegisterWillDragEndEvent(const KRRenderCallback event_callback);
+    bool RegisterVisibleRangeChangedEvent(const KRRenderCallback event_callback);
+    bool RegisterPrefetchRangeEvent(const KRRenderCallback event_callback);
+    bool SetPrefetchDistance(const KRAnyValue &value);
     void FireOnScrollEvent(ArkUI_NodeEvent *event);
     void FireBeginDragEvent(ArkUI_NodeEvent *event);
     void FireEndDragEvent(ArkUI_NodeEvent *event);
@@ -135,6 +139,11 @@ class KRScrollerView : public IKRRenderViewExport {
     void InnerSetBouncesEnable(bool enable);
     void AdjustHeaderBouncesEnableWhenWillScroll(ArkUI_NodeEvent *event);
     void DispatchDidScrollToObservers(KRPoint point);
+    KRPoint GetEffectiveVelocity();
+    void UpdateVisibleRange(KRPoint point, KRPoint velocity);
+    void CollectVisibleRangeItems();
+    void BeginScrollFrameSession();
+    void EndScrollFrameSession();
     bool SetFlingEnable(bool enable);
     bool SetFlingSpeedLimit(const KRAnyValue &value);
     KRPoint MaxContentOffsetInContentInset(const std::shared_ptr<KRScrollerContentInset> &content_inset);
@@ -145,6 +154,8 @@ class KRScrollerView : public IKRRenderViewExport {
     KRRenderCallback on_drag_end_callback_ = nullptr;
     KRRenderCallback on_scroll_end_callback_ = nullptr;
     KRRenderCallback on_will_drag_end_callback_ = nullptr;
+    KRRenderCallback on_visible_range_changed_callback_ = nullptr;
+    KRRenderCallback on_prefetch_range_callback_ = nullptr;
     std::shared_ptr<KRScrollerContentView> content_view_;
     bool bounces_enabled_ = true;
     bool limit_header_bounces_ = false;
@@ -176,6 +187,11 @@ class KRScrollerView : public IKRRenderViewExport {
     float last_fired_scroll_x_ = 0;
     float last_fired_scroll_y_ = 0;
     bool direction_row_ = false;
+    bool in_scroll_frame_session_ = false;  // 是否已向帧监控上报滚动开始
+    KRScrollVisibleRangeTracker visible_range_tracker_;
+    static constexpr uint64_t kInvalidLayoutVersion = UINT64_MAX;
+    uint64_t visible_range_layout_version_ = kInvalidLayoutVersion;  // 上次重建索引时 content view 的子节点布局版本号
+    float prefetch_distance_ = -1;  // 预取距离，< 0 表示使用默认的一屏
 };
 
 #endif  // CORE_RENDER_OHOS_KRSCROLLERVIEW_H
@@ -18,8 +18,10 @@
 #include <algorithm>
 #include "libohos_render/expand/components/richtext/KRRichTextView.h"
 #include "libohos_render/expand/components/scroller/KRScrollerView.h"
+#include "libohos_render/expand/events/KRMoveEventHistory.h"
 #include "libohos_render/foundation/KRBorderRadiuses.h"
 #include "libohos_render/foundation/KRConfig.h"
+#include "libohos_render/foundation/thread/KRVSyncScheduler.h"
 #include "libohos_render/foundation/type/KRRenderValue.h"
 #include "libohos_render/manager/KRSnapshotManager.h"
 #include "libohos_render/utils/KRJSONObject.h"
@@ -61,6 +63,7 @@ constexpr char kPropNamePreventTouch[] = "preventTouch";
 constexpr char kPropNameSuperTouch[] = "superTouch";
 constexpr char kPropNameHitTestModeOhos[] = "hit-test-ohos";
 constexpr char kPropNameStopPropagation[] = "stop-propagation-ohos";
+constexpr char kPropNameCoalesceTouchMove[] = "coalesceTouchMove";
 
 constexpr char kOhosHitTestModeDefault[] = "default";
 constexpr char kOhosHitTestModeBlock[] = "block";
@@ -134,6 +137,9 @@ bool KRView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
     } else if (kuikly::util::isEqual(prop_key, kPropNameStopPropagation)) {
         stop_propagation_ = prop_value->toBool();
         didHand = true;
+    } else if (kuikly::util::isEqual(prop_key, kPropNameCoalesceTouchMove)) {
+        SetCoalesceTouchMove(prop_value->toBool());
+        didHand = true;
     } else if (kuikly::util::isEqual(prop_key, kTextSelectable)) {
         selectable_option_ = static_cast<SelectableOption>(prop_value->toInt());
         didHand = true;
@@ -403,6 +409,9 @@ bool KRView::ResetProp(const std::string &prop_key) {
         didHande = true;
     } else if (kuikly::util::isEqual(prop_key, kPropNameTouchMove)) {
         touch_move_callback_ = nullptr;
+        if (touch_move_coalescer_) {
+            touch_move_coalescer_->Clear();
+        }
         didHande = true;
     } else if (kuikly::util::isEqual(prop_key, kPropNameTouchUp)) {
         touch_up_callback_ = nullptr;
@@ -420,6 +429,9 @@ bool KRView::ResetProp(const std::string &prop_key) {
     } else if (kuikly::util::isEqual(prop_key, kPropNameStopPropagation)) {
         stop_propagation_ = false;
         didHande = true;
+    } else if (kuikly::util::isEqual(prop_key, kPropNameCoalesceTouchMove)) {
+        SetCoalesceTouchMove(false);
+        didHande = true;
     } else if (kuikly::util::isEqual(prop_key, kTextSelectable)) {
         selectable_option_ = ENABLE;
         didHande = true;
@@ -452,6 +464,10 @@ void KRView::ProcessTouchEvent(ArkUI_NodeEvent *event) {
             return;
         }
     }
+    if (action != UI_TOUCH_EVENT_ACTION_MOVE && touch_move_coalescer_) {
+        // down/up/cancel 不合并，投递前先把已合并的 move 发出去，保证事件顺序
+        touch_move_coalescer_->Flush();
+    }
     bool handled = false;
     if (action == UI_TOUCH_EVENT_ACTION_DOWN) {
         handled = TryFireOnTouchDownEvent(input_event);
@@ -537,10 +553,54 @@ bool KRView::TryFireOnTouchMoveEvent(ArkUI_UIInputEvent *input_event) {
     if (!touch_move_callback_) {
         return false;
     }
+    KRTouchEventSample sample;
+    if (touch_move_coalescer_ && CaptureTouchEventSample(input_event, sample)) {
+        CoalesceTouchMoveEvent(std::move(sample));
+        return true;
+    }
     touch_move_callback_(GenerateBaseParamsWithTouch(input_event, kPropNameTouchMove));
     return true;
 }
 
+void KRView::SetCoalesceTouchMove(bool enable) {
+    if (!enable) {
+        if (touch_move_coalescer_) {
+            touch_move_coalescer_->Flush();
+            touch_move_coalescer_ = nullptr;
+        }
+        return;
+    }
+    if (touch_move_coalescer_) {
+        return;
+    }
+    touch_move_coalescer_ = std::make_unique<KRMoveEventCoalescer<KRTouchEventSample>>(
+        [this](KRTouchEventSample &sample, const std::vector<KRCoalescedMoveSample> &history) {
+            if (touch_move_callback_) {
+                touch_move_callback_(GenerateBaseParamsWithTouch(sample, kPropNameTouchMove, &history));
+            }
+        });
+}
+
+void KRView::CoalesceTouchMoveEvent(KRTouchEventSample &&sample) {
+    // 指针集合标识：指针数 + 各指针 id，多指按下/抬起时集合变化，不能与之前的 move 合并
+    uint64_t pointer_key = sample.pointers.size();
+    for (const auto &pointer : sample.pointers) {
+        pointer_key = pointer_key * 1000003 ^ static_cast<uint32_t>(pointer.pointer_id + 1);
+    }
+    const auto &first_pointer = sample.pointers[0];
+    KRCoalescedMoveSample move_sample{first_pointer.point.x, first_pointer.point.y, sample.timestamp_ms};
+    if (!touch_move_coalescer_->Push(pointer_key, move_sample, std::move(sample))) {
+        return;
+    }
+    std::weak_ptr<IKRRenderViewExport> weak_self = shared_from_this();
+    KRVSyncScheduler::GetInstance().PostFrameCallback([weak_self](int64_t frame_time_nanos) {
+        auto self = std::static_pointer_cast<KRView>(weak_self.lock());
+        if (self && self->touch_move_coalescer_) {
+            self->touch_move_coalescer_->OnFrame();
+        }
+    });
+}
+
 bool KRView::TryFireOnTouchUpEvent(ArkUI_UIInputEvent *input_event) {
     if (!touch_up_callback_) {
         return false;
@@ -579,13 +639,38 @@ bool KRView::TryFireSuperTouchCancelEvent(ArkUI_UIInputEvent *input_event) {
     return canceled;
 }
 
-KRAnyValue KRView::GenerateBaseParamsWithTouch(ArkUI_UIInputEvent *input_event, const std::string &action) {
+bool KRView::CaptureTouchEventSample(ArkUI_UIInputEvent *input_event, KRTouchEventSample &sample) {
     if (!input_event) {
-        return KREmptyValue();
+        return false;
     }
 
     auto pointer_count = kuikly::util::GetArkUIInputEventPointerCount(input_event);
     if (pointer_count <= 0) {
+        return false;
+    }
+
+    sample.pointers.resize(pointer_count);
+    for (int i = 0; i < pointer_count; i++) {
+        auto &pointer = sample.pointers[i];
+        pointer.point = kuikly::util::GetArkUIInputEventPoint(input_event, i);
+        pointer.window_point = kuikly::util::GetArkUIInputEventWindowPoint(input_event, i);
+        pointer.pointer_id = OH_ArkUI_PointerEvent_GetPointerId(input_event, i);
+    }
+    sample.timestamp_ms = kuikly::util::GetArkUIInputEventTime(input_event) / NS_PER_MS;
+    return true;
+}
+
+KRAnyValue KRView::GenerateBaseParamsWithTouch(ArkUI_UIInputEvent *input_event, const std::string &action) {
+    KRTouchEventSample sample;
+    if (!CaptureTouchEventSample(input_event, sample)) {
+        return KREmptyValue();
+    }
+    return GenerateBaseParamsWithTouch(sample, action);
+}
+
+KRAnyValue KRView::GenerateBaseParamsWithTouch(const KRTouchEventSample &sample, const std::string &action,
+                                               const std::vector<KRCoalescedMoveSample> *history) {
+    if (sample.pointers.empty()) {
         return KREmptyValue();
     }
 
@@ -596,29 +681,26 @@ KRAnyValue KRView::GenerateBaseParamsWithTouch(ArkUI_UIInputEvent *input_event,
     }
 
     KRRenderValueArray touches;
-    for (int i = 0; i < pointer_count; i++) {
-        auto point = kuikly::util::GetArkUIInputEventPoint(input_event, i);
-        auto window_point = kuikly::util::GetArkUIInputEventWindowPoint(input_event, i);
-
-        float container_relative_x = window_point.x - container_position.x;
-        float container_relative_y = window_point.y - container_position.y;
+    for (const auto &pointer : sample.pointers) {
+        float container_relative_x = pointer.window_point.x - container_position.x;
+        float container_relative_y = pointer.window_point.y - container_position.y;
 
         KRRenderValueMap touch_map;
-        touch_map["x"] = NewKRRenderValue(point.x);
-        touch_map["y"] = NewKRRenderValue(point.y);
+        touch_map["x"] = NewKRRenderValue(pointer.point.x);
+        touch_map["y"] = NewKRRenderValue(pointer.point.y);
         touch_map["pageX"] = NewKRRenderValue(container_relative_x);
         touch_map["pageY"] = NewKRRenderValue(container_relative_y);
-        touch_map["pointerId"] = NewKRRenderValue(OH_ArkUI_PointerEvent_GetPointerId(input_event, i));
+        touch_map["pointerId"] = NewKRRenderValue(pointer.pointer_id);
         touches.push_back(NewKRRenderValue(touch_map));
     }
     auto first_touch = touches[0]->toMap();
     first_touch["touches"] = NewKRRenderValue(touches);
     first_touch["action"] = NewKRRenderValue(action);
-    auto event_time_millis = kuikly::util::GetArkUIInputEventTime(input_event) / NS_PER_MS;
-    first_touch["timestamp"] = NewKRRenderValue(event_time_millis);
+    first_touch["timestamp"] = NewKRRenderValue(sample.timestamp_ms);
     if (super_touch_handler_) {
         first_touch["consumed"] = NewKRRenderValue(super_touch_handler_->IsCanceled() ? 1 : 0);
     }
+    KRAppendHistoricalPoints(first_touch, history);
     return NewKRRenderValue(first_touch);
 }
 
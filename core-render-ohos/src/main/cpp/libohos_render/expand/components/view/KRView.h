@@ -18,6 +18,7 @@
 
 #include "libohos_render/expand/components/richtext/KRRichTextView.h"
 #include "libohos_render/expand/components/view/SuperTouchHandler.h"
+#include "libohos_render/expand/events/KRMoveEventCoalescer.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
 #include "libohos_render/foundation/KRPoint.h"
 #include "libohos_render/view/IKRRenderView.h"
@@ -25,6 +26,20 @@
 class KRViewInternalScrollViewObserver;
 class KRRenderView;
 
+/**
+ * 触摸事件原始数据，从 ArkUI_UIInputEvent 拷贝而来，便于延迟到 VSync 再构造参数
+ */
+struct KRTouchPointerSample {
+    KRPoint point;
+    KRPoint window_point;
+    int32_t pointer_id = 0;
+};
+
+struct KRTouchEventSample {
+    std::vector<KRTouchPointerSample> pointers;
+    int64_t timestamp_ms = 0;
+};
+
 class KRView : public IKRRenderViewExport {
  public:
     enum SelectableOption {
@@ -66,6 +81,11 @@ class KRView : public IKRRenderViewExport {
     bool TryFireOnTouchCancelEvent(ArkUI_UIInputEvent *input_event);
     bool TryFireSuperTouchCancelEvent(ArkUI_UIInputEvent *input_event);
     KRAnyValue GenerateBaseParamsWithTouch(ArkUI_UIInputEvent *input_event, const std::string &action);
+    KRAnyValue GenerateBaseParamsWithTouch(const KRTouchEventSample &sample, const std::string &action,
+                                           const std::vector<KRCoalescedMoveSample> *history = nullptr);
+    bool CaptureTouchEventSample(ArkUI_UIInputEvent *input_event, KRTouchEventSample &sample);
+    void SetCoalesceTouchMove(bool enable);
+    void CoalesceTouchMoveEvent(KRTouchEventSample &&sample);
     bool HasTouchEvent();
     void UpdateHitTestMode(bool shouldUseTarget);
     void EnsureSuperTouchType();
@@ -105,6 +125,8 @@ class KRView : public IKRRenderViewExport {
     KRRenderCallback touch_down_callback_ = nullptr;
     KRRenderCallback touch_move_callback_ = nullptr;
     KRRenderCallback touch_up_callback_ = nullptr;
+    // 开启 coalesceTouchMove 后，同一帧内的 touchMove 合并为一次投递
+    std::unique_ptr<KRMoveEventCoalescer<KRTouchEventSample>> touch_move_coalescer_;
 
     bool register_touch_event_ = false;
     short using_target_hit_test_mode = -1;
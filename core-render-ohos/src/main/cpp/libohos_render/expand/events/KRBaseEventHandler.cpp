@@ -17,7 +17,9 @@
 
 #include <arkui/native_node.h>
 #include "libohos_render/expand/events/KREventDispatchCenter.h"
+#include "libohos_render/expand/events/KRMoveEventHistory.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
+#include "libohos_render/foundation/thread/KRVSyncScheduler.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/KRStringUtil.h"
 
@@ -27,6 +29,7 @@ constexpr char kLongPressEventName[] = "longPress";
 constexpr char kPanEventName[] = "pan";
 constexpr char kPinchEventName[] = "pinch";
 constexpr char kCaptureAttrName[] = "capture";
+constexpr char kCoalescePanAttrName[] = "coalescePan";
 
 constexpr char kParamKeyX[] = "x";
 constexpr char kParamKeyY[] = "y";
@@ -37,6 +40,8 @@ constexpr char kStartState[] = "start";
 constexpr char kEndState[] = "end";
 constexpr char kParamKeyScale[] = "scale";
 constexpr char kParamKeyIsCancel[] = "isCancel";
+constexpr char kMoveState[] = "move";
+constexpr int64_t kNanosPerMilli = 1000000;
 
 KRBaseEventHandler::KRBaseEventHandler(const std::shared_ptr<KRConfig> &kr_config) : kr_config_(kr_config) {}
 
@@ -57,6 +62,9 @@ bool KRBaseEventHandler::SetProp(const std::shared_ptr<IKRRenderViewExport> &vie
         }
     } else if (kuikly::util::isEqual(prop_key, kCaptureAttrName)) {
         didHanded = SetCaptureRule(view_export, prop_value->toString());
+    } else if (kuikly::util::isEqual(prop_key, kCoalescePanAttrName)) {
+        SetCoalescePan(prop_value->toBool());
+        didHanded = true;
     }
     return didHanded;
 }
@@ -99,6 +107,12 @@ bool KRBaseEventHandler::ResetProp(const std::string &prop_key) {
         didHanded = true;
     } else if (kuikly::util::isEqual(prop_key, kPanEventName)) {
         pan_event_callback_ = nullptr;
+        if (pan_move_coalescer_) {
+            pan_move_coalescer_->Clear();
+        }
+        didHanded = true;
+    } else if (kuikly::util::isEqual(prop_key, kCoalescePanAttrName)) {
+        SetCoalescePan(false);
         didHanded = true;
     } else if (kuikly::util::isEqual(prop_key, kPinchEventName)) {
         pinch_event_callback_ = nullptr;
@@ -117,6 +131,7 @@ void KRBaseEventHandler::OnDestroy() {
     long_press_callback_ = nullptr;
     pan_event_callback_ = nullptr;
     pinch_event_callback_ = nullptr;
+    pan_move_coalescer_ = nullptr;
 }
 
 bool KRBaseEventHandler::RegisterOnClick(const std::shared_ptr<IKRRenderViewExport> &view_export,
@@ -200,14 +215,65 @@ bool KRBaseEventHandler::FireOnPanCallback(const std::shared_ptr<KRGestureEventD
         return false;
     }
 
+    auto gesture_event = gesture_event_data->gesture_event_;
+    if (pan_move_coalescer_) {
+        if (kuikly::util::GetArkUIGestureActionType(gesture_event) == GESTURE_EVENT_ACTION_UPDATE) {
+            auto input_event = OH_ArkUI_GestureEvent_GetRawInputEvent(gesture_event);
+            KRCoalescedMoveSample move_sample{kr_config_->Px2Vp(gesture_event_data->gesture_event_point_.x),
+                                              kr_config_->Px2Vp(gesture_event_data->gesture_event_point_.y),
+                                              kuikly::util::GetArkUIInputEventTime(input_event) / kNanosPerMilli};
+            auto pointer_key = static_cast<uint64_t>(kuikly::util::GetArkUIInputEventPointerCount(input_event));
+            KRPanMoveSample sample{gesture_event_data->gesture_event_point_,
+                                   gesture_event_data->gesture_event_window_point_};
+            if (pan_move_coalescer_->Push(pointer_key, move_sample, std::move(sample))) {
+                std::weak_ptr<KRBaseEventHandler> weak_self = shared_from_this();
+                KRVSyncScheduler::GetInstance().PostFrameCallback([weak_self](int64_t frame_time_nanos) {
+                    auto self = weak_self.lock();
+                    if (self && self->pan_move_coalescer_) {
+                        self->pan_move_coalescer_->OnFrame();
+                    }
+                });
+            }
+            return true;
+        }
+        // start/end 不合并，投递前先把已合并的 move 发出去，保证事件顺序
+        pan_move_coalescer_->Flush();
+    }
+    FirePanEvent(gesture_event_data->gesture_event_point_, gesture_event_data->gesture_event_window_point_,
+                 kuikly::util::GetArkUIGestureActionState(gesture_event), nullptr);
+    return true;
+}
+
+void KRBaseEventHandler::FirePanEvent(const KRPoint &point, const KRPoint &window_point, const std::string &state,
+                                      const std::vector<KRCoalescedMoveSample> *history) {
+    if (!pan_event_callback_) {
+        return;
+    }
     KRRenderValueMap params;
-    params[kParamKeyX] = NewKRRenderValue(kr_config_->Px2Vp(gesture_event_data->gesture_event_point_.x));
-    params[kParamKeyY] = NewKRRenderValue(kr_config_->Px2Vp(gesture_event_data->gesture_event_point_.y));
-    params[kParamKeyPageX] = NewKRRenderValue(kr_config_->Px2Vp(gesture_event_data->gesture_event_window_point_.x));
-    params[kParamKeyPageY] = NewKRRenderValue(kr_config_->Px2Vp(gesture_event_data->gesture_event_window_point_.y));
-    params[kParamKeyState] = NewKRRenderValue(kuikly::util::GetArkUIGestureActionState(gesture_event_data->gesture_event_));
+    params[kParamKeyX] = NewKRRenderValue(kr_config_->Px2Vp(point.x));
+    params[kParamKeyY] = NewKRRenderValue(kr_config_->Px2Vp(point.y));
+    params[kParamKeyPageX] = NewKRRenderValue(kr_config_->Px2Vp(window_point.x));
+    params[kParamKeyPageY] = NewKRRenderValue(kr_config_->Px2Vp(window_point.y));
+    params[kParamKeyState] = NewKRRenderValue(state);
+    KRAppendHistoricalPoints(params, history);
     pan_event_callback_(NewKRRenderValue(params));
-    return true;
+}
+
+void KRBaseEventHandler::SetCoalescePan(bool enable) {
+    if (!enable) {
+        if (pan_move_coalescer_) {
+            pan_move_coalescer_->Flush();
+            pan_move_coalescer_ = nullptr;
+        }
+        return;
+    }
+    if (pan_move_coalescer_) {
+        return;
+    }
+    pan_move_coalescer_ = std::make_unique<KRMoveEventCoalescer<KRPanMoveSample>>(
+        [this](KRPanMoveSample &sample, const std::vector<KRCoalescedMoveSample> &history) {
+            FirePanEvent(sample.point, sample.window_point, kMoveState, &history);
+        });
 }
 
 bool KRBaseEventHandler::RegisterOnPinch(const std::shared_ptr<IKRRenderViewExport> &view_export,
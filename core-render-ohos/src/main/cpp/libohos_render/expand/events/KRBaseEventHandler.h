@@ -19,6 +19,7 @@
 #include <arkui/native_node.h>
 #include <string>
 #include "gesture/KRGestueEventType.h"
+#include "libohos_render/expand/events/KRMoveEventCoalescer.h"
 #include "libohos_render/foundation/KRCommon.h"
 #include "libohos_render/utils/KREventUtil.h"
 #include "libohos_render/view/IKRRenderView.h"
@@ -59,6 +60,9 @@ class KRBaseEventHandler : public std::enable_shared_from_this<KRBaseEventHandle
 
     bool RegisterOnPan(const std::shared_ptr<IKRRenderViewExport> &view_export, const KRRenderCallback &event_callback);
     bool FireOnPanCallback(const std::shared_ptr<KRGestureEventData> &gesture_event_data);
+    void FirePanEvent(const KRPoint &point, const KRPoint &window_point, const std::string &state,
+                      const std::vector<KRCoalescedMoveSample> *history);
+    void SetCoalescePan(bool enable);
 
     bool RegisterOnPinch(const std::shared_ptr<IKRRenderViewExport> &view_export,
                          const KRRenderCallback &event_callback);
@@ -74,6 +78,13 @@ class KRBaseEventHandler : public std::enable_shared_from_this<KRBaseEventHandle
     std::shared_ptr<KRConfig> kr_config_;
     bool has_capture_rule_ = false;
     bool is_long_press_happening = false;
+
+    // 开启 coalescePan 后，同一帧内 pan 的 move 状态合并为一次投递
+    struct KRPanMoveSample {
+        KRPoint point;
+        KRPoint window_point;
+    };
+    std::unique_ptr<KRMoveEventCoalescer<KRPanMoveSample>> pan_move_coalescer_;
 };
 
 class KRArkTSBaseEventHandler : public KRBaseEventHandler {
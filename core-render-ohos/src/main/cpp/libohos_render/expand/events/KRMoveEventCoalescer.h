@@ -0,0 +1,125 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRMOVEEVENTCOALESCER_H
+#define CORE_RENDER_OHOS_KRMOVEEVENTCOALESCER_H
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * 被合并掉的历史 move 采样点（主指针），供 Kotlin 侧计算速度
+ */
+struct KRCoalescedMoveSample {
+    float x = 0;
+    float y = 0;
+    int64_t timestamp_ms = 0;
+};
+
+/**
+ * move 事件合并器（不依赖 OHOS 运行时，可在 host 上单测）。
+ *
+ * 规则：
+ *   1. 连续的、指针集合相同的 move 事件合并为一次投递，只保留最后一次的完整数据，
+ *      之前的主指针位置作为历史采样点一并投递；
+ *   2. 指针集合变化（多指按下/抬起其中一指）时，先投递已合并的事件再开始新一轮合并；
+ *   3. down/up/cancel 等不可合并事件由调用方在投递前先调用 Flush，保证事件顺序不变。
+ *
+ * Payload 为调用方自定义的原始事件数据，合并期间不做任何参数转换，只在最终投递时构造一次参数。
+ */
+template <typename Payload>
+class KRMoveEventCoalescer {
+ public:
+    using Deliver = std::function<void(Payload &payload, const std::vector<KRCoalescedMoveSample> &history)>;
+
+    static constexpr size_t kMaxHistorySamples = 64;
+
+    explicit KRMoveEventCoalescer(Deliver deliver) : deliver_(std::move(deliver)) {}
+
+    /**
+     * 合入一个 move 事件
+     * @param pointer_key 指针集合标识
+     * @param sample 主指针采样点
+     * @param payload 原始事件数据
+     * @return true 表示本帧尚未申请刷新，调用方需安排一次 OnFrame
+     */
+    bool Push(uint64_t pointer_key, const KRCoalescedMoveSample &sample, Payload &&payload) {
+        if (has_pending_ && pointer_key != pending_key_) {
+            Flush();
+        }
+        if (has_pending_) {
+            if (history_.size() >= kMaxHistorySamples) {
+                history_.erase(history_.begin());
+            }
+            history_.push_back(pending_sample_);
+        }
+        pending_key_ = pointer_key;
+        pending_sample_ = sample;
+        pending_payload_ = std::move(payload);
+        has_pending_ = true;
+        if (frame_requested_) {
+            return false;
+        }
+        frame_requested_ = true;
+        return true;
+    }
+
+    /**
+     * 立即投递已合并的事件（若有）
+     */
+    void Flush() {
+        if (!has_pending_) {
+            return;
+        }
+        has_pending_ = false;
+        Payload payload = std::move(pending_payload_);
+        std::vector<KRCoalescedMoveSample> history;
+        history.swap(history_);
+        deliver_(payload, history);
+    }
+
+    /**
+     * 帧刷新时机（VSync）到来
+     */
+    void OnFrame() {
+        frame_requested_ = false;
+        Flush();
+    }
+
+    /**
+     * 丢弃未投递的事件（如视图复用/销毁）
+     */
+    void Clear() {
+        has_pending_ = false;
+        history_.clear();
+    }
+
+    bool HasPending() const {
+        return has_pending_;
+    }
+
+ private:
+    Deliver deliver_;
+    bool has_pending_ = false;
+    bool frame_requested_ = false;
+    uint64_t pending_key_ = 0;
+    KRCoalescedMoveSample pending_sample_;
+    Payload pending_payload_{};
+    std::vector<KRCoalescedMoveSample> history_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRMOVEEVENTCOALESCER_H
@@ -0,0 +1,47 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRMOVEEVENTHISTORY_H
+#define CORE_RENDER_OHOS_KRMOVEEVENTHISTORY_H
+
+#include <vector>
+#include "libohos_render/expand/events/KRMoveEventCoalescer.h"
+#include "libohos_render/foundation/KRCommon.h"
+
+/**
+ * 事件参数中被合并掉的历史采样点的 key（touchMove 与 pan 共用）
+ */
+constexpr char kKRParamKeyHistoricalPoints[] = "historicalPoints";
+
+/**
+ * 把被合并掉的历史采样点按 [x, y, timestamp] 平铺写入事件参数，没有历史点时不写
+ * @param params 事件参数
+ * @param history 合并器投递的历史采样点，可为空
+ */
+inline void KRAppendHistoricalPoints(KRRenderValueMap &params, const std::vector<KRCoalescedMoveSample> *history) {
+    if (history == nullptr || history->empty()) {
+        return;
+    }
+    KRRenderValueArray historical_points;
+    historical_points.reserve(history->size() * 3);
+    for (const auto &sample : *history) {
+        historical_points.push_back(NewKRRenderValue(sample.x));
+        historical_points.push_back(NewKRRenderValue(sample.y));
+        historical_points.push_back(NewKRRenderValue(sample.timestamp_ms));
+    }
+    params[kKRParamKeyHistoricalPoints] = NewKRRenderValue(historical_points);
+}
+
+#endif  // CORE_RENDER_OHOS_KRMOVEEVENTHISTORY_H
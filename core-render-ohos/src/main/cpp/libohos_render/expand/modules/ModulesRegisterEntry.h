@@ -16,6 +16,8 @@
 #ifndef CORE_RENDER_OHOS_MODULESREGISTERENTRY_H
 #define CORE_RENDER_OHOS_MODULESREGISTERENTRY_H
 
+#include <iterator>
+
 #include "libohos_render/expand/modules/back_press/KRBackPressModule.h"
 #include "libohos_render/expand/modules/cache/KRMemoryCacheModule.h"
 #include "libohos_render/expand/modules/calendar/KRCalendarModule.h"
@@ -29,49 +31,47 @@
 #include "libohos_render/expand/modules/preferences/KROhSharedPreferencesModule.h"
 #include "libohos_render/expand/modules/file/KRFileModule.h"
 #include "libohos_render/export/IKRRenderModuleExport.h"
+#include "libohos_render/foundation/KRPerfectHash.h"
 
 #endif  // CORE_RENDER_OHOS_MODULESREGISTERENTRY_H
 
+template <typename T>
+static std::shared_ptr<IKRRenderModuleExport> MakeBuiltinModule() {
+    return std::make_shared<T>();
+}
+
 /**
- * 内置Module均在此注册生成实例闭包
+ * 内置Module表，编译期生成完美哈希索引，启动时无需构造任何创建闭包
  */
-static void ModulesRegisterEntry() {
-    // 注册通用转发调用ArkTS层 Module
-    IKRRenderModuleExport::RegisterForwardArkTSModuleCreator([] { return std::make_shared<KRForwardArkTSModule>(); });
-    IKRRenderModuleExport::RegisterModuleCreator(kMemoryCacheModuleName,
-                                                 [] { return std::make_shared<KRMemoryCacheModule>(); });
-    IKRRenderModuleExport::RegisterModuleCreator(kLogModuleName, [] { return std::make_shared<KRLogModule>(); });
-
-    IKRRenderModuleExport::RegisterModuleCreator(kNetworkModuleName,
-                                                 [] { return std::make_shared<KRNetworkModule>(); });
-
-    IKRRenderModuleExport::RegisterModuleCreator(kuikly::expand::KRSharedPreferencesModule::MODULE_NAME, [] {
-        return std::make_shared<kuikly::expand::KRSharedPreferencesModule>();
-    });
+static constexpr KRBuiltinModuleCreator kBuiltinModuleCreators[] = {
+    {kMemoryCacheModuleName, MakeBuiltinModule<KRMemoryCacheModule>},
+    {kLogModuleName, MakeBuiltinModule<KRLogModule>},
+    {kNetworkModuleName, MakeBuiltinModule<KRNetworkModule>},
+    {kuikly::expand::KRSharedPreferencesModule::MODULE_NAME,
+     MakeBuiltinModule<kuikly::expand::KRSharedPreferencesModule>},
+    {kuikly::module::KRCodecModule::MODULE_NAME, MakeBuiltinModule<kuikly::module::KRCodecModule>},
+    {kuikly::module::KRCalendarModule::MODULE_NAME, MakeBuiltinModule<kuikly::module::KRCalendarModule>},
+    {kuikly::module::KRPerformanceModule::MODULE_NAME, MakeBuiltinModule<kuikly::module::KRPerformanceModule>},
+    {kuikly::module::KRBackPressModule::MODULE_NAME, MakeBuiltinModule<kuikly::module::KRBackPressModule>},
+    {kuikly::module::KRLogTestModule::MODULE_NAME, MakeBuiltinModule<kuikly::module::KRLogTestModule>},
+    {kuikly::expand::KROhSharedPreferencesModule::MODULE_NAME,
+     MakeBuiltinModule<kuikly::expand::KROhSharedPreferencesModule>},
+    {kuikly::module::KRFileModule::MODULE_NAME, MakeBuiltinModule<kuikly::module::KRFileModule>},
+};
 
-    IKRRenderModuleExport::RegisterModuleCreator(kuikly::module::KRCodecModule::MODULE_NAME,
-                                                 [] { return std::make_shared<kuikly::module::KRCodecModule>(); });
+static constexpr KRPerfectHashIndex<std::size(kBuiltinModuleCreators)> kBuiltinModuleIndex(
+    kBuiltinModuleCreators, [](const KRBuiltinModuleCreator &creator) { return creator.module_name; });
 
-    IKRRenderModuleExport::RegisterModuleCreator(kuikly::module::KRCalendarModule::MODULE_NAME,
-                                                 [] { return std::make_shared<kuikly::module::KRCalendarModule>(); });
+static const KRBuiltinModuleCreator *FindBuiltinModuleCreator(std::string_view module_name) {
+    int index = kBuiltinModuleIndex.Find(module_name);
+    return index >= 0 ? &kBuiltinModuleCreators[index] : nullptr;
+}
 
-    IKRRenderModuleExport::RegisterModuleCreator(kuikly::module::KRPerformanceModule::MODULE_NAME, [] {
-        return std::make_shared<kuikly::module::KRPerformanceModule>();
-    });
-    
-    IKRRenderModuleExport::RegisterModuleCreator(kuikly::module::KRBackPressModule::MODULE_NAME, [] {
-        return std::make_shared<kuikly::module::KRBackPressModule>();
-    });
-    
-    IKRRenderModuleExport::RegisterModuleCreator(kuikly::module::KRLogTestModule::MODULE_NAME, [] {
-        return std::make_shared<kuikly::module::KRLogTestModule>();
-    });
-    
-    IKRRenderModuleExport::RegisterModuleCreator(kuikly::expand::KROhSharedPreferencesModule::MODULE_NAME, [] {
-        return std::make_shared<kuikly::expand::KROhSharedPreferencesModule>();
-    });
-
-    IKRRenderModuleExport::RegisterModuleCreator(kuikly::module::KRFileModule::MODULE_NAME, [] {
-        return std::make_shared<kuikly::module::KRFileModule>();
-    });
-}
\ No newline at end of file
+/**
+ * 内置Module均在此注册
+ */
+static void ModulesRegisterEntry() {
+    // 注册通用转发调用ArkTS层 Module
+    IKRRenderModuleExport::RegisterForwardArkTSModuleCreator([] { return std::make_shared<KRForwardArkTSModule>(); });
+    IKRRenderModuleExport::RegisterBuiltinModuleLookup(FindBuiltinModuleCreator);
+}
@@ -22,7 +22,6 @@
 namespace kuikly {
 namespace module {
 
-const char KRBackPressModule::MODULE_NAME[] = "KRBackPressModule";
 const char KRBackPressModule::METHOD_BACK_HANDLE[] = "backHandle";
 
 KRAnyValue KRBackPressModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
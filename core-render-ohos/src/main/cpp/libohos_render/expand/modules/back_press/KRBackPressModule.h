@@ -29,7 +29,7 @@ namespace module {
 
 class KRBackPressModule : public IKRRenderModuleExport {
  public:
-    static const char MODULE_NAME[];
+    static constexpr char MODULE_NAME[] = "KRBackPressModule";
     
     KRBackPressModule() = default;
     KRAnyValue CallMethod(bool sync, const std::string &method, KRAnyValue params,
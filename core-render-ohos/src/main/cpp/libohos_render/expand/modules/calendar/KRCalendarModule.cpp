@@ -21,7 +21,6 @@ static const char *TAG = __FILE_NAME__;
 namespace kuikly {
 namespace module {
 
-const char KRCalendarModule::MODULE_NAME[] = "KRCalendarModule";
 const char KRCalendarModule::METHOD_CURRENT_TIMESTAMP[] = "method_cur_timestamp";
 const char KRCalendarModule::METHOD_GET_FIELD[] = "method_get_field";
 const char KRCalendarModule::METHOD_GET_TIME_IN_MILLIS[] = "method_get_time_in_millis";
@@ -33,7 +33,7 @@ enum Field {
 
 class KRCalendarModule : public IKRRenderModuleExport {
  public:
-    static const char MODULE_NAME[];
+    static constexpr char MODULE_NAME[] = "KRCalendarModule";
     bool SyncMode();
     KRAnyValue CallMethod(bool sync, const std::string &method, KRAnyValue params,
                           const KRRenderCallback &callback) override;
@@ -15,13 +15,15 @@
 
 #include "KRCodec.h"
 
-#include <iomanip>
-#include <sstream>
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <vector>
+#include "libohos_render/utils/KRBase64Util.h"
 #include "md5.h"
 #include "sha256.h"
 
 #define MD5_DIGEST_LENGTH 16
-static const char *TAG = __FILE_NAME__;
 namespace kuikly {
 inline namespace model_util {
 const char HEX_DIGITS[] = "0123456789abcdef";
@@ -31,11 +33,6 @@ const char HEX_DIGITS_URI[] = "0123456789ABCDEF";
 // RFC 3986 section 2.1 says "For consistency, URI producers and normalizers should use uppercase
 // hexadecimal digits for all percent-encodings.
 
-const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                            "abcdefghijklmnopqrstuvwxyz"
-                            "0123456789+/";
-// Maps integer in the range [0,16) to a hex digit.
-
 std::string KREncodeURLComponent(const std::string &in) {
     std::string out;
     for (auto &b : in) {
@@ -73,94 +70,138 @@ std::string KRDecodeURLComponent(const std::string &in) {
 }
 
 std::string KRBase64Encode(const std::string &in) {
-    std::string out;
-    int val = 0, valb = -6;
-    for (unsigned char c : in) {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0) {
-            out.push_back(base64_chars[(val >> valb) & 0x3F]);
-            valb -= 6;
-        }
-    }
-    if (valb > -6)
-        out.push_back(base64_chars[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (out.size() % 4)
-        out.push_back('=');
-    return out;
+    return KRBase64Util::Encode(std::string_view(in));
 }
 
 std::string KRBase64Encode(const std::string_view in) {
-    std::string out;
-    int val = 0, valb = -6;
-    for (unsigned char c : in) {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0) {
-            out.push_back(base64_chars[(val >> valb) & 0x3F]);
-            valb -= 6;
-        }
-    }
-    if (valb > -6)
-        out.push_back(base64_chars[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (out.size() % 4)
-        out.push_back('=');
-    return out;
+    return KRBase64Util::Encode(in);
 }
 
 std::string KRBase64Decode(const std::string &in) {
-    std::string out;
-    std::vector<int> T(256, -1);
-    for (int i = 0; i < 64; i++)
-        T[base64_chars[i]] = i;
-    int val = 0, valb = -8;
-    for (unsigned char c : in) {
-        if (T[c] == -1)
-            break;
-        val = (val << 6) + T[c];
-        valb += 6;
-        if (valb >= 0) {
-            out.push_back(static_cast<char>((val >> valb) & 0xFF));
-            valb -= 8;
-        }
-    }
-    return out;
+    return KRBase64Util::Decode(std::string_view(in));
+}
+
+std::string KRBase64UrlEncode(const std::string &in) {
+    return KRBase64Util::Encode(std::string_view(in), KRBase64Util::Alphabet::kUrlSafe, false);
+}
+
+std::string KRBase64UrlDecode(const std::string &in) {
+    return KRBase64Util::Decode(std::string_view(in), KRBase64Util::Alphabet::kUrlSafe);
 }
 
 std::string KRMd5(const std::string &in) {
-    unsigned char md[MD5_DIGEST_LENGTH];
-    MD5_CTX md5c;
-    MD5_Init(&md5c);
-    MD5_Update(&md5c, in.data(), in.size());
-    MD5_Final(md, &md5c);
-    std::ostringstream out;
-    for (int i = 0; i < MD5_DIGEST_LENGTH; ++i) {
-        out << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(md[i]);
-    }
-    return out.str().substr(8, 16);
+    // 16 位 md5 取 32 位结果的中间 16 个字符
+    return KRMd5With32(in).substr(8, 16);
 }
 
 std::string KRMd5With32(const std::string &in) {
-    unsigned char md[MD5_DIGEST_LENGTH];
-    MD5_CTX md5c;
-    MD5_Init(&md5c);
-    MD5_Update(&md5c, in.data(), in.size());
-    MD5_Final(md, &md5c);
-    std::ostringstream out;
-    for (int i = 0; i < MD5_DIGEST_LENGTH; ++i) {
-        out << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(md[i]);
-    }
-    return out.str();
+    return KRMd5With32(reinterpret_cast<const uint8_t *>(in.data()), in.size());
 }
 
 std::string KRSha256(const std::string &in) {
-    uint8_t digest[SHA256_DIGEST_SIZE];
-    SHA256_hash(in.data(), in.size(), digest);
-    std::ostringstream out;
-    for (int i = 0; i < SHA256_DIGEST_SIZE; ++i) {
-        out << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(digest[i]);
+    return KRSha256(reinterpret_cast<const uint8_t *>(in.data()), in.size());
+}
+
+std::string KRMd5With32(const uint8_t *data, size_t length) {
+    auto hasher = KRHasher::Create(KRHasher::Algorithm::kMd5);
+    hasher->Update(data, length);
+    return hasher->FinalHex();
+}
+
+std::string KRSha256(const uint8_t *data, size_t length) {
+    auto hasher = KRHasher::Create(KRHasher::Algorithm::kSha256);
+    hasher->Update(data, length);
+    return hasher->FinalHex();
+}
+
+namespace {
+// md5/sha256 的 C 实现以 unsigned long/int 传长度，超大数据分段喂入
+constexpr size_t kMaxHashUpdateLength = INT_MAX / 2;
+constexpr size_t kHashFileChunkSize = 256 * 1024;
+
+class KRMd5Hasher : public KRHasher {
+ public:
+    KRMd5Hasher() {
+        MD5_Init(&ctx_);
+    }
+    void Update(const void *data, size_t length) override {
+        auto bytes = static_cast<const uint8_t *>(data);
+        while (length > 0) {
+            size_t chunk = std::min(length, kMaxHashUpdateLength);
+            MD5_Update(&ctx_, bytes, static_cast<unsigned long>(chunk));
+            bytes += chunk;
+            length -= chunk;
+        }
+    }
+    std::string FinalHex() override {
+        unsigned char md[MD5_DIGEST_LENGTH];
+        MD5_Final(md, &ctx_);
+        return KRBase64Util::HexEncode(md, MD5_DIGEST_LENGTH);
+    }
+
+ private:
+    MD5_CTX ctx_;
+};
+
+class KRSha256Hasher : public KRHasher {
+ public:
+    KRSha256Hasher() {
+        SHA256_init(&ctx_);
+    }
+    void Update(const void *data, size_t length) override {
+        auto bytes = static_cast<const uint8_t *>(data);
+        while (length > 0) {
+            size_t chunk = std::min(length, kMaxHashUpdateLength);
+            SHA256_update(&ctx_, bytes, static_cast<int>(chunk));
+            bytes += chunk;
+            length -= chunk;
+        }
+    }
+    std::string FinalHex() override {
+        return KRBase64Util::HexEncode(SHA256_final(&ctx_), SHA256_DIGEST_SIZE);
+    }
+
+ private:
+    SHA256_CTX ctx_;
+};
+}  // namespace
+
+bool KRHasher::ParseAlgorithm(const std::string &name, Algorithm &algorithm) {
+    if (name == "md5") {
+        algorithm = Algorithm::kMd5;
+        return true;
+    }
+    if (name == "sha256") {
+        algorithm = Algorithm::kSha256;
+        return true;
+    }
+    return false;
+}
+
+std::unique_ptr<KRHasher> KRHasher::Create(Algorithm algorithm) {
+    if (algorithm == Algorithm::kSha256) {
+        return std::make_unique<KRSha256Hasher>();
+    }
+    return std::make_unique<KRMd5Hasher>();
+}
+
+bool KRHashFile(const std::string &path, KRHasher::Algorithm algorithm, std::string &digest_hex) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    auto hasher = KRHasher::Create(algorithm);
+    std::vector<uint8_t> buffer(kHashFileChunkSize);
+    size_t read_length = 0;
+    while ((read_length = fread(buffer.data(), 1, buffer.size(), file)) > 0) {
+        hasher->Update(buffer.data(), read_length);
+    }
+    bool ok = ferror(file) == 0;
+    fclose(file);
+    if (ok) {
+        digest_hex = hasher->FinalHex();
     }
-    return out.str();
+    return ok;
 }
 }  //  namespace util
 }  //  namespace kuikly
@@ -14,6 +14,9 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
 
 namespace kuikly {
@@ -27,10 +30,47 @@ std::string KRBase64Encode(const std::string_view in);
 
 std::string KRBase64Decode(const std::string &str);
 
+// URL-safe 字母表（'-' '_'），编码不补 '='
+std::string KRBase64UrlEncode(const std::string &str);
+
+std::string KRBase64UrlDecode(const std::string &str);
+
 std::string KRMd5(const std::string &str);
 
 std::string KRMd5With32(const std::string &str);
 
 std::string KRSha256(const std::string &str);
+
+// 二进制数据摘要，结果为小写十六进制
+std::string KRMd5With32(const uint8_t *data, size_t length);
+
+std::string KRSha256(const uint8_t *data, size_t length);
+
+/**
+ * 增量摘要计算，用于分块处理大数据，非线程安全
+ */
+class KRHasher {
+ public:
+    enum class Algorithm { kMd5, kSha256 };
+
+    /**
+     * @param name "md5" 或 "sha256"，其他返回 false
+     */
+    static bool ParseAlgorithm(const std::string &name, Algorithm &algorithm);
+    static std::unique_ptr<KRHasher> Create(Algorithm algorithm);
+
+    virtual ~KRHasher() = default;
+    virtual void Update(const void *data, size_t length) = 0;
+    /**
+     * 结束计算并返回小写十六进制摘要，调用后不可再 Update
+     */
+    virtual std::string FinalHex() = 0;
+};
+
+/**
+ * 流式读取文件计算摘要，在调用线程同步执行
+ * @return 文件无法读取时返回 false
+ */
+bool KRHashFile(const std::string &path, KRHasher::Algorithm algorithm, std::string &digest_hex);
 }  //  namespace util
 }  //  namespace kuikly
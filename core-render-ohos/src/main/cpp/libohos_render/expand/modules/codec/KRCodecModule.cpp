@@ -16,25 +16,66 @@
 #include "KRCodecModule.h"
 
 #include "libohos_render/expand/modules/codec/KRCodec.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
 
 namespace kuikly {
 namespace module {
 
-const char KRCodecModule::MODULE_NAME[] = "KRCodecModule";
 const char KRCodecModule::METHOD_URL_DECODE[] = "urlDecode";
 const char KRCodecModule::METHOD_URL_ENCODE[] = "urlEncode";
 const char KRCodecModule::METHOD_BASE64_ENCODE[] = "base64Encode";
 const char KRCodecModule::METHOD_BASE64_DECODE[] = "base64Decode";
+const char KRCodecModule::METHOD_BASE64_URL_ENCODE[] = "base64UrlEncode";
+const char KRCodecModule::METHOD_BASE64_URL_DECODE[] = "base64UrlDecode";
 const char KRCodecModule::METHOD_MD5[] = "md5";
 const char KRCodecModule::METHOD_MD5_32[] = "md5With32";
 const char KRCodecModule::METHOD_SHA256[] = "sha256";
+const char KRCodecModule::METHOD_HASH_CREATE[] = "hashCreate";
+const char KRCodecModule::METHOD_HASH_UPDATE[] = "hashUpdate";
+const char KRCodecModule::METHOD_HASH_FINAL[] = "hashFinal";
+const char KRCodecModule::METHOD_HASH_FILE[] = "hashFile";
+
+static constexpr char kHashFileResultCode[] = "code";
+static constexpr char kHashFileResultDigest[] = "digest";
+static constexpr char kHashFileResultMessage[] = "message";
+
+// 取 [ByteArray, ...] 形式参数的第一个二进制参数
+static KRAnyValue GetFirstByteArrayArg(const KRAnyValue &params) {
+    if (params->isByteArray()) {
+        return params;
+    }
+    if (params->isArray()) {
+        auto args = params->toArray();
+        if (!args.empty() && args[0]->isByteArray()) {
+            return args[0];
+        }
+    }
+    return nullptr;
+}
 
 bool KRCodecModule::SyncMode() {
     return true;
 }
-void KRCodecModule::OnDestroy() {}
+void KRCodecModule::OnDestroy() {
+    std::lock_guard<std::mutex> lock(hashers_mutex_);
+    hashers_.clear();
+}
 KRAnyValue KRCodecModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
                                      const KRRenderCallback &callback) {
+    if (method == METHOD_HASH_CREATE) {
+        return this->HashCreate(params);
+    } else if (method == METHOD_HASH_UPDATE) {
+        return this->HashUpdate(params);
+    } else if (method == METHOD_HASH_FINAL) {
+        return this->HashFinal(params);
+    } else if (method == METHOD_HASH_FILE) {
+        this->HashFile(params, callback);
+        return KRRenderValue::Make();
+    } else if (method == METHOD_MD5 || method == METHOD_MD5_32 || method == METHOD_SHA256) {
+        if (auto bytes = GetFirstByteArrayArg(params)) {
+            return this->HashBytes(method, bytes);
+        }
+    }
     auto str = params->toString();
     if (method == this->METHOD_URL_ENCODE) {
         return this->UrlEncode(str);
@@ -44,6 +85,10 @@ KRAnyValue KRCodecModule::CallMethod(bool sync, const std::string &method, KRAny
         return this->Base64Encode(str);
     } else if (method == METHOD_BASE64_DECODE) {
         return this->Base64Decode(str);
+    } else if (method == METHOD_BASE64_URL_ENCODE) {
+        return this->Base64UrlEncode(str);
+    } else if (method == METHOD_BASE64_URL_DECODE) {
+        return this->Base64UrlDecode(str);
     } else if (method == METHOD_MD5) {
         return this->Md5(str);
     } else if (method == METHOD_MD5_32) {
@@ -70,6 +115,14 @@ KRAnyValue KRCodecModule::Base64Decode(const std::string str) {
     return KRRenderValue::Make(KRBase64Decode(str));
 }
 
+KRAnyValue KRCodecModule::Base64UrlEncode(const std::string str) {
+    return KRRenderValue::Make(KRBase64UrlEncode(str));
+}
+
+KRAnyValue KRCodecModule::Base64UrlDecode(const std::string str) {
+    return KRRenderValue::Make(KRBase64UrlDecode(str));
+}
+
 KRAnyValue KRCodecModule::Md5(const std::string str) {
     return KRRenderValue::Make(KRMd5(str));
 }
@@ -81,5 +134,99 @@ KRAnyValue KRCodecModule::Md5With32(const std::string str) {
 KRAnyValue KRCodecModule::Sha256(const std::string str) {
     return KRRenderValue::Make(KRSha256(str));
 }
+
+KRAnyValue KRCodecModule::HashBytes(const std::string &method, const KRAnyValue &bytes) {
+    if (method == METHOD_SHA256) {
+        return KRRenderValue::Make(KRSha256(bytes->bytesData(), bytes->bytesSize()));
+    }
+    auto digest = KRMd5With32(bytes->bytesData(), bytes->bytesSize());
+    if (method == METHOD_MD5) {
+        digest = digest.substr(8, 16);
+    }
+    return KRRenderValue::Make(digest);
+}
+
+KRAnyValue KRCodecModule::HashCreate(const KRAnyValue &params) {
+    // 参数: "md5" | "sha256" 或 [algorithm]
+    auto args = params->isArray() ? params->toArray() : KRRenderValue::Array();
+    auto name = args.empty() ? params->toString() : args[0]->toString();
+    KRHasher::Algorithm algorithm;
+    if (!KRHasher::ParseAlgorithm(name, algorithm)) {
+        return KRRenderValue::Make(-1);
+    }
+    std::lock_guard<std::mutex> lock(hashers_mutex_);
+    int32_t id = next_hasher_id_++;
+    hashers_[id] = KRHasher::Create(algorithm);
+    return KRRenderValue::Make(id);
+}
+
+KRAnyValue KRCodecModule::HashUpdate(const KRAnyValue &params) {
+    // 参数: [handle, ByteArray | String]
+    auto args = params->toArray();
+    if (args.size() < 2) {
+        return KRRenderValue::Make(false);
+    }
+    std::lock_guard<std::mutex> lock(hashers_mutex_);
+    auto it = hashers_.find(args[0]->toInt());
+    if (it == hashers_.end()) {
+        return KRRenderValue::Make(false);
+    }
+    if (args[1]->isByteArray()) {
+        it->second->Update(args[1]->bytesData(), args[1]->bytesSize());
+    } else {
+        const auto &str = args[1]->toString();
+        it->second->Update(str.data(), str.size());
+    }
+    return KRRenderValue::Make(true);
+}
+
+KRAnyValue KRCodecModule::HashFinal(const KRAnyValue &params) {
+    // 参数: handle 或 [handle]
+    auto args = params->isArray() ? params->toArray() : KRRenderValue::Array();
+    int32_t id = args.empty() ? params->toInt() : args[0]->toInt();
+    std::unique_ptr<KRHasher> hasher;
+    {
+        std::lock_guard<std::mutex> lock(hashers_mutex_);
+        auto it = hashers_.find(id);
+        if (it == hashers_.end()) {
+            return KRRenderValue::Make("");
+        }
+        hasher = std::move(it->second);
+        hashers_.erase(it);
+    }
+    return KRRenderValue::Make(hasher->FinalHex());
+}
+
+void KRCodecModule::HashFile(const KRAnyValue &params, const KRRenderCallback &callback) {
+    // 参数: [path, algorithm]，algorithm 缺省为 md5；结果 {code, digest | message}
+    auto args = params->toArray();
+    std::string path = args.empty() ? "" : args[0]->toString();
+    std::string name = args.size() > 1 ? args[1]->toString() : "md5";
+    KRHasher::Algorithm algorithm;
+    if (path.empty() || !KRHasher::ParseAlgorithm(name, algorithm)) {
+        if (callback) {
+            KRRenderValue::Map result;
+            result[kHashFileResultCode] = KRRenderValue::Make(-1);
+            result[kHashFileResultMessage] = KRRenderValue::Make("invalid path or algorithm");
+            callback(KRRenderValue::Make(result));
+        }
+        return;
+    }
+    KRGCDQueue::GetInstance().DispatchAsync([path, algorithm, callback] {
+        std::string digest;
+        bool ok = KRHashFile(path, algorithm, digest);
+        if (!callback) {
+            return;
+        }
+        KRRenderValue::Map result;
+        result[kHashFileResultCode] = KRRenderValue::Make(ok ? 0 : -1);
+        if (ok) {
+            result[kHashFileResultDigest] = KRRenderValue::Make(digest);
+        } else {
+            result[kHashFileResultMessage] = KRRenderValue::Make("failed to read file: " + path);
+        }
+        callback(KRRenderValue::Make(result));
+    });
+}
 }  // namespace module
 }  // namespace kuikly
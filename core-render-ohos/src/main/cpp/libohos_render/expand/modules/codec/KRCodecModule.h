@@ -14,13 +14,17 @@
  */
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include "libohos_render/export/IKRRenderModuleExport.h"
+#include "libohos_render/expand/modules/codec/KRCodec.h"
 
 namespace kuikly {
 namespace module {
 class KRCodecModule : public IKRRenderModuleExport {
  public:
-    static const char MODULE_NAME[];
+    static constexpr char MODULE_NAME[] = "KRCodecModule";
 
     bool SyncMode();
     KRAnyValue CallMethod(bool sync, const std::string &method, KRAnyValue params,
@@ -32,17 +36,38 @@ class KRCodecModule : public IKRRenderModuleExport {
     static const char METHOD_URL_ENCODE[];
     static const char METHOD_BASE64_ENCODE[];
     static const char METHOD_BASE64_DECODE[];
+    static const char METHOD_BASE64_URL_ENCODE[];
+    static const char METHOD_BASE64_URL_DECODE[];
     static const char METHOD_MD5[];
     static const char METHOD_MD5_32[];
     static const char METHOD_SHA256[];
+    static const char METHOD_HASH_CREATE[];
+    static const char METHOD_HASH_UPDATE[];
+    static const char METHOD_HASH_FINAL[];
+    static const char METHOD_HASH_FILE[];
 
     KRAnyValue UrlEncode(std::string);
     KRAnyValue UrlDecode(std::string);
     KRAnyValue Base64Encode(std::string);
     KRAnyValue Base64Decode(std::string);
+    KRAnyValue Base64UrlEncode(std::string);
+    KRAnyValue Base64UrlDecode(std::string);
     KRAnyValue Md5(std::string);
     KRAnyValue Md5With32(std::string);
     KRAnyValue Sha256(std::string);
+
+    // md5/md5With32/sha256 也接受 [ByteArray] 参数，避免二进制数据先转成字符串
+    KRAnyValue HashBytes(const std::string &method, const KRAnyValue &bytes);
+    // 增量摘要：hashCreate 返回句柄，hashUpdate 分块喂入，hashFinal 返回结果并释放句柄
+    KRAnyValue HashCreate(const KRAnyValue &params);
+    KRAnyValue HashUpdate(const KRAnyValue &params);
+    KRAnyValue HashFinal(const KRAnyValue &params);
+    // 在后台线程流式读取文件计算摘要，通过 callback 返回
+    void HashFile(const KRAnyValue &params, const KRRenderCallback &callback);
+
+    std::mutex hashers_mutex_;
+    std::unordered_map<int32_t, std::unique_ptr<KRHasher>> hashers_;
+    int32_t next_hasher_id_ = 1;
 };
 }  // namespace module
 }  // namespace kuikly
@@ -27,7 +27,6 @@
 namespace kuikly {
 namespace module {
 
-const char KRFileModule::MODULE_NAME[]       = "KRFileModule";
 const char KRFileModule::METHOD_WRITE_FILE[] = "writeFile";
 const char KRFileModule::METHOD_APPEND_FILE[]  = "appendFile";
 const char KRFileModule::METHOD_GET_FILES_DIR[] = "getFilesDir";
@@ -30,7 +30,7 @@ namespace module {
  */
 class KRFileModule : public IKRRenderModuleExport {
  public:
-    static const char MODULE_NAME[];
+    static constexpr char MODULE_NAME[] = "KRFileModule";
 
     KRAnyValue CallMethod(bool sync, const std::string &method, KRAnyValue params,
                           const KRRenderCallback &callback) override;
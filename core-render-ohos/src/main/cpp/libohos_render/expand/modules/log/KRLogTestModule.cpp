@@ -10,8 +10,6 @@
 namespace kuikly {
 namespace module {
 
-const char KRLogTestModule::MODULE_NAME[] = "KRLogTestModule";
-
 KRAnyValue KRLogTestModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
                           const KRRenderCallback &callback) {
     if (method == "test") {
@@ -14,7 +14,7 @@ namespace module {
 
 class KRLogTestModule : public IKRRenderModuleExport {
  public:
-    static const char MODULE_NAME[];
+    static constexpr char MODULE_NAME[] = "KRLogTestModule";
     
     KRLogTestModule() = default;
 
@@ -21,8 +21,7 @@ namespace kuikly {
 namespace module {
 constexpr char kMethodNameOnCreatePageFinish[] = "onPageCreateFinish";
 constexpr char kMethodNameGetPerformanceData[] = "getPerformanceData";
-
-const char KRPerformanceModule::MODULE_NAME[] = "KRPerformanceModule";
+constexpr char kMethodNameGetScrollFrameData[] = "getScrollFrameData";
 
 KRAnyValue KRPerformanceModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
                                            const KRRenderCallback &callback) {
@@ -40,6 +39,11 @@ KRAnyValue KRPerformanceModule::CallMethod(bool sync, const std::string &method,
                 callback_param = KRRenderValue::Make(data);
             }
             callback(callback_param);
+        } else if (method == kMethodNameGetScrollFrameData) {
+            std::string data = performance_manager->GetScrollFrameData();
+            if (callback) {
+                callback(data.empty() ? KRRenderValue::Make(nullptr) : KRRenderValue::Make(data));
+            }
         }
     }
     return KREmptyValue();
@@ -25,7 +25,7 @@ class KRPerformanceModule : public IKRRenderModuleExport {
     KRPerformanceModule() = default;
     KRAnyValue CallMethod(bool sync, const std::string &method, KRAnyValue params,
                           const KRRenderCallback &callback) override;
-    static const char MODULE_NAME[];
+    static constexpr char MODULE_NAME[] = "KRPerformanceModule";
 };
 }  // namespace module
 }  // namespace kuikly
@@ -25,7 +25,6 @@
 
 namespace kuikly {
 namespace expand {
-const char KROhSharedPreferencesModule::MODULE_NAME[] = "KROhSharedPreferencesModule";
 const char KROhSharedPreferencesModule::GET_ITEM[] = "getItem";
 const char KROhSharedPreferencesModule::SET_ITEM[] = "setItem";
 
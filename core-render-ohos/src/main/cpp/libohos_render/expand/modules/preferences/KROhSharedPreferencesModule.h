@@ -26,7 +26,7 @@ namespace expand {
 
 class KROhSharedPreferencesModule : public IKRRenderModuleExport {
  public:
-    static const char MODULE_NAME[];
+    static constexpr char MODULE_NAME[] = "KROhSharedPreferencesModule";
     bool SyncMode();
     KRAnyValue CallMethod(bool sync, const std::string &method, KRAnyValue params,
                           const KRRenderCallback &callback) override;
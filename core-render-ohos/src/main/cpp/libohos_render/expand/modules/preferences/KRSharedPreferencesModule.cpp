@@ -20,7 +20,6 @@
 
 namespace kuikly {
 namespace expand {
-const char KRSharedPreferencesModule::MODULE_NAME[] = "KRSharedPreferencesModule";
 const char KRSharedPreferencesModule::GET_ITEM[] = "getItem";
 const char KRSharedPreferencesModule::SET_ITEM[] = "setItem";
 
@@ -25,7 +25,7 @@ namespace expand {
 
 class KRSharedPreferencesModule : public IKRRenderModuleExport {
  public:
-    static const char MODULE_NAME[];
+    static constexpr char MODULE_NAME[] = "KRSharedPreferencesModule";
     bool SyncMode();
     KRAnyValue CallMethod(bool sync, const std::string &method, KRAnyValue params,
                           const KRRenderCallback &callback) override;
@@ -19,6 +19,7 @@
 #define FOAWARD_ARTKS_MODULE_NAME "FOAWARD_ARTKS_MODULE_NAME"
 
 #include <unordered_map>
+#include "libohos_render/export/KRBuiltinCreators.h"
 #include "libohos_render/foundation/KRCommon.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/manager/KRArkTSManager.h"
@@ -136,19 +137,27 @@ class IKRRenderModuleExport : public std::enable_shared_from_this<IKRRenderModul
     }
 
     /**
-     * 注册Module创建器
+     * 运行期注册Module创建器（KRRenderModuleRegister 等外部扩展使用），同名时覆盖内置Module
      * @param creator
      */
     static void RegisterModuleCreator(const std::string &module_name, const KRModuleCreator &creator) {
         GetRegisterModuleCreator()[module_name] = creator;
     }
 
+    /**
+     * 注册内置Module查找表（编译期生成的完美哈希表，见 ModulesRegisterEntry）
+     * @param lookup
+     */
+    static void RegisterBuiltinModuleLookup(KRBuiltinModuleLookup lookup) {
+        GetBuiltinModuleLookup() = lookup;
+    }
+
     /**
      * 注册通用转发ArkTS层Module创建器
      * @param creator
      */
     static void RegisterForwardArkTSModuleCreator(const KRModuleCreator &creator) {
-        RegisterModuleCreator(std::string(FOAWARD_ARTKS_MODULE_NAME), creator);
+        GetForwardArkTSModuleCreator() = creator;
     }
 
     /**
@@ -157,15 +166,22 @@ class IKRRenderModuleExport : public std::enable_shared_from_this<IKRRenderModul
      * @return 新的Module实例
      */
     static std::shared_ptr<IKRRenderModuleExport> CreateModule(const std::string &module_name) {
-        auto it = GetRegisterModuleCreator().find(module_name);
-        if (it != GetRegisterModuleCreator().end()) {
-            return it->second();
-        } else {  // 使用通用Module，转发到ArkTS层Module
-            it = GetRegisterModuleCreator().find(std::string(FOAWARD_ARTKS_MODULE_NAME));
-            if (it != GetRegisterModuleCreator().end()) {
+        auto &module_creator_map = GetRegisterModuleCreator();
+        if (!module_creator_map.empty()) {
+            auto it = module_creator_map.find(module_name);
+            if (it != module_creator_map.end()) {
                 return it->second();
             }
         }
+        if (auto lookup = GetBuiltinModuleLookup()) {
+            if (auto builtin = lookup(module_name)) {
+                return builtin->create_module();
+            }
+        }
+        // 使用通用Module，转发到ArkTS层Module
+        if (auto &creator = GetForwardArkTSModuleCreator()) {
+            return creator();
+        }
         return nullptr;
     }
 
@@ -174,6 +190,16 @@ class IKRRenderModuleExport : public std::enable_shared_from_this<IKRRenderModul
         return gRegisterModuleCreator;
     }
 
+    static KRBuiltinModuleLookup &GetBuiltinModuleLookup() {
+        static KRBuiltinModuleLookup gBuiltinModuleLookup = nullptr;
+        return gBuiltinModuleLookup;
+    }
+
+    static KRModuleCreator &GetForwardArkTSModuleCreator() {
+        static KRModuleCreator gForwardArkTSModuleCreator;
+        return gForwardArkTSModuleCreator;
+    }
+
     static KRModuleCreator &GetOrSetForwardArkTModuleCreator(KRModuleCreator module_creator) {
         static KRModuleCreator gForwardArkTSModuleCreator;
         gForwardArkTSModuleCreator = module_creator;
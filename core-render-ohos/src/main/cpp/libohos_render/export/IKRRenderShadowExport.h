@@ -17,6 +17,7 @@
 #define CORE_RENDER_OHOS_IKRRENDERSHADOWEXPORT_H
 
 #include <string>
+#include "libohos_render/export/KRBuiltinCreators.h"
 #include "libohos_render/foundation/KRCommon.h"
 #include "libohos_render/foundation/KRSize.h"
 #include "libohos_render/scheduler/IKRScheduler.h"
@@ -52,6 +53,15 @@ class IKRRenderShadowExport : public std::enable_shared_from_this<IKRRenderShado
      */
     virtual KRSize CalculateRenderViewSize(double constraint_width, double constraint_height) = 0;
 
+    /**
+     * 批量测量时是否允许在工作线程上与其他 shadow 并行计算尺寸
+     * 默认 false，即仍在 context 线程串行调用 CalculateRenderViewSize
+     * @return
+     */
+    virtual bool CanCalculateRenderViewSizeConcurrently() {
+        return false;
+    }
+
     /**
      * 将要SetShadow调用
      * @return
@@ -59,27 +69,49 @@ class IKRRenderShadowExport : public std::enable_shared_from_this<IKRRenderShado
     virtual KRSchedulerTask TaskToMainQueueWhenWillSetShadowToView() = 0;
 
     /**
-     * 注册View创建器
+     * 运行期注册Shadow创建器（外部扩展使用），同名时覆盖内置组件
      * @param creator
      */
     static void RegisterShadowCreator(const std::string &view_name, const KRShadowCreator &creator) {
         GetRegisterShadowCreator()[view_name] = creator;
     }
 
+    /**
+     * 注册内置组件查找表，与 View 共用一张表
+     * @param lookup
+     */
+    static void RegisterBuiltinShadowLookup(KRBuiltinViewLookup lookup) {
+        GetBuiltinShadowLookup() = lookup;
+    }
+
     static std::unordered_map<std::string, KRShadowCreator> &GetRegisterShadowCreator() {
         static std::unordered_map<std::string, KRShadowCreator> gRegisterShadowCreator;
         return gRegisterShadowCreator;
     }
 
+    static KRBuiltinViewLookup &GetBuiltinShadowLookup() {
+        static KRBuiltinViewLookup gBuiltinShadowLookup = nullptr;
+        return gBuiltinShadowLookup;
+    }
+
     /**
      * 指定ViewName生成View
      * @param view_name
      * @return 新的View实例
      */
     static std::shared_ptr<IKRRenderShadowExport> CreateShadow(const std::string &view_name) {
-        auto it = GetRegisterShadowCreator().find(view_name);
-        if (it != GetRegisterShadowCreator().end()) {
-            return it->second();
+        auto &shadow_creator_map = GetRegisterShadowCreator();
+        if (!shadow_creator_map.empty()) {
+            auto it = shadow_creator_map.find(view_name);
+            if (it != shadow_creator_map.end()) {
+                return it->second();
+            }
+        }
+        if (auto lookup = GetBuiltinShadowLookup()) {
+            auto builtin = lookup(view_name);
+            if (builtin && builtin->create_shadow) {
+                return builtin->create_shadow();
+            }
         }
         return nullptr;
     }
@@ -18,6 +18,7 @@
 #include "libohos_render/api/include/Kuikly/Kuikly.h"
 #include "libohos_render/api/src/KRAnyDataInternal.h"
 #include "libohos_render/foundation/KRConfig.h"
+#include "libohos_render/foundation/thread/KRIdleTaskQueue.h"
 #include "libohos_render/manager/KRSnapshotManager.h"
 #include "libohos_render/manager/KRWeakObjectManager.h"
 
@@ -43,28 +44,35 @@ void KRRenderViewSetExternalPropHandler(KRRenderViewOnSetProp set, KRRenderViewO
 std::shared_ptr<IKRRenderViewExport> IKRRenderViewExport::CreateView(const std::string &view_name) {
     KREnsureMainThread();
 
-    auto &ViewCreatorMap = GetRegisterViewCreator();
-    if (ViewCreatorMap.find(view_name) != ViewCreatorMap.end()) {
-        return ViewCreatorMap[view_name]();
-    } else {  // 使用通用View，转发到ArkTS层Module
-        switch(KRArkTSViewNameRegistry::GetInstance().KindOfView(view_name)){
-        case KRArkTSViewNameRegistry::ViewKindV1:{
-            auto it = GetRegisterViewCreator().find(std::string(FORWARD_ARKTS_VIEW_NAME));
-            if (it != GetRegisterViewCreator().end()) {
-                KR_LOG_DEBUG << "Creating View with Forwarder V1 for View:"<<view_name;
-                return it->second();
-            }
+    // 运行期注册的创建器优先（可覆盖同名内置组件），没有外部注册时只是一次判空
+    auto &view_creator_map = GetRegisterViewCreator();
+    if (!view_creator_map.empty()) {
+        auto it = view_creator_map.find(view_name);
+        if (it != view_creator_map.end()) {
+            return it->second();
         }
-        break;
-        case KRArkTSViewNameRegistry::ViewKindV2:{
-            auto it = GetRegisterViewCreator().find(std::string(FORWARD_ARKTS_VIEW_NAME_V2));
-            if (it != GetRegisterViewCreator().end()) {
-                KR_LOG_DEBUG << "Creating View with Forwarder V1 for View:"<<view_name;
-                return it->second();
-            }
+    }
+    if (auto lookup = GetBuiltinViewLookup()) {
+        if (auto builtin = lookup(view_name)) {
+            return builtin->create_view();
+        }
+    }
+    // 使用通用View，转发到ArkTS层
+    switch (KRArkTSViewNameRegistry::GetInstance().KindOfView(view_name)) {
+    case KRArkTSViewNameRegistry::ViewKindV1:
+        if (auto &creator = GetForwardArkTSViewCreator(false)) {
+            KR_LOG_DEBUG << "Creating View with Forwarder V1 for View:" << view_name;
+            return creator();
         }
         break;
+    case KRArkTSViewNameRegistry::ViewKindV2:
+        if (auto &creator = GetForwardArkTSViewCreator(true)) {
+            KR_LOG_DEBUG << "Creating View with Forwarder V2 for View:" << view_name;
+            return creator();
         }
+        break;
+    default:
+        break;
     }
     KR_LOG_ERROR << "View Creator Not Found! View Name:"<<view_name;
     return nullptr;
@@ -160,7 +168,8 @@ void IKRRenderViewExport::DestroyTouchInterrupter() {
     if (touch_interrupt_node_) {
         kuikly::util::GetNodeApi()->unregisterNodeEvent(touch_interrupt_node_, NODE_TOUCH_EVENT);
         auto node = touch_interrupt_node_;
-        KRMainThread::RunOnMainThreadForNextLoop([node] { kuikly::util::GetNodeApi()->disposeNode(node); });
+        // 事件已注销，节点释放可以延后到主线程空闲时
+        KRIdleTaskQueue::PostIdleTask([node] { kuikly::util::GetNodeApi()->disposeNode(node); });
         touch_interrupt_node_ = nullptr;
         KRWeakObjectManagerUnregisterWeakObject(shared_from_this());
     }
@@ -185,6 +194,7 @@ void IKRRenderViewExport::ToSetProp(const std::string &prop_key, const KRAnyValu
         if (isFrameProp) {
             const std::string &s = prop_value->toString();
             memcpy(&frame_, s.data(), s.size());
+            MarkParentChildrenLayoutChanged();
             SetRenderViewFrame(frame_);
         }
     }
@@ -17,6 +17,7 @@
 #define CORE_RENDER_OHOS_IKRRENDERVIEWEXPORT_H
 
 #include <arkui/native_node.h>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <set>
@@ -26,6 +27,7 @@
 #include "libohos_render/expand/events/KREventDispatchCenter.h"
 #include "libohos_render/export/IKRRenderModuleExport.h"
 #include "libohos_render/export/IKRRenderShadowExport.h"
+#include "libohos_render/export/KRBuiltinCreators.h"
 #include "libohos_render/foundation/KRCommon.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
@@ -222,22 +224,30 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
     bool CanReuse();
 
     /**
-     * 注册View创建器
+     * 运行期注册View创建器（外部扩展使用），同名时覆盖内置组件
      * @param creator
      */
     static void RegisterViewCreator(const std::string &view_name, const KRViewCreator &creator) {
         GetRegisterViewCreator()[view_name] = creator;
     }
 
+    /**
+     * 注册内置组件查找表（编译期生成的完美哈希表，见 ComponentsRegisterEntry）
+     * @param lookup
+     */
+    static void RegisterBuiltinViewLookup(KRBuiltinViewLookup lookup) {
+        GetBuiltinViewLookup() = lookup;
+    }
+
     /**
      * 注册通用转发ArkTS层View创建器
      * @param creator
      */
     static void RegisterForwardArkTSViewCreator(const KRViewCreator &creator) {
-        RegisterViewCreator(std::string(FORWARD_ARKTS_VIEW_NAME), creator);
+        GetForwardArkTSViewCreator(false) = creator;
     }
     static void RegisterForwardArkTSViewCreatorV2(const KRViewCreator &creator) {
-        RegisterViewCreator(std::string(FORWARD_ARKTS_VIEW_NAME_V2), creator);
+        GetForwardArkTSViewCreator(true) = creator;
     }
 
     /**
@@ -252,10 +262,30 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
         return gRegisterViewCreator;
     }
 
+    static KRBuiltinViewLookup &GetBuiltinViewLookup() {
+        static KRBuiltinViewLookup gBuiltinViewLookup = nullptr;
+        return gBuiltinViewLookup;
+    }
+
+    static KRViewCreator &GetForwardArkTSViewCreator(bool v2) {
+        static KRViewCreator gForwardArkTSViewCreator;
+        static KRViewCreator gForwardArkTSViewCreatorV2;
+        return v2 ? gForwardArkTSViewCreatorV2 : gForwardArkTSViewCreator;
+    }
+
     KRRect &GetFrame() {
         return frame_;
     }
 
+    /**
+     * 子节点布局版本号（仅主线程读写），子节点列表或任一直接子节点的 frame 变化时更新。
+     * 取值来自进程内递增序列，不同 view 的版本号不会重复；依赖子节点布局的缓存（如滚动可见区间索引）
+     * 可据此判断是否需要重建，不受其他 view 布局变化的影响。
+     */
+    uint64_t ChildrenLayoutVersion() const {
+        return children_layout_version_;
+    }
+
     void RegisterEvent(const ArkUI_NodeEventType &event_type) {
         KREventDispatchCenter::GetInstance().RegisterEvent(shared_from_this(), event_type);
     }
@@ -348,6 +378,7 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
             ResetProp(prop_key);
         }
         frame_ = KRRect(0, 0, 0, 0);
+        MarkParentChildrenLayoutChanged();
     }
 
     void ToReuse() {
@@ -382,6 +413,7 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
         if (auto parent_view = GetParentView()) {
             auto shared = shared_from_this();
             parent_view->sub_render_views_.erase(shared);
+            parent_view->MarkChildrenLayoutChanged();
         }
 
         WillRemoveFromParentView();
@@ -430,6 +462,7 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
         InsertChildNode(GetNode(), sub_render_view->GetNode(), index, sub_render_view);
         sub_render_view->DidMoveToParentView();
         sub_render_views_.insert(sub_render_view);
+        MarkChildrenLayoutChanged();
         DidInsertSubRenderView(sub_render_view, index);
     }
 
@@ -585,6 +618,15 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
             did_set_props_.push_back(prop_key);
         }
     }
+    void MarkChildrenLayoutChanged() {
+        children_layout_version_ = ++layout_version_seq_;
+    }
+    // 自身 frame 变化只影响父节点的子节点布局
+    void MarkParentChildrenLayoutChanged() {
+        if (auto parent = parent_.lock()) {
+            parent->MarkChildrenLayoutChanged();
+        }
+    }
 
  protected:
     ArkUI_NodeHandle node_ = nullptr;
@@ -600,6 +642,8 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
     int parent_tag_ = -1;
     std::shared_ptr<KRBasePropsHandler> base_props_handler_;
     KRRect frame_;
+    uint64_t children_layout_version_ = 0;
+    static inline uint64_t layout_version_seq_ = 0;
     bool did_init_ = false;
     ArkUI_NodeHandle touch_interrupt_node_ = nullptr;
     bool touch_interrupt_node_attached_ = false;
@@ -0,0 +1,48 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRBUILTINCREATORS_H
+#define CORE_RENDER_OHOS_KRBUILTINCREATORS_H
+
+#include <memory>
+#include <string_view>
+
+class IKRRenderViewExport;
+class IKRRenderShadowExport;
+class IKRRenderModuleExport;
+
+/**
+ * 内置组件的创建函数（普通函数指针，常量初始化，启动时无需构造）
+ */
+struct KRBuiltinViewCreator {
+    std::string_view view_name;
+    std::shared_ptr<IKRRenderViewExport> (*create_view)();
+    /** 没有 shadow 的组件为 nullptr */
+    std::shared_ptr<IKRRenderShadowExport> (*create_shadow)();
+};
+
+/**
+ * 内置Module的创建函数
+ */
+struct KRBuiltinModuleCreator {
+    std::string_view module_name;
+    std::shared_ptr<IKRRenderModuleExport> (*create_module)();
+};
+
+/** 按名字查找内置创建函数，找不到返回 nullptr */
+using KRBuiltinViewLookup = const KRBuiltinViewCreator *(*)(std::string_view view_name);
+using KRBuiltinModuleLookup = const KRBuiltinModuleCreator *(*)(std::string_view module_name);
+
+#endif  // CORE_RENDER_OHOS_KRBUILTINCREATORS_H
@@ -100,6 +100,21 @@ class KRConfig {
         if (performanceMonitorTypesMask != map.end()) {
             performanceMonitorTypesMask_ = performanceMonitorTypesMask->second->toInt();
         }
+
+        auto firstFrameReplayVersion = map.find("firstFrameReplayVersion");
+        if (firstFrameReplayVersion != map.end()) {
+            firstFrameReplayVersion_ = firstFrameReplayVersion->second->toString();
+        }
+
+        auto viewFlattening = map.find("viewFlattening");
+        if (viewFlattening != map.end()) {
+            viewFlattening_ = viewFlattening->second->toBool();
+        }
+
+        auto pauseUIFlushWhenHidden = map.find("pauseUIFlushWhenHidden");
+        if (pauseUIFlushWhenHidden != map.end()) {
+            pauseUIFlushWhenHidden_ = pauseUIFlushWhenHidden->second->toBool();
+        }
     }
 
     /**
@@ -184,6 +199,35 @@ class KRConfig {
         return performanceMonitorTypesMask_;
     }
 
+    const float GetScreenWidth() {
+        return screen_width_;
+    }
+
+    const float GetScreenHeight() {
+        return screen_height_;
+    }
+
+    /**
+     * 首帧回放的业务版本号，为空表示不开启首帧回放
+     */
+    const std::string &GetFirstFrameReplayVersion() {
+        return firstFrameReplayVersion_;
+    }
+
+    /**
+     * 是否开启容器拍平：没有视觉属性和事件的 KRView 不创建 ArkUI 节点
+     */
+    const bool GetViewFlatteningEnabled() {
+        return viewFlattening_;
+    }
+
+    /**
+     * 页面不可见时是否暂停下发 UI 操作：期间的操作在 context 线程合并，页面可见时一次性下发
+     */
+    const bool GetPauseUIFlushWhenHiddenEnabled() {
+        return pauseUIFlushWhenHidden_;
+    }
+
  private:
     float vp2px_ = 0;
     float fontWeightScale_ = 1;
@@ -199,6 +243,9 @@ class KRConfig {
     bool fontSizeScaleFollowSystem_ = true;
     int performanceMonitorTypesMask_ = 0;
     bool useOhSharedPreferences_ = true;    // 默认使用新的SharedPreferencesModule
+    std::string firstFrameReplayVersion_;
+    bool viewFlattening_ = false;
+    bool pauseUIFlushWhenHidden_ = false;
 };
 
 #endif  // CORE_RENDER_OHOS_KRCONFIG_H
@@ -0,0 +1,266 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRHANDLETABLE_H
+#define CORE_RENDER_OHOS_KRHANDLETABLE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "libohos_render/foundation/KRSlotId.h"
+
+/**
+ * 不透明的 64 位句柄：高 32 位为代数，低 32 位为槽位下标 + 1，0 永远无效
+ */
+using KRHandle = uint64_t;
+using KRHandleCodec = KRSlotIdCodec<KRHandle, 32>;
+constexpr KRHandle kKRInvalidHandle = 0;
+
+/** 句柄与 C 接口 userData 之间的转换（64 位平台上指针可以无损容纳句柄） */
+inline void *KRHandleToPointer(KRHandle handle) {
+    static_assert(sizeof(void *) >= sizeof(KRHandle), "handle must fit in a pointer");
+    return reinterpret_cast<void *>(static_cast<uintptr_t>(handle));
+}
+
+inline KRHandle KRHandleFromPointer(const void *pointer) {
+    return static_cast<KRHandle>(reinterpret_cast<uintptr_t>(pointer));
+}
+
+/**
+ * 多线程共享的句柄表（header-only，可在 host 上单测）。
+ *
+ * KRSlotTable 只给单线程使用（底层 vector 扩容会移动槽位），这里是可以被多个线程同时访问的版本：
+ *   * 槽位按块分配，块一旦分配就不再移动或释放，读线程无需表级锁；
+ *   * 值放在插入后不再修改的节点里，槽位只保存节点指针。Get/Contains 无锁：
+ *     登记读者计数、原子读取节点指针、校验代数后拷贝值，不会等待其他线程；
+ *   * 删除只摘下节点并挂入待回收列表，写操作发现没有进行中的读者时才释放，
+ *     读者拿到的节点在读取期间始终有效；
+ *   * 只有插入/删除会拿表级锁维护空闲链表与待回收列表。
+ * 槽位被删除后代数加一，旧句柄永远不会命中新值。
+ */
+template <typename T>
+class KRHandleTable {
+ public:
+    static constexpr uint32_t kChunkBits = 8;
+    static constexpr uint32_t kChunkSize = 1u << kChunkBits;
+    static constexpr uint32_t kMaxChunks = 1024;
+
+    KRHandleTable() {
+        for (auto &chunk : chunks_) {
+            chunk.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~KRHandleTable() {
+        for (auto &chunk : chunks_) {
+            auto slots = chunk.load(std::memory_order_relaxed);
+            if (slots == nullptr) {
+                continue;
+            }
+            for (uint32_t i = 0; i < kChunkSize; i++) {
+                delete slots[i].node.load(std::memory_order_relaxed);
+            }
+            delete[] slots;
+        }
+        for (auto node : retired_) {
+            delete node;
+        }
+    }
+
+    KRHandleTable(const KRHandleTable &) = delete;
+    KRHandleTable &operator=(const KRHandleTable &) = delete;
+
+    /**
+     * 插入一个值
+     * @return 值对应的句柄，槽位耗尽时返回 kKRInvalidHandle
+     */
+    KRHandle Insert(T value) {
+        std::vector<Node *> reclaimed;
+        KRHandle handle = kKRInvalidHandle;
+        {
+            std::lock_guard<std::mutex> lock(write_mutex_);
+            uint32_t index;
+            if (!free_indexes_.empty()) {
+                index = free_indexes_.back();
+                free_indexes_.pop_back();
+            } else {
+                if (next_index_ >= kChunkSize * kMaxChunks) {
+                    return kKRInvalidHandle;
+                }
+                index = next_index_++;
+                auto &chunk = chunks_[index >> kChunkBits];
+                if (chunk.load(std::memory_order_relaxed) == nullptr) {
+                    chunk.store(new Slot[kChunkSize], std::memory_order_release);
+                }
+            }
+            auto &slot = SlotAt(index);
+            // 奇数代数表示占用
+            uint32_t generation = slot.generation.load(std::memory_order_relaxed) + 1;
+            slot.node.store(new Node{generation, std::move(value)});
+            slot.generation.store(generation, std::memory_order_release);
+            size_.fetch_add(1, std::memory_order_relaxed);
+            handle = KRHandleCodec::Encode(generation, index);
+            TakeReclaimableLocked(reclaimed);
+        }
+        DeleteNodes(reclaimed);
+        return handle;
+    }
+
+    /**
+     * 查找句柄对应的值（可在任意线程调用，无锁）
+     * @return 句柄无效或已过期时返回 T{}
+     */
+    T Get(KRHandle handle) const {
+        uint32_t generation = 0;
+        uint32_t index = 0;
+        if (!Decode(handle, &generation, &index)) {
+            return T{};
+        }
+        ReaderScope reader(active_readers_);
+        const Slot *slot = SlotAtOrNull(index);
+        if (slot == nullptr) {
+            return T{};
+        }
+        const Node *node = slot->node.load();
+        if (node == nullptr || node->generation != generation) {
+            return T{};
+        }
+        return node->value;
+    }
+
+    /** 无锁判断句柄是否仍有效 */
+    bool Contains(KRHandle handle) const {
+        uint32_t generation = 0;
+        uint32_t index = 0;
+        if (!Decode(handle, &generation, &index)) {
+            return false;
+        }
+        const Slot *slot = SlotAtOrNull(index);
+        return slot != nullptr && slot->generation.load(std::memory_order_acquire) == generation;
+    }
+
+    /**
+     * 删除句柄对应的值
+     * @return 被删除的值（在锁外析构），句柄无效或已过期时返回 T{}
+     */
+    T Remove(KRHandle handle) {
+        std::vector<Node *> reclaimed;
+        T value{};
+        {
+            std::lock_guard<std::mutex> lock(write_mutex_);
+            uint32_t generation = 0;
+            uint32_t index = 0;
+            if (!Decode(handle, &generation, &index)) {
+                return T{};
+            }
+            Slot *slot = const_cast<Slot *>(SlotAtOrNull(index));
+            if (slot == nullptr || slot->generation.load(std::memory_order_relaxed) != generation) {
+                return T{};
+            }
+            slot->generation.store(generation + 1, std::memory_order_release);
+            Node *node = slot->node.exchange(nullptr);
+            // 读者可能仍在拷贝节点里的值，这里只拷贝不移动，节点随后回收
+            value = node->value;
+            retired_.push_back(node);
+            free_indexes_.push_back(index);
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            TakeReclaimableLocked(reclaimed);
+        }
+        DeleteNodes(reclaimed);
+        return value;
+    }
+
+    size_t Size() const {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    /** 已删除但尚未回收的节点数（单测用） */
+    size_t RetiredCount() {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        return retired_.size();
+    }
+
+ private:
+    struct Node {
+        uint32_t generation;
+        T value;
+    };
+
+    struct Slot {
+        std::atomic<uint32_t> generation{0};
+        std::atomic<Node *> node{nullptr};
+    };
+
+    /** Get 期间登记为读者，写操作据此判断被摘下的节点能否释放 */
+    class ReaderScope {
+     public:
+        explicit ReaderScope(std::atomic<uint32_t> &readers) : readers_(readers) {
+            readers_.fetch_add(1);
+        }
+        ~ReaderScope() {
+            readers_.fetch_sub(1);
+        }
+        ReaderScope(const ReaderScope &) = delete;
+        ReaderScope &operator=(const ReaderScope &) = delete;
+
+     private:
+        std::atomic<uint32_t> &readers_;
+    };
+
+    static bool Decode(KRHandle handle, uint32_t *generation, uint32_t *index) {
+        return KRHandleCodec::Decode(handle, generation, index) && (*generation & 1) != 0 &&
+               *index < kChunkSize * kMaxChunks;
+    }
+
+    Slot &SlotAt(uint32_t index) {
+        return chunks_[index >> kChunkBits].load(std::memory_order_relaxed)[index & (kChunkSize - 1)];
+    }
+
+    const Slot *SlotAtOrNull(uint32_t index) const {
+        const Slot *chunk = chunks_[index >> kChunkBits].load(std::memory_order_acquire);
+        return chunk == nullptr ? nullptr : &chunk[index & (kChunkSize - 1)];
+    }
+
+    /**
+     * 没有进行中的读者时取走全部待回收节点（须持有 write_mutex_）。
+     * 节点指针的摘除与读者计数都是 seq_cst：这里读到 0，说明之后开始的 Get 只会看到新的节点指针
+     */
+    void TakeReclaimableLocked(std::vector<Node *> &out) {
+        if (!retired_.empty() && active_readers_.load() == 0) {
+            out.swap(retired_);
+        }
+    }
+
+    /** 在锁外释放节点，值的析构可能回调到本表 */
+    static void DeleteNodes(const std::vector<Node *> &nodes) {
+        for (auto node : nodes) {
+            delete node;
+        }
+    }
+
+    std::array<std::atomic<Slot *>, kMaxChunks> chunks_;
+    mutable std::atomic<uint32_t> active_readers_{0};
+    std::mutex write_mutex_;
+    std::vector<uint32_t> free_indexes_;
+    std::vector<Node *> retired_;
+    uint32_t next_index_ = 0;
+    std::atomic<size_t> size_{0};
+};
+
+#endif  // CORE_RENDER_OHOS_KRHANDLETABLE_H
@@ -0,0 +1,199 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRNODELIVENESSTABLE_H
+#define CORE_RENDER_OHOS_KRNODELIVENESSTABLE_H
+
+#include <cstdint>
+#include <vector>
+#include "libohos_render/foundation/KRSlotId.h"
+
+/** 节点ID：高 32 位为代数，低 32 位为槽位下标 + 1，0 永远无效（与 KRHandle 同一编码） */
+using KRNodeId = uint64_t;
+using KRNodeIdCodec = KRSlotIdCodec<KRNodeId, 32>;
+
+/**
+ * 节点存活表（非线程安全，归主线程所有，header-only，可在 host 上单测）。
+ *
+ * 每个节点在登记时分配一个带代数的 ID，节点销毁后槽位代数加一，旧 ID 永远不会再命中。
+ *   * 按 ID 校验只比较一次槽位代数；
+ *   * 按节点指针校验走开放寻址（线性探测、负载不超过 1/2）的索引，通常一次探测即可命中，
+ *     删除使用后移补位而不是墓碑，长时间运行也不会退化；
+ * 整个过程不加锁、不分配内存（扩容除外），开销低到可以在 release 包中常开。
+ */
+class KRNodeLivenessTable {
+ public:
+    KRNodeLivenessTable() {
+        buckets_.assign(kInitialBuckets, kEmptyBucket);
+    }
+
+    /**
+     * 登记节点
+     * @return 节点ID，重复登记返回已有ID
+     */
+    KRNodeId Add(const void *node) {
+        if (node == nullptr) {
+            return 0;
+        }
+        size_t bucket = FindBucket(node);
+        if (buckets_[bucket] != kEmptyBucket) {
+            return MakeId(buckets_[bucket]);
+        }
+        uint32_t index;
+        if (!free_indexes_.empty()) {
+            index = free_indexes_.back();
+            free_indexes_.pop_back();
+        } else {
+            index = static_cast<uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+        auto &slot = slots_[index];
+        slot.node = node;
+        slot.generation++;
+        buckets_[bucket] = index;
+        size_++;
+        if (size_ * 2 > buckets_.size()) {
+            Rehash(buckets_.size() * 2);
+        }
+        return MakeId(index);
+    }
+
+    /**
+     * 注销节点，之前分配的 ID 随之失效
+     * @return 节点是否登记过
+     */
+    bool Remove(const void *node) {
+        if (node == nullptr) {
+            return false;
+        }
+        size_t bucket = FindBucket(node);
+        uint32_t index = buckets_[bucket];
+        if (index == kEmptyBucket) {
+            return false;
+        }
+        auto &slot = slots_[index];
+        slot.node = nullptr;
+        slot.generation++;
+        free_indexes_.push_back(index);
+        size_--;
+        EraseBucket(bucket);
+        return true;
+    }
+
+    bool Contains(const void *node) const {
+        return node != nullptr && buckets_[FindBucket(node)] != kEmptyBucket;
+    }
+
+    /** 节点当前的 ID，未登记时返回 0 */
+    KRNodeId IdOf(const void *node) const {
+        if (node == nullptr) {
+            return 0;
+        }
+        uint32_t index = buckets_[FindBucket(node)];
+        return index == kEmptyBucket ? 0 : MakeId(index);
+    }
+
+    /** 按 ID 校验，一次下标访问 + 一次比较 */
+    bool IsAlive(KRNodeId id) const {
+        uint32_t generation;
+        uint32_t index;
+        if (!KRNodeIdCodec::Decode(id, &generation, &index) || index >= slots_.size()) {
+            return false;
+        }
+        const auto &slot = slots_[index];
+        return slot.node != nullptr && slot.generation == generation;
+    }
+
+    size_t Size() const {
+        return size_;
+    }
+
+    void Clear() {
+        for (auto &slot : slots_) {
+            if (slot.node != nullptr) {
+                slot.node = nullptr;
+                slot.generation++;
+            }
+        }
+        free_indexes_.clear();
+        for (uint32_t i = static_cast<uint32_t>(slots_.size()); i > 0; i--) {
+            free_indexes_.push_back(i - 1);
+        }
+        buckets_.assign(buckets_.size(), kEmptyBucket);
+        size_ = 0;
+    }
+
+ private:
+    static constexpr uint32_t kEmptyBucket = UINT32_MAX;
+    static constexpr size_t kInitialBuckets = 1024;
+
+    struct Slot {
+        const void *node = nullptr;
+        uint32_t generation = 0;
+    };
+
+    KRNodeId MakeId(uint32_t index) const {
+        return KRNodeIdCodec::Encode(slots_[index].generation, index);
+    }
+
+    size_t Hash(const void *node) const {
+        // 指针低位恒为 0，Fibonacci 散列把高位的差异打散到桶下标
+        auto value = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(node)) >> 3;
+        return static_cast<size_t>((value * 0x9E3779B97F4A7C15ull) >> 32) & (buckets_.size() - 1);
+    }
+
+    /** 返回节点所在的桶，不存在时返回探测序列上的第一个空桶 */
+    size_t FindBucket(const void *node) const {
+        size_t mask = buckets_.size() - 1;
+        for (size_t bucket = Hash(node);; bucket = (bucket + 1) & mask) {
+            uint32_t index = buckets_[bucket];
+            if (index == kEmptyBucket || slots_[index].node == node) {
+                return bucket;
+            }
+        }
+    }
+
+    /** 线性探测的后移删除：把后续同一探测链上的条目前移补位 */
+    void EraseBucket(size_t bucket) {
+        size_t mask = buckets_.size() - 1;
+        size_t hole = bucket;
+        for (size_t next = (hole + 1) & mask; buckets_[next] != kEmptyBucket; next = (next + 1) & mask) {
+            size_t home = Hash(slots_[buckets_[next]].node);
+            // home 不在 (hole, next] 区间内时，该条目可以移到 hole
+            bool movable = hole <= next ? (home <= hole || home > next) : (home <= hole && home > next);
+            if (movable) {
+                buckets_[hole] = buckets_[next];
+                hole = next;
+            }
+        }
+        buckets_[hole] = kEmptyBucket;
+    }
+
+    void Rehash(size_t bucket_count) {
+        buckets_.assign(bucket_count, kEmptyBucket);
+        for (uint32_t index = 0; index < slots_.size(); index++) {
+            if (slots_[index].node != nullptr) {
+                buckets_[FindBucket(slots_[index].node)] = index;
+            }
+        }
+    }
+
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> buckets_;
+    std::vector<uint32_t> free_indexes_;
+    size_t size_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRNODELIVENESSTABLE_H
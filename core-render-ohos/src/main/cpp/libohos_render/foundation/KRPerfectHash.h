@@ -0,0 +1,190 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRPERFECTHASH_H
+#define CORE_RENDER_OHOS_KRPERFECTHASH_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+/**
+ * 带种子的 FNV-1a 字符串哈希（constexpr，可在编译期求值）
+ */
+constexpr uint32_t KRPerfectHashString(std::string_view key, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ (seed * 16777619u);
+    for (char c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * 用位移值 displacement 把字符串哈希重新打散到槽位上（murmur3 fmix32）
+ */
+constexpr uint32_t KRPerfectHashMix(uint32_t hash, uint32_t displacement) {
+    hash ^= displacement * 0x9E3779B9u;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/**
+ * 编译期构建的字符串完美哈希索引（header-only，可在 host 上单测）。
+ *
+ * 采用 hash-and-displace：key 先按哈希分桶，再从大桶到小桶为每个桶找一个位移值，
+ * 使桶内 key 重新打散后落在互不冲突的空槽位上。查找只需对 key 做一次哈希、读一个位移值
+ * 再做一次字符串比较，没有链表与堆分配。用 constexpr 变量定义时整个表在编译期生成，
+ * key 重复会导致构建失败，直接表现为编译错误。
+ * @tparam N key 的数量
+ */
+template <size_t N>
+class KRPerfectHashIndex {
+ public:
+    static constexpr size_t PowerOfTwoAtLeast(size_t value) {
+        size_t count = 1;
+        while (count < value) {
+            count <<= 1;
+        }
+        return count;
+    }
+    static constexpr size_t kBucketCount = PowerOfTwoAtLeast(N);
+    static constexpr size_t kSlotCount = PowerOfTwoAtLeast(N * 2);
+    static constexpr uint32_t kMaxSeed = 16;
+    static constexpr uint32_t kMaxDisplacement = 1u << 16;
+
+    /**
+     * @param entries 条目数组
+     * @param key_of 从条目中取出 key 的函数
+     */
+    template <typename Entry, typename KeyOf>
+    constexpr KRPerfectHashIndex(const Entry (&entries)[N], KeyOf key_of) {
+        for (size_t i = 0; i < N; i++) {
+            keys_[i] = key_of(entries[i]);
+            for (size_t j = 0; j < i; j++) {
+                if (keys_[j] == keys_[i]) {
+                    throw std::logic_error("KRPerfectHashIndex: duplicate keys");
+                }
+            }
+        }
+        // 不同 key 的 32 位哈希完全相同时换一个种子重建
+        for (uint32_t seed = 0; seed < kMaxSeed; seed++) {
+            if (TryBuild(seed)) {
+                seed_ = seed;
+                return;
+            }
+        }
+        throw std::logic_error("KRPerfectHashIndex: no perfect hash found");
+    }
+
+    /**
+     * @return key 在构造数组中的下标，不存在时返回 -1
+     */
+    constexpr int Find(std::string_view key) const {
+        uint32_t hash = KRPerfectHashString(key, seed_);
+        uint32_t displacement = displacements_[hash & (kBucketCount - 1)];
+        int index = slots_[KRPerfectHashMix(hash, displacement) & (kSlotCount - 1)];
+        return index >= 0 && keys_[index] == key ? index : -1;
+    }
+
+    constexpr uint32_t Seed() const {
+        return seed_;
+    }
+
+ private:
+    constexpr bool TryBuild(uint32_t seed) {
+        std::array<uint32_t, N> hashes{};
+        std::array<size_t, kBucketCount> bucket_sizes{};
+        for (size_t i = 0; i < N; i++) {
+            hashes[i] = KRPerfectHashString(keys_[i], seed);
+            bucket_sizes[hashes[i] & (kBucketCount - 1)]++;
+        }
+        for (auto &slot : slots_) {
+            slot = -1;
+        }
+        for (auto &displacement : displacements_) {
+            displacement = 0;
+        }
+        // 大桶约束最多，先放
+        std::array<bool, kBucketCount> placed{};
+        for (size_t round = 0; round < kBucketCount; round++) {
+            size_t bucket = kBucketCount;
+            for (size_t b = 0; b < kBucketCount; b++) {
+                if (placed[b] || bucket_sizes[b] == 0) {
+                    continue;
+                }
+                if (bucket == kBucketCount || bucket_sizes[b] > bucket_sizes[bucket]) {
+                    bucket = b;
+                }
+            }
+            if (bucket == kBucketCount) {
+                return true;
+            }
+            placed[bucket] = true;
+            if (!PlaceBucket(hashes, bucket)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr bool PlaceBucket(const std::array<uint32_t, N> &hashes, size_t bucket) {
+        for (uint32_t displacement = 0; displacement < kMaxDisplacement; displacement++) {
+            bool ok = true;
+            size_t taken = 0;
+            for (size_t i = 0; i < N && ok; i++) {
+                if ((hashes[i] & (kBucketCount - 1)) != bucket) {
+                    continue;
+                }
+                auto &slot = slots_[KRPerfectHashMix(hashes[i], displacement) & (kSlotCount - 1)];
+                if (slot >= 0) {
+                    ok = false;
+                } else {
+                    slot = static_cast<int16_t>(i);
+                    taken++;
+                }
+            }
+            if (ok) {
+                displacements_[bucket] = displacement;
+                return true;
+            }
+            // 撤销本次尝试占用的槽位
+            for (size_t i = 0; i < N && taken > 0; i++) {
+                if ((hashes[i] & (kBucketCount - 1)) != bucket) {
+                    continue;
+                }
+                auto &slot = slots_[KRPerfectHashMix(hashes[i], displacement) & (kSlotCount - 1)];
+                if (slot == static_cast<int16_t>(i)) {
+                    slot = -1;
+                    taken--;
+                }
+            }
+        }
+        return false;
+    }
+
+    std::array<std::string_view, N> keys_{};
+    std::array<uint32_t, kBucketCount> displacements_{};
+    std::array<int16_t, kSlotCount> slots_{};
+    uint32_t seed_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRPERFECTHASH_H
@@ -0,0 +1,70 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRSLOTID_H
+#define CORE_RENDER_OHOS_KRSLOTID_H
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * "槽位 + 代数" ID 的统一编解码，KRSlotTable / KRHandleTable / KRNodeLivenessTable 共用。
+ *
+ * ID = (generation << IndexBits) | (index + 1)：低位存槽位下标 + 1，因此 0 永远无效；
+ * 有符号 ID 只使用非符号位，保证编码结果恒为非负数。
+ */
+template <typename Id, int IndexBits>
+struct KRSlotIdCodec {
+    static_assert(std::numeric_limits<Id>::is_integer, "id must be an integer");
+    static_assert(IndexBits > 0 && IndexBits <= 32 && IndexBits < std::numeric_limits<Id>::digits,
+                  "index bits out of range");
+
+    static constexpr int kIndexBits = IndexBits;
+    static constexpr int kGenerationBits = std::numeric_limits<Id>::digits - IndexBits;
+    static constexpr uint64_t kLowMask = (uint64_t(1) << IndexBits) - 1;
+    /** 可编码的槽位数（低位为 0 表示无效） */
+    static constexpr uint32_t kMaxSlots = static_cast<uint32_t>(kLowMask);
+    static constexpr uint32_t kMaxGeneration =
+        kGenerationBits >= 32 ? UINT32_MAX : static_cast<uint32_t>((uint64_t(1) << kGenerationBits) - 1);
+
+    static Id Encode(uint32_t generation, uint32_t index) {
+        return static_cast<Id>((static_cast<uint64_t>(generation) << IndexBits) | (static_cast<uint64_t>(index) + 1));
+    }
+
+    /**
+     * 解出代数与槽位下标
+     * @return ID 为 0、负数或低位为 0 时返回 false
+     */
+    static bool Decode(Id id, uint32_t *generation, uint32_t *index) {
+        if (id <= 0) {
+            return false;
+        }
+        auto bits = static_cast<uint64_t>(id);
+        auto low = static_cast<uint32_t>(bits & kLowMask);
+        if (low == 0) {
+            return false;
+        }
+        *generation = static_cast<uint32_t>(bits >> IndexBits);
+        *index = low - 1;
+        return true;
+    }
+
+    /** 代数加一，超过可编码范围时回绕到 first */
+    static uint32_t NextGeneration(uint32_t generation, uint32_t first = 1) {
+        return generation >= kMaxGeneration ? first : generation + 1;
+    }
+};
+
+#endif  // CORE_RENDER_OHOS_KRSLOTID_H
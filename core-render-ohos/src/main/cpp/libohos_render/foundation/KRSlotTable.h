@@ -0,0 +1,164 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRSLOTTABLE_H
+#define CORE_RENDER_OHOS_KRSLOTTABLE_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "libohos_render/foundation/KRSlotId.h"
+
+/**
+ * 以整数ID索引的稠密槽位表（非线程安全）。
+ *
+ * ID 按 KRSlotIdCodec 编码（高位代数、低位槽位下标 + 1），槽位释放后通过空闲链表复用，
+ * 复用时代数加一，过期ID不会命中新值。ID恒为正数，0永远无效。
+ * 插入、查找、取出均为O(1)且只访问一次数组。
+ */
+template <typename T>
+class KRSlotTable {
+ public:
+    using Codec = KRSlotIdCodec<int32_t, 20>;
+    static constexpr int kIndexBits = Codec::kIndexBits;
+    static constexpr int32_t kIndexMask = static_cast<int32_t>(Codec::kLowMask);
+    static constexpr uint32_t kMaxGeneration = Codec::kMaxGeneration;
+
+    /**
+     * 插入一个值
+     * @return 值对应的ID，槽位耗尽时返回0
+     */
+    int32_t Insert(T value) {
+        uint32_t index;
+        if (free_head_ >= 0) {
+            index = static_cast<uint32_t>(free_head_);
+            free_head_ = slots_[index].next_free;
+        } else {
+            if (slots_.size() >= Codec::kMaxSlots) {
+                return 0;
+            }
+            index = static_cast<uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+        auto &slot = slots_[index];
+        slot.value = std::move(value);
+        slot.occupied = true;
+        size_++;
+        return Codec::Encode(slot.generation, index);
+    }
+
+    /**
+     * 查找ID对应的值，不存在或已过期时返回nullptr
+     */
+    T *Find(int32_t id) {
+        auto *slot = SlotOf(id);
+        return slot ? &slot->value : nullptr;
+    }
+
+    /**
+     * 取出并删除ID对应的值
+     * @return 是否存在
+     */
+    bool Take(int32_t id, T &out) {
+        auto *slot = SlotOf(id);
+        if (slot == nullptr) {
+            return false;
+        }
+        out = std::move(slot->value);
+        Release(static_cast<uint32_t>(slot - slots_.data()));
+        return true;
+    }
+
+    /**
+     * 只查找一次，pred(value) 为 true 时取出并删除，否则拷贝一份留在表中
+     * @return 是否存在
+     */
+    template <typename Pred>
+    bool TakeIf(int32_t id, Pred &&pred, T &out) {
+        auto *slot = SlotOf(id);
+        if (slot == nullptr) {
+            return false;
+        }
+        if (pred(static_cast<const T &>(slot->value))) {
+            out = std::move(slot->value);
+            Release(static_cast<uint32_t>(slot - slots_.data()));
+        } else {
+            out = slot->value;
+        }
+        return true;
+    }
+
+    /**
+     * 删除ID对应的值
+     * @return 是否存在
+     */
+    bool Erase(int32_t id) {
+        auto *slot = SlotOf(id);
+        if (slot == nullptr) {
+            return false;
+        }
+        Release(static_cast<uint32_t>(slot - slots_.data()));
+        return true;
+    }
+
+    size_t Size() const {
+        return size_;
+    }
+
+    void Clear() {
+        for (uint32_t i = 0; i < slots_.size(); i++) {
+            if (slots_[i].occupied) {
+                Release(i);
+            }
+        }
+    }
+
+ private:
+    struct Slot {
+        T value{};
+        uint32_t generation = 1;
+        int32_t next_free = -1;
+        bool occupied = false;
+    };
+
+    Slot *SlotOf(int32_t id) {
+        uint32_t generation;
+        uint32_t index;
+        if (!Codec::Decode(id, &generation, &index) || index >= slots_.size()) {
+            return nullptr;
+        }
+        auto &slot = slots_[index];
+        if (!slot.occupied || slot.generation != generation) {
+            return nullptr;
+        }
+        return &slot;
+    }
+
+    void Release(uint32_t index) {
+        auto &slot = slots_[index];
+        slot.value = T{};
+        slot.occupied = false;
+        slot.generation = Codec::NextGeneration(slot.generation);
+        slot.next_free = free_head_;
+        free_head_ = static_cast<int32_t>(index);
+        size_--;
+    }
+
+    std::vector<Slot> slots_;
+    int32_t free_head_ = -1;
+    size_t size_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRSLOTTABLE_H
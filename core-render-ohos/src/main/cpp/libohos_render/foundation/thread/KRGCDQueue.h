@@ -16,10 +16,12 @@
 #ifndef CORE_RENDER_OHOS_KRGCDQUEUE_H
 #define CORE_RENDER_OHOS_KRGCDQUEUE_H
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -51,6 +53,54 @@ class KRGCDQueue {
         condition.notify_one();
     }
 
+    /**
+     * 将 [0, count) 的下标分发到线程池并行执行 body，阻塞直到全部完成。
+     * 调用线程同样参与领取下标，因此即使线程池繁忙也不会死等；各下标只会被执行一次。
+     * @param count 任务数
+     * @param body 任务体，参数为下标，需保证不同下标之间互不依赖
+     */
+    void ParallelFor(size_t count, const std::function<void(size_t)> &body) {
+        if (count == 0) {
+            return;
+        }
+        if (count == 1) {
+            body(0);
+            return;
+        }
+        struct ParallelState {
+            std::function<void(size_t)> body;
+            size_t count = 0;
+            std::atomic<size_t> next{0};
+            size_t finished = 0;
+            std::mutex mutex;
+            std::condition_variable done;
+        };
+        auto state = std::make_shared<ParallelState>();
+        state->body = body;
+        state->count = count;
+        auto drain = [](ParallelState &s) {
+            size_t executed = 0;
+            for (size_t i = s.next.fetch_add(1); i < s.count; i = s.next.fetch_add(1)) {
+                s.body(i);
+                executed++;
+            }
+            if (executed > 0) {
+                std::lock_guard<std::mutex> lock(s.mutex);
+                s.finished += executed;
+                if (s.finished == s.count) {
+                    s.done.notify_all();
+                }
+            }
+        };
+        size_t helpers = std::min(count - 1, threads.size());
+        for (size_t i = 0; i < helpers; i++) {
+            DispatchAsync([state, drain] { drain(*state); });
+        }
+        drain(*state);
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->done.wait(lock, [&state] { return state->finished == state->count; });
+    }
+
  private:
     // 将构造函数设为私有
     explicit KRGCDQueue(size_t num_threads) {
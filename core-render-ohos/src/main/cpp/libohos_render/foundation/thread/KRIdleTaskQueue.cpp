@@ -0,0 +1,71 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/thread/KRIdleTaskQueue.h"
+
+#include <chrono>
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/foundation/thread/KRVSyncScheduler.h"
+
+// 与 VSync 时间戳同为 CLOCK_MONOTONIC
+static int64_t NowNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+KRIdleTaskQueue &KRIdleTaskQueue::GetInstance() {
+    static KRIdleTaskQueue instance;
+    return instance;
+}
+
+void KRIdleTaskQueue::PostIdleTask(Task task, int delay_ms) {
+    auto &queue = GetInstance();
+    auto eligible_ns = NowNanos() + static_cast<int64_t>(std::max(delay_ms, 0)) * 1000000;
+    if (queue.Enqueue(std::move(task), eligible_ns)) {
+        queue.RequestFrame();
+    }
+    int64_t fire_at_ns = 0;
+    if (queue.ArmDeadline(&fire_at_ns)) {
+        queue.ScheduleDeadline(fire_at_ns);
+    }
+}
+
+void KRIdleTaskQueue::RequestFrame() {
+    KRVSyncScheduler::GetInstance().PostFrameCallback([this](int64_t frame_time_nanos) {
+        BeginFrame(frame_time_nanos, NowNanos());
+        // 帧回调之后才轮到本帧的 UI 任务，切片放到下一个 loop，只使用这些工作之后剩下的时间
+        KRMainThread::RunOnMainThreadForNextLoop([this] {
+            RunSlice(NowNanos);
+            if (NeedsFrame()) {
+                RequestFrame();
+            }
+        });
+    });
+}
+
+void KRIdleTaskQueue::ScheduleDeadline(int64_t fire_at_ns) {
+    auto delay_ns = std::max<int64_t>(fire_at_ns - NowNanos(), 0);
+    auto delay_ms = static_cast<int>((delay_ns + 999999) / 1000000);
+    // VSync 停止时帧回调不再到来，由主线程定时器兜底执行超时的任务
+    KRMainThread::RunOnMainThread(
+        [this] {
+            RunOverdue(NowNanos);
+            int64_t next_fire_at_ns = 0;
+            if (ArmDeadline(&next_fire_at_ns)) {
+                ScheduleDeadline(next_fire_at_ns);
+            }
+        },
+        delay_ms);
+}
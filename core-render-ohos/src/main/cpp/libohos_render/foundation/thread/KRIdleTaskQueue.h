@@ -0,0 +1,224 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRIDLETASKQUEUE_H
+#define CORE_RENDER_OHOS_KRIDLETASKQUEUE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * 主线程空闲任务队列：view 销毁、节点释放等低优先级的收尾工作不在投递时立即执行，
+ * 而是跟随 VSync 在一帧的剩余时间里分片执行，避免和滚动等帧内工作抢主线程。
+ *
+ * 规则：
+ * - 每帧只执行一个切片，切片截止时间取"本帧结束前预留 kFrameMarginNs"与"切片开始 + kMaxSliceNs"中较早者
+ * - 帧内工作已经耗尽本帧时间时本帧不执行，等下一帧
+ * - 最早的可执行任务等待超过 kStarvationNs 时，本帧至少执行 kStarvedSliceNs，保证繁忙时也能逐步消化
+ * - 任务按可执行时间先后、同一时间按投递顺序执行；可以指定最短延迟
+ * - 另有主线程定时器兜底：VSync 停止（应用退后台、熄屏）时，任务在可执行时间之后 kDeadlineNs 内仍会执行
+ *
+ * 分片策略是纯逻辑，时间由调用方传入，便于单测；GetInstance/PostIdleTask 负责对接 VSync 与主线程。
+ */
+class KRIdleTaskQueue {
+ public:
+    using Task = std::function<void()>;
+
+    static constexpr int64_t kDefaultFrameIntervalNs = 16666667;
+    static constexpr int64_t kMinFrameIntervalNs = 4000000;   // 240Hz
+    static constexpr int64_t kMaxFrameIntervalNs = 33333334;  // 30Hz
+    static constexpr int64_t kFrameMarginNs = 1000000;        // 给系统渲染预留的时间
+    static constexpr int64_t kMaxSliceNs = 4000000;
+    static constexpr int64_t kStarvationNs = 200000000;
+    static constexpr int64_t kStarvedSliceNs = 2000000;
+    static constexpr int64_t kDeadlineNs = 500000000;
+
+    static KRIdleTaskQueue &GetInstance();
+
+    /**
+     * 投递空闲任务（任意线程可调用），任务在主线程执行
+     * @param task 任务
+     * @param delay_ms 最短延迟，到期前不会执行
+     */
+    static void PostIdleTask(Task task, int delay_ms = 0);
+
+    KRIdleTaskQueue() = default;
+    KRIdleTaskQueue(const KRIdleTaskQueue &) = delete;
+    KRIdleTaskQueue &operator=(const KRIdleTaskQueue &) = delete;
+
+    /**
+     * 入队，返回 true 表示需要调用方申请下一帧（同一时刻只会申请一次）
+     */
+    bool Enqueue(Task task, int64_t eligible_ns) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        heap_.push_back({eligible_ns, next_seq_++, std::move(task)});
+        std::push_heap(heap_.begin(), heap_.end(), Later);
+        return RequestFrameLocked();
+    }
+
+    /**
+     * VSync 到来时在主线程调用，更新帧间隔估计与本帧截止时间
+     * @param frame_time_ns VSync 时间戳，为 0 或与当前时间偏差过大时以 now_ns 为准
+     */
+    void BeginFrame(int64_t frame_time_ns, int64_t now_ns) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        frame_requested_ = false;
+        if (frame_time_ns <= 0 || frame_time_ns > now_ns || now_ns - frame_time_ns > kMaxFrameIntervalNs * 4) {
+            frame_time_ns = now_ns;
+        }
+        if (last_frame_time_ns_ > 0) {
+            auto delta = frame_time_ns - last_frame_time_ns_;
+            if (delta >= kMinFrameIntervalNs && delta <= kMaxFrameIntervalNs) {
+                // 刷新率升高时立即跟随，降低时缓慢跟随（中间丢帧的间隔不会被当作新的刷新率）
+                frame_interval_ns_ = delta < frame_interval_ns_ ? delta : (frame_interval_ns_ * 7 + delta) / 8;
+            }
+        }
+        last_frame_time_ns_ = frame_time_ns;
+        frame_deadline_ns_ = frame_time_ns + frame_interval_ns_ - kFrameMarginNs;
+    }
+
+    /**
+     * 在主线程执行一个切片
+     * @param clock 返回当前时间（ns）
+     * @return 本次执行的任务数
+     */
+    template <typename Clock>
+    size_t RunSlice(Clock &&clock) {
+        auto now = clock();
+        auto deadline = std::min(frame_deadline_ns_, now + kMaxSliceNs);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!heap_.empty() && heap_.front().eligible_ns <= now && now - heap_.front().eligible_ns >= kStarvationNs) {
+                deadline = std::max(deadline, now + kStarvedSliceNs);
+            }
+        }
+        size_t count = 0;
+        Task task;
+        while (now < deadline && PopEligible(now, &task)) {
+            task();
+            task = nullptr;
+            count++;
+            now = clock();
+        }
+        return count;
+    }
+
+    /**
+     * 申请兜底定时器，同一时刻只会申请一个
+     * @param fire_at_ns 返回 true 时写入定时器的触发时间（最早任务的可执行时间 + kDeadlineNs）
+     * @return true 表示需要调用方设置定时器
+     */
+    bool ArmDeadline(int64_t *fire_at_ns) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (deadline_armed_ || heap_.empty()) {
+            return false;
+        }
+        deadline_armed_ = true;
+        *fire_at_ns = heap_.front().eligible_ns + kDeadlineNs;
+        return true;
+    }
+
+    /**
+     * 兜底定时器到期时在主线程调用，执行已超过截止时间的任务，单次不超过 kMaxSliceNs；
+     * 调用后需再次 ArmDeadline 以覆盖剩余任务
+     * @param clock 返回当前时间（ns）
+     * @return 本次执行的任务数
+     */
+    template <typename Clock>
+    size_t RunOverdue(Clock &&clock) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            deadline_armed_ = false;
+        }
+        auto now = clock();
+        auto deadline = now + kMaxSliceNs;
+        size_t count = 0;
+        Task task;
+        while (now < deadline && PopEligible(now - kDeadlineNs, &task)) {
+            task();
+            task = nullptr;
+            count++;
+            now = clock();
+        }
+        return count;
+    }
+
+    /**
+     * 切片执行完后调用，仍有任务时返回 true 表示需要申请下一帧
+     */
+    bool NeedsFrame() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return !heap_.empty() && RequestFrameLocked();
+    }
+
+    size_t PendingCount() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return heap_.size();
+    }
+
+    int64_t FrameInterval() const {
+        return frame_interval_ns_;
+    }
+
+ private:
+    struct Entry {
+        int64_t eligible_ns;
+        uint64_t seq;
+        Task task;
+    };
+
+    // 小顶堆：可执行时间早的在前，相同时按投递顺序
+    static bool Later(const Entry &lhs, const Entry &rhs) {
+        return lhs.eligible_ns != rhs.eligible_ns ? lhs.eligible_ns > rhs.eligible_ns : lhs.seq > rhs.seq;
+    }
+
+    // 弹出可执行时间不晚于 limit_ns 的最早任务
+    bool PopEligible(int64_t limit_ns, Task *task) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (heap_.empty() || heap_.front().eligible_ns > limit_ns) {
+            return false;
+        }
+        std::pop_heap(heap_.begin(), heap_.end(), Later);
+        *task = std::move(heap_.back().task);
+        heap_.pop_back();
+        return true;
+    }
+
+    bool RequestFrameLocked() {
+        if (frame_requested_) {
+            return false;
+        }
+        frame_requested_ = true;
+        return true;
+    }
+
+    void RequestFrame();
+    void ScheduleDeadline(int64_t fire_at_ns);
+
+    std::mutex mutex_;
+    std::vector<Entry> heap_;
+    uint64_t next_seq_ = 0;
+    bool frame_requested_ = false;
+    bool deadline_armed_ = false;
+    // 以下只在主线程访问
+    int64_t frame_interval_ns_ = kDefaultFrameIntervalNs;
+    int64_t last_frame_time_ns_ = 0;
+    int64_t frame_deadline_ns_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRIDLETASKQUEUE_H
@@ -0,0 +1,73 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/thread/KRVSyncScheduler.h"
+
+#include <cstring>
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/utils/KRRenderLoger.h"
+
+static constexpr char kVSyncName[] = "KRVSyncScheduler";
+
+KRVSyncScheduler &KRVSyncScheduler::GetInstance() {
+    static KRVSyncScheduler instance;
+    return instance;
+}
+
+KRVSyncScheduler::KRVSyncScheduler() {
+    native_vsync_ = OH_NativeVSync_Create(kVSyncName, strlen(kVSyncName));
+}
+
+KRVSyncScheduler::~KRVSyncScheduler() {
+    if (native_vsync_) {
+        OH_NativeVSync_Destroy(native_vsync_);
+        native_vsync_ = nullptr;
+    }
+}
+
+void KRVSyncScheduler::PostFrameCallback(FrameCallback callback) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_callbacks_.push_back(std::move(callback));
+        if (frame_requested_) {
+            return;
+        }
+        frame_requested_ = true;
+    }
+    if (native_vsync_ && OH_NativeVSync_RequestFrame(native_vsync_, &KRVSyncScheduler::OnVSync, this) == 0) {
+        return;
+    }
+    KR_LOG_ERROR << "KRVSyncScheduler request frame failed, fallback to next main loop.";
+    KRMainThread::RunOnMainThreadForNextLoop([this] { DispatchFrameCallbacks(0); });
+}
+
+void KRVSyncScheduler::OnVSync(long long timestamp, void *data) {
+    // VSync 回调运行在系统 VSync 线程，切回主线程后再统一取出回调，
+    // 保证切线程期间新投递的回调也能在本帧执行，而不会额外再申请一次 VSync
+    auto *scheduler = static_cast<KRVSyncScheduler *>(data);
+    KRMainThread::RunOnMainThread([scheduler, timestamp] { scheduler->DispatchFrameCallbacks(timestamp); });
+}
+
+void KRVSyncScheduler::DispatchFrameCallbacks(int64_t frame_time_nanos) {
+    std::vector<FrameCallback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callbacks.swap(pending_callbacks_);
+        frame_requested_ = false;
+    }
+    for (const auto &callback : callbacks) {
+        callback(frame_time_nanos);
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRVSYNCSCHEDULER_H
+#define CORE_RENDER_OHOS_KRVSYNCSCHEDULER_H
+
+#include <native_vsync/native_vsync.h>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * 进程级 VSync 调度器：把需要"每帧最多执行一次"的主线程任务对齐到 VSync。
+ * 同一帧内的多次 PostFrameCallback 只会向系统申请一次 VSync，
+ * VSync 到来后回调统一切回主线程按投递顺序执行。
+ */
+class KRVSyncScheduler {
+ public:
+    using FrameCallback = std::function<void(int64_t frame_time_nanos)>;
+
+    static KRVSyncScheduler &GetInstance();
+
+    KRVSyncScheduler(const KRVSyncScheduler &) = delete;
+    KRVSyncScheduler &operator=(const KRVSyncScheduler &) = delete;
+
+    /**
+     * 在下一个 VSync 后于主线程执行回调（任意线程可调用）
+     * @param callback 回调，参数为 VSync 时间戳（ns），申请 VSync 失败时退化为下一个主线程 loop 执行，时间戳为 0
+     */
+    void PostFrameCallback(FrameCallback callback);
+
+ private:
+    KRVSyncScheduler();
+    ~KRVSyncScheduler();
+    static void OnVSync(long long timestamp, void *data);
+    void DispatchFrameCallbacks(int64_t frame_time_nanos);
+
+    OH_NativeVSync *native_vsync_ = nullptr;
+    std::mutex mutex_;
+    std::vector<FrameCallback> pending_callbacks_;
+    bool frame_requested_ = false;
+};
+
+#endif  // CORE_RENDER_OHOS_KRVSYNCSCHEDULER_H
@@ -0,0 +1,34 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KREXTERNALBUFFER_H
+#define CORE_RENDER_OHOS_KREXTERNALBUFFER_H
+
+#include <cstddef>
+
+// 不小于该长度的连续存储以外部 ArrayBuffer 共享给 ArkTS，更小的数据直接拷贝更省
+constexpr size_t kKRExternalArrayBufferMinSize = 4096;
+
+/**
+ * 连续存储转 ArkTS TypedArray 时能否共享原存储（否则拷贝）。
+ * owner_use_count 为转换时存储的引用计数：仅当 KRRenderValue 是唯一持有者（== 1）才共享；
+ * native 侧仍持有可写引用时若共享，ArkTS 与 native 的读写会交错到同一块内存，改为拷贝。
+ * 无 owner（use_count 为 0）时无法把存储生命周期托付给 finalizer，同样拷贝
+ */
+inline bool KRShouldShareExternalBuffer(size_t byte_size, long owner_use_count) {
+    return byte_size >= kKRExternalArrayBufferMinSize && owner_use_count == 1;
+}
+
+#endif  // CORE_RENDER_OHOS_KREXTERNALBUFFER_H
@@ -25,7 +25,9 @@
  */
 typedef struct KRRenderCValue {
     // 定义一个枚举类型来表示值的类型
-    enum Type { NULL_VALUE, INT, LONG, FLOAT, DOUBLE, BOOL, STRING, BYTES, ARRAY } type;
+    // 新增类型只能追加在末尾，保持与已编译的 Kotlin 侧枚举值一致
+    enum Type { NULL_VALUE, INT, LONG, FLOAT, DOUBLE, BOOL, STRING, BYTES, ARRAY, FLOAT32_ARRAY, FLOAT64_ARRAY,
+                INT32_ARRAY } type;
 
     // 定义一个联合体来存储不同类型的值
     union Value {
@@ -37,10 +39,13 @@ typedef struct KRRenderCValue {
         char *stringValue;
         char *bytesValue;
         struct KRRenderCValue *arrayValue;
+        float *float32ArrayValue;
+        double *float64ArrayValue;
+        int32_t *int32ArrayValue;
     } value;
 
     /**
-     * 当类型为数组或者二进制时, 表示其长度
+     * 当类型为数组或者二进制时, 表示其长度; 数值数组时为元素个数
      */
     int32_t size;
 
@@ -23,7 +23,9 @@
 #include <js_native_api_types.h>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -32,6 +34,7 @@
 #include <vector>
 #include "KRRenderCValue.h"
 #include "libohos_render/foundation/ark_ts.h"
+#include "libohos_render/foundation/type/KRExternalBuffer.h"
 #include "libohos_render/foundation/type/KRRenderCValue.h"
 #include "libohos_render/utils/KRJsUtil.h"
 #include "libohos_render/utils/KRRenderLoger.h"
@@ -88,6 +91,21 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     using Map = std::unordered_map<std::string, std::shared_ptr<KRRenderValue>>;
     using Array = std::vector<std::shared_ptr<KRRenderValue>>;
     using ByteArray = std::shared_ptr<std::vector<uint8_t>>;
+    using ConstByteArray = std::shared_ptr<const std::vector<uint8_t>>;
+    // 连续存储的数值数组，避免逐个装箱为 KRRenderValue
+    using Float32Array = std::shared_ptr<std::vector<float>>;
+    using Float64Array = std::shared_ptr<std::vector<double>>;
+    using Int32Array = std::shared_ptr<std::vector<int32_t>>;
+
+    /**
+     * 借用的外部二进制数据（零拷贝）。
+     * data 在 owner 存活期间有效，owner 最后一个引用释放时回收底层存储
+     */
+    struct ExternalBytes {
+        const uint8_t *data = nullptr;
+        size_t size = 0;
+        std::shared_ptr<const void> owner;
+    };
     
     KRRenderValue(const KRRenderValue&) = delete;
     KRRenderValue& operator=(const KRRenderValue&) = delete;
@@ -161,6 +179,22 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         value_ = value;
     }
 
+    explicit KRRenderValue(const ExternalBytes &value) : KRRenderValue() {
+        value_ = value;
+    }
+
+    explicit KRRenderValue(const Float32Array &value) : KRRenderValue() {
+        value_ = value;
+    }
+
+    explicit KRRenderValue(const Float64Array &value) : KRRenderValue() {
+        value_ = value;
+    }
+
+    explicit KRRenderValue(const Int32Array &value) : KRRenderValue() {
+        value_ = value;
+    }
+
     explicit KRRenderValue(const KRRenderCValue &cValue) : KRRenderValue() {
         if (cValue.type == KRRenderCValue::Type::BOOL) {
             value_ = cValue.value.boolValue != 0;
@@ -175,13 +209,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         } else if (cValue.type == KRRenderCValue::Type::STRING) {
             value_ = std::string(cValue.value.stringValue);
         } else if (cValue.type == KRRenderCValue::Type::BYTES) {
-            auto length = cValue.size;
-            auto start_address = cValue.value.bytesValue;
-            auto bytes = std::make_shared<std::vector<uint8_t>>();
-            for (int i = 0; i < length; i++) {
-                bytes->push_back(*(reinterpret_cast<uint8_t *>(start_address + i)));
-            }
-            value_ = bytes;
+            value_ = CopyBytes(cValue.value.bytesValue, cValue.size);
         } else if (cValue.type == KRRenderCValue::Type::ARRAY) {
             auto array_size = cValue.size;
             Array array;
@@ -189,6 +217,12 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                 array.push_back(Make(cValue.value.arrayValue[i]));
             }
             value_ = array;
+        } else if (cValue.type == KRRenderCValue::Type::FLOAT32_ARRAY) {
+            value_ = CopyNumbers<float>(cValue.value.float32ArrayValue, cValue.size);
+        } else if (cValue.type == KRRenderCValue::Type::FLOAT64_ARRAY) {
+            value_ = CopyNumbers<double>(cValue.value.float64ArrayValue, cValue.size);
+        } else if (cValue.type == KRRenderCValue::Type::INT32_ARRAY) {
+            value_ = CopyNumbers<int32_t>(cValue.value.int32ArrayValue, cValue.size);
         } else {
             value_ = std::monostate();
         }
@@ -222,12 +256,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                 void *byte_array = nullptr;
                 size_t byte_length;
                 napi_get_arraybuffer_info(napi_env, nvalue, &byte_array, &byte_length);
-                auto bytes = std::make_shared<std::vector<uint8_t>>();
-                auto byte_buffer = reinterpret_cast<uint8_t *>(byte_array);
-                for (size_t i = 0; i < byte_length; i++) {
-                    bytes->push_back(*(byte_buffer + i));
-                }
-                value_ = bytes;
+                value_ = CopyBytes(byte_array, byte_length);
                 return;
             }
 
@@ -251,6 +280,18 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                     }
                     return;
                 }
+                if (status == napi_ok && typedArrayType == napi_float32_array) {
+                    value_ = CopyNumbers<float>(typedArrayData, typedArrayLength);
+                    return;
+                }
+                if (status == napi_ok && typedArrayType == napi_float64_array) {
+                    value_ = CopyNumbers<double>(typedArrayData, typedArrayLength);
+                    return;
+                }
+                if (status == napi_ok && typedArrayType == napi_int32_array) {
+                    value_ = CopyNumbers<int32_t>(typedArrayData, typedArrayLength);
+                    return;
+                }
             }
 
             // 3. 检查是否是 Array
@@ -319,12 +360,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                 void *byte_array = nullptr;
                 size_t byte_length;
                 OH_JSVM_GetArraybufferInfo(js_env, js_value, &byte_array, &byte_length);
-                auto bytes = std::make_shared<std::vector<uint8_t>>();
-                auto byte_buffer = reinterpret_cast<uint8_t *>(byte_array);
-                for (int i = 0; i < byte_length; i++) {
-                    bytes->push_back(*(byte_buffer + i));
-                }
-                value_ = bytes;
+                value_ = CopyBytes(byte_array, byte_length);
                 return;
             }
             bool is_type_array;
@@ -336,12 +372,15 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                 JSVM_Value retArrayBuffer;
                 size_t byteOffset = -1;
                 OH_JSVM_GetTypedarrayInfo(js_env, js_value, &type, &length, &data, &retArrayBuffer, &byteOffset);
-                auto bytes = std::make_shared<std::vector<uint8_t>>();
-                auto byte_buffer = reinterpret_cast<uint8_t *>(data);
-                for (int i = 0; i < length; i++) {
-                    bytes->push_back(*(byte_buffer + i));
+                if (type == JSVM_FLOAT32_ARRAY) {
+                    value_ = CopyNumbers<float>(data, length);
+                } else if (type == JSVM_FLOAT64_ARRAY) {
+                    value_ = CopyNumbers<double>(data, length);
+                } else if (type == JSVM_INT32_ARRAY) {
+                    value_ = CopyNumbers<int32_t>(data, length);
+                } else {
+                    value_ = CopyBytes(data, length);
                 }
-                value_ = bytes;
                 return;
             }
 
@@ -401,7 +440,26 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     }
 
     bool isByteArray() const {
-        return std::holds_alternative<ByteArray>(value_);
+        return std::holds_alternative<ByteArray>(value_) || std::holds_alternative<ExternalBytes>(value_);
+    }
+
+    bool isFloat32Array() const {
+        return std::holds_alternative<Float32Array>(value_);
+    }
+
+    bool isFloat64Array() const {
+        return std::holds_alternative<Float64Array>(value_);
+    }
+
+    bool isInt32Array() const {
+        return std::holds_alternative<Int32Array>(value_);
+    }
+
+    /**
+     * 是否为连续存储的数值数组（Float32Array / Float64Array / Int32Array）
+     */
+    bool isNumericArray() const {
+        return isFloat32Array() || isFloat64Array() || isInt32Array();
     }
 
     bool isNapiValue() const {
@@ -522,6 +580,12 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     Array toArray() const {
         if (isArray()) {
             return std::get<Array>(value_);
+        } else if (isFloat32Array()) {
+            return BoxNumbers(std::get<Float32Array>(value_));
+        } else if (isFloat64Array()) {
+            return BoxNumbers(std::get<Float64Array>(value_));
+        } else if (isInt32Array()) {
+            return BoxNumbers(std::get<Int32Array>(value_));
         } else if (isString()) {
             std::string str = toString();
             cJSON *cjson = cJSON_Parse(str.c_str());
@@ -540,14 +604,61 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         }
     }
 
-    const ByteArray toByteArray() const {
-        if (isByteArray()) {
+    /**
+     * 获取数值数组，类型不符时返回空数组（不做元素类型转换）
+     */
+    const Float32Array toFloat32Array() const {
+        return isFloat32Array() ? std::get<Float32Array>(value_) : std::make_shared<std::vector<float>>();
+    }
+
+    const Float64Array toFloat64Array() const {
+        return isFloat64Array() ? std::get<Float64Array>(value_) : std::make_shared<std::vector<double>>();
+    }
+
+    const Int32Array toInt32Array() const {
+        return isInt32Array() ? std::get<Int32Array>(value_) : std::make_shared<std::vector<int32_t>>();
+    }
+
+    /**
+     * 获取二进制数据（只读），外部借用的数据会拷贝一份，只读场景优先用 bytesData / bytesSize
+     */
+    ConstByteArray toByteArray() const {
+        if (std::holds_alternative<ByteArray>(value_)) {
             return std::get<ByteArray>(value_);
+        } else if (std::holds_alternative<ExternalBytes>(value_)) {
+            auto &external = std::get<ExternalBytes>(value_);
+            return CopyBytes(external.data, external.size);
         } else {
             return std::make_shared<std::vector<uint8_t>>();
         }
     }
 
+    /**
+     * 二进制数据首地址（不拷贝），非二进制类型返回 nullptr
+     */
+    const uint8_t *bytesData() const {
+        if (std::holds_alternative<ByteArray>(value_)) {
+            auto &bytes = std::get<ByteArray>(value_);
+            return bytes ? bytes->data() : nullptr;
+        } else if (std::holds_alternative<ExternalBytes>(value_)) {
+            return std::get<ExternalBytes>(value_).data;
+        }
+        return nullptr;
+    }
+
+    /**
+     * 二进制数据长度，非二进制类型返回 0
+     */
+    size_t bytesSize() const {
+        if (std::holds_alternative<ByteArray>(value_)) {
+            auto &bytes = std::get<ByteArray>(value_);
+            return bytes ? bytes->size() : 0;
+        } else if (std::holds_alternative<ExternalBytes>(value_)) {
+            return std::get<ExternalBytes>(value_).size;
+        }
+        return 0;
+    }
+
     const KRRenderCValue &toCValue() const {
         std::call_once(c_value_once_flag_, [this]() {
             if (isBool()) {
@@ -571,14 +682,28 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
                 c_value_.value.stringValue = const_cast<char *>(cached_string_for_c_value_.c_str());
             } else if (isByteArray()) {
                 c_value_.type = KRRenderCValue::Type::BYTES;
-                auto byte_array = std::get<ByteArray>(value_).get();
-                c_value_.size = byte_array->size();
-                c_value_.value.bytesValue = reinterpret_cast<char *>(byte_array->data());
+                c_value_.size = bytesSize();
+                c_value_.value.bytesValue = reinterpret_cast<char *>(const_cast<uint8_t *>(bytesData()));
+            } else if (isFloat32Array()) {
+                auto &numbers = std::get<Float32Array>(value_);
+                c_value_.type = KRRenderCValue::Type::FLOAT32_ARRAY;
+                c_value_.size = numbers->size();
+                c_value_.value.float32ArrayValue = numbers->data();
+            } else if (isFloat64Array()) {
+                auto &numbers = std::get<Float64Array>(value_);
+                c_value_.type = KRRenderCValue::Type::FLOAT64_ARRAY;
+                c_value_.size = numbers->size();
+                c_value_.value.float64ArrayValue = numbers->data();
+            } else if (isInt32Array()) {
+                auto &numbers = std::get<Int32Array>(value_);
+                c_value_.type = KRRenderCValue::Type::INT32_ARRAY;
+                c_value_.size = numbers->size();
+                c_value_.value.int32ArrayValue = numbers->data();
             } else if (isMap()) {
                 ToJsonMapOrArrayLocked();
             } else if (isArray()) {
                 auto array = toArray();
-                if (HadByteArrayElement(array)) {  // 有二进制元素的话, 不进行 json 序列化，直接传递数组
+                if (HadBinaryElement(array)) {  // 有二进制/数值数组元素的话, 不进行 json 序列化，直接传递数组
                     c_value_.type = KRRenderCValue::Type::ARRAY;
                     c_value_.size = array.size();
                     if (array_ptr_ != nullptr) {
@@ -613,25 +738,26 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
             auto str = toString();
             js_status = OH_JSVM_CreateStringUtf8(js_env, str.c_str(), str.size(), js_value);
         } else if (isByteArray()) {
-            auto &data = toByteArray();
-            auto size = data->size();
+            auto size = bytesSize();
             void *buffer = nullptr;
             JSVM_Value array_buffer_value = nullptr;
             js_status = OH_JSVM_CreateArraybuffer(js_env, size, &buffer, &array_buffer_value);
-            if (js_status == JSVM_OK) {
-                auto byte_buffer = reinterpret_cast<uint8_t *>(buffer);
-                auto origin_buffer = data.get()->data();
-                for (int i = 0; i < size; i++) {
-                    byte_buffer[i] = origin_buffer[i];
-                }
+            if (js_status == JSVM_OK && size > 0) {
+                memcpy(buffer, bytesData(), size);
             }
             OH_JSVM_CreateTypedarray(js_env, JSVM_TypedarrayType::JSVM_INT8_ARRAY, size, array_buffer_value, 0,
                                      js_value);
+        } else if (isFloat32Array()) {
+            js_status = NumbersToJsVmValue(js_env, std::get<Float32Array>(value_), JSVM_FLOAT32_ARRAY, js_value);
+        } else if (isFloat64Array()) {
+            js_status = NumbersToJsVmValue(js_env, std::get<Float64Array>(value_), JSVM_FLOAT64_ARRAY, js_value);
+        } else if (isInt32Array()) {
+            js_status = NumbersToJsVmValue(js_env, std::get<Int32Array>(value_), JSVM_INT32_ARRAY, js_value);
         } else if (isMap()) {
             js_status = ToJsonMapOrArray(js_env, js_value);
         } else if (isArray()) {
             auto array = toArray();
-            if (HadByteArrayElement(array)) {  // 有二进制元素的话, 不进行 json 序列化，直接传递数组
+            if (HadBinaryElement(array)) {  // 有二进制/数值数组元素的话, 不进行 json 序列化，直接传递数组
                 auto size = array.size();
                 js_status = OH_JSVM_CreateArrayWithLength(js_env, size, js_value);
                 if (js_status == JSVM_Status::JSVM_OK) {
@@ -663,25 +789,19 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
             auto str = toString();
             nstatus = napi_create_string_utf8(env, str.c_str(), str.size(), nvalue);
         } else if (isByteArray()) {
-            auto &data = toByteArray();
-            auto size = data->size();
-            void *buffer = nullptr;
-            napi_value arrayBuffer;
-            nstatus = napi_create_arraybuffer(env, size, &buffer, &arrayBuffer);
-            if (nstatus == napi_ok) {
-                auto byte_buffer = reinterpret_cast<uint8_t *>(buffer);
-                auto origin_buffer = data.get()->data();
-                for (int i = 0; i < size; i++) {
-                    byte_buffer[i] = origin_buffer[i];
-                }
-                nstatus = napi_create_typedarray(env, napi_int8_array, size, arrayBuffer, 0, nvalue);
-            }
+            nstatus = BytesToNapiValue(env, nvalue);
+        } else if (isFloat32Array()) {
+            nstatus = NumbersToNapiValue(env, std::get<Float32Array>(value_), napi_float32_array, nvalue);
+        } else if (isFloat64Array()) {
+            nstatus = NumbersToNapiValue(env, std::get<Float64Array>(value_), napi_float64_array, nvalue);
+        } else if (isInt32Array()) {
+            nstatus = NumbersToNapiValue(env, std::get<Int32Array>(value_), napi_int32_array, nvalue);
         } else if (isMap()) {
             nstatus = ToJsonMapOrArray(env, nvalue);
         } else if (isArray()) {
             auto array = toArray();
 #if 0
-            if (HadByteArrayElement(array)) {
+            if (HadBinaryElement(array)) {
 #endif
             auto size = array.size();
             nstatus = napi_create_array_with_length(env, size, nvalue);
@@ -712,7 +832,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
 
  private:
     std::variant<std::monostate, bool, int32_t, int64_t, float, double, std::string, Map, Array, void *, ByteArray,
-                 NapiValue>
+                 NapiValue, ExternalBytes, Float32Array, Float64Array, Int32Array>
         value_;
     
     mutable std::once_flag c_value_once_flag_;
@@ -754,9 +874,115 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         return napi_create_string_utf8(env, json_str.c_str(), json_str.length(), nvalue);
     }
 
-    static bool HadByteArrayElement(const Array &array) {
+    static ByteArray CopyBytes(const void *data, size_t size) {
+        if (data == nullptr || size == 0) {
+            return std::make_shared<std::vector<uint8_t>>();
+        }
+        auto begin = reinterpret_cast<const uint8_t *>(data);
+        return std::make_shared<std::vector<uint8_t>>(begin, begin + size);
+    }
+
+    template <typename T>
+    static std::shared_ptr<std::vector<T>> CopyNumbers(const void *data, size_t count) {
+        auto numbers = std::make_shared<std::vector<T>>(data == nullptr ? 0 : count);
+        if (!numbers->empty()) {
+            memcpy(numbers->data(), data, count * sizeof(T));
+        }
+        return numbers;
+    }
+
+    template <typename T>
+    static Array BoxNumbers(const std::shared_ptr<std::vector<T>> &numbers) {
+        Array array;
+        array.reserve(numbers->size());
+        for (auto number : *numbers) {
+            array.push_back(Make(number));
+        }
+        return array;
+    }
+
+    /**
+     * 二进制数据转为 ArkTS Int8Array，共享条件见 KRShouldShareExternalBuffer
+     */
+    napi_status BytesToNapiValue(const napi_env &env, napi_value *nvalue) const {
+        auto size = bytesSize();
+        std::shared_ptr<const void> owner;
+        if (std::holds_alternative<ByteArray>(value_)) {
+            auto &bytes = std::get<ByteArray>(value_);
+            if (KRShouldShareExternalBuffer(size, bytes.use_count())) {
+                owner = bytes;
+            }
+        } else {
+            auto &external = std::get<ExternalBytes>(value_).owner;
+            if (KRShouldShareExternalBuffer(size, external.use_count())) {
+                owner = external;
+            }
+        }
+        return BufferToNapiValue(env, bytesData(), size, std::move(owner), napi_int8_array, size, nvalue);
+    }
+
+    template <typename T>
+    static napi_status NumbersToNapiValue(const napi_env &env, const std::shared_ptr<std::vector<T>> &numbers,
+                                          napi_typedarray_type type, napi_value *nvalue) {
+        auto byte_size = numbers->size() * sizeof(T);
+        std::shared_ptr<const void> owner;
+        if (KRShouldShareExternalBuffer(byte_size, numbers.use_count())) {
+            owner = numbers;
+        }
+        return BufferToNapiValue(env, numbers->data(), byte_size, std::move(owner), type, numbers->size(), nvalue);
+    }
+
+    /**
+     * 连续存储转为 ArkTS TypedArray。
+     * 传入 owner 时不拷贝：以外部 ArrayBuffer 引用原存储，finalizer 中释放 owner；否则拷贝一份
+     */
+    static napi_status BufferToNapiValue(const napi_env &env, const void *data, size_t byte_size,
+                                         std::shared_ptr<const void> owner, napi_typedarray_type type,
+                                         size_t element_count, napi_value *nvalue) {
+        napi_value array_buffer = nullptr;
+        napi_status status = napi_generic_failure;
+        if (owner != nullptr) {
+            auto holder = new std::shared_ptr<const void>(std::move(owner));
+            status = napi_create_external_arraybuffer(
+                env, const_cast<void *>(data), byte_size,
+                [](napi_env, void *, void *hint) { delete static_cast<std::shared_ptr<const void> *>(hint); },
+                holder, &array_buffer);
+            if (status != napi_ok) {
+                delete holder;
+            }
+        }
+        if (status != napi_ok) {
+            void *buffer = nullptr;
+            status = napi_create_arraybuffer(env, byte_size, &buffer, &array_buffer);
+            if (status == napi_ok && byte_size > 0) {
+                memcpy(buffer, data, byte_size);
+            }
+        }
+        if (status == napi_ok) {
+            status = napi_create_typedarray(env, type, element_count, array_buffer, 0, nvalue);
+        }
+        return status;
+    }
+
+    template <typename T>
+    static JSVM_Status NumbersToJsVmValue(JSVM_Env js_env, const std::shared_ptr<std::vector<T>> &numbers,
+                                          JSVM_TypedarrayType type, JSVM_Value *js_value) {
+        auto byte_size = numbers->size() * sizeof(T);
+        void *buffer = nullptr;
+        JSVM_Value array_buffer_value = nullptr;
+        auto status = OH_JSVM_CreateArraybuffer(js_env, byte_size, &buffer, &array_buffer_value);
+        if (status != JSVM_OK) {
+            return status;
+        }
+        if (byte_size > 0) {
+            memcpy(buffer, numbers->data(), byte_size);
+        }
+        return OH_JSVM_CreateTypedarray(js_env, type, numbers->size(), array_buffer_value, 0, js_value);
+    }
+
+    static bool HadBinaryElement(const Array &array) {
         for (const auto &item : array) {
-            if (item->isByteArray()) {
+            if (item->isByteArray() || item->isNumericArray()) {
                 return true;
             }
         }
@@ -793,6 +1019,15 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
             return cJSON_CreateNumber(value->toDouble());
         } else if (value->isString()) {
             return cJSON_CreateString(value->toString().c_str());
+        } else if (value->isFloat32Array()) {
+            auto numbers = value->toFloat32Array();
+            return cJSON_CreateFloatArray(numbers->data(), static_cast<int>(numbers->size()));
+        } else if (value->isFloat64Array()) {
+            auto numbers = value->toFloat64Array();
+            return cJSON_CreateDoubleArray(numbers->data(), static_cast<int>(numbers->size()));
+        } else if (value->isInt32Array()) {
+            auto numbers = value->toInt32Array();
+            return cJSON_CreateIntArray(numbers->data(), static_cast<int>(numbers->size()));
         } else {
             return cJSON_CreateNull();
         }
@@ -21,6 +21,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 #include "libohos_render/context/KRRenderContextParams.h"
 #include "libohos_render/export/IKRRenderModuleExport.h"
 #include "libohos_render/export/IKRRenderShadowExport.h"
@@ -89,6 +90,15 @@ class IKRRenderLayer {
      */
     virtual std::string CalculateRenderViewSize(int tag, double constraint_width, double constraint_height) = 0;
 
+    /**
+     * 批量计算渲染视图尺寸，支持并行测量的 shadow 会分发到工作线程池上同时计算
+     * @param tags 视图 ID 列表
+     * @param constraints 测量约束，按 [width0, height0, width1, height1, ...] 排列，长度为 tags 的两倍
+     * @return 计算得到的尺寸，按 [width0, height0, width1, height1, ...] 排列，找不到 shadow 的视图返回 0
+     */
+    virtual std::vector<float> CalculateRenderViewSizes(const std::vector<int32_t> &tags,
+                                                const std::vector<float> &constraints) = 0;
+
     /**
      * 调用渲染视图方法
      * @param tag 视图 ID
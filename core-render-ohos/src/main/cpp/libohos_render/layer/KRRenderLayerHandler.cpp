@@ -15,6 +15,67 @@
 
 #include "libohos_render/layer/KRRenderLayerHandler.h"
 
+#include <sys/stat.h>
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <unordered_set>
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/foundation/thread/KRIdleTaskQueue.h"
+#include "libohos_render/performance/frame/KRFrameWorkCounter.h"
+
+// 容器拍平只作用于普通容器，其余组件对直接子节点可能有自己的语义
+static constexpr char kFlattenableViewName[] = "KRView";
+
+/**
+ * 属性值转换为可落盘的快照值，napi 对象、数值数组等无法落盘的类型返回 false
+ */
+static bool ToTreePropValue(const KRAnyValue &value, KRTreePropValue &out) {
+    if (value == nullptr || value->isNull()) {
+        out = KRTreePropValue::Null();
+    } else if (value->isBool()) {
+        out = KRTreePropValue::Bool(value->toBool());
+    } else if (value->isInt() || value->isLong()) {
+        out = KRTreePropValue::Int(value->toLong());
+    } else if (value->isFloat() || value->isDouble()) {
+        out = KRTreePropValue::Double(value->toDouble());
+    } else if (value->isString()) {
+        out = KRTreePropValue::String(value->toString());
+    } else if (value->isMap() || value->isArray()) {
+        out = KRTreePropValue::Json(value->toString());
+    } else if (value->isByteArray()) {
+        auto size = value->bytesSize();
+        out = KRTreePropValue::Bytes(size > 0 ? std::string(reinterpret_cast<const char *>(value->bytesData()), size)
+                                              : std::string());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static KRAnyValue FromTreePropValue(const KRTreePropValue &value) {
+    switch (value.type) {
+    case KRTreePropType::kBool:
+        return KRRenderValue::Make(value.int_value != 0);
+    case KRTreePropType::kInt:
+        if (value.int_value >= INT32_MIN && value.int_value <= INT32_MAX) {
+            return KRRenderValue::Make(static_cast<int32_t>(value.int_value));
+        }
+        return KRRenderValue::Make(value.int_value);
+    case KRTreePropType::kDouble:
+        return KRRenderValue::Make(value.double_value);
+    case KRTreePropType::kString:
+    case KRTreePropType::kJson:  // json 字符串在 toMap / toArray 时解析
+        return KRRenderValue::Make(value.string_value);
+    case KRTreePropType::kBytes:
+        return KRRenderValue::Make(
+            std::make_shared<std::vector<uint8_t>>(value.string_value.begin(), value.string_value.end()));
+    case KRTreePropType::kNull:
+        break;
+    }
+    return KRRenderValue::Make();
+}
+
 /**
  * 初始化
  * @param rootView 渲染根容器view
@@ -23,6 +84,10 @@ void KRRenderLayerHandler::Init(std::weak_ptr<IKRRenderView> root_view,
                                 std::shared_ptr<KRRenderContextParams> &context) {
     context_ = context;
     root_view_ = root_view;
+    SetupFirstFrameRecorder();
+    if (context_->Config()->GetViewFlatteningEnabled()) {
+        flatten_tree_ = std::make_unique<KRViewFlattenTree>(this);
+    }
 }
 
 /**
@@ -36,25 +101,22 @@ void KRRenderLayerHandler::CreateRenderView(int tag, const std::string &view_nam
         // noop if the root view has been destroyed
         return;
     }
+    RecordFirstFrame([tag, &view_name](KRRenderTreeSnapshot &tree) { tree.RecordCreate(tag, view_name); });
+    if (replay_reconciler_ != nullptr &&
+        replay_reconciler_->OnCreate(tag, view_name) == KRRenderTreeReconciler::CreateAction::kReplace) {
+        DetachReplayedView(tag);
+        RecycleRenderView(tag);
+    }
+    // 认领回放出来的 view 时 tag 已经注册过，这里不会重复创建
     auto it = view_registry_.find(tag);
     if (it == view_registry_.end() || it->second == nullptr) {
-        auto view = PopViewFromReuseQueue(view_name);
-        if (view == nullptr) {
-            view = IKRRenderViewExport::CreateView(view_name);
-            if(view){
-                view->SetRootView(root_view_, context_->InstanceId());
-                view->SetViewName(view_name);
-                view->SetViewTag(tag);
-                view->ToInit();
-            }else{
-                KR_LOG_ERROR << "Failed to create view with name:"<<view_name<<", tag:"<<tag;
-            }
-        } else {
-            view->SetViewTag(tag);
+        if (flatten_tree_ != nullptr && view_name == kFlattenableViewName) {
+            flatten_tree_->AddNode(tag, true, true);  // 先以虚拟节点存在，收到视觉属性或事件时再创建
+            return;
         }
-        if (view != nullptr) {
-            view_registry_[tag] = view;
-            handle_to_tag_[view->GetNode()] = tag;
+        auto view = NewRenderView(tag, view_name);
+        if (flatten_tree_ != nullptr && view != nullptr) {
+            flatten_tree_->AddNode(tag, false, false);
         }
     }
 }
@@ -64,6 +126,17 @@ void KRRenderLayerHandler::CreateRenderView(int tag, const std::string &view_nam
  * @param tag 视图 ID
  */
 void KRRenderLayerHandler::RemoveRenderView(int tag) {
+    RecordFirstFrame([tag](KRRenderTreeSnapshot &tree) { tree.RecordRemove(tag); });
+    if (replay_reconciler_ != nullptr) {
+        replay_reconciler_->OnRemove(tag);
+    }
+    RecycleRenderView(tag);
+    if (flatten_tree_ != nullptr) {
+        flatten_tree_->RemoveNode(tag);
+    }
+}
+
+void KRRenderLayerHandler::RecycleRenderView(int tag) {
     auto it = view_registry_.find(tag);
     if (it == view_registry_.end()) {
         return;
@@ -81,9 +154,8 @@ void KRRenderLayerHandler::RemoveRenderView(int tag) {
     } else {
         // 触摸事件分发子系统涉及多个子系统，存在衔接问题，表现上5.0.0.102版本后比较容易出现节点析构后系统内部会因为事件派发出现crash，
         // 这里暂时做个兜底，延缓两帧再销毁view，后续系统OK后再恢复回来。
-    KRContextScheduler::ScheduleTask(32, [view]() {
-            KRContextScheduler::ScheduleTaskOnMainThread(false, [view]() { view->ToDestroy(); });
-        });
+        // 销毁放到空闲队列，在帧内工作之后的空闲时间分片执行，避免滚动中集中析构造成卡顿
+        KRIdleTaskQueue::PostIdleTask([view]() { view->ToDestroy(); }, 32);
     }
 }
 
@@ -94,6 +166,21 @@ void KRRenderLayerHandler::RemoveRenderView(int tag) {
  * @param index 插入的位置
  */
 void KRRenderLayerHandler::InsertSubRenderView(int parent_tag, int child_tag, int index) {
+    RecordFirstFrame([parent_tag, child_tag, index](KRRenderTreeSnapshot &tree) {
+        tree.RecordInsert(parent_tag, child_tag, index);
+    });
+    if (replay_reconciler_ != nullptr) {
+        if (replay_reconciler_->ShouldSkipInsert(parent_tag, child_tag)) {
+            return;
+        }
+        if (replay_reconciler_->IsClaimed(child_tag)) {
+            DetachReplayedView(child_tag);  // 回放时已经挂载，先摘下来再按真实位置插入
+        }
+    }
+    if (flatten_tree_ != nullptr) {
+        flatten_tree_->Insert(parent_tag, child_tag, index);
+        return;
+    }
     auto isRootViewTag = parent_tag == -1;
     auto &child_view = view_registry_[child_tag];
     if (isRootViewTag) {
@@ -115,8 +202,42 @@ void KRRenderLayerHandler::InsertSubRenderView(int parent_tag, int child_tag, in
  * @param propValue 属性值
  */
 void KRRenderLayerHandler::SetProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) {
+    if (first_frame_recording_.load(std::memory_order_acquire) || replay_reconciler_ != nullptr) {
+        KRTreePropValue tree_value;
+        auto persistable = ToTreePropValue(prop_value, tree_value);
+        auto skip = false;
+        if (replay_reconciler_ != nullptr) {
+            if (persistable) {
+                skip = replay_reconciler_->ShouldSkipProp(tag, prop_key, tree_value);
+            } else {
+                replay_reconciler_->ConfirmProp(tag, prop_key);
+            }
+        }
+        RecordFirstFrame([tag, &prop_key, persistable, &tree_value](KRRenderTreeSnapshot &tree) {
+            if (persistable) {
+                tree.RecordProp(tag, prop_key, std::move(tree_value));
+            } else {
+                tree.ForgetProp(tag, prop_key);
+            }
+        });
+        if (skip) {
+            return;  // 与回放时设置的值相同
+        }
+    }
+    if (flatten_tree_ != nullptr && flatten_tree_->Contains(tag)) {
+        if (KRViewFlattenTree::IsStructuralProp(prop_key)) {
+            KRRect frame;
+            const std::string &data = prop_value->toString();
+            memcpy(&frame, data.data(), std::min(data.size(), sizeof(KRRect)));
+            KRFrameWorkCounter::AddPropSet();
+            flatten_tree_->SetFrame(tag, frame);  // 叠加虚拟祖先的偏移后下发
+            return;
+        }
+        flatten_tree_->Materialize(tag);
+    }
     auto &view = view_registry_[tag];
     if (view != nullptr) {
+        KRFrameWorkCounter::AddPropSet();
         view->ToSetProp(prop_key, prop_value, nullptr);
     }
 }
@@ -128,8 +249,10 @@ void KRRenderLayerHandler::SetProp(int tag, const std::string &prop_key, const K
  * @param propValue 事件
  */
 void KRRenderLayerHandler::SetEvent(int tag, const std::string &prop_key, const KRRenderCallback &callback) {
+    MaterializeIfVirtual(tag);
     auto &view = view_registry_[tag];
     if (view != nullptr) {
+        KRFrameWorkCounter::AddPropSet();
         view->ToSetProp(prop_key, nullptr, callback);
     }
 }
@@ -140,6 +263,7 @@ void KRRenderLayerHandler::SetEvent(int tag, const std::string &prop_key, const
  * @param shadow 视图对应的 shadow 对象
  */
 void KRRenderLayerHandler::SetShadow(int tag, const std::shared_ptr<IKRRenderShadowExport> &shadow) {
+    MaterializeIfVirtual(tag);
     auto &view = view_registry_[tag];
     if (view != nullptr) {
         view->SetShadow(shadow);
@@ -154,6 +278,9 @@ void KRRenderLayerHandler::SetShadow(int tag, const std::shared_ptr<IKRRenderSha
  * @return 计算得到的尺寸，"${width}|${height}" 格式封装返回
  */
 std::string KRRenderLayerHandler::CalculateRenderViewSize(int tag, double constraint_width, double constraint_height) {
+    RecordFirstFrame([tag, constraint_width, constraint_height](KRRenderTreeSnapshot &tree) {
+        tree.RecordShadowConstraint(tag, constraint_width, constraint_height);
+    });
     auto &shadow = shadow_registry_[tag];
     if (shadow != nullptr) {
         auto size = shadow->CalculateRenderViewSize(constraint_width, constraint_height);
@@ -162,6 +289,48 @@ std::string KRRenderLayerHandler::CalculateRenderViewSize(int tag, double constr
     return "0|0";
 }
 
+/**
+ * 批量计算渲染视图尺寸
+ * @param tags 视图 ID 列表
+ * @param constraints 测量约束，按 [width0, height0, width1, height1, ...] 排列
+ * @return 计算得到的尺寸，按 [width0, height0, width1, height1, ...] 排列
+ */
+std::vector<float> KRRenderLayerHandler::CalculateRenderViewSizes(const std::vector<int32_t> &tags,
+                                                                  const std::vector<float> &constraints) {
+    const size_t count = std::min(tags.size(), constraints.size() / 2);
+    std::vector<float> sizes(count * 2, 0);
+    RecordFirstFrame([&tags, &constraints, count](KRRenderTreeSnapshot &tree) {
+        for (size_t i = 0; i < count; i++) {
+            tree.RecordShadowConstraint(tags[i], constraints[i * 2], constraints[i * 2 + 1]);
+        }
+    });
+    // shadow 注册表只在 context 线程访问，先在这里取出，工作线程只接触各自独立的 shadow
+    std::vector<std::shared_ptr<IKRRenderShadowExport>> concurrent_shadows;
+    std::vector<size_t> concurrent_indexes;
+    for (size_t i = 0; i < count; i++) {
+        auto it = shadow_registry_.find(tags[i]);
+        if (it == shadow_registry_.end() || it->second == nullptr) {
+            continue;
+        }
+        auto &shadow = it->second;
+        if (shadow->CanCalculateRenderViewSizeConcurrently()) {
+            concurrent_shadows.push_back(shadow);
+            concurrent_indexes.push_back(i);
+        } else {
+            auto size = shadow->CalculateRenderViewSize(constraints[i * 2], constraints[i * 2 + 1]);
+            sizes[i * 2] = size.width;
+            sizes[i * 2 + 1] = size.height;
+        }
+    }
+    KRGCDQueue::GetInstance().ParallelFor(concurrent_shadows.size(), [&](size_t n) {
+        auto i = concurrent_indexes[n];
+        auto size = concurrent_shadows[n]->CalculateRenderViewSize(constraints[i * 2], constraints[i * 2 + 1]);
+        sizes[i * 2] = size.width;
+        sizes[i * 2 + 1] = size.height;
+    });
+    return sizes;
+}
+
 /**
  * 调用渲染视图方法
  * @param tag 视图 ID
@@ -171,6 +340,7 @@ std::string KRRenderLayerHandler::CalculateRenderViewSize(int tag, double constr
  */
 void KRRenderLayerHandler::CallViewMethod(int tag, const std::string &method, const KRAnyValue &params,
                                           const KRRenderCallback &callback) {
+    MaterializeIfVirtual(tag);
     auto &view = view_registry_[tag];
     if (view != nullptr) {
         view->CallMethod(method, params, callback);
@@ -209,6 +379,7 @@ KRAnyValue KRRenderLayerHandler::CallTDFModuleMethod(const std::string &module_n
  * @param viewName 视图名字
  */
 void KRRenderLayerHandler::CreateShadow(int tag, const std::string &view_name) {
+    RecordFirstFrame([tag, &view_name](KRRenderTreeSnapshot &tree) { tree.RecordCreateShadow(tag, view_name); });
     auto it = shadow_registry_.find(tag);
     if (it == shadow_registry_.end()) {
         auto shadow = IKRRenderShadowExport::CreateShadow(view_name);
@@ -224,6 +395,7 @@ void KRRenderLayerHandler::CreateShadow(int tag, const std::string &view_name) {
  * @param tag 视图 ID
  */
 void KRRenderLayerHandler::RemoveShadow(int tag) {
+    RecordFirstFrame([tag](KRRenderTreeSnapshot &tree) { tree.RecordRemoveShadow(tag); });
     shadow_registry_.erase(tag);
 }
 
@@ -234,6 +406,14 @@ void KRRenderLayerHandler::RemoveShadow(int tag) {
  * @param propValue 属性值
  */
 void KRRenderLayerHandler::SetShadowProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) {
+    RecordFirstFrame([tag, &prop_key, &prop_value](KRRenderTreeSnapshot &tree) {
+        KRTreePropValue tree_value;
+        if (ToTreePropValue(prop_value, tree_value)) {
+            tree.RecordShadowProp(tag, prop_key, std::move(tree_value));
+        } else {
+            tree.ForgetShadowProp(tag, prop_key);
+        }
+    });
     auto it = shadow_registry_.find(tag);
     if (it != shadow_registry_.end()) {
         auto shadow = it->second;
@@ -289,6 +469,7 @@ std::shared_ptr<IKRRenderModuleExport> KRRenderLayerHandler::GetModule(const std
  * @return 对应 ID 的渲染视图实例，如果不存在则返回 null
  */
 std::shared_ptr<IKRRenderViewExport> KRRenderLayerHandler::GetRenderView(int tag) {
+    MaterializeIfVirtual(tag);
     return view_registry_[tag];
 }
 
@@ -319,6 +500,9 @@ void KRRenderLayerHandler::OnDestroy() {
     // would still be able to find them and could cause unexpected behaviors
     view_registry_.clear();
     handle_to_tag_.clear();
+    if (flatten_tree_ != nullptr) {
+        flatten_tree_->Clear();
+    }
 
     {  // auto lock sub-scope to destroy modules
         std::unique_lock lock(module_rw_mutex_);
@@ -340,8 +524,258 @@ void KRRenderLayerHandler::OnDestroy() {
     }
     view_reuse_queue_.clear();
 }
+/**
+ * 回放上次记录的首帧渲染树
+ */
+void KRRenderLayerHandler::ReplayFirstFrame() {
+    auto root = root_view_.lock();
+    if (first_frame_path_.empty() || root == nullptr ||
+        !KRRenderTreeSnapshot::ReadFile(first_frame_path_, replayed_data_)) {
+        return;
+    }
+    auto replayed = std::make_shared<KRRenderTreeSnapshot>();
+    if (!replayed->Decode(replayed_data_, first_frame_key_) || replayed->Empty()) {
+        return;
+    }
+    if (flatten_tree_ != nullptr) {
+        // 回放出来的 view 树不经过拍平，对账依赖 tag 与真实节点一一对应，本页面关闭拍平
+        flatten_tree_ = nullptr;
+        KR_LOG_INFO << "view flattening disabled for replayed first frame";
+    }
+    auto order = replayed->PreOrder();
+    std::vector<int32_t> failed_tags;
+    std::unordered_set<int32_t> failed;
+    for (auto tag : order) {
+        const auto *node = replayed->Node(tag);
+        auto parent_ok = node->parent_tag == KRRenderTreeSnapshot::kRootTag || !failed.count(node->parent_tag);
+        auto view = parent_ok ? NewRenderView(tag, node->view_name) : nullptr;
+        if (view == nullptr) {
+            failed.insert(tag);
+            failed_tags.push_back(tag);
+            continue;
+        }
+        for (const auto &prop : node->props) {
+            view->ToSetProp(prop.first, FromTreePropValue(prop.second), nullptr);
+        }
+        if (const auto *shadow_node = replayed->Shadow(tag)) {
+            ReplayShadow(view, *shadow_node);
+        }
+        if (node->parent_tag == KRRenderTreeSnapshot::kRootTag) {
+            root->AddReplayedContentView(view);
+        } else {
+            view_registry_[node->parent_tag]->ToInsertSubRenderView(view, -1);
+        }
+    }
+    // 没有回放出来的节点不参与对账，真实操作流到达时正常创建
+    for (auto it = failed_tags.rbegin(); it != failed_tags.rend(); ++it) {
+        replayed->RecordRemove(*it);
+    }
+    KR_LOG_INFO << "first frame replayed, views: " << order.size() - failed_tags.size();
+    replay_reconciler_ = std::make_unique<KRRenderTreeReconciler>(replayed);
+}
+
+/**
+ * 首帧结束：停止记录并异步落盘，同时完成对账
+ */
+void KRRenderLayerHandler::DidEndFirstFrame() {
+    std::unique_ptr<KRRenderTreeSnapshot> live;
+    {
+        std::lock_guard<std::mutex> lock(first_frame_mutex_);
+        live = std::move(first_frame_recorder_);
+        first_frame_recording_.store(false, std::memory_order_release);
+    }
+    if (live == nullptr) {
+        return;
+    }
+    if (replay_reconciler_ != nullptr) {
+        FinishReplay(*live);
+        replay_reconciler_ = nullptr;
+    }
+    if (live->Empty()) {
+        return;
+    }
+    std::shared_ptr<KRRenderTreeSnapshot> tree = std::move(live);
+    KRGCDQueue::GetInstance().DispatchAsync(
+        [tree, path = first_frame_path_, key = first_frame_key_, previous = std::move(replayed_data_)] {
+            auto data = tree->Encode(key);
+            if (data != previous) {
+                KRRenderTreeSnapshot::WriteFile(path, data);
+            }
+        });
+}
+
 /*** private ****/
 
+std::shared_ptr<IKRRenderViewExport> KRRenderLayerHandler::NewRenderView(int tag, const std::string &view_name) {
+    auto view = PopViewFromReuseQueue(view_name);
+    if (view == nullptr) {
+        view = IKRRenderViewExport::CreateView(view_name);
+        if(view){
+            view->SetRootView(root_view_, context_->InstanceId());
+            view->SetViewName(view_name);
+            view->SetViewTag(tag);
+            view->ToInit();
+        }else{
+            KR_LOG_ERROR << "Failed to create view with name:"<<view_name<<", tag:"<<tag;
+        }
+    } else {
+        view->SetViewTag(tag);
+    }
+    if (view != nullptr) {
+        KRFrameWorkCounter::AddViewCreated();
+        view_registry_[tag] = view;
+        handle_to_tag_[view->GetNode()] = tag;
+    }
+    return view;
+}
+
+void KRRenderLayerHandler::SetupFirstFrameRecorder() {
+    const auto &config = context_->Config();
+    const auto &version = config->GetFirstFrameReplayVersion();
+    if (version.empty() || config->GetFilesDir().empty()) {
+        return;
+    }
+    std::string dir = config->GetFilesDir() + "/KuiklyFirstFrame";
+    struct stat st{};
+    if (stat(dir.c_str(), &st) != 0) {
+        mkdir(dir.c_str(), 0755);
+    }
+    const auto &page_name = context_->PageName();
+    first_frame_path_ = dir + "/" + std::to_string(std::hash<std::string>()(page_name)) + ".bin";
+    // 屏幕尺寸、密度和字体缩放都会影响排版结果，变化后旧记录直接作废
+    std::ostringstream key;
+    key << page_name << '|' << version << '|' << config->GetScreenWidth() << 'x' << config->GetScreenHeight() << '|'
+        << config->vp2px(1) << '|' << config->GetFontSizeScale() << '|' << config->GetFontWeightScale();
+    first_frame_key_ = key.str();
+    first_frame_recorder_ = std::make_unique<KRRenderTreeSnapshot>();
+    first_frame_recording_.store(true, std::memory_order_release);
+}
+
+void KRRenderLayerHandler::DetachReplayedView(int tag) {
+    auto it = view_registry_.find(tag);
+    if (it == view_registry_.end() || it->second == nullptr) {
+        return;
+    }
+    const auto *node = replay_reconciler_->Replayed().Node(tag);
+    if (node != nullptr && node->parent_tag == KRRenderTreeSnapshot::kRootTag) {
+        if (auto root = root_view_.lock()) {
+            root->RemoveContentView(it->second);
+        }
+    } else {
+        it->second->ToRemoveFromSuperView();
+    }
+}
+
+void KRRenderLayerHandler::ReplayShadow(const std::shared_ptr<IKRRenderViewExport> &view,
+                                        const KRTreeShadow &shadow_node) {
+    auto shadow = IKRRenderShadowExport::CreateShadow(shadow_node.view_name);
+    if (shadow == nullptr) {
+        return;
+    }
+    shadow->SetRootView(root_view_);
+    for (const auto &prop : shadow_node.props) {
+        shadow->SetProp(prop.first, FromTreePropValue(prop.second));
+    }
+    if (shadow_node.has_constraint) {
+        shadow->CalculateRenderViewSize(shadow_node.constraint_width, shadow_node.constraint_height);
+    }
+    if (auto task = shadow->TaskToMainQueueWhenWillSetShadowToView()) {
+        task();
+    }
+    view->SetShadow(shadow);
+}
+
+void KRRenderLayerHandler::FinishReplay(const KRRenderTreeSnapshot &live) {
+    auto result = replay_reconciler_->Finish(live);
+    for (auto tag : result.unclaimed_tags) {
+        DetachReplayedView(tag);
+        RecycleRenderView(tag);
+    }
+    // 回放设置过、真实流没有设置的属性恢复默认值
+    std::unordered_set<int32_t> reset_tags;
+    for (const auto &[tag, key] : result.stale_props) {
+        auto it = view_registry_.find(tag);
+        if (it != view_registry_.end() && it->second != nullptr) {
+            it->second->ToResetProp(key);
+            reset_tags.insert(tag);
+        }
+    }
+    // ToResetProp 会清空 view 记录的 frame，按真实流的 frame 重新设置一次
+    for (auto tag : reset_tags) {
+        const auto *node = live.Node(tag);
+        if (node == nullptr) {
+            continue;
+        }
+        for (const auto &prop : node->props) {
+            if (prop.first == "frame") {
+                view_registry_[tag]->ToSetProp(prop.first, FromTreePropValue(prop.second), nullptr);
+                break;
+            }
+        }
+    }
+    // 子节点顺序与回放不一致的父节点，按真实流的顺序重新挂载
+    for (auto parent_tag : result.reorder_parents) {
+        auto parent_view = view_registry_[parent_tag];
+        if (parent_view == nullptr) {
+            continue;
+        }
+        std::vector<std::shared_ptr<IKRRenderViewExport>> children;
+        for (auto child_tag : live.Children(parent_tag)) {
+            if (auto child = view_registry_[child_tag]) {
+                child->ToRemoveFromSuperView();
+                children.push_back(child);
+            }
+        }
+        for (size_t i = 0; i < children.size(); i++) {
+            parent_view->ToInsertSubRenderView(children[i], static_cast<int>(i));
+        }
+    }
+    KR_LOG_INFO << "first frame reconciled, removed: " << result.unclaimed_tags.size()
+                << ", reset props: " << result.stale_props.size() << ", reordered: " << result.reorder_parents.size();
+}
+
+void KRRenderLayerHandler::MaterializeIfVirtual(int tag) {
+    if (flatten_tree_ != nullptr && flatten_tree_->IsVirtual(tag)) {
+        flatten_tree_->Materialize(tag);
+    }
+}
+
+void KRRenderLayerHandler::AttachRealView(int32_t host_tag, int32_t child_tag, int index) {
+    auto child_view = view_registry_[child_tag];
+    if (child_view == nullptr) {
+        return;
+    }
+    if (host_tag == KRViewFlattenTree::kRootTag) {
+        if (auto root = root_view_.lock()) {
+            root->AddContentView(child_view, index);
+        }
+        return;
+    }
+    auto &host_view = view_registry_[host_tag];
+    if (host_view != nullptr) {
+        host_view->ToInsertSubRenderView(child_view, index);
+    }
+}
+
+void KRRenderLayerHandler::DetachRealView(int32_t child_tag) {
+    auto &view = view_registry_[child_tag];
+    if (view != nullptr) {
+        view->ToRemoveFromSuperView();
+    }
+}
+
+void KRRenderLayerHandler::ApplyRealFrame(int32_t tag, const KRRect &frame) {
+    auto &view = view_registry_[tag];
+    if (view != nullptr) {
+        std::string data(reinterpret_cast<const char *>(&frame), sizeof(KRRect));
+        view->ToSetProp("frame", KRRenderValue::Make(data), nullptr);
+    }
+}
+
+bool KRRenderLayerHandler::CreateRealView(int32_t tag) {
+    return NewRenderView(tag, kFlattenableViewName) != nullptr;
+}
+
 std::shared_ptr<IKRRenderViewExport> KRRenderLayerHandler::PopViewFromReuseQueue(const std::string &view_name) {
     auto it = view_reuse_queue_.find(view_name);
     if (it != view_reuse_queue_.end()) {
@@ -17,11 +17,16 @@
 #define CORE_RENDER_OHOS_KRRENDERLAYERHANDLER_H
 
 #include <arkui/native_node.h>
+#include <atomic>
+#include <mutex>
 #include <shared_mutex>
 #include "libohos_render/context/KRRenderContextParams.h"
 #include "libohos_render/layer/IKRRenderLayer.h"
+#include "libohos_render/layer/KRRenderTreeReconciler.h"
+#include "libohos_render/layer/KRRenderTreeSnapshot.h"
+#include "libohos_render/layer/KRViewFlattenTree.h"
 
-class KRRenderLayerHandler : public IKRRenderLayer {
+class KRRenderLayerHandler : public IKRRenderLayer, public IKRViewFlattenDelegate {
  public:
     KRRenderLayerHandler() {}
     /**
@@ -83,6 +88,15 @@ class KRRenderLayerHandler : public IKRRenderLayer {
      */
     std::string CalculateRenderViewSize(int tag, double constraint_width, double constraint_height) override;
 
+    /**
+     * 批量计算渲染视图尺寸，支持并行测量的 shadow 会分发到工作线程池上同时计算
+     * @param tags 视图 ID 列表
+     * @param constraints 测量约束，按 [width0, height0, width1, height1, ...] 排列，长度为 tags 的两倍
+     * @return 计算得到的尺寸，按 [width0, height0, width1, height1, ...] 排列，找不到 shadow 的视图返回 0
+     */
+    std::vector<float> CalculateRenderViewSizes(const std::vector<int32_t> &tags,
+                                                const std::vector<float> &constraints) override;
+
     /**
      * 调用渲染视图方法
      * @param tag 视图 ID
@@ -189,6 +203,16 @@ class KRRenderLayerHandler : public IKRRenderLayer {
 
     std::shared_ptr<IKRRenderModuleExport> GetModuleOrCreate(const std::string &name);
 
+    /**
+     * 回放上次记录的首帧渲染树，在主线程、context 创建页面实例之前调用，未开启或没有记录时为空操作
+     */
+    void ReplayFirstFrame();
+
+    /**
+     * 首帧结束时在主线程调用：停止记录并异步落盘，同时与回放出来的渲染树完成对账
+     */
+    void DidEndFirstFrame();
+
  private:
     std::shared_ptr<KRRenderContextParams> context_;
     std::weak_ptr<IKRRenderView> root_view_;
@@ -200,10 +224,49 @@ class KRRenderLayerHandler : public IKRRenderLayer {
     mutable std::shared_mutex module_rw_mutex_;  // 用于module读写安全用的读写锁
     bool destroying_ = false;
 
+    // 首帧回放：view 操作在主线程记录，shadow 操作在 context 线程记录，因此记录器需要加锁
+    std::atomic<bool> first_frame_recording_{false};
+    std::mutex first_frame_mutex_;
+    std::unique_ptr<KRRenderTreeSnapshot> first_frame_recorder_;
+    std::unique_ptr<KRRenderTreeReconciler> replay_reconciler_;  // 只在主线程访问
+    std::string first_frame_path_;
+    std::string first_frame_key_;
+    std::string replayed_data_;  // 上次落盘的内容，首帧没有变化时不重复写文件
+    std::unique_ptr<KRViewFlattenTree> flatten_tree_;  // 未开启容器拍平时为空，只在主线程访问
+
     /** 从复用队列中弹出一个view */
     std::shared_ptr<IKRRenderViewExport> PopViewFromReuseQueue(const std::string &view_name);
     /** 把view放进复用队列里复用 */
     void PushViewToReuseQueue(std::shared_ptr<IKRRenderViewExport> view);
+    /** 创建（或从复用队列取出）view 并注册 */
+    std::shared_ptr<IKRRenderViewExport> NewRenderView(int tag, const std::string &view_name);
+    /** 从父节点摘下 view 并回收 */
+    void RecycleRenderView(int tag);
+    /** 初始化首帧记录的文件路径与 key，未开启时为空 */
+    void SetupFirstFrameRecorder();
+    /** 把回放出来的 view 从回放时的父节点上摘下来 */
+    void DetachReplayedView(int tag);
+    void ReplayShadow(const std::shared_ptr<IKRRenderViewExport> &view, const KRTreeShadow &shadow_node);
+    void FinishReplay(const KRRenderTreeSnapshot &live);
+    /** 拍平模式下虚拟节点被外部访问时先物化 */
+    void MaterializeIfVirtual(int tag);
+
+    // IKRViewFlattenDelegate
+    void AttachRealView(int32_t host_tag, int32_t child_tag, int index) override;
+    void DetachRealView(int32_t child_tag) override;
+    void ApplyRealFrame(int32_t tag, const KRRect &frame) override;
+    bool CreateRealView(int32_t tag) override;
+
+    template <typename Fn>
+    void RecordFirstFrame(Fn &&fn) {
+        if (!first_frame_recording_.load(std::memory_order_acquire)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(first_frame_mutex_);
+        if (first_frame_recorder_ != nullptr) {
+            fn(*first_frame_recorder_);
+        }
+    }
 };
 
 #endif  // CORE_RENDER_OHOS_KRRENDERLAYERHANDLER_H
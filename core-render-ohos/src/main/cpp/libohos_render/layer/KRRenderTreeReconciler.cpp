@@ -0,0 +1,87 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/layer/KRRenderTreeReconciler.h"
+
+KRRenderTreeReconciler::CreateAction KRRenderTreeReconciler::OnCreate(int32_t tag, const std::string &view_name) {
+    auto node = replayed_->Node(tag);
+    if (node == nullptr || !handled_.insert(tag).second) {
+        return CreateAction::kCreate;
+    }
+    if (node->view_name != view_name) {
+        return CreateAction::kReplace;
+    }
+    claimed_.insert(tag);
+    return CreateAction::kReuse;
+}
+
+void KRRenderTreeReconciler::OnRemove(int32_t tag) {
+    if (replayed_->Node(tag) != nullptr) {
+        handled_.insert(tag);
+    }
+    claimed_.erase(tag);
+    confirmed_props_.erase(tag);
+}
+
+bool KRRenderTreeReconciler::ShouldSkipProp(int32_t tag, const std::string &key, const KRTreePropValue &value) {
+    if (!IsClaimed(tag) || !confirmed_props_[tag].insert(key).second) {
+        return false;
+    }
+    for (const auto &prop : replayed_->Node(tag)->props) {
+        if (prop.first == key) {
+            return prop.second == value;
+        }
+    }
+    return false;
+}
+
+void KRRenderTreeReconciler::ConfirmProp(int32_t tag, const std::string &key) {
+    if (IsClaimed(tag)) {
+        confirmed_props_[tag].insert(key);
+    }
+}
+
+bool KRRenderTreeReconciler::ShouldSkipInsert(int32_t parent_tag, int32_t child_tag) {
+    if (!IsClaimed(child_tag) || !inserted_.insert(child_tag).second) {
+        return false;
+    }
+    return parent_tag != KRRenderTreeSnapshot::kRootTag && IsClaimed(parent_tag) &&
+           replayed_->Node(child_tag)->parent_tag == parent_tag;
+}
+
+KRRenderTreeReconciler::Result KRRenderTreeReconciler::Finish(const KRRenderTreeSnapshot &live) const {
+    Result result;
+    auto order = replayed_->PreOrder();
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        if (!handled_.count(*it)) {
+            result.unclaimed_tags.push_back(*it);
+        }
+    }
+    for (auto tag : order) {
+        if (!IsClaimed(tag)) {
+            continue;
+        }
+        auto confirmed = confirmed_props_.find(tag);
+        for (const auto &prop : replayed_->Node(tag)->props) {
+            if (confirmed == confirmed_props_.end() || !confirmed->second.count(prop.first)) {
+                result.stale_props.emplace_back(tag, prop.first);
+            }
+        }
+        if (live.Node(tag) != nullptr && live.Children(tag) != replayed_->Children(tag)) {
+            result.reorder_parents.push_back(tag);
+        }
+    }
+    return result;
+}
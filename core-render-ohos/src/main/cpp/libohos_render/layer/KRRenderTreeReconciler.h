@@ -0,0 +1,88 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRENDERTREERECONCILER_H
+#define CORE_RENDER_OHOS_KRRENDERTREERECONCILER_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "libohos_render/layer/KRRenderTreeSnapshot.h"
+
+/**
+ * 首帧回放对账器：回放出来的 view 树先上屏，真实操作流到达后逐条与回放树比对，
+ * 能复用的 view 直接认领，相同的属性和挂载关系跳过，只把差异下发到节点上。
+ *
+ * 规则：
+ * - 创建：tag 与 view 名字都一致时认领回放的 view；名字不一致时丢弃回放的 view 重新创建
+ * - 属性：认领的 view 上第一次设置某个 key 且值与回放值相同时跳过
+ * - 挂载：认领的 view 第一次插入到回放时的同一个父节点下时跳过（根节点除外，由调用方处理）
+ * - 收尾：Finish 给出没有被认领的 view、回放设置过但真实流没有设置的属性、以及子节点顺序与回放不一致的父节点
+ */
+class KRRenderTreeReconciler {
+ public:
+    enum class CreateAction {
+        kCreate,   // 不是回放出来的 tag，正常创建
+        kReuse,    // 认领回放出来的 view
+        kReplace,  // view 名字不一致，先删除回放出来的 view 再创建
+    };
+
+    struct Result {
+        std::vector<int32_t> unclaimed_tags;  // 子节点在前
+        std::vector<std::pair<int32_t, std::string>> stale_props;
+        std::vector<int32_t> reorder_parents;
+    };
+
+    explicit KRRenderTreeReconciler(std::shared_ptr<const KRRenderTreeSnapshot> replayed)
+        : replayed_(std::move(replayed)) {}
+
+    const KRRenderTreeSnapshot &Replayed() const {
+        return *replayed_;
+    }
+
+    CreateAction OnCreate(int32_t tag, const std::string &view_name);
+    void OnRemove(int32_t tag);
+    bool IsClaimed(int32_t tag) const {
+        return claimed_.count(tag) > 0;
+    }
+    /**
+     * 返回 true 表示与回放值相同，可以跳过本次设置
+     */
+    bool ShouldSkipProp(int32_t tag, const std::string &key, const KRTreePropValue &value);
+    /**
+     * 值无法比较（无法落盘的类型）时只标记该 key 已经被真实流设置过
+     */
+    void ConfirmProp(int32_t tag, const std::string &key);
+    /**
+     * 返回 true 表示回放时已经挂载在同一个父节点下，可以跳过本次插入
+     */
+    bool ShouldSkipInsert(int32_t parent_tag, int32_t child_tag);
+    /**
+     * @param live 真实操作流记录下来的渲染树
+     */
+    Result Finish(const KRRenderTreeSnapshot &live) const;
+
+ private:
+    std::shared_ptr<const KRRenderTreeSnapshot> replayed_;
+    std::unordered_set<int32_t> handled_;  // 已经被创建/删除操作处理过的回放 tag
+    std::unordered_set<int32_t> claimed_;
+    std::unordered_set<int32_t> inserted_;
+    std::unordered_map<int32_t, std::unordered_set<std::string>> confirmed_props_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRRENDERTREERECONCILER_H
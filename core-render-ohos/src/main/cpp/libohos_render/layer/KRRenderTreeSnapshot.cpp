@@ -0,0 +1,482 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/layer/KRRenderTreeSnapshot.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+constexpr char kSnapshotMagic[4] = {'K', 'R', 'F', 'T'};
+constexpr uint64_t kSnapshotFormatVersion = 1;
+
+void SetProp(KRTreeProps &props, const std::string &key, KRTreePropValue value) {
+    for (auto &prop : props) {
+        if (prop.first == key) {
+            prop.second = std::move(value);
+            return;
+        }
+    }
+    props.emplace_back(key, std::move(value));
+}
+
+void EraseProp(KRTreeProps &props, const std::string &key) {
+    props.erase(std::remove_if(props.begin(), props.end(), [&key](const auto &prop) { return prop.first == key; }),
+                props.end());
+}
+
+class Writer {
+ public:
+    void Bytes(const void *data, size_t length) {
+        out_.append(static_cast<const char *>(data), length);
+    }
+    void Byte(uint8_t value) {
+        out_.push_back(static_cast<char>(value));
+    }
+    void Varint(uint64_t value) {
+        while (value >= 0x80) {
+            Byte(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        Byte(static_cast<uint8_t>(value));
+    }
+    void Signed(int64_t value) {
+        Varint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+    void Double(double value) {
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(bits));
+        for (int i = 0; i < 8; i++) {
+            Byte(static_cast<uint8_t>(bits >> (i * 8)));
+        }
+    }
+    void String(const std::string &value) {
+        Varint(value.size());
+        Bytes(value.data(), value.size());
+    }
+    void Value(const KRTreePropValue &value) {
+        Byte(static_cast<uint8_t>(value.type));
+        switch (value.type) {
+        case KRTreePropType::kBool:
+            Byte(value.int_value ? 1 : 0);
+            break;
+        case KRTreePropType::kInt:
+            Signed(value.int_value);
+            break;
+        case KRTreePropType::kDouble:
+            Double(value.double_value);
+            break;
+        case KRTreePropType::kString:
+        case KRTreePropType::kJson:
+        case KRTreePropType::kBytes:
+            String(value.string_value);
+            break;
+        case KRTreePropType::kNull:
+            break;
+        }
+    }
+    void Props(const KRTreeProps &props) {
+        Varint(props.size());
+        for (const auto &prop : props) {
+            String(prop.first);
+            Value(prop.second);
+        }
+    }
+    std::string &Result() {
+        return out_;
+    }
+
+ private:
+    std::string out_;
+};
+
+class Reader {
+ public:
+    explicit Reader(const std::string &data) : data_(data) {}
+
+    bool Bytes(void *out, size_t length) {
+        if (data_.size() - pos_ < length) {
+            return false;
+        }
+        memcpy(out, data_.data() + pos_, length);
+        pos_ += length;
+        return true;
+    }
+    bool Byte(uint8_t &value) {
+        return Bytes(&value, 1);
+    }
+    bool Varint(uint64_t &value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = 0;
+            if (!Byte(byte)) {
+                return false;
+            }
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+    bool Signed(int64_t &value) {
+        uint64_t raw = 0;
+        if (!Varint(raw)) {
+            return false;
+        }
+        value = static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+        return true;
+    }
+    bool Tag(int32_t &value) {
+        int64_t raw = 0;
+        if (!Signed(raw) || raw < INT32_MIN || raw > INT32_MAX) {
+            return false;
+        }
+        value = static_cast<int32_t>(raw);
+        return true;
+    }
+    bool Double(double &value) {
+        uint64_t bits = 0;
+        for (int i = 0; i < 8; i++) {
+            uint8_t byte = 0;
+            if (!Byte(byte)) {
+                return false;
+            }
+            bits |= static_cast<uint64_t>(byte) << (i * 8);
+        }
+        memcpy(&value, &bits, sizeof(value));
+        return true;
+    }
+    bool String(std::string &value) {
+        uint64_t length = 0;
+        if (!Varint(length) || data_.size() - pos_ < length) {
+            return false;
+        }
+        value.assign(data_, pos_, length);
+        pos_ += length;
+        return true;
+    }
+    bool Value(KRTreePropValue &value) {
+        uint8_t type = 0;
+        if (!Byte(type) || type > static_cast<uint8_t>(KRTreePropType::kBytes)) {
+            return false;
+        }
+        value = {};
+        value.type = static_cast<KRTreePropType>(type);
+        switch (value.type) {
+        case KRTreePropType::kBool: {
+            uint8_t flag = 0;
+            if (!Byte(flag)) {
+                return false;
+            }
+            value.int_value = flag ? 1 : 0;
+            return true;
+        }
+        case KRTreePropType::kInt:
+            return Signed(value.int_value);
+        case KRTreePropType::kDouble:
+            return Double(value.double_value);
+        case KRTreePropType::kString:
+        case KRTreePropType::kJson:
+        case KRTreePropType::kBytes:
+            return String(value.string_value);
+        case KRTreePropType::kNull:
+            return true;
+        }
+        return false;
+    }
+    bool Props(KRTreeProps &props) {
+        uint64_t count = 0;
+        if (!Varint(count) || count > data_.size() - pos_) {
+            return false;
+        }
+        props.clear();
+        for (uint64_t i = 0; i < count; i++) {
+            std::string key;
+            KRTreePropValue value;
+            if (!String(key) || !Value(value)) {
+                return false;
+            }
+            SetProp(props, key, std::move(value));
+        }
+        return true;
+    }
+    bool AtEnd() const {
+        return pos_ == data_.size();
+    }
+    size_t Remaining() const {
+        return data_.size() - pos_;
+    }
+
+ private:
+    const std::string &data_;
+    size_t pos_ = 0;
+};
+
+}  // namespace
+
+void KRRenderTreeSnapshot::RecordCreate(int32_t tag, const std::string &view_name) {
+    if (tag == kRootTag || tag == kDetachedTag || nodes_.count(tag)) {
+        return;
+    }
+    auto &node = nodes_[tag];
+    node.tag = tag;
+    node.view_name = view_name;
+}
+
+void KRRenderTreeSnapshot::RecordRemove(int32_t tag) {
+    auto it = nodes_.find(tag);
+    if (it == nodes_.end()) {
+        return;
+    }
+    Detach(tag);
+    for (auto child : it->second.children) {
+        auto child_it = nodes_.find(child);
+        if (child_it != nodes_.end()) {
+            child_it->second.parent_tag = kDetachedTag;
+        }
+    }
+    nodes_.erase(it);
+}
+
+void KRRenderTreeSnapshot::RecordInsert(int32_t parent_tag, int32_t child_tag, int index) {
+    auto child_it = nodes_.find(child_tag);
+    auto children = MutableChildren(parent_tag);
+    if (child_it == nodes_.end() || children == nullptr) {
+        return;
+    }
+    // 不允许把节点插到自己的子树里，否则前序遍历会成环
+    for (auto ancestor = parent_tag; ancestor != kRootTag && ancestor != kDetachedTag;) {
+        if (ancestor == child_tag) {
+            return;
+        }
+        ancestor = nodes_.at(ancestor).parent_tag;
+    }
+    Detach(child_tag);
+    if (index < 0 || static_cast<size_t>(index) > children->size()) {
+        children->push_back(child_tag);
+    } else {
+        children->insert(children->begin() + index, child_tag);
+    }
+    child_it->second.parent_tag = parent_tag;
+}
+
+void KRRenderTreeSnapshot::RecordProp(int32_t tag, const std::string &key, KRTreePropValue value) {
+    auto it = nodes_.find(tag);
+    if (it != nodes_.end()) {
+        SetProp(it->second.props, key, std::move(value));
+    }
+}
+
+void KRRenderTreeSnapshot::ForgetProp(int32_t tag, const std::string &key) {
+    auto it = nodes_.find(tag);
+    if (it != nodes_.end()) {
+        EraseProp(it->second.props, key);
+    }
+}
+
+void KRRenderTreeSnapshot::RecordCreateShadow(int32_t tag, const std::string &view_name) {
+    if (!shadows_.count(tag)) {
+        shadows_[tag].view_name = view_name;
+    }
+}
+
+void KRRenderTreeSnapshot::RecordRemoveShadow(int32_t tag) {
+    shadows_.erase(tag);
+}
+
+void KRRenderTreeSnapshot::RecordShadowProp(int32_t tag, const std::string &key, KRTreePropValue value) {
+    auto it = shadows_.find(tag);
+    if (it != shadows_.end()) {
+        SetProp(it->second.props, key, std::move(value));
+    }
+}
+
+void KRRenderTreeSnapshot::ForgetShadowProp(int32_t tag, const std::string &key) {
+    auto it = shadows_.find(tag);
+    if (it != shadows_.end()) {
+        EraseProp(it->second.props, key);
+    }
+}
+
+void KRRenderTreeSnapshot::RecordShadowConstraint(int32_t tag, double width, double height) {
+    auto it = shadows_.find(tag);
+    if (it != shadows_.end()) {
+        it->second.has_constraint = true;
+        it->second.constraint_width = width;
+        it->second.constraint_height = height;
+    }
+}
+
+const KRTreeNode *KRRenderTreeSnapshot::Node(int32_t tag) const {
+    auto it = nodes_.find(tag);
+    return it == nodes_.end() ? nullptr : &it->second;
+}
+
+const KRTreeShadow *KRRenderTreeSnapshot::Shadow(int32_t tag) const {
+    auto it = shadows_.find(tag);
+    return it == shadows_.end() ? nullptr : &it->second;
+}
+
+const std::vector<int32_t> &KRRenderTreeSnapshot::Children(int32_t parent_tag) const {
+    static const std::vector<int32_t> kEmpty;
+    if (parent_tag == kRootTag) {
+        return root_children_;
+    }
+    auto it = nodes_.find(parent_tag);
+    return it == nodes_.end() ? kEmpty : it->second.children;
+}
+
+std::vector<int32_t> KRRenderTreeSnapshot::PreOrder() const {
+    std::vector<int32_t> order;
+    std::vector<int32_t> stack(root_children_.rbegin(), root_children_.rend());
+    while (!stack.empty()) {
+        auto tag = stack.back();
+        stack.pop_back();
+        order.push_back(tag);
+        const auto &children = Children(tag);
+        stack.insert(stack.end(), children.rbegin(), children.rend());
+    }
+    return order;
+}
+
+void KRRenderTreeSnapshot::Clear() {
+    nodes_.clear();
+    shadows_.clear();
+    root_children_.clear();
+}
+
+std::string KRRenderTreeSnapshot::Encode(const std::string &key) const {
+    Writer writer;
+    writer.Bytes(kSnapshotMagic, sizeof(kSnapshotMagic));
+    writer.Varint(kSnapshotFormatVersion);
+    writer.String(key);
+    auto order = PreOrder();
+    writer.Varint(order.size());
+    for (auto tag : order) {
+        const auto &node = nodes_.at(tag);
+        writer.Signed(node.tag);
+        writer.Signed(node.parent_tag);
+        writer.String(node.view_name);
+        writer.Props(node.props);
+        auto shadow = Shadow(tag);
+        writer.Byte(shadow != nullptr ? 1 : 0);
+        if (shadow != nullptr) {
+            writer.String(shadow->view_name);
+            writer.Props(shadow->props);
+            writer.Byte(shadow->has_constraint ? 1 : 0);
+            writer.Double(shadow->constraint_width);
+            writer.Double(shadow->constraint_height);
+        }
+    }
+    return std::move(writer.Result());
+}
+
+bool KRRenderTreeSnapshot::Decode(const std::string &data, const std::string &key) {
+    Clear();
+    Reader reader(data);
+    char magic[sizeof(kSnapshotMagic)] = {};
+    uint64_t version = 0;
+    std::string file_key;
+    uint64_t count = 0;
+    if (!reader.Bytes(magic, sizeof(magic)) || memcmp(magic, kSnapshotMagic, sizeof(magic)) != 0 ||
+        !reader.Varint(version) || version != kSnapshotFormatVersion || !reader.String(file_key) ||
+        file_key != key || !reader.Varint(count) || count > reader.Remaining()) {
+        return false;
+    }
+    bool ok = true;
+    for (uint64_t i = 0; i < count && ok; i++) {
+        int32_t tag = 0;
+        int32_t parent_tag = 0;
+        std::string view_name;
+        KRTreeProps props;
+        uint8_t has_shadow = 0;
+        ok = reader.Tag(tag) && reader.Tag(parent_tag) && reader.String(view_name) && reader.Props(props) &&
+             reader.Byte(has_shadow);
+        // 前序遍历保证父节点先出现，重复 tag 或父节点缺失都视为损坏
+        ok = ok && tag != kRootTag && tag != kDetachedTag && !nodes_.count(tag) &&
+             (parent_tag == kRootTag || nodes_.count(parent_tag));
+        if (!ok) {
+            break;
+        }
+        RecordCreate(tag, view_name);
+        RecordInsert(parent_tag, tag, -1);
+        nodes_[tag].props = std::move(props);
+        if (has_shadow) {
+            KRTreeShadow shadow;
+            uint8_t has_constraint = 0;
+            ok = reader.String(shadow.view_name) && reader.Props(shadow.props) && reader.Byte(has_constraint) &&
+                 reader.Double(shadow.constraint_width) && reader.Double(shadow.constraint_height);
+            shadow.has_constraint = has_constraint != 0;
+            shadows_[tag] = std::move(shadow);
+        }
+    }
+    if (!ok || !reader.AtEnd()) {
+        Clear();
+        return false;
+    }
+    return true;
+}
+
+bool KRRenderTreeSnapshot::WriteFile(const std::string &path, const std::string &data) {
+    std::string tmp_path = path + ".tmp";
+    FILE *file = fopen(tmp_path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok = (fclose(file) == 0) && ok;
+    if (!ok || rename(tmp_path.c_str(), path.c_str()) != 0) {
+        remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool KRRenderTreeSnapshot::ReadFile(const std::string &path, std::string &data) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    data.clear();
+    char buffer[16 * 1024];
+    size_t read_length = 0;
+    while ((read_length = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.append(buffer, read_length);
+    }
+    fclose(file);
+    return true;
+}
+
+void KRRenderTreeSnapshot::Detach(int32_t tag) {
+    auto it = nodes_.find(tag);
+    if (it == nodes_.end() || it->second.parent_tag == kDetachedTag) {
+        return;
+    }
+    if (auto children = MutableChildren(it->second.parent_tag)) {
+        children->erase(std::remove(children->begin(), children->end(), tag), children->end());
+    }
+    it->second.parent_tag = kDetachedTag;
+}
+
+std::vector<int32_t> *KRRenderTreeSnapshot::MutableChildren(int32_t parent_tag) {
+    if (parent_tag == kRootTag) {
+        return &root_children_;
+    }
+    auto it = nodes_.find(parent_tag);
+    return it == nodes_.end() ? nullptr : &it->second.children;
+}
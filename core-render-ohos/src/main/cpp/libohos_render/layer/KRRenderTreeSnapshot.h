@@ -0,0 +1,156 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRENDERTREESNAPSHOT_H
+#define CORE_RENDER_OHOS_KRRENDERTREESNAPSHOT_H
+
+#include <climits>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * 首帧快照里可落盘的属性值类型（不依赖 KRRenderValue，便于 host 单测）
+ */
+enum class KRTreePropType : uint8_t {
+    kNull = 0,
+    kBool = 1,
+    kInt = 2,
+    kDouble = 3,
+    kString = 4,
+    kJson = 5,   // Map / Array 序列化后的 json 字符串
+    kBytes = 6,  // 二进制数据
+};
+
+struct KRTreePropValue {
+    KRTreePropType type = KRTreePropType::kNull;
+    int64_t int_value = 0;  // kBool / kInt
+    double double_value = 0;
+    std::string string_value;  // kString / kJson / kBytes
+
+    static KRTreePropValue Null() {
+        return {};
+    }
+    static KRTreePropValue Bool(bool value) {
+        return {KRTreePropType::kBool, value ? 1 : 0, 0, {}};
+    }
+    static KRTreePropValue Int(int64_t value) {
+        return {KRTreePropType::kInt, value, 0, {}};
+    }
+    static KRTreePropValue Double(double value) {
+        return {KRTreePropType::kDouble, 0, value, {}};
+    }
+    static KRTreePropValue String(std::string value) {
+        return {KRTreePropType::kString, 0, 0, std::move(value)};
+    }
+    static KRTreePropValue Json(std::string value) {
+        return {KRTreePropType::kJson, 0, 0, std::move(value)};
+    }
+    static KRTreePropValue Bytes(std::string value) {
+        return {KRTreePropType::kBytes, 0, 0, std::move(value)};
+    }
+
+    bool operator==(const KRTreePropValue &other) const {
+        return type == other.type && int_value == other.int_value && double_value == other.double_value &&
+               string_value == other.string_value;
+    }
+    bool operator!=(const KRTreePropValue &other) const {
+        return !(*this == other);
+    }
+};
+
+/** 按首次设置的顺序保存属性，回放时按同样的顺序设置 */
+using KRTreeProps = std::vector<std::pair<std::string, KRTreePropValue>>;
+
+struct KRTreeShadow {
+    std::string view_name;
+    KRTreeProps props;
+    bool has_constraint = false;  // 是否测量过，回放时用最后一次测量约束重新排版
+    double constraint_width = 0;
+    double constraint_height = 0;
+};
+
+struct KRTreeNode {
+    int32_t tag = 0;
+    std::string view_name;
+    int32_t parent_tag = INT32_MIN;  // KRRenderTreeSnapshot::kDetachedTag 表示未挂载
+    std::vector<int32_t> children;
+    KRTreeProps props;
+};
+
+/**
+ * 渲染树快照：按 CreateRenderView / InsertSubRenderView / SetProp 等操作流维护一棵 view 树，
+ * 用于记录页面首帧并落盘，下次打开同一页面时先回放出来，再与真实操作流对账（见 KRRenderTreeReconciler）。
+ *
+ * 只保存从根节点可达的子树，事件不会落盘。文件格式为 magic + 格式版本 + key + 前序遍历的节点，
+ * 整数用 varint 编码；key 不一致（页面、业务版本或屏幕参数变化）时 Decode 直接失败。
+ * 非线程安全，由调用方加锁。
+ */
+class KRRenderTreeSnapshot {
+ public:
+    static constexpr int32_t kRootTag = -1;
+    static constexpr int32_t kDetachedTag = INT32_MIN;
+
+    void RecordCreate(int32_t tag, const std::string &view_name);
+    void RecordRemove(int32_t tag);
+    /**
+     * index < 0 或越界时追加到末尾，与 ToInsertSubRenderView 一致
+     */
+    void RecordInsert(int32_t parent_tag, int32_t child_tag, int index);
+    void RecordProp(int32_t tag, const std::string &key, KRTreePropValue value);
+    /** 属性值无法落盘时调用，避免回放出过期的值 */
+    void ForgetProp(int32_t tag, const std::string &key);
+
+    void RecordCreateShadow(int32_t tag, const std::string &view_name);
+    void RecordRemoveShadow(int32_t tag);
+    void RecordShadowProp(int32_t tag, const std::string &key, KRTreePropValue value);
+    void ForgetShadowProp(int32_t tag, const std::string &key);
+    void RecordShadowConstraint(int32_t tag, double width, double height);
+
+    const KRTreeNode *Node(int32_t tag) const;
+    const KRTreeShadow *Shadow(int32_t tag) const;
+    /**
+     * 子节点列表，parent_tag 为 kRootTag 时返回根节点下的内容
+     */
+    const std::vector<int32_t> &Children(int32_t parent_tag) const;
+    /**
+     * 从根节点可达的节点，父节点在前，兄弟节点按顺序排列
+     */
+    std::vector<int32_t> PreOrder() const;
+    bool Empty() const {
+        return root_children_.empty();
+    }
+    void Clear();
+
+    std::string Encode(const std::string &key) const;
+    bool Decode(const std::string &data, const std::string &key);
+    /**
+     * 先写临时文件再 rename，读到半截文件时 ReadFile 直接失败
+     */
+    static bool WriteFile(const std::string &path, const std::string &data);
+    static bool ReadFile(const std::string &path, std::string &data);
+
+ private:
+    std::unordered_map<int32_t, KRTreeNode> nodes_;
+    std::unordered_map<int32_t, KRTreeShadow> shadows_;
+    std::vector<int32_t> root_children_;
+
+    void Detach(int32_t tag);
+    std::vector<int32_t> *MutableChildren(int32_t parent_tag);
+};
+
+#endif  // CORE_RENDER_OHOS_KRRENDERTREESNAPSHOT_H
@@ -0,0 +1,263 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/layer/KRViewFlattenTree.h"
+
+#include <algorithm>
+
+void KRViewFlattenTree::AddNode(int32_t tag, bool is_virtual, bool can_host) {
+    if (tag == kRootTag) {
+        return;
+    }
+    if (Contains(tag)) {
+        RemoveNode(tag);
+    }
+    auto &node = nodes_[tag];
+    node.is_virtual = is_virtual;
+    node.can_host = can_host;
+    if (is_virtual) {
+        virtual_count_++;
+    }
+}
+
+void KRViewFlattenTree::RemoveNode(int32_t tag) {
+    auto it = nodes_.find(tag);
+    if (it == nodes_.end() || tag == kRootTag) {
+        return;
+    }
+    if (it->second.is_virtual) {
+        // 虚拟节点没有自己的 ArkUI 节点，挂在祖先上的子孙节点需要显式摘下，效果与删除真实容器时整棵子树离屏一致
+        std::vector<int32_t> roots;
+        CollectRealRoots(tag, roots);
+        for (auto root : roots) {
+            DetachReal(root);
+        }
+        virtual_count_--;
+    }
+    DetachFromParent(tag);
+    auto children = std::move(nodes_[tag].children);
+    for (auto child : children) {
+        nodes_[child].parent = kNoParent;
+    }
+    nodes_.erase(tag);
+}
+
+void KRViewFlattenTree::Insert(int32_t parent_tag, int32_t child_tag, int index) {
+    if (parent_tag == child_tag || !Contains(parent_tag) || !Contains(child_tag) || child_tag == kRootTag) {
+        return;
+    }
+    if (nodes_[child_tag].parent != kNoParent) {
+        if (nodes_[child_tag].is_virtual) {
+            std::vector<int32_t> roots;
+            CollectRealRoots(child_tag, roots);
+            for (auto root : roots) {
+                DetachReal(root);
+            }
+        }
+        DetachFromParent(child_tag);
+    }
+    auto &parent = nodes_[parent_tag];
+    auto &siblings = parent.children;
+    if (index < 0 || index > static_cast<int>(siblings.size())) {
+        index = static_cast<int>(siblings.size());
+    }
+    siblings.insert(siblings.begin() + index, child_tag);
+    auto &child = nodes_[child_tag];
+    child.parent = parent_tag;
+
+    if (child.is_virtual && !parent.is_virtual && !parent.can_host) {
+        Materialize(child_tag);  // 物化时会挂到父节点上
+        return;
+    }
+    auto host = HostOf(child_tag);
+    if (host == kNoParent) {
+        // 虚拟祖先还没有挂到树上，等链路接通时一起挂载；从别处移过来的真实节点先从旧位置摘下
+        DetachReal(child_tag);
+        return;
+    }
+    if (child.is_virtual) {
+        std::vector<int32_t> roots;
+        CollectRealRoots(child_tag, roots);
+        AttachRealRoots(host, roots);
+    } else {
+        AttachReal(host, child_tag, RealIndexOf(host, child_tag));
+        ApplyFrame(child_tag, false);
+    }
+}
+
+void KRViewFlattenTree::SetFrame(int32_t tag, const KRRect &frame) {
+    auto it = nodes_.find(tag);
+    if (it == nodes_.end() || tag == kRootTag) {
+        return;
+    }
+    it->second.frame = frame;
+    it->second.has_frame = true;
+    if (!it->second.is_virtual) {
+        ApplyFrame(tag, true);
+        return;
+    }
+    // 只有原点变化会影响子孙节点，ApplyFrame 内按偏移是否变化过滤
+    std::vector<int32_t> roots;
+    CollectRealRoots(tag, roots);
+    for (auto root : roots) {
+        ApplyFrame(root, false);
+    }
+}
+
+bool KRViewFlattenTree::Materialize(int32_t tag) {
+    auto it = nodes_.find(tag);
+    if (it == nodes_.end()) {
+        return false;
+    }
+    if (!it->second.is_virtual) {
+        return true;
+    }
+    if (!delegate_->CreateRealView(tag)) {
+        return false;
+    }
+    std::vector<int32_t> roots;
+    CollectRealRoots(tag, roots);
+    auto &node = nodes_[tag];
+    node.is_virtual = false;
+    node.can_host = true;
+    virtual_count_--;
+    // 先把子孙节点收回到新节点下，再把新节点挂到祖先上，祖先只发生一次子节点变化
+    for (size_t i = 0; i < roots.size(); i++) {
+        DetachReal(roots[i]);
+        AttachReal(tag, roots[i], static_cast<int>(i));
+        ApplyFrame(roots[i], false);
+    }
+    ApplyFrame(tag, true);
+    auto host = HostOf(tag);
+    if (host != kNoParent) {
+        AttachReal(host, tag, RealIndexOf(host, tag));
+    }
+    return true;
+}
+
+int32_t KRViewFlattenTree::HostOf(int32_t tag) const {
+    auto parent = nodes_.at(tag).parent;
+    while (parent != kNoParent) {
+        const auto &node = nodes_.at(parent);
+        if (!node.is_virtual) {
+            return parent;
+        }
+        parent = node.parent;
+    }
+    return kNoParent;
+}
+
+KRPoint KRViewFlattenTree::OffsetOf(int32_t tag) const {
+    KRPoint offset;
+    auto parent = nodes_.at(tag).parent;
+    while (parent != kNoParent) {
+        const auto &node = nodes_.at(parent);
+        if (!node.is_virtual) {
+            break;
+        }
+        if (node.has_frame) {
+            offset.x += node.frame.x;
+            offset.y += node.frame.y;
+        }
+        parent = node.parent;
+    }
+    return offset;
+}
+
+void KRViewFlattenTree::CollectRealRoots(int32_t tag, std::vector<int32_t> &out) const {
+    for (auto child : nodes_.at(tag).children) {
+        if (nodes_.at(child).is_virtual) {
+            CollectRealRoots(child, out);
+        } else {
+            out.push_back(child);
+        }
+    }
+}
+
+int KRViewFlattenTree::RealIndexOf(int32_t host_tag, int32_t target) const {
+    int count = 0;
+    CountRealBefore(host_tag, target, count);
+    return count;
+}
+
+bool KRViewFlattenTree::CountRealBefore(int32_t tag, int32_t target, int &count) const {
+    for (auto child : nodes_.at(tag).children) {
+        if (child == target) {
+            return true;
+        }
+        const auto &node = nodes_.at(child);
+        if (node.is_virtual) {
+            if (CountRealBefore(child, target, count)) {
+                return true;
+            }
+        } else if (node.attached) {
+            count++;
+        }
+    }
+    return false;
+}
+
+void KRViewFlattenTree::DetachFromParent(int32_t tag) {
+    auto &node = nodes_[tag];
+    if (node.parent == kNoParent) {
+        return;
+    }
+    auto &siblings = nodes_[node.parent].children;
+    auto it = std::find(siblings.begin(), siblings.end(), tag);
+    if (it != siblings.end()) {
+        siblings.erase(it);
+    }
+    node.parent = kNoParent;
+}
+
+void KRViewFlattenTree::AttachReal(int32_t host_tag, int32_t tag, int index) {
+    delegate_->AttachRealView(host_tag, tag, index);
+    nodes_[tag].attached = true;
+}
+
+void KRViewFlattenTree::DetachReal(int32_t tag) {
+    auto &node = nodes_[tag];
+    if (!node.attached) {
+        return;
+    }
+    delegate_->DetachRealView(tag);
+    node.attached = false;
+}
+
+void KRViewFlattenTree::AttachRealRoots(int32_t host_tag, const std::vector<int32_t> &roots) {
+    if (roots.empty()) {
+        return;
+    }
+    // 同一个虚拟节点展开出来的真实节点在先序上是连续的
+    auto index = RealIndexOf(host_tag, roots.front());
+    for (size_t i = 0; i < roots.size(); i++) {
+        AttachReal(host_tag, roots[i], index + static_cast<int>(i));
+        ApplyFrame(roots[i], false);
+    }
+}
+
+void KRViewFlattenTree::ApplyFrame(int32_t tag, bool force) {
+    auto &node = nodes_[tag];
+    if (node.is_virtual || !node.has_frame) {
+        return;
+    }
+    auto offset = OffsetOf(tag);
+    if (!force && offset == node.applied_offset) {
+        return;
+    }
+    node.applied_offset = offset;
+    KRRect frame(node.frame.x + offset.x, node.frame.y + offset.y, node.frame.width, node.frame.height);
+    delegate_->ApplyRealFrame(tag, frame);
+}
@@ -0,0 +1,137 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRVIEWFLATTENTREE_H
+#define CORE_RENDER_OHOS_KRVIEWFLATTENTREE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "libohos_render/foundation/KRRect.h"
+
+/**
+ * 拍平树对真实节点的操作回调，由 layer 层实现，全部在主线程调用
+ */
+class IKRViewFlattenDelegate {
+ public:
+    virtual ~IKRViewFlattenDelegate() = default;
+    /**
+     * 把真实节点 child 挂到真实节点 host 的 index 位置，host 为 KRViewFlattenTree::kRootTag 时挂到根容器
+     */
+    virtual void AttachRealView(int32_t host_tag, int32_t child_tag, int index) = 0;
+    virtual void DetachRealView(int32_t child_tag) = 0;
+    /**
+     * 设置真实节点的 frame，已换算到所挂载的真实父节点坐标系
+     */
+    virtual void ApplyRealFrame(int32_t tag, const KRRect &frame) = 0;
+    /**
+     * 为虚拟节点创建真实 view，失败时返回 false，节点保持虚拟
+     */
+    virtual bool CreateRealView(int32_t tag) = 0;
+};
+
+/**
+ * 容器拍平：只用于布局分组、没有任何视觉属性和事件的容器不创建 ArkUI 节点，
+ * 以虚拟节点的形式留在逻辑树上，其真实子孙节点直接挂到最近的真实祖先上，frame 叠加虚拟祖先的偏移。
+ * 虚拟节点收到视觉属性或事件时按需物化为真实节点，并把挂在祖先上的子孙节点收回到自己名下。
+ *
+ * 规则：
+ * - 虚拟节点只能挂在可承载的真实节点（普通容器）下，直接挂到根容器或其他组件下时立即物化，
+ *   避免改变列表、滚动容器等组件看到的直接子节点
+ * - 真实节点在真实父节点中的下标按逻辑树先序展开虚拟节点后计算，保证绘制顺序与不拍平时一致
+ * - 偏移只在节点设置过 frame 后才下发（kotlin 侧每个节点都会设置 frame）
+ * - 纯逻辑结构，不依赖 ArkUI，只在主线程使用
+ */
+class KRViewFlattenTree {
+ public:
+    static constexpr int32_t kRootTag = -1;
+
+    explicit KRViewFlattenTree(IKRViewFlattenDelegate *delegate) : delegate_(delegate) {
+        nodes_[kRootTag] = Node();
+    }
+
+    /**
+     * 是否为只影响布局的属性，其余属性或事件到达虚拟节点时需要先物化
+     */
+    static bool IsStructuralProp(const std::string &prop_key) {
+        return prop_key == "frame";
+    }
+
+    /**
+     * 登记节点
+     * @param is_virtual 是否以虚拟节点创建
+     * @param can_host 真实节点是否可以承载虚拟子节点展开后的子孙节点
+     */
+    void AddNode(int32_t tag, bool is_virtual, bool can_host);
+    void RemoveNode(int32_t tag);
+    void Insert(int32_t parent_tag, int32_t child_tag, int index);
+    void SetFrame(int32_t tag, const KRRect &frame);
+    /**
+     * 把虚拟节点物化为真实节点，非虚拟节点直接返回 true
+     */
+    bool Materialize(int32_t tag);
+
+    bool Contains(int32_t tag) const {
+        return nodes_.count(tag) > 0;
+    }
+    bool IsVirtual(int32_t tag) const {
+        auto it = nodes_.find(tag);
+        return it != nodes_.end() && it->second.is_virtual;
+    }
+    size_t VirtualCount() const {
+        return virtual_count_;
+    }
+    void Clear() {
+        nodes_.clear();
+        nodes_[kRootTag] = Node();
+        virtual_count_ = 0;
+    }
+
+ private:
+    static constexpr int32_t kNoParent = -2;
+
+    struct Node {
+        int32_t parent = kNoParent;
+        std::vector<int32_t> children;
+        KRRect frame;
+        KRPoint applied_offset;  // 真实节点上次下发 frame 时使用的偏移
+        bool has_frame = false;
+        bool attached = false;  // 真实节点当前是否已挂到真实父节点上
+        bool is_virtual = false;
+        bool can_host = false;
+    };
+
+    IKRViewFlattenDelegate *delegate_;
+    std::unordered_map<int32_t, Node> nodes_;
+    size_t virtual_count_ = 0;
+
+    /** 从 tag 的父节点开始向上越过虚拟节点，返回最近的真实祖先，链路悬空时返回 kNoParent */
+    int32_t HostOf(int32_t tag) const;
+    /** 虚拟祖先的累计偏移 */
+    KRPoint OffsetOf(int32_t tag) const;
+    /** 虚拟节点展开后直接挂到真实祖先上的真实节点，先序 */
+    void CollectRealRoots(int32_t tag, std::vector<int32_t> &out) const;
+    /** target 在 host 展开后的真实子节点中的下标 */
+    int RealIndexOf(int32_t host_tag, int32_t target) const;
+    bool CountRealBefore(int32_t tag, int32_t target, int &count) const;
+    void DetachFromParent(int32_t tag);
+    void AttachReal(int32_t host_tag, int32_t tag, int index);
+    void DetachReal(int32_t tag);
+    void AttachRealRoots(int32_t host_tag, const std::vector<int32_t> &roots);
+    void ApplyFrame(int32_t tag, bool force);
+};
+
+#endif  // CORE_RENDER_OHOS_KRVIEWFLATTENTREE_H
@@ -90,34 +90,48 @@ KRAnyValue KRArkTSManager::CallArkTSMethod(const std::string &instanceId, KRNati
     if (arkTSCallbackData_ == nullptr) {
         return nullptr;
     }
+    if (!pending_view_ops_.Empty()) {
+        // 保证之前记录的View变更先于本次调用到达ArkTS侧
+        FlushViewOps();
+    }
+    return CallArkTSMethodDirectly(instanceId, methodId, arg0, arg1, arg2, arg3, arg4, callback, callback_keep_alive,
+                                   return_node_handle, arg_prefers_raw_napi_value, pContentHandle);
+}
+
+KRAnyValue KRArkTSManager::CallArkTSMethodDirectly(const std::string &instanceId, KRNativeCallArkTSMethod methodId,
+                                                   const KRAnyValue &arg0, const KRAnyValue &arg1,
+                                                   const KRAnyValue &arg2, const KRAnyValue &arg3,
+                                                   const KRAnyValue &arg4, const KRRenderCallback &callback,
+                                                   bool callback_keep_alive, ArkUI_NodeHandle *return_node_handle,
+                                                   bool arg_prefers_raw_napi_value,
+                                                   ArkUI_NodeContentHandle *pContentHandle) {
     napi_env env = arkTSCallbackData_->env;
     napi_value callbackFun;
     napi_get_reference_value(env, arkTSCallbackData_->callbackRef, &callbackFun);
     napi_value callbackArgs[8] = {nullptr};
-    napi_value instanceIdValue;
     napi_status status;
-    KRRenderValue::Make(instanceId)->ToNapiValue(env, &instanceIdValue, status);
-    callbackArgs[0] = instanceIdValue;
-    napi_value methodIdValue;
-    napi_create_int32(env, (int32_t)methodId, &methodIdValue);
-    callbackArgs[1] = methodIdValue;
+    auto instance_cache = GetInstanceCache(instanceId);
+    if (instance_cache == nullptr || instance_cache->instance_id_ref == nullptr ||
+        napi_get_reference_value(env, instance_cache->instance_id_ref, &callbackArgs[0]) != napi_ok ||
+        callbackArgs[0] == nullptr) {
+        napi_create_string_utf8(env, instanceId.c_str(), instanceId.size(), &callbackArgs[0]);
+    }
+    napi_create_int32(env, (int32_t)methodId, &callbackArgs[1]);
     callbackArgs[2] = CToNApiValue(env, arg0);
     callbackArgs[3] = CToNApiValue(env, arg1);
     callbackArgs[4] = CToNApiValue(env, arg2);
     callbackArgs[5] = CToNApiValue(env, arg3);
     callbackArgs[6] = CToNApiValue(env, arg4);
-    if (callback != nullptr) {
-        auto pager_id = instanceId;
-        auto renderView = KRRenderManager::GetInstance().GetRenderView(pager_id);
-        if (renderView != nullptr) {
-            auto callback_id =
-                renderView->GenerateArgCallbackId(callback, callback_keep_alive, arg_prefers_raw_napi_value);
-            callbackArgs[7] = CToNApiValue(env, NewKRRenderValue(callback_id));
-        }
+    std::shared_ptr<KRRenderView> renderView;
+    if (callback != nullptr && instance_cache != nullptr) {
+        renderView = instance_cache->render_view.lock();
+    }
+    if (renderView != nullptr) {
+        auto callback_id =
+            renderView->GenerateArgCallbackId(callback, callback_keep_alive, arg_prefers_raw_napi_value);
+        napi_create_int32(env, callback_id, &callbackArgs[7]);
     } else {
-        napi_value nullValue;
-        napi_get_null(env, &nullValue);
-        callbackArgs[7] = nullValue;
+        napi_get_null(env, &callbackArgs[7]);
     }
     // 执行回调函数
     napi_value result = nullptr;
@@ -145,6 +159,95 @@ KRAnyValue KRArkTSManager::CallArkTSMethod(const std::string &instanceId, KRNati
     return KRRenderValue::Make(env, result);
 }
 
+void KRArkTSManager::BeginViewOpBatch() {
+    view_op_batch_depth_++;
+}
+
+void KRArkTSManager::EndViewOpBatch() {
+    if (view_op_batch_depth_ > 0 && --view_op_batch_depth_ == 0) {
+        FlushViewOps();
+    }
+}
+
+void KRArkTSManager::EnqueueViewOp(const std::string &instanceId, KRNativeCallArkTSMethod methodId, int tag,
+                                   const KRAnyValue &arg0, const KRAnyValue &arg1) {
+    if (view_op_batch_depth_ == 0 || arkTSCallbackData_ == nullptr) {
+        CallArkTSMethod(instanceId, methodId, KRRenderValue::Make(tag), arg0, arg1, nullptr, nullptr, nullptr);
+        return;
+    }
+    pending_view_ops_.Enqueue(instanceId, tag, static_cast<int>(methodId), arg0 ? arg0 : KRRenderValue::Make(nullptr),
+                              arg1 ? arg1 : KRRenderValue::Make(nullptr));
+}
+
+void KRArkTSManager::FlushViewOps() {
+    if (arkTSCallbackData_ == nullptr) {
+        return;
+    }
+    // 逐个实例出队后直接发送（不再经过 CallArkTSMethod 的预下发），发送期间ArkTS侧同步回调触发的
+    // 其他调用会先下发剩余实例，保持跨实例的原有顺序
+    pending_view_ops_.Flush([this](const KRViewOpQueue<KRAnyValue>::Batch &batch) {
+        const auto &ops = batch.second;
+        if (ops.size() == 1) {
+            // 单条变更沿用原有调用方式，省去数组转换
+            const auto &op = ops.front();
+            CallArkTSMethodDirectly(batch.first, static_cast<KRNativeCallArkTSMethod>(op.method_id),
+                                    KRRenderValue::Make(op.tag), op.arg0, op.arg1, nullptr, nullptr, nullptr, false,
+                                    nullptr, false, nullptr);
+            return;
+        }
+        KRRenderValue::Array flat;
+        flat.reserve(ops.size() * 4);
+        for (const auto &op : ops) {
+            flat.push_back(KRRenderValue::Make(op.tag));
+            flat.push_back(KRRenderValue::Make(op.method_id));
+            flat.push_back(op.arg0);
+            flat.push_back(op.arg1);
+        }
+        CallArkTSMethodDirectly(batch.first, KRNativeCallArkTSMethod::BatchViewOps, KRRenderValue::Make(flat),
+                                nullptr, nullptr, nullptr, nullptr, nullptr, false, nullptr, false, nullptr);
+    });
+}
+
+KRArkTSManager::KRInstanceCache *KRArkTSManager::GetInstanceCache(const std::string &instanceId) {
+    auto it = instance_caches_.find(instanceId);
+    if (it != instance_caches_.end()) {
+        return &it->second;
+    }
+    auto renderView = KRRenderManager::GetInstance().GetRenderView(instanceId);
+    if (renderView == nullptr || arkTSCallbackData_ == nullptr) {
+        return nullptr;
+    }
+    auto env = arkTSCallbackData_->env;
+    KRInstanceCache &cache = instance_caches_[instanceId];
+    cache.render_view = renderView;
+    napi_value instanceIdValue = nullptr;
+    if (napi_create_string_utf8(env, instanceId.c_str(), instanceId.size(), &instanceIdValue) == napi_ok) {
+        // 部分napi实现不支持对基础类型创建引用，失败时退化为每次创建字符串
+        if (napi_create_reference(env, instanceIdValue, 1, &cache.instance_id_ref) != napi_ok) {
+            cache.instance_id_ref = nullptr;
+        }
+    }
+    return &cache;
+}
+
+std::shared_ptr<KRRenderView> KRArkTSManager::GetRenderView(const std::string &instanceId) {
+    if (auto cache = GetInstanceCache(instanceId)) {
+        return cache->render_view.lock();
+    }
+    return nullptr;
+}
+
+void KRArkTSManager::ReleaseInstanceCache(const std::string &instanceId) {
+    auto it = instance_caches_.find(instanceId);
+    if (it == instance_caches_.end()) {
+        return;
+    }
+    if (it->second.instance_id_ref != nullptr && arkTSCallbackData_ != nullptr) {
+        napi_delete_reference(arkTSCallbackData_->env, it->second.instance_id_ref);
+    }
+    instance_caches_.erase(it);
+}
+
 /**
  * 键盘高度变化回调
  */
@@ -160,8 +263,9 @@ void KRArkTSManager::KeyboardHeightChange(napi_env env, napi_value *args, size_t
  */
 void KRArkTSManager::FireCallbackFromArkTS(napi_env env, napi_value *args, size_t arg_size) {
     auto pager_id = KRRenderValue::Make(env, args[0])->toString();
-    auto callback_id = KRRenderValue::Make(env, args[2])->toString();
-    auto renderView = KRRenderManager::GetInstance().GetRenderView(pager_id);
+    int32_t callback_id = 0;
+    napi_get_value_int32(env, args[2], &callback_id);
+    auto renderView = GetRenderView(pager_id);
     if (renderView != nullptr) {
         bool arg_prefer_raw_napi_value = false;
         auto callback = renderView->GetArgCallback(callback_id, arg_prefer_raw_napi_value);
@@ -184,7 +288,7 @@ void KRArkTSManager::FireViewEventFromArkTS(napi_env env, napi_value *args, size
     auto pager_id = KRRenderValue::Make(env, args[0])->toString();
     auto tag = KRRenderValue::Make(env, args[2])->toInt();
     auto eventKey = KRRenderValue::Make(env, args[3])->toString();
-    auto renderView = KRRenderManager::GetInstance().GetRenderView(pager_id);
+    auto renderView = GetRenderView(pager_id);
     if (renderView != nullptr) {
         auto view = renderView->GetView(tag);
         if (view != nullptr) {
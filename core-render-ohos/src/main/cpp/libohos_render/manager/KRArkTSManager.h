@@ -17,10 +17,15 @@
 #define CORE_RENDER_OHOS_KRARKTSMANAGER_H
 #include <arkui/native_type.h>
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include "libohos_render/foundation/KRCallbackData.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/manager/KRViewOpQueue.h"
 #include "napi/native_api.h"
 
 /// Native调用ArkTS方法枚举
@@ -35,6 +40,7 @@ enum class KRNativeCallArkTSMethod {
     RemoveView = 7,           // 删除View
     SetViewSize = 8,          // 设置View尺寸
     DidMoveToParentView = 9,  // 添加到父节点中
+    BatchViewOps = 10,        // 批量下发View变更，arg0为[tag, methodId, arg0, arg1, ...]扁平数组
 };
 
 /// ArkTS调用Native方法枚举
@@ -46,6 +52,7 @@ enum class KRArkTSCallNativeMethod {
     FireViewEvent = 4,         // 响应View事件
 };
 
+class KRRenderView;
 class KRArkTSManager {
  public:
     static KRArkTSManager &GetInstance();
@@ -70,6 +77,34 @@ class KRArkTSManager {
                                bool callback_keep_alive = false, ArkUI_NodeHandle *return_node_handle = nullptr,
                                bool arg_prefers_raw_napi_value = false, ArkUI_NodeContentHandle *contentHandle = nullptr);
 
+    /**
+     * 开启View变更合批区间(仅主线程，可嵌套)。
+     * 区间内经EnqueueViewOp记录的变更会在最外层EndViewOpBatch时按实例合并为一次BatchViewOps调用
+     */
+    void BeginViewOpBatch();
+
+    /**
+     * 结束View变更合批区间，最外层结束时下发所有待处理变更
+     */
+    void EndViewOpBatch();
+
+    /**
+     * 记录一条转发View变更(仅支持SetViewProp/SetViewEvent/SetViewSize)，不在合批区间内时立即调用ArkTS。
+     * 任何其他CallArkTSMethod调用前都会先下发待处理变更，因此与逐条调用的时序一致
+     */
+    void EnqueueViewOp(const std::string &instanceId, KRNativeCallArkTSMethod methodId, int tag,
+                       const KRAnyValue &arg0, const KRAnyValue &arg1);
+
+    /**
+     * 立即下发所有待处理的View变更
+     */
+    void FlushViewOps();
+
+    /**
+     * 释放实例对应的napi缓存(实例销毁时主线程调用)
+     */
+    void ReleaseInstanceCache(const std::string &instanceId);
+
     /**
      * 获取NAPI Env
      * @return napi_env
@@ -84,6 +119,36 @@ class KRArkTSManager {
  private:
     KRArkTSManager();  // 构造函数私有化
     KRCallbackData *arkTSCallbackData_ = nullptr;
+    /**
+     * 实例级缓存：实例ID对应的napi字符串引用及RenderView弱引用，
+     * 避免每次调用ArkTS都重新创建实例ID字符串、加锁查找RenderView
+     */
+    struct KRInstanceCache {
+        napi_ref instance_id_ref = nullptr;
+        std::weak_ptr<KRRenderView> render_view;
+    };
+    std::unordered_map<std::string, KRInstanceCache> instance_caches_;
+    /**
+     * 获取实例缓存，实例不存在时返回nullptr且不创建缓存
+     */
+    KRInstanceCache *GetInstanceCache(const std::string &instanceId);
+    /**
+     * 获取实例对应的RenderView，优先使用缓存
+     */
+    std::shared_ptr<KRRenderView> GetRenderView(const std::string &instanceId);
+    /**
+     * 实际调用ArkTS，不先下发待处理的View变更（FlushViewOps 发送已出队的批次时使用）
+     */
+    KRAnyValue CallArkTSMethodDirectly(const std::string &instanceId, KRNativeCallArkTSMethod methodId,
+                                       const KRAnyValue &arg0, const KRAnyValue &arg1, const KRAnyValue &arg2,
+                                       const KRAnyValue &arg3, const KRAnyValue &arg4,
+                                       const KRRenderCallback &callback, bool callback_keep_alive,
+                                       ArkUI_NodeHandle *return_node_handle, bool arg_prefers_raw_napi_value,
+                                       ArkUI_NodeContentHandle *contentHandle);
+    // 合批区间嵌套深度
+    int view_op_batch_depth_ = 0;
+    // 按实例首次出现顺序保存的待下发View变更
+    KRViewOpQueue<KRAnyValue> pending_view_ops_;
     /**
      * 注册调用ArkTS的回调闭包，实现Native调用ArkTS通道
      */
@@ -120,24 +185,20 @@ private:
     
     void AddViewName(const std::string &name, ViewKind kind ){
         if(kind == ViewKindV1){
-            v1_names_.insert(name);
+            // 同名时 V1 优先
+            view_kinds_[name] = ViewKindV1;
         }else if(kind == ViewKindV2){
-            v2_names_.insert(name);
+            view_kinds_.emplace(name, ViewKindV2);
         }
     }
     
     ViewKind KindOfView(const std::string& viewName){
-        if(v1_names_.find(viewName) != v1_names_.end()){
-            return ViewKindV1;
-        }
-        if(v2_names_.find(viewName) != v2_names_.end()){
-            return ViewKindV2;
-        }
-        return ViewKindNotFound;
+        // 每次创建转发 View 都会查询，用一次哈希查找代替两个有序集合的查找
+        auto it = view_kinds_.find(viewName);
+        return it != view_kinds_.end() ? it->second : ViewKindNotFound;
     }
     
 private:
-    std::set<std::string> v1_names_;
-    std::set<std::string> v2_names_;
+    std::unordered_map<std::string, ViewKind> view_kinds_;
 };
 #endif  // CORE_RENDER_OHOS_KRARKTSMANAGER_H
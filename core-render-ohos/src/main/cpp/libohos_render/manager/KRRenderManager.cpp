@@ -19,6 +19,7 @@
 #include "libohos_render/expand/components/ComponentsRegisterEntry.h"
 #include "libohos_render/expand/events/KREventDispatchCenter.h"
 #include "libohos_render/expand/modules/ModulesRegisterEntry.h"
+#include "libohos_render/manager/KRArkTSManager.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/KRViewUtil.h"
@@ -64,7 +65,10 @@ void KRRenderManager::CreateRenderViewIfNeeded(napi_env env, napi_callback_info
 
     if (renderView == nullptr) {
         auto render_view = std::make_shared<KRRenderView>(contentHandle, id);
-        SetRenderView(id, render_view);
+        if (auto handle = SetRenderView(id, render_view)) {
+            // NodeContent 回调通过句柄直接找回 RenderView
+            OH_ArkUI_NodeContent_SetUserData(contentHandle, KRHandleToPointer(handle));
+        }
     }
 }
 
@@ -72,42 +76,76 @@ void KRRenderManager::Export(napi_env env, napi_value exports) {
     KRMainThread::Export(env, exports);
 }
 
+/** 每个线程缓存自己查过的实例ID → 句柄，句柄过期时回退到加锁的索引 */
+static std::unordered_map<std::string, KRHandle> &ThreadRenderViewHandleCache() {
+    thread_local std::unordered_map<std::string, KRHandle> cache;
+    return cache;
+}
+
+static constexpr size_t kMaxThreadRenderViewHandleCacheSize = 64;
+
 std::shared_ptr<KRRenderView> KRRenderManager::GetRenderView(const std::string &instanceId) {
-    KRScopedSpinLock lock(&render_view_map_lock_);
-    auto it = render_view_map_.find(instanceId);
-    if (it == render_view_map_.end()) {
+    auto &cache = ThreadRenderViewHandleCache();
+    if (auto it = cache.find(instanceId); it != cache.end()) {
+        if (auto renderView = render_views_.Get(it->second)) {
+            return renderView;
+        }
+        cache.erase(it);
+    }
+    auto handle = GetRenderViewHandle(instanceId);
+    if (handle == kKRInvalidHandle) {
         return nullptr;
     }
-    return it->second;
+    auto renderView = render_views_.Get(handle);
+    if (renderView) {
+        if (cache.size() >= kMaxThreadRenderViewHandleCacheSize) {
+            cache.clear();
+        }
+        cache[instanceId] = handle;
+    }
+    return renderView;
 }
 
-bool KRRenderManager::SetRenderView(std::string &instanceId, std::shared_ptr<KRRenderView> &renderView) {
-    KRScopedSpinLock lock(&render_view_map_lock_);
-    if (render_view_map_.find(instanceId) == render_view_map_.end()) {
-        render_view_map_[instanceId] = renderView;
-        return true;
+std::shared_ptr<KRRenderView> KRRenderManager::GetRenderView(KRHandle handle) {
+    return render_views_.Get(handle);
+}
+
+KRHandle KRRenderManager::GetRenderViewHandle(const std::string &instanceId) {
+    KRScopedSpinLock lock(&render_view_index_lock_);
+    auto it = render_view_index_.find(instanceId);
+    return it != render_view_index_.end() ? it->second : kKRInvalidHandle;
+}
+
+KRHandle KRRenderManager::SetRenderView(std::string &instanceId, std::shared_ptr<KRRenderView> &renderView) {
+    KRScopedSpinLock lock(&render_view_index_lock_);
+    if (render_view_index_.find(instanceId) != render_view_index_.end()) {
+        return kKRInvalidHandle;
     }
-    return false;
+    auto handle = render_views_.Insert(renderView);
+    if (handle != kKRInvalidHandle) {
+        render_view_index_[instanceId] = handle;
+    }
+    return handle;
 }
 
 void KRRenderManager::DestroyRenderView(std::string &instanceId) {
-    {
-        KRScopedSpinLock lock(&render_view_map_lock_);
-        if (auto it = render_view_map_.find(instanceId); it != render_view_map_.end()) {
-            if (it->second != nullptr) {
-                it->second->WillDestroy(instanceId);
-            }
-        }
+    if (auto renderView = GetRenderView(instanceId)) {
+        renderView->WillDestroy(instanceId);
     }
 }
 
 void KRRenderManager::DestroyRenderViewCallBack(const std::string &instanceId) {
+    KRArkTSManager::GetInstance().ReleaseInstanceCache(instanceId);
+    KRHandle handle = kKRInvalidHandle;
     {
-        KRScopedSpinLock lock(&render_view_map_lock_);
-        if (render_view_map_.find(instanceId) != render_view_map_.end()) {
-            render_view_map_.erase(instanceId);
+        KRScopedSpinLock lock(&render_view_index_lock_);
+        if (auto it = render_view_index_.find(instanceId); it != render_view_index_.end()) {
+            handle = it->second;
+            render_view_index_.erase(it);
         }
     }
+    // 在锁外析构 RenderView
+    render_views_.Remove(handle);
     {
         KRScopedSpinLock lock(&launch_init_time_map_lock_);
         if (launch_init_time_map_.find(instanceId) != launch_init_time_map_.end()) {
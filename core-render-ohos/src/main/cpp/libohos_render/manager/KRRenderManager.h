@@ -19,6 +19,7 @@
 #include <string>
 #include <pthread.h>
 #include "libohos_render/context/KRRenderExecuteModeWrapper.h"
+#include "libohos_render/foundation/KRHandleTable.h"
 #include "libohos_render/view/KRRenderView.h"
 #include "libohos_render/utils/KRScopedSpinLock.h"
 /** 全局递增实例ID */
@@ -33,7 +34,18 @@ class KRRenderManager {
     KRRenderManager &operator=(const KRRenderManager &) = delete;
 
     void Export(napi_env env, napi_value exports);
+    /**
+     * 按实例ID查找（ArkTS/外部接口使用），同一线程内重复查找只做一次字符串哈希、不拿锁
+     */
     std::shared_ptr<KRRenderView> GetRenderView(const std::string &instanceId);
+    /**
+     * 按句柄查找，任意线程无锁校验
+     */
+    std::shared_ptr<KRRenderView> GetRenderView(KRHandle handle);
+    /**
+     * 实例ID对应的句柄，不存在时返回 kKRInvalidHandle
+     */
+    KRHandle GetRenderViewHandle(const std::string &instanceId);
 
     void DestroyRenderView(std::string &instanceId);
 
@@ -46,13 +58,17 @@ class KRRenderManager {
     void CreateRenderViewIfNeeded(napi_env env, napi_callback_info info);
 
  private:
-    KRSpinLock render_view_map_lock_;
-    std::unordered_map<std::string, std::shared_ptr<KRRenderView>> render_view_map_;
+    /** 所有页面的 RenderView，按句柄索引 */
+    KRHandleTable<std::shared_ptr<KRRenderView>> render_views_;
+    /** 实例ID到句柄的索引，只在页面创建/销毁与线程缓存未命中时加锁访问 */
+    KRSpinLock render_view_index_lock_;
+    std::unordered_map<std::string, KRHandle> render_view_index_;
     KRSpinLock launch_init_time_map_lock_;
     std::unordered_map<std::string, int64_t> launch_init_time_map_;
     KRRenderManager();  // 构造函数私有化
     ~KRRenderManager();
-    bool SetRenderView(std::string &instanceId, std::shared_ptr<KRRenderView> &renderView);
+    /** @return 新页面的句柄，实例ID已存在时返回 kKRInvalidHandle */
+    KRHandle SetRenderView(std::string &instanceId, std::shared_ptr<KRRenderView> &renderView);
     // 在这里添加其他私有成员变量和函数
 };
 
@@ -0,0 +1,80 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KRSnapshotLruIndex.h"
+
+std::vector<KRSnapshotLruIndex::Entry> KRSnapshotLruIndex::Put(Owner owner, const std::string &key, size_t bytes) {
+    auto it = index_.find({owner, key});
+    if (it != index_.end()) {
+        resident_bytes_ -= it->second->bytes;
+        it->second->bytes = bytes;
+        entries_.splice(entries_.begin(), entries_, it->second);
+    } else {
+        entries_.push_front({owner, key, bytes});
+        index_[{owner, key}] = entries_.begin();
+    }
+    resident_bytes_ += bytes;
+    return EvictOverBudget(1);
+}
+
+void KRSnapshotLruIndex::Touch(Owner owner, const std::string &key) {
+    auto it = index_.find({owner, key});
+    if (it != index_.end()) {
+        entries_.splice(entries_.begin(), entries_, it->second);
+    }
+}
+
+void KRSnapshotLruIndex::Remove(Owner owner, const std::string &key) {
+    auto it = index_.find({owner, key});
+    if (it == index_.end()) {
+        return;
+    }
+    resident_bytes_ -= it->second->bytes;
+    entries_.erase(it->second);
+    index_.erase(it);
+}
+
+void KRSnapshotLruIndex::RemoveOwner(Owner owner) {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->owner == owner) {
+            resident_bytes_ -= it->bytes;
+            index_.erase({it->owner, it->key});
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+std::vector<KRSnapshotLruIndex::Entry> KRSnapshotLruIndex::SetBudget(size_t budget_bytes) {
+    budget_bytes_ = budget_bytes;
+    return EvictOverBudget(0);
+}
+
+bool KRSnapshotLruIndex::Contains(Owner owner, const std::string &key) const {
+    return index_.find({owner, key}) != index_.end();
+}
+
+std::vector<KRSnapshotLruIndex::Entry> KRSnapshotLruIndex::EvictOverBudget(size_t keep_count) {
+    std::vector<Entry> evicted;
+    while (resident_bytes_ > budget_bytes_ && entries_.size() > keep_count) {
+        auto &oldest = entries_.back();
+        resident_bytes_ -= oldest.bytes;
+        index_.erase({oldest.owner, oldest.key});
+        evicted.push_back(std::move(oldest));
+        entries_.pop_back();
+    }
+    return evicted;
+}
@@ -0,0 +1,105 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRSNAPSHOTLRUINDEX_H
+#define CORE_RENDER_OHOS_KRSNAPSHOTLRUINDEX_H
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * 快照内存预算的 LRU 索引（纯 C++，可在 host 上单测）。
+ *
+ * 只记录"常驻内存"的快照条目及其字节数，不持有任何像素数据；
+ * 由 KRSnapshotManager 在进程内共享一份，条目以 (owner, key) 区分不同页面。
+ * 超出预算时按最近最少使用的顺序返回需要换出的条目，由调用方负责真正释放/落盘。
+ */
+class KRSnapshotLruIndex {
+ public:
+    using Owner = const void *;
+
+    struct Entry {
+        Owner owner;
+        std::string key;
+        size_t bytes;
+    };
+
+    explicit KRSnapshotLruIndex(size_t budget_bytes) : budget_bytes_(budget_bytes) {}
+
+    /**
+     * 记录（或更新）一个常驻条目并置为最近使用
+     * @return 为满足预算需要换出的条目，按从旧到新排列；刚放入的条目永远不会被换出
+     */
+    std::vector<Entry> Put(Owner owner, const std::string &key, size_t bytes);
+
+    /**
+     * 标记条目被使用，不存在时忽略
+     */
+    void Touch(Owner owner, const std::string &key);
+
+    void Remove(Owner owner, const std::string &key);
+
+    /**
+     * 移除某个 owner 的所有条目（页面销毁时调用）
+     */
+    void RemoveOwner(Owner owner);
+
+    /**
+     * 调整预算
+     * @return 为满足新预算需要换出的条目
+     */
+    std::vector<Entry> SetBudget(size_t budget_bytes);
+
+    bool Contains(Owner owner, const std::string &key) const;
+
+    size_t Budget() const {
+        return budget_bytes_;
+    }
+
+    size_t ResidentBytes() const {
+        return resident_bytes_;
+    }
+
+    size_t Size() const {
+        return entries_.size();
+    }
+
+ private:
+    struct EntryId {
+        Owner owner;
+        std::string key;
+        bool operator==(const EntryId &other) const {
+            return owner == other.owner && key == other.key;
+        }
+    };
+    struct EntryIdHash {
+        size_t operator()(const EntryId &id) const {
+            return std::hash<std::string>()(id.key) ^ (std::hash<Owner>()(id.owner) << 1);
+        }
+    };
+
+    std::vector<Entry> EvictOverBudget(size_t keep_count);
+
+    // 头部为最近使用
+    std::list<Entry> entries_;
+    std::unordered_map<EntryId, std::list<Entry>::iterator, EntryIdHash> index_;
+    size_t budget_bytes_;
+    size_t resident_bytes_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRSNAPSHOTLRUINDEX_H
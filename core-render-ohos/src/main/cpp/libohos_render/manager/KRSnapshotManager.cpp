@@ -30,6 +30,12 @@
 
 constexpr static int TIME_TO_UPDATE_SNAPSHOT_URI_MS = 100;
 constexpr static int MAX_DELAY_DURATION_MS = 1000;
+constexpr static size_t DEFAULT_SNAPSHOT_MEMORY_BUDGET_BYTES = 64 * 1024 * 1024;
+
+static KRSnapshotLruIndex &SnapshotLruIndex() {
+    static KRSnapshotLruIndex index(DEFAULT_SNAPSHOT_MEMORY_BUDGET_BYTES);
+    return index;
+}
 
 static void ReleaseDrawableItem(struct KRSnapshotItem *item) {
     if (item) {
@@ -49,27 +55,117 @@ static void ReleaseDrawableItem(struct KRSnapshotItem *item) {
             }
         }
         item->env = nullptr;
+        item->memoryBytes = 0;
     }
 }
 
 static void DisposeItem(struct KRSnapshotItem *item) {
     if (item) {
         ReleaseDrawableItem(item);
+        item->evictWhenFileReady = false;
         item->uri = "";
     }
 }
 
+static NativePixelMap *GetNativePixelMap(napi_env env, napi_value pixelMap, OhosPixelMapInfos &info) {
+    if (env == nullptr || pixelMap == nullptr) {
+        return nullptr;
+    }
+    NativePixelMap *nativePixelMap = OH_PixelMap_InitNativePixelMap(env, pixelMap);
+    if (nativePixelMap == nullptr || OH_PixelMap_GetImageInfo(nativePixelMap, &info) != IMAGE_RESULT_SUCCESS) {
+        return nullptr;
+    }
+    return nativePixelMap;
+}
+
 KRSnapshotManager::~KRSnapshotManager() {
+    SnapshotLruIndex().RemoveOwner(this);
     std::for_each(drawableDescriptorCache_.begin(), drawableDescriptorCache_.end(),
-                  [](auto desc) { DisposeItem(&desc.second); });
+                  [](auto &desc) { DisposeItem(&desc.second); });
     drawableDescriptorCache_.clear();
+    // 页面销毁时节点随之销毁，不再需要等待引用释放
+    std::for_each(retiredDescriptors_.begin(), retiredDescriptors_.end(),
+                  [](auto &desc) { ReleaseDrawableItem(&desc.second); });
+    retiredDescriptors_.clear();
+}
+
+void KRSnapshotManager::SetMemoryBudget(size_t budget_bytes) {
+    EvictSnapshots(SnapshotLruIndex().SetBudget(budget_bytes));
+}
+
+void KRSnapshotManager::EvictSnapshots(const std::vector<KRSnapshotLruIndex::Entry> &evicted) {
+    for (const auto &entry : evicted) {
+        // owner 均为存活的 KRSnapshotManager（析构时已从索引移除），且只在主线程访问
+        auto manager = const_cast<KRSnapshotManager *>(static_cast<const KRSnapshotManager *>(entry.owner));
+        manager->EvictSnapshot(entry.key);
+    }
+}
+
+void KRSnapshotManager::BindSnapshotToNode(ArkUI_NodeHandle node, ArkUI_DrawableDescriptor *descriptor) {
+    auto it = nodeDescriptors_.find(node);
+    if (it != nodeDescriptors_.end() && it->second == descriptor) {
+        return;
+    }
+    ReleaseSnapshotFromNode(node);
+    nodeDescriptors_[node] = descriptor;
+    ++descriptorRefCounts_[descriptor];
+}
+
+void KRSnapshotManager::ReleaseSnapshotFromNode(ArkUI_NodeHandle node) {
+    auto it = nodeDescriptors_.find(node);
+    if (it == nodeDescriptors_.end()) {
+        return;
+    }
+    auto descriptor = it->second;
+    nodeDescriptors_.erase(it);
+    auto count = descriptorRefCounts_.find(descriptor);
+    if (count == descriptorRefCounts_.end() || --count->second > 0) {
+        return;
+    }
+    descriptorRefCounts_.erase(count);
+    auto retired = retiredDescriptors_.find(descriptor);
+    if (retired != retiredDescriptors_.end()) {
+        ReleaseDrawableItem(&retired->second);
+        retiredDescriptors_.erase(retired);
+    }
+}
+
+void KRSnapshotManager::ReleaseOrRetireDrawable(struct KRSnapshotItem *item) {
+    auto descriptor = item->drawableDescriptor;
+    if (descriptor && descriptorRefCounts_.count(descriptor)) {
+        // 仍有节点在展示，把 descriptor 及其持有的像素/引用转移出去，等节点释放后再 Dispose
+        auto &retired = retiredDescriptors_[descriptor];
+        retired.drawableDescriptor = descriptor;
+        retired.env = item->env;
+        retired.drawableDescriptorRef = item->drawableDescriptorRef;
+        retired.pixelMapRef = item->pixelMapRef;
+        item->drawableDescriptor = nullptr;
+        item->drawableDescriptorRef = nullptr;
+        item->pixelMapRef = nullptr;
+    }
+    ReleaseDrawableItem(item);
+}
+
+void KRSnapshotManager::DisposeOrRetireItem(struct KRSnapshotItem *item) {
+    ReleaseOrRetireDrawable(item);
+    DisposeItem(item);
+}
+
+void KRSnapshotManager::MarkSnapshotResident(const std::string &key, size_t bytes) {
+    auto item = drawableDescriptorCache_.find(key);
+    if (item == drawableDescriptorCache_.end()) {
+        return;
+    }
+    item->second.memoryBytes = bytes;
+    EvictSnapshots(SnapshotLruIndex().Put(this, key, bytes));
 }
 
 void KRSnapshotManager::CacheSnapshot(napi_env env, napi_value drawableDescriptor, napi_value pixelMap,
                                       ArkUI_DrawableDescriptor *descriptor, const std::string &key) {
     auto item = drawableDescriptorCache_.find(key);
     if (item != drawableDescriptorCache_.end()) {
-        DisposeItem(&item->second);
+        SnapshotLruIndex().Remove(this, key);
+        DisposeOrRetireItem(&item->second);
     }
 
     if (descriptor) {
@@ -80,15 +176,41 @@ void KRSnapshotManager::CacheSnapshot(napi_env env, napi_value drawableDescripto
         item.drawableDescriptorRef = arkTs.CreateReference(drawableDescriptor);
         item.pixelMapRef = arkTs.CreateReference(pixelMap);
         drawableDescriptorCache_[key] = item;
+
+        OhosPixelMapInfos info;
+        size_t bytes = 0;
+        if (GetNativePixelMap(env, pixelMap, info)) {
+            bytes = static_cast<size_t>(info.rowSize) * info.height;
+        }
+        MarkSnapshotResident(key, bytes);
     } else {
         drawableDescriptorCache_.erase(key);
     }
 }
 
+void KRSnapshotManager::EvictSnapshot(const std::string &key) {
+    auto it = drawableDescriptorCache_.find(key);
+    if (it == drawableDescriptorCache_.end() || !it->second.drawableDescriptor) {
+        return;
+    }
+    auto &item = it->second;
+    if (item.uri.empty()) {
+        // ArkTS 侧的 png 文件还没写好（通常在百毫秒内），此时释放会丢失快照，等文件就绪后再释放
+        item.evictWhenFileReady = true;
+        return;
+    }
+    ReleaseOrRetireDrawable(&item);
+}
+
 void KRSnapshotManager::UpdateSnapshot(const std::string &uri, const std::string &key) {
     auto item = drawableDescriptorCache_.find(key);
     if (item != drawableDescriptorCache_.end()) {
         item->second.uri = uri;
+        // png 文件已就绪，后续优先使用 uri；内存中的 pixelmap 交给 LRU 换出，已被选中换出的此时释放
+        if (item->second.evictWhenFileReady) {
+            item->second.evictWhenFileReady = false;
+            ReleaseOrRetireDrawable(&item->second);
+        }
     }
 }
 
@@ -100,6 +222,8 @@ bool KRSnapshotManager::SetCachedSnapshotToNode(ArkUI_NodeHandle node, const std
             return true;
         }
         if (item->second.drawableDescriptor) {
+            SnapshotLruIndex().Touch(this, key);
+            BindSnapshotToNode(node, item->second.drawableDescriptor);
             kuikly::util::SetArkUIImageSrc(node, item->second.drawableDescriptor);
             return true;
         }
@@ -17,25 +17,54 @@
 #define CORE_RENDER_OHOS_KRSNAPSHOTMANAGER_H
 #include <arkui/drawable_descriptor.h>
 #include <js_native_api.h>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "libohos_render/export/IKRRenderViewExport.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/manager/KRSnapshotLruIndex.h"
 
 struct KRSnapshotItem {
-    KRSnapshotItem() : drawableDescriptor(nullptr), env(nullptr), drawableDescriptorRef(nullptr), pixelMapRef(nullptr) {}
+    KRSnapshotItem()
+        : drawableDescriptor(nullptr), env(nullptr), drawableDescriptorRef(nullptr), pixelMapRef(nullptr),
+          memoryBytes(0), evictWhenFileReady(false) {}
     ArkUI_DrawableDescriptor *drawableDescriptor;
     napi_env env;
     napi_ref drawableDescriptorRef;
     napi_ref pixelMapRef;
     std::string uri;
+    // 常驻内存时的像素字节数，计入进程级快照内存预算
+    size_t memoryBytes;
+    // 被 LRU 选中换出时 png 文件尚未写好，等文件就绪后再释放
+    bool evictWhenFileReady;
 };
 
+/**
+ * 快照管理（每个 KRRenderView 一份）。
+ *
+ * cacheKey 类型的快照以 pixelmap 常驻内存，所有页面共享一个内存预算（默认 64MB），
+ * 超出时按 LRU 换出，换出后改用 ArkTS 侧已写好的 png 文件展示，不再额外编码落盘。
+ */
 class KRSnapshotManager {
  public:
     ~KRSnapshotManager();
 
+    /**
+     * 设置进程级快照内存预算（字节），超出部分立即换出。需在主线程调用。
+     */
+    static void SetMemoryBudget(size_t budget_bytes);
+
+    /**
+     * 将缓存的快照设置到 image 节点
+     * @return 是否设置成功
+     */
     bool SetCachedSnapshotToNode(ArkUI_NodeHandle node, const std::string &key);
+    /**
+     * image 节点不再展示快照（src 变更或节点销毁）时调用，释放节点对 drawableDescriptor 的引用。
+     * 被换出或替换时仍有节点在展示的 drawableDescriptor 会延迟到最后一个引用释放后再 Dispose。
+     */
+    void ReleaseSnapshotFromNode(ArkUI_NodeHandle node);
     void TakeSnapshot(const std::string &instance_id, const std::string &method_name, const std::string &nodeId,
                       const KRAnyValue &params, const KRRenderCallback &cb,
                       std::weak_ptr<IKRRenderViewExport> weak_view);
@@ -67,7 +96,19 @@ class KRSnapshotManager {
     void UpdateCachedSnapshotUriAfterDelay(int delayMS, const std::string &key, const std::string &path,
                                            const std::string &pathUri, std::weak_ptr<IKRRenderViewExport> weak_view);
 
+    void MarkSnapshotResident(const std::string &key, size_t bytes);
+    void BindSnapshotToNode(ArkUI_NodeHandle node, ArkUI_DrawableDescriptor *descriptor);
+    void ReleaseOrRetireDrawable(struct KRSnapshotItem *item);
+    void DisposeOrRetireItem(struct KRSnapshotItem *item);
+    void EvictSnapshot(const std::string &key);
+    static void EvictSnapshots(const std::vector<KRSnapshotLruIndex::Entry> &evicted);
+
     std::unordered_map<std::string, struct KRSnapshotItem> drawableDescriptorCache_;
+    // 正在展示快照的 image 节点及其引用的 drawableDescriptor、每个 drawableDescriptor 的节点引用数
+    std::unordered_map<ArkUI_NodeHandle, ArkUI_DrawableDescriptor *> nodeDescriptors_;
+    std::unordered_map<ArkUI_DrawableDescriptor *, int> descriptorRefCounts_;
+    // 已从缓存中换出/替换、但仍被节点引用的 drawableDescriptor，引用数归零时才真正释放
+    std::unordered_map<ArkUI_DrawableDescriptor *, struct KRSnapshotItem> retiredDescriptors_;
 };
 
 #endif  // CORE_RENDER_OHOS_KRSNAPSHOTMANAGER_H
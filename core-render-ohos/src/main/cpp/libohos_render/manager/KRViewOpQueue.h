@@ -0,0 +1,76 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRVIEWOPQUEUE_H
+#define CORE_RENDER_OHOS_KRVIEWOPQUEUE_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * 转发View变更的待下发队列（纯 C++，可在 host 上单测）。
+ *
+ * 按实例首次出现的顺序分组保存变更，Flush 时逐个实例出队后交给调用方发送。
+ * 先出队再发送：发送期间若有嵌套调用再次 Flush（如 ArkTS 同步回调触发的其他调用），
+ * 会接着发送剩余实例，跨实例的先后顺序保持不变。
+ */
+template <typename Value>
+class KRViewOpQueue {
+ public:
+    struct Op {
+        int tag;
+        int method_id;
+        Value arg0;
+        Value arg1;
+    };
+    using Batch = std::pair<std::string, std::vector<Op>>;
+
+    void Enqueue(const std::string &instance_id, int tag, int method_id, const Value &arg0, const Value &arg1) {
+        std::vector<Op> *ops = nullptr;
+        for (auto &pending : pending_) {
+            if (pending.first == instance_id) {
+                ops = &pending.second;
+                break;
+            }
+        }
+        if (ops == nullptr) {
+            pending_.emplace_back(instance_id, std::vector<Op>());
+            ops = &pending_.back().second;
+        }
+        ops->push_back(Op{tag, method_id, arg0, arg1});
+    }
+
+    /**
+     * 按实例顺序逐个出队并调用 send(const Batch &)
+     */
+    template <typename Send>
+    void Flush(Send &&send) {
+        while (!pending_.empty()) {
+            auto batch = std::move(pending_.front());
+            pending_.erase(pending_.begin());
+            send(batch);
+        }
+    }
+
+    bool Empty() const {
+        return pending_.empty();
+    }
+
+ private:
+    std::vector<Batch> pending_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRVIEWOPQUEUE_H
@@ -17,32 +17,48 @@
 #define CORE_RENDER_OHOS_KR_WEAK_OBJECT_MANAGER_H
 
 #include <memory>
-#include <map>
+#include <unordered_map>
+#include "libohos_render/foundation/KRHandleTable.h"
 #include "libohos_render/utils/KRScopedSpinLock.h"
 
+/**
+ * 以句柄作为 userData 的弱引用表：交给 ArkUI 回调的 key 是 KRHandle，
+ * 回调线程查找时不拿表级锁；对象指针到句柄的索引只在注册/反注册时访问。
+ */
 template<typename T>
 class KRWeakRegistry{
 public:
-    void Set(void* key, std::weak_ptr<T> value){
+    void* Register(const std::shared_ptr<T> &value){
         KRScopedSpinLock lock(&spin_);
-        entries_[key] = value;
+        const void* object = value.get();
+        if (auto it = handles_.find(object); it != handles_.end()) {
+            // 同一对象重复注册返回同一个 key；地址被新对象复用时换一个句柄
+            if (table_.Get(it->second).lock() == value) {
+                return KRHandleToPointer(it->second);
+            }
+            table_.Remove(it->second);
+        }
+        KRHandle handle = table_.Insert(value);
+        handles_[object] = handle;
+        return KRHandleToPointer(handle);
     }
-    void Remove(void* key){
+
+    void Unregister(const T* object){
         KRScopedSpinLock lock(&spin_);
-        entries_.erase(key);
+        if (auto it = handles_.find(object); it != handles_.end()) {
+            table_.Remove(it->second);
+            handles_.erase(it);
+        }
     }
 
     std::weak_ptr<T> Get(void* key){
-        KRScopedSpinLock lock(&spin_);
-        if (auto it = entries_.find(key); it != entries_.end()) {
-            return it->second;
-        }
-        return std::weak_ptr<T>();
+        return table_.Get(KRHandleFromPointer(key));
     }
 
 private:
     KRSpinLock spin_;
-    std::map<void*, std::weak_ptr<T>> entries_;
+    std::unordered_map<const void*, KRHandle> handles_;
+    KRHandleTable<std::weak_ptr<T>> table_;
 };
 
 template<typename T>
@@ -57,9 +73,7 @@ public:
 template<typename T>
 void *KRWeakObjectManagerRegisterWeakObject(std::shared_ptr<T> ptr){
     if(ptr){
-        void* key = ptr.get();
-        KRWeakObjectMgr<T>::GetInstance().Set(key, ptr);
-        return key;
+        return KRWeakObjectMgr<T>::GetInstance().Register(ptr);
     }
     return nullptr;
 }
@@ -67,7 +81,7 @@ void *KRWeakObjectManagerRegisterWeakObject(std::shared_ptr<T> ptr){
 template<typename T>
 void KRWeakObjectManagerUnregisterWeakObject(std::shared_ptr<T> ptr){
     if(ptr){
-        KRWeakObjectMgr<T>::GetInstance().Remove(ptr.get());
+        KRWeakObjectMgr<T>::GetInstance().Unregister(ptr.get());
     }
 }
 
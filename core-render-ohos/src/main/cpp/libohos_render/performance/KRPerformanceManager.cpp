@@ -24,6 +24,7 @@
 
 static constexpr char ON_GET_LAUNCH_DATA_DATA[] = "onGetLaunchData";
 static constexpr char ON_GET_PERFORMANCE_DATA_DATA[] = "onGetPerformanceData";
+static constexpr char ON_GET_SCROLL_FRAME_DATA[] = "onGetScrollFrameData";
 
 bool KRPerformanceManager::cold_launch_flag = true;
 std::list<std::string> KRPerformanceManager::page_record_;
@@ -135,6 +136,21 @@ void KRPerformanceManager::OnDestroy() {
     }
 }
 
+void KRPerformanceManager::OnScrollBegin() {
+    if (auto monitor = GetMonitor(KRFrameMonitor::kMonitorName)) {
+        std::static_pointer_cast<KRFrameMonitor>(monitor)->OnScrollBegin();
+    }
+}
+
+void KRPerformanceManager::OnScrollEnd() {
+    if (auto monitor = GetMonitor(KRFrameMonitor::kMonitorName)) {
+        auto data = std::static_pointer_cast<KRFrameMonitor>(monitor)->OnScrollEnd();
+        if (!data.empty()) {
+            CallArkTsPerformanceModule(ON_GET_SCROLL_FRAME_DATA, data);
+        }
+    }
+}
+
 std::string KRPerformanceManager::GetInstanceId() {
     return instance_id_;
 }
@@ -156,6 +172,14 @@ std::string KRPerformanceManager::GetFrameData() {  //  获取帧数据
     return "";
 }
 
+std::string KRPerformanceManager::GetScrollFrameData() {  //  获取滚动会话帧数据
+    auto monitor = GetMonitor(KRFrameMonitor::kMonitorName);
+    if (monitor) {
+        return std::static_pointer_cast<KRFrameMonitor>(monitor)->GetScrollSessionData();
+    }
+    return "";
+}
+
 std::string KRPerformanceManager::GetMemoryData() {  //  获取内存数据
     auto monitor = GetMonitor(KRMemoryMonitor::kMonitorName);
     if (monitor) {
@@ -40,10 +40,19 @@ class KRPerformanceManager {
     void OnResume();
     void OnPause();
     void OnDestroy();
+    /**
+     * 列表开始滚动，开启滚动会话帧统计
+     */
+    void OnScrollBegin();
+    /**
+     * 列表停止滚动，结束滚动会话并回调该会话的帧数据
+     */
+    void OnScrollEnd();
     std::string GetInstanceId();
     std::string GetLaunchData();
     std::string GetFrameData();
     std::string GetMemoryData();
+    std::string GetScrollFrameData();
     std::string GetPerformanceData();
     std::shared_ptr<KRMonitor> GetMonitor(std::string monitor_name);
     void SetArkLaunchTime(int64_t launch_time);
@@ -14,19 +14,101 @@
  */
 
 #include "KRFrameData.h"
+
+#include <algorithm>
 #include "thirdparty/cJSON/cJSON.h"
 
+static constexpr long long kOneMilliSecondInNanos = 1000000LL;
+static constexpr char kKeyJankTimestamp[] = "timestamp";
+static constexpr char kKeyJankDuration[] = "duration";
+static constexpr char kKeySchedulerTasks[] = "schedulerTasks";
+static constexpr char kKeyViewsCreated[] = "viewsCreated";
+static constexpr char kKeyPropsSet[] = "propsSet";
+
+static double NanosToMillis(long long nanos) {
+    return static_cast<double>(nanos) / kOneMilliSecondInNanos;
+}
+
+static cJSON *CreateWorkJSON(const KRFrameWorkSnapshot &work) {
+    cJSON *json = cJSON_CreateObject();
+    cJSON_AddNumberToObject(json, kKeySchedulerTasks, static_cast<double>(work.scheduler_tasks));
+    cJSON_AddNumberToObject(json, kKeyViewsCreated, static_cast<double>(work.views_created));
+    cJSON_AddNumberToObject(json, kKeyPropsSet, static_cast<double>(work.props_set));
+    return json;
+}
+
+void KRFrameData::AddFrame(long long timestamp_nanos, long long frame_duration_nanos, long long frame_interval_nanos,
+                           const KRFrameWorkSnapshot &work) {
+    // 1. 累计总耗时
+    total_duration += frame_duration_nanos / kOneMilliSecondInNanos;
+    frame_count++;
+    histogram.Record(frame_duration_nanos);
+    // 2. 计算掉帧/卡顿
+    // 如果一帧超过 16.6ms，多出来的部分记为卡顿
+    if (frame_duration_nanos > frame_interval_nanos) {
+        hitches_duration += (frame_duration_nanos - frame_interval_nanos) / kOneMilliSecondInNanos;
+    }
+    // 3. 卡顿帧归因：VSync 时间戳按帧间隔量化，超过 1.5 倍帧间隔即至少丢了一帧
+    if (frame_duration_nanos * 2 < frame_interval_nanos * 3) {
+        return;
+    }
+    jank_count++;
+    jank_work += work;
+    KRJankFrame jank_frame{timestamp_nanos, frame_duration_nanos, work};
+    auto pos = std::upper_bound(jank_frames.begin(), jank_frames.end(), jank_frame,
+                                [](const KRJankFrame &lhs, const KRJankFrame &rhs) {
+                                    return lhs.duration_nanos > rhs.duration_nanos;
+                                });
+    if (pos == jank_frames.end() && jank_frames.size() >= kMaxJankFrames) {
+        return;
+    }
+    jank_frames.insert(pos, jank_frame);
+    if (jank_frames.size() > kMaxJankFrames) {
+        jank_frames.pop_back();
+    }
+}
+
 double KRFrameData::getFps() const {
     if (total_duration <= 0) return 0;
     return ((float)(total_duration - hitches_duration) / total_duration) * 60;
 }
 
-std::string KRFrameData::ToJSONString() {
+cJSON *KRFrameData::ToJSON() const {
     cJSON *frame_data = cJSON_CreateObject();
     cJSON_AddNumberToObject(frame_data, kKeyTotalDuration, total_duration);
-    cJSON_AddNumberToObject(frame_data, kKeyHitchesDuration, total_duration);
-    cJSON_AddNumberToObject(frame_data, kKeyFrameCount, total_duration);
+    cJSON_AddNumberToObject(frame_data, kKeyHitchesDuration, hitches_duration);
+    cJSON_AddNumberToObject(frame_data, kKeyFrameCount, frame_count);
     cJSON_AddNumberToObject(frame_data, kKeyMainFPS, getFps());
+    cJSON_AddNumberToObject(frame_data, kKeyJankCount, jank_count);
+    cJSON_AddNumberToObject(frame_data, kKeyFrameP50, NanosToMillis(histogram.Percentile(50)));
+    cJSON_AddNumberToObject(frame_data, kKeyFrameP90, NanosToMillis(histogram.Percentile(90)));
+    cJSON_AddNumberToObject(frame_data, kKeyFrameP99, NanosToMillis(histogram.Percentile(99)));
+    cJSON_AddNumberToObject(frame_data, kKeyFrameMax, NanosToMillis(histogram.Max()));
+    // 只输出非空桶：[桶下边界(ms), 帧数]
+    cJSON *buckets = cJSON_AddArrayToObject(frame_data, kKeyHistogram);
+    for (int i = 0; i < KRFrameHistogram::kBucketCount; i++) {
+        auto count = histogram.BucketCountAt(i);
+        if (count == 0) {
+            continue;
+        }
+        cJSON *bucket = cJSON_CreateArray();
+        cJSON_AddItemToArray(bucket, cJSON_CreateNumber(NanosToMillis(KRFrameHistogram::BucketLowerBound(i))));
+        cJSON_AddItemToArray(bucket, cJSON_CreateNumber(count));
+        cJSON_AddItemToArray(buckets, bucket);
+    }
+    cJSON_AddItemToObject(frame_data, kKeyJankWork, CreateWorkJSON(jank_work));
+    cJSON *frames = cJSON_AddArrayToObject(frame_data, kKeyJankFrames);
+    for (const auto &jank_frame : jank_frames) {
+        cJSON *frame = CreateWorkJSON(jank_frame.work);
+        cJSON_AddNumberToObject(frame, kKeyJankTimestamp, NanosToMillis(jank_frame.timestamp_nanos));
+        cJSON_AddNumberToObject(frame, kKeyJankDuration, NanosToMillis(jank_frame.duration_nanos));
+        cJSON_AddItemToArray(frames, frame);
+    }
+    return frame_data;
+}
+
+std::string KRFrameData::ToJSONString() {
+    cJSON *frame_data = ToJSON();
     char* json_str = cJSON_Print(frame_data);
     std::string result = json_str;
     free(json_str);
@@ -38,4 +120,8 @@ void KRFrameData::Reset() {
     total_duration = 0;
     hitches_duration = 0;
     frame_count = 0;
-}
\ No newline at end of file
+    jank_count = 0;
+    histogram.Reset();
+    jank_work = {};
+    jank_frames.clear();
+}
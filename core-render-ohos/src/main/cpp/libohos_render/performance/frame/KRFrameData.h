@@ -17,20 +17,58 @@
 #define CORE_RENDER_OHOS_KRFRAMEDATA_H
 
 #include <string>
+#include <vector>
+#include "libohos_render/performance/frame/KRFrameHistogram.h"
+#include "libohos_render/performance/frame/KRFrameWorkCounter.h"
+
+struct cJSON;
 
 constexpr char kKeyTotalDuration[] = "totalDuration";
 constexpr char kKeyHitchesDuration[] = "hitchesDuration";
 constexpr char kKeyFrameCount[] = "frameCount";
 constexpr char kKeyMainFPS[] = "mainFPS";
 constexpr char kKeyKotlinFPS[] = "kotlinFPS";
+constexpr char kKeyJankCount[] = "jankCount";
+constexpr char kKeyFrameP50[] = "p50";
+constexpr char kKeyFrameP90[] = "p90";
+constexpr char kKeyFrameP99[] = "p99";
+constexpr char kKeyFrameMax[] = "max";
+constexpr char kKeyHistogram[] = "histogram";
+constexpr char kKeyJankWork[] = "jankWork";
+constexpr char kKeyJankFrames[] = "jankFrames";
+
+/**
+ * 单个卡顿帧及其期间主线程做过的工作
+ */
+struct KRJankFrame {
+    long long timestamp_nanos = 0;  // 帧结束时的 VSync 时间戳
+    long long duration_nanos = 0;   // 帧耗时
+    KRFrameWorkSnapshot work;       // 帧内主线程工作量
+};
 
 class KRFrameData {
 public:
+    static constexpr size_t kMaxJankFrames = 16;  // 只保留最严重的若干卡顿帧
+
     long long total_duration = 0;            // 总耗时 (ms)
     long long hitches_duration = 0;          // 卡顿耗时 (ms)
     long long drive_hitches_duration = 0;     // 驱动卡顿耗时 (ms)
     long long frame_count = 0;               // 总帧数
     long long drive_frame_count = 0;          // 驱动帧数
+    long long jank_count = 0;                // 卡顿帧数
+    KRFrameHistogram histogram;              // 帧耗时直方图
+    KRFrameWorkSnapshot jank_work;           // 所有卡顿帧内主线程工作量之和
+    std::vector<KRJankFrame> jank_frames;    // 耗时最长的卡顿帧（按耗时降序）
+
+    /**
+     * 记录一帧
+     * @param timestamp_nanos 帧结束时的 VSync 时间戳（ns）
+     * @param frame_duration_nanos 帧耗时（ns）
+     * @param frame_interval_nanos 标准帧间隔（ns），超出部分记为卡顿
+     * @param work 帧内主线程工作量
+     */
+    void AddFrame(long long timestamp_nanos, long long frame_duration_nanos, long long frame_interval_nanos,
+                  const KRFrameWorkSnapshot &work);
 
     // 获取 FPS
     double getFps() const;
@@ -38,9 +76,14 @@ public:
     // todo
     double getKotlinFps() const;
 
+    /**
+     * 生成 JSON 对象，调用方负责 cJSON_Delete
+     */
+    cJSON *ToJSON() const;
+
     std::string ToJSONString();
 
     void Reset();
 };
 
-#endif //CORE_RENDER_OHOS_KRFRAMEDATA_H
\ No newline at end of file
+#endif //CORE_RENDER_OHOS_KRFRAMEDATA_H
@@ -0,0 +1,92 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KRFrameHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+static constexpr long long kOneMicroSecondInNanos = 1000;
+
+int KRFrameHistogram::BucketIndex(long long duration_nanos) {
+    if (duration_nanos <= 0) {
+        return 0;
+    }
+    auto micros = static_cast<unsigned long long>(duration_nanos / kOneMicroSecondInNanos);
+    if (micros < (1ULL << kMinOctaveBits)) {
+        return 0;
+    }
+    int msb = 63 - __builtin_clzll(micros);
+    int octave = msb - kMinOctaveBits;
+    if (octave >= kOctaveCount) {
+        return kBucketCount - 1;
+    }
+    int sub = static_cast<int>((micros >> (msb - kSubBucketBits)) & (kSubBucketCount - 1));
+    return 1 + octave * kSubBucketCount + sub;
+}
+
+long long KRFrameHistogram::BucketLowerBound(int index) {
+    if (index <= 0) {
+        return 0;
+    }
+    int octave = (index - 1) / kSubBucketCount;
+    int sub = (index - 1) % kSubBucketCount;
+    long long micros = static_cast<long long>(kSubBucketCount + sub) << (octave + kMinOctaveBits - kSubBucketBits);
+    return micros * kOneMicroSecondInNanos;
+}
+
+void KRFrameHistogram::Record(long long duration_nanos) {
+    if (duration_nanos < 0) {
+        return;
+    }
+    int index = BucketIndex(duration_nanos);
+    buckets_[index]++;
+    bucket_sums_nanos_[index] += duration_nanos;
+    count_++;
+    max_nanos_ = std::max(max_nanos_, duration_nanos);
+}
+
+void KRFrameHistogram::Merge(const KRFrameHistogram &other) {
+    for (int i = 0; i < kBucketCount; i++) {
+        buckets_[i] += other.buckets_[i];
+        bucket_sums_nanos_[i] += other.bucket_sums_nanos_[i];
+    }
+    count_ += other.count_;
+    max_nanos_ = std::max(max_nanos_, other.max_nanos_);
+}
+
+long long KRFrameHistogram::Percentile(double percentile) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    percentile = std::min(100.0, std::max(0.0, percentile));
+    auto rank = static_cast<long long>(std::ceil(percentile / 100.0 * count_));
+    rank = std::max(1LL, rank);
+    long long seen = 0;
+    for (int i = 0; i < kBucketCount; i++) {
+        seen += buckets_[i];
+        if (seen >= rank) {
+            return bucket_sums_nanos_[i] / buckets_[i];
+        }
+    }
+    return max_nanos_;
+}
+
+void KRFrameHistogram::Reset() {
+    buckets_.fill(0);
+    bucket_sums_nanos_.fill(0);
+    count_ = 0;
+    max_nanos_ = 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRFRAMEHISTOGRAM_H
+#define CORE_RENDER_OHOS_KRFRAMEHISTOGRAM_H
+
+#include <array>
+
+/**
+ * 帧耗时对数分桶直方图（不依赖 OHOS 运行时，可在 host 上单测）。
+ *
+ * 分桶规则（以微秒计）：
+ *   - [0, 1ms) 归入 0 号桶；
+ *   - 之后每个 2 的幂区间（1~2ms, 2~4ms, ...）再等分 kSubBucketCount 份；
+ *   - 超过上限（约 4.2s）的帧统一落在最后一个桶。
+ * 每个桶同时记录落入帧的耗时总和，分位值取所在桶的均值，
+ * 对于稳定 16.6ms 的帧序列能得到精确值而不是桶边界。
+ */
+class KRFrameHistogram {
+ public:
+    static constexpr int kSubBucketBits = 3;
+    static constexpr int kSubBucketCount = 1 << kSubBucketBits;
+    static constexpr int kMinOctaveBits = 10;  // 2^10 us ≈ 1ms
+    static constexpr int kOctaveCount = 12;    // 1ms ~ 4.2s
+    static constexpr int kBucketCount = 1 + kOctaveCount * kSubBucketCount;
+
+    /**
+     * 记录一帧耗时
+     * @param duration_nanos 帧耗时（ns）
+     */
+    void Record(long long duration_nanos);
+
+    /**
+     * 合并另一份直方图（如把滚动会话汇总进整页数据）
+     */
+    void Merge(const KRFrameHistogram &other);
+
+    /**
+     * 获取分位耗时
+     * @param percentile 分位，取值 (0, 100]
+     * @return 分位耗时（ns），无数据时返回 0
+     */
+    long long Percentile(double percentile) const;
+
+    long long Max() const {
+        return max_nanos_;
+    }
+
+    long long Count() const {
+        return count_;
+    }
+
+    long long BucketCountAt(int index) const {
+        return buckets_[index];
+    }
+
+    void Reset();
+
+    /**
+     * 帧耗时对应的桶索引
+     */
+    static int BucketIndex(long long duration_nanos);
+
+    /**
+     * 桶的下边界（ns），0 号桶下边界为 0
+     */
+    static long long BucketLowerBound(int index);
+
+ private:
+    std::array<long long, kBucketCount> buckets_{};
+    std::array<long long, kBucketCount> bucket_sums_nanos_{};
+    long long count_ = 0;
+    long long max_nanos_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRFRAMEHISTOGRAM_H
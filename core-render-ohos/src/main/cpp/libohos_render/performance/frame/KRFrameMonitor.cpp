@@ -15,6 +15,7 @@
 
 #include "KRFrameMonitor.h"
 #include "libohos_render/utils/KRRenderLoger.h"
+#include "thirdparty/cJSON/cJSON.h"
 
 const char KRFrameMonitor::kMonitorName[] = "KRFrameMonitor";
 constexpr char kTag[] = "KRFrameMonitor";
@@ -44,7 +45,10 @@ void KRFrameMonitor::Start() {
     is_started_ = true;
     is_resumed_ = true;
     last_frame_time_nanos_ = 0;
-    frame_data_.Reset();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        frame_data_.Reset();
+    }
     RequestNextVSync();
 }
 
@@ -69,7 +73,7 @@ void KRFrameMonitor::OnResume() {
 }
 
 void KRFrameMonitor::OnPause() {
-    if (!is_started_ || is_resumed_) {
+    if (!is_started_ || !is_resumed_) {
         KR_LOG_INFO_WITH_TAG(kTag) << "pause, isStarted: " << is_started_ << "isResumed: " << is_resumed_;
         return;   
     }
@@ -82,9 +86,47 @@ void KRFrameMonitor::OnDestroy() {
 }
 
 std::string KRFrameMonitor::GetMonitorData() {
+    std::lock_guard<std::mutex> lock(mutex_);
     return frame_data_.ToJSONString();
 }
 
+void KRFrameMonitor::OnScrollBegin() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (scroll_depth_++ == 0) {
+        scroll_frame_data_.Reset();
+    }
+}
+
+std::string KRFrameMonitor::OnScrollEnd() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (scroll_depth_ == 0 || --scroll_depth_ > 0) {
+        return "";
+    }
+    if (scroll_frame_data_.frame_count == 0) {
+        return "";
+    }
+    auto data = scroll_frame_data_.ToJSONString();
+    scroll_sessions_.push_back(data);
+    if (scroll_sessions_.size() > MAX_SCROLL_SESSIONS) {
+        scroll_sessions_.pop_front();
+    }
+    scroll_frame_data_.Reset();
+    return data;
+}
+
+std::string KRFrameMonitor::GetScrollSessionData() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cJSON *sessions = cJSON_CreateArray();
+    for (const auto &session : scroll_sessions_) {
+        cJSON_AddItemToArray(sessions, cJSON_Parse(session.c_str()));
+    }
+    char *json_str = cJSON_PrintUnformatted(sessions);
+    std::string result = json_str;
+    free(json_str);
+    cJSON_Delete(sessions);
+    return result;
+}
+
 void KRFrameMonitor::RequestNextVSync() {
     if (native_vsync_ && is_started_ && is_resumed_) {
         OH_NativeVSync_RequestFrame(native_vsync_, &KRFrameMonitor::OnVSync, this);
@@ -96,21 +138,18 @@ void KRFrameMonitor::OnVSync(long long timestamp, void* data) {
     if (!monitor || !monitor->is_started_ || !monitor->is_resumed_) {
         return;
     }
+    auto work = KRFrameWorkCounter::Snapshot();
     if (monitor->last_frame_time_nanos_ > 0) {
         long long frameDuration = timestamp - monitor->last_frame_time_nanos_;
-        // 1. 累计总耗时
-        long long frameDurationMillis = frameDuration / ONE_MILLI_SECOND_IN_NANOS;
-        monitor->frame_data_.total_duration += frameDuration / ONE_MILLI_SECOND_IN_NANOS;
-        monitor->frame_data_.frame_count++;
-        // 2. 计算掉帧/卡顿
-        // 如果一帧超过 16.6ms，多出来的部分记为卡顿
-        long long hitches = 0;
-        if (frameDuration > FRAME_INTERVAL_NANOS) {
-            hitches = (frameDuration - FRAME_INTERVAL_NANOS) / ONE_MILLI_SECOND_IN_NANOS;
-            monitor->frame_data_.hitches_duration += hitches;
+        // 两次 VSync 之间主线程做过的工作，用于卡顿归因
+        auto frameWork = work - monitor->last_frame_work_;
+        std::lock_guard<std::mutex> lock(monitor->mutex_);
+        monitor->frame_data_.AddFrame(timestamp, frameDuration, FRAME_INTERVAL_NANOS, frameWork);
+        if (monitor->scroll_depth_ > 0) {
+            monitor->scroll_frame_data_.AddFrame(timestamp, frameDuration, FRAME_INTERVAL_NANOS, frameWork);
         }
-
     }
+    monitor->last_frame_work_ = work;
     monitor->last_frame_time_nanos_ = timestamp;
     // 请求下一帧
     monitor->RequestNextVSync();
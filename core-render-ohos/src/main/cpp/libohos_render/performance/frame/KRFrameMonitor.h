@@ -19,6 +19,7 @@
 #include "libohos_render/performance/KRMonitor.h"
 #include "libohos_render/performance/frame/KRFrameData.h"
 #include <native_vsync/native_vsync.h>
+#include <list>
 #include <string>
 #include <mutex>
 
@@ -32,6 +33,20 @@ public:
     void OnPause() override;
     void OnDestroy() override;
     std::string GetMonitorData() override;
+
+    /**
+     * 滚动开始，进入滚动会话（支持嵌套滚动，计数归零时会话结束）
+     */
+    void OnScrollBegin();
+    /**
+     * 滚动结束
+     * @return 本次结束的滚动会话帧数据 JSON，会话未结束或无有效帧时返回空串
+     */
+    std::string OnScrollEnd();
+    /**
+     * 最近若干次滚动会话的帧数据（JSON 数组）
+     */
+    std::string GetScrollSessionData();
     
     static const char kMonitorName[];
 
@@ -46,8 +61,13 @@ private:
 private:
     static constexpr long FRAME_INTERVAL_NANOS = 16666667L; // 60fps 的刷新间隔（ns）
     static constexpr long ONE_MILLI_SECOND_IN_NANOS = 1000000L; // 1毫秒的纳秒表示 1ms = 1000,000 ns
+    static constexpr size_t MAX_SCROLL_SESSIONS = 8; // 保留的滚动会话数
     
     KRFrameData frame_data_;
+    KRFrameData scroll_frame_data_;          // 当前滚动会话的帧数据
+    std::list<std::string> scroll_sessions_;  // 已结束的滚动会话（JSON）
+    int scroll_depth_ = 0;
+    KRFrameWorkSnapshot last_frame_work_;
     std::mutex mutex_;
     bool is_started_ = false;
     bool is_resumed_ = false;
@@ -0,0 +1,72 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRFRAMEWORKCOUNTER_H
+#define CORE_RENDER_OHOS_KRFRAMEWORKCOUNTER_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * 主线程工作量快照，两次 VSync 之间的差值即为该帧内主线程做过的事情，用于卡顿归因
+ */
+struct KRFrameWorkSnapshot {
+    uint64_t scheduler_tasks = 0;  // KRUIScheduler 执行的主线程任务数
+    uint64_t views_created = 0;    // 创建的 view 数
+    uint64_t props_set = 0;        // 设置的属性/事件数
+
+    KRFrameWorkSnapshot operator-(const KRFrameWorkSnapshot &other) const {
+        return {scheduler_tasks - other.scheduler_tasks, views_created - other.views_created,
+                props_set - other.props_set};
+    }
+
+    KRFrameWorkSnapshot &operator+=(const KRFrameWorkSnapshot &other) {
+        scheduler_tasks += other.scheduler_tasks;
+        views_created += other.views_created;
+        props_set += other.props_set;
+        return *this;
+    }
+};
+
+/**
+ * 进程级主线程工作量计数器。
+ * 只在主线程累加，由 VSync 线程读取，因此使用 relaxed 原子操作即可，开销等同一次普通自增。
+ */
+class KRFrameWorkCounter {
+ public:
+    static void AddSchedulerTasks(uint64_t count) {
+        scheduler_tasks_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    static void AddViewCreated() {
+        views_created_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void AddPropSet() {
+        props_set_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static KRFrameWorkSnapshot Snapshot() {
+        return {scheduler_tasks_.load(std::memory_order_relaxed), views_created_.load(std::memory_order_relaxed),
+                props_set_.load(std::memory_order_relaxed)};
+    }
+
+ private:
+    static inline std::atomic<uint64_t> scheduler_tasks_{0};
+    static inline std::atomic<uint64_t> views_created_{0};
+    static inline std::atomic<uint64_t> props_set_{0};
+};
+
+#endif  // CORE_RENDER_OHOS_KRFRAMEWORKCOUNTER_H
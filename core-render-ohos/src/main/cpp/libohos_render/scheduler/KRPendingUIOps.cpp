@@ -0,0 +1,94 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/scheduler/KRPendingUIOps.h"
+
+#include <unordered_set>
+
+using Kind = KRPendingUIOp::Kind;
+
+void KRPendingUIOps::Add(KRPendingUIOp op) {
+    if (op.kind == Kind::kProp || op.kind == Kind::kEvent) {
+        auto &index = prop_index_[op.tag];
+        auto key = (op.kind == Kind::kEvent ? "@" : ":") + op.key;
+        auto it = index.find(key);
+        if (it != index.end()) {
+            // 只替换值，不移动位置，避免越过同一 view 的其他操作
+            ops_[it->second].task = std::move(op.task);
+            coalesced_count_++;
+            return;
+        }
+        index.emplace(std::move(key), ops_.size());
+    } else if (op.kind == Kind::kViewCall) {
+        prop_index_.erase(op.tag);
+    }
+    ops_.push_back(std::move(op));
+    live_count_++;
+}
+
+std::vector<std::function<void()>> KRPendingUIOps::Drain() {
+    // 暂存期间先创建后移除的 view 为抵消候选
+    std::unordered_set<int> created;
+    std::unordered_set<int> cancelled;
+    for (const auto &op : ops_) {
+        if (!op.task) {
+            continue;
+        }
+        if (op.kind == Kind::kCreate) {
+            created.insert(op.tag);
+        } else if (op.kind == Kind::kRemove && created.count(op.tag)) {
+            cancelled.insert(op.tag);
+        }
+    }
+    // 被未抵消的子节点插入过的父节点不能抵消，直到稳定
+    bool changed = !cancelled.empty();
+    while (changed) {
+        changed = false;
+        for (const auto &op : ops_) {
+            if (op.task && op.kind == Kind::kInsert && cancelled.count(op.parent_tag) && !cancelled.count(op.tag)) {
+                cancelled.erase(op.parent_tag);
+                changed = true;
+            }
+        }
+    }
+
+    std::vector<std::function<void()>> tasks;
+    tasks.reserve(live_count_);
+    for (auto &op : ops_) {
+        if (!op.task) {
+            continue;
+        }
+        bool drop = op.kind != Kind::kOther &&
+                    (cancelled.count(op.tag) || (op.kind == Kind::kInsert && cancelled.count(op.parent_tag)));
+        if (drop) {
+            coalesced_count_++;
+            if (op.drop_task) {
+                tasks.push_back(std::move(op.drop_task));
+            }
+            continue;
+        }
+        tasks.push_back(std::move(op.task));
+    }
+    ops_.clear();
+    prop_index_.clear();
+    live_count_ = 0;
+    return tasks;
+}
+
+void KRPendingUIOps::Clear() {
+    ops_.clear();
+    prop_index_.clear();
+    live_count_ = 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRPENDINGUIOPS_H
+#define CORE_RENDER_OHOS_KRPENDINGUIOPS_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * 页面不可见期间暂存的一条 UI 操作
+ */
+struct KRPendingUIOp {
+    enum class Kind {
+        kCreate,    // 创建 view
+        kRemove,    // 移除 view
+        kInsert,    // 插入到父 view，parent_tag 为父节点
+        kProp,      // 设置属性（含 frame），同一 view 同一 key 只保留最后一次的值
+        kEvent,     // 设置事件，同一 view 同一 key 只保留最后一次的值
+        kViewCall,  // 其他只作用于该 view 的操作（view 方法调用、设置 shadow 等）
+        kOther,     // 与 view 无关或不按 view 合并的操作（如作用于 view 的 module 调用），原样保留
+    };
+
+    Kind kind = Kind::kOther;
+    int tag = 0;
+    int parent_tag = 0;
+    std::string key;
+    std::function<void()> task;
+    // 操作因 view 被抵消而丢弃时代替 task 执行，如以失败结果回调 Kotlin，保证回调不丢失
+    std::function<void()> drop_task;
+};
+
+/**
+ * 页面不可见时积攒的 UI 操作（只在 context 线程访问），可见时一次性取出下发：
+ * - 同一 view 同一 key 的属性/事件重复设置只保留最后一次的值，位置保持在第一次设置处；
+ *   该 view 的 kViewCall 之后的设置另起一条，保证 view 方法调用时看到的属性与原顺序执行一致
+ * - 暂存期间创建又移除的 view 连同它的所有操作一起抵消；
+ *   若还有未被抵消的子节点插入过它，则保留它，保证其他 view 的父子关系与原顺序执行一致；
+ *   被抵消的操作若带有 drop_task，在原位置改为执行 drop_task
+ */
+class KRPendingUIOps {
+ public:
+    void Add(KRPendingUIOp op);
+
+    /**
+     * 按原顺序取出合并后的任务（含被抵消操作的 drop_task）并清空
+     */
+    std::vector<std::function<void()>> Drain();
+
+    void Clear();
+
+    bool Empty() const {
+        return live_count_ == 0;
+    }
+
+    /**
+     * 当前暂存的操作数（合并后）
+     */
+    size_t Size() const {
+        return live_count_;
+    }
+
+    /**
+     * 累计合并掉的操作数（覆盖与抵消）
+     */
+    uint64_t CoalescedCount() const {
+        return coalesced_count_;
+    }
+
+ private:
+    std::vector<KRPendingUIOp> ops_;
+    // tag -> (种类 + 属性名 -> ops_ 下标)，遇到该 view 的 kViewCall 时清空
+    std::unordered_map<int, std::unordered_map<std::string, size_t>> prop_index_;
+    size_t live_count_ = 0;
+    uint64_t coalesced_count_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRPENDINGUIOPS_H
@@ -15,6 +15,9 @@
 
 #include "libohos_render/scheduler/KRUIScheduler.h"
 
+#include "libohos_render/expand/components/base/animation/KRNodeAnimationBatch.h"
+#include "libohos_render/manager/KRArkTSManager.h"
+#include "libohos_render/performance/frame/KRFrameWorkCounter.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 
@@ -130,6 +133,11 @@ void KRUIScheduler::PerformOnMainQueueWithTask(bool sync, const std::function<vo
 
 void KRUIScheduler::RunMainQueueTasks(const std::vector<KRSchedulerTask> &tasks) {
     // 主线程
+    KRFrameWorkCounter::AddSchedulerTasks(tasks.size());
+    // 本轮任务内转发给ArkTS View的变更合并为一次调用下发
+    KRArkTSManager::GetInstance().BeginViewOpBatch();
+    // 本轮任务内提交的属性动画按配置合并为一次 animateTo
+    KRNodeAnimationBatch::GetInstance().Begin();
     m_performing_main_queue_task_ = true;
     for (size_t i = 0; i < tasks.size(); i++) {
         tasks[i]();
@@ -150,6 +158,8 @@ void KRUIScheduler::RunMainQueueTasks(const std::vector<KRSchedulerTask> &tasks)
             tasks[i]();
         }
     }
+    KRNodeAnimationBatch::GetInstance().End();
+    KRArkTSManager::GetInstance().EndViewOpBatch();
 }
 
 void KRUIScheduler::PerformMainThreadTaskWaitToSyncBlockIfNeed() {
@@ -15,6 +15,24 @@
 
 #include "KRBase64Util.h"
 
+#include <cstdint>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define KR_BASE64_NEON 1
+#elif defined(KR_BASE64_NEON_EMULATION)
+// host 单测在 x86 上用标量模拟的 intrinsics 验证 NEON 路径
+#include "neon_emulation.h"
+#define KR_BASE64_NEON 1
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define KR_BASE64_AVX2 1
+#define KR_BASE64_SSSE3 1
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define KR_BASE64_SSSE3 1
+#endif
+
 static const char HEX_DIGITS[] = "0123456789abcdef";
 // Maps integer in the range [0,16) to a hex digit.
 
@@ -22,25 +40,284 @@ static const char HEX_DIGITS_URI[] = "0123456789ABCDEF";
 // RFC 3986 section 2.1 says "For consistency, URI producers and normalizers should use uppercase
 // hexadecimal digits for all percent-encodings.
 
-static const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                                   "abcdefghijklmnopqrstuvwxyz"
-                                   "0123456789+/";
+namespace {
+
+constexpr uint8_t kDecodeInvalid = 0xFF;
+constexpr uint8_t kDecodeWhitespace = 0xFE;
+// SIMD 解码一次最多多写出的字节数（按 16/32 字节整块 store）
+constexpr size_t kDecodeOutputSlack = 32;
+
+struct Base64Alphabet {
+    char c62;
+    char c63;
+    uint8_t encode[64];
+    uint8_t decode[256];
+};
+
+Base64Alphabet MakeAlphabet(char c62, char c63) {
+    Base64Alphabet alphabet{};
+    alphabet.c62 = c62;
+    alphabet.c63 = c63;
+    const char chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+    for (int i = 0; i < 62; i++) {
+        alphabet.encode[i] = static_cast<uint8_t>(chars[i]);
+    }
+    alphabet.encode[62] = static_cast<uint8_t>(c62);
+    alphabet.encode[63] = static_cast<uint8_t>(c63);
+    for (int i = 0; i < 256; i++) {
+        alphabet.decode[i] = kDecodeInvalid;
+    }
+    for (int i = 0; i < 64; i++) {
+        alphabet.decode[alphabet.encode[i]] = static_cast<uint8_t>(i);
+    }
+    for (char c : {' ', '\t', '\r', '\n'}) {
+        alphabet.decode[static_cast<uint8_t>(c)] = kDecodeWhitespace;
+    }
+    return alphabet;
+}
+
+const Base64Alphabet &GetAlphabet(KRBase64Util::Alphabet alphabet) {
+    static const Base64Alphabet standard = MakeAlphabet('+', '/');
+    static const Base64Alphabet url_safe = MakeAlphabet('-', '_');
+    return alphabet == KRBase64Util::Alphabet::kUrlSafe ? url_safe : standard;
+}
+
+#if KR_BASE64_SSSE3
+// 6bit 索引 -> 字符：按区间加偏移，62/63 两个字符按字母表替换
+inline __m128i EncodeTranslate(__m128i idx, const Base64Alphabet &alphabet) {
+    __m128i result = _mm_add_epi8(idx, _mm_set1_epi8('A'));
+    result = _mm_add_epi8(result, _mm_and_si128(_mm_cmpgt_epi8(idx, _mm_set1_epi8(25)), _mm_set1_epi8(6)));
+    result = _mm_add_epi8(result, _mm_and_si128(_mm_cmpgt_epi8(idx, _mm_set1_epi8(51)), _mm_set1_epi8(-75)));
+    __m128i eq62 = _mm_cmpeq_epi8(idx, _mm_set1_epi8(62));
+    __m128i eq63 = _mm_cmpeq_epi8(idx, _mm_set1_epi8(63));
+    result = _mm_or_si128(_mm_andnot_si128(_mm_or_si128(eq62, eq63), result),
+                          _mm_or_si128(_mm_and_si128(eq62, _mm_set1_epi8(alphabet.c62)),
+                                       _mm_and_si128(eq63, _mm_set1_epi8(alphabet.c63))));
+    return result;
+}
+
+// 每 3 字节拆成 4 个 6bit 索引，12 字节输入 -> 16 个索引
+inline __m128i EncodeSplit(__m128i in) {
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t1, t3);
+}
 
-std::string KRBase64Util::Encode(std::string_view in) {
+// 字符 -> 6bit 索引，非法字符（含空白、'='、非 ASCII）在 valid 中对应位为 0
+inline __m128i DecodeTranslate(__m128i c, const Base64Alphabet &alphabet, int &valid_mask) {
+    __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('Z' + 1)));
+    __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('z' + 1)));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+    __m128i eq62 = _mm_cmpeq_epi8(c, _mm_set1_epi8(alphabet.c62));
+    __m128i eq63 = _mm_cmpeq_epi8(c, _mm_set1_epi8(alphabet.c63));
+    __m128i idx = _mm_and_si128(upper, _mm_sub_epi8(c, _mm_set1_epi8('A')));
+    idx = _mm_or_si128(idx, _mm_and_si128(lower, _mm_sub_epi8(c, _mm_set1_epi8('a' - 26))));
+    idx = _mm_or_si128(idx, _mm_and_si128(digit, _mm_add_epi8(c, _mm_set1_epi8(52 - '0'))));
+    idx = _mm_or_si128(idx, _mm_and_si128(eq62, _mm_set1_epi8(62)));
+    idx = _mm_or_si128(idx, _mm_and_si128(eq63, _mm_set1_epi8(63)));
+    __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, _mm_or_si128(eq62, eq63)));
+    valid_mask = _mm_movemask_epi8(valid);
+    return idx;
+}
+
+// 16 个索引 -> 12 字节，结果在低 12 字节
+inline __m128i DecodePack(__m128i idx) {
+    const __m128i merge_ab_and_bc = _mm_maddubs_epi16(idx, _mm_set1_epi32(0x01400140));
+    const __m128i out = _mm_madd_epi16(merge_ab_and_bc, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(out, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+#endif
+
+#if KR_BASE64_AVX2
+inline __m256i EncodeTranslate256(__m256i idx, const Base64Alphabet &alphabet) {
+    __m256i result = _mm256_add_epi8(idx, _mm256_set1_epi8('A'));
+    result = _mm256_add_epi8(result, _mm256_and_si256(_mm256_cmpgt_epi8(idx, _mm256_set1_epi8(25)),
+                                                      _mm256_set1_epi8(6)));
+    result = _mm256_add_epi8(result, _mm256_and_si256(_mm256_cmpgt_epi8(idx, _mm256_set1_epi8(51)),
+                                                      _mm256_set1_epi8(-75)));
+    __m256i eq62 = _mm256_cmpeq_epi8(idx, _mm256_set1_epi8(62));
+    __m256i eq63 = _mm256_cmpeq_epi8(idx, _mm256_set1_epi8(63));
+    result = _mm256_blendv_epi8(result, _mm256_set1_epi8(alphabet.c62), eq62);
+    return _mm256_blendv_epi8(result, _mm256_set1_epi8(alphabet.c63), eq63);
+}
+
+inline __m256i EncodeSplit256(__m256i in) {
+    in = _mm256_shuffle_epi8(in, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1, 10, 11, 9, 10, 7,
+                                                 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    return _mm256_or_si256(t1, t3);
+}
+
+inline __m256i InRange256(__m256i c, char lo, char hi) {
+    return _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8(lo - 1)),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8(hi + 1), c));
+}
+
+inline __m256i DecodeTranslate256(__m256i c, const Base64Alphabet &alphabet, uint32_t &valid_mask) {
+    __m256i upper = InRange256(c, 'A', 'Z');
+    __m256i lower = InRange256(c, 'a', 'z');
+    __m256i digit = InRange256(c, '0', '9');
+    __m256i eq62 = _mm256_cmpeq_epi8(c, _mm256_set1_epi8(alphabet.c62));
+    __m256i eq63 = _mm256_cmpeq_epi8(c, _mm256_set1_epi8(alphabet.c63));
+    __m256i idx = _mm256_and_si256(upper, _mm256_sub_epi8(c, _mm256_set1_epi8('A')));
+    idx = _mm256_or_si256(idx, _mm256_and_si256(lower, _mm256_sub_epi8(c, _mm256_set1_epi8('a' - 26))));
+    idx = _mm256_or_si256(idx, _mm256_and_si256(digit, _mm256_add_epi8(c, _mm256_set1_epi8(52 - '0'))));
+    idx = _mm256_or_si256(idx, _mm256_and_si256(eq62, _mm256_set1_epi8(62)));
+    idx = _mm256_or_si256(idx, _mm256_and_si256(eq63, _mm256_set1_epi8(63)));
+    __m256i valid = _mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, _mm256_or_si256(eq62, eq63)));
+    valid_mask = static_cast<uint32_t>(_mm256_movemask_epi8(valid));
+    return idx;
+}
+
+// 32 个索引 -> 24 字节，结果在低 24 字节
+inline __m256i DecodePack256(__m256i idx) {
+    const __m256i merge_ab_and_bc = _mm256_maddubs_epi16(idx, _mm256_set1_epi32(0x01400140));
+    __m256i out = _mm256_madd_epi16(merge_ab_and_bc, _mm256_set1_epi32(0x00011000));
+    out = _mm256_shuffle_epi8(out, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0,
+                                                    6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    return _mm256_permutevar8x32_epi32(out, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+}
+#endif
+
+/**
+ * SIMD 编码尽可能多的整块，返回消耗的输入字节数（3 的倍数），输出 consumed / 3 * 4 个字符
+ */
+size_t EncodeBlocks([[maybe_unused]] const uint8_t *src, [[maybe_unused]] size_t length,
+                    [[maybe_unused]] uint8_t *dst, [[maybe_unused]] const Base64Alphabet &alphabet) {
+    size_t i = 0;
+#if KR_BASE64_NEON
+    const uint8x16x4_t table = vld1q_u8_x4(alphabet.encode);
+    const uint8x16_t mask = vdupq_n_u8(0x3F);
+    for (; i + 48 <= length; i += 48, dst += 64) {
+        uint8x16x3_t in = vld3q_u8(src + i);
+        uint8x16x4_t out;
+        out.val[0] = vqtbl4q_u8(table, vshrq_n_u8(in.val[0], 2));
+        out.val[1] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask));
+        out.val[2] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask));
+        out.val[3] = vqtbl4q_u8(table, vandq_u8(in.val[2], mask));
+        vst4q_u8(dst, out);
+    }
+#endif
+#if KR_BASE64_AVX2
+    // 两个 128 位 lane 各取 12 字节：lane0 读 [i, i+16)，lane1 读 [i+12, i+28)
+    for (; i + 28 <= length; i += 24, dst += 32) {
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 12));
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), EncodeTranslate256(EncodeSplit256(in), alphabet));
+    }
+#endif
+#if KR_BASE64_SSSE3
+    // 读 16 字节只用前 12 字节
+    for (; i + 16 <= length; i += 12, dst += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), EncodeTranslate(EncodeSplit(in), alphabet));
+    }
+#endif
+    return i;
+}
+
+/**
+ * SIMD 解码尽可能多的整块，遇到含空白/非法字符的块即停止，交由标量路径处理
+ */
+void DecodeBlocks([[maybe_unused]] const uint8_t *src, [[maybe_unused]] size_t length,
+                  [[maybe_unused]] uint8_t *dst, [[maybe_unused]] const Base64Alphabet &alphabet, size_t &consumed,
+                  size_t &produced) {
+    size_t i = 0;
+    size_t o = 0;
+#if KR_BASE64_NEON
+    const uint8x16x4_t table_lo = vld1q_u8_x4(alphabet.decode);
+    const uint8x16x4_t table_hi = vld1q_u8_x4(alphabet.decode + 64);
+    const uint8x16_t offset = vdupq_n_u8(64);
+    const uint8x16_t high_bit = vdupq_n_u8(0x80);
+    for (; i + 64 <= length; i += 64, o += 48) {
+        uint8x16x4_t in = vld4q_u8(src + i);
+        uint8x16_t error = vdupq_n_u8(0);
+        uint8x16_t d[4];
+        for (int k = 0; k < 4; k++) {
+            // [0, 64) 查 table_lo，[64, 128) 查 table_hi，>= 128 由 high_bit 标记为非法
+            d[k] = vqtbx4q_u8(vqtbl4q_u8(table_lo, in.val[k]), table_hi, vsubq_u8(in.val[k], offset));
+            error = vorrq_u8(error, vorrq_u8(d[k], vandq_u8(in.val[k], high_bit)));
+        }
+        if (vmaxvq_u8(error) > 63) {
+            break;
+        }
+        uint8x16x3_t out;
+        out.val[0] = vorrq_u8(vshlq_n_u8(d[0], 2), vshrq_n_u8(d[1], 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(d[1], 4), vshrq_n_u8(d[2], 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(d[2], 6), d[3]);
+        vst3q_u8(dst + o, out);
+    }
+#endif
+#if KR_BASE64_AVX2
+    for (; i + 32 <= length; i += 32, o += 24) {
+        __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        uint32_t valid_mask = 0;
+        __m256i idx = DecodeTranslate256(in, alphabet, valid_mask);
+        if (valid_mask != 0xFFFFFFFFu) {
+            break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + o), DecodePack256(idx));
+    }
+#endif
+#if KR_BASE64_SSSE3
+    for (; i + 16 <= length; i += 16, o += 12) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        int valid_mask = 0;
+        __m128i idx = DecodeTranslate(in, alphabet, valid_mask);
+        if (valid_mask != 0xFFFF) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + o), DecodePack(idx));
+    }
+#endif
+    consumed = i;
+    produced = o;
+}
+
+}  // namespace
+
+std::string KRBase64Util::Encode(std::string_view data, Alphabet alphabet, bool padding) {
+    const Base64Alphabet &table = GetAlphabet(alphabet);
+    const auto *src = reinterpret_cast<const uint8_t *>(data.data());
+    const size_t length = data.size();
+    const size_t tail = length % 3;
     std::string out;
-    int val = 0, valb = -6;
-    for (unsigned char c : in) {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0) {
-            out.push_back(base64_chars[(val >> valb) & 0x3F]);
-            valb -= 6;
+    out.resize(length / 3 * 4 + (tail == 0 ? 0 : (padding ? 4 : tail + 1)));
+    auto *dst = reinterpret_cast<uint8_t *>(&out[0]);
+
+    size_t i = EncodeBlocks(src, length, dst, table);
+    dst += i / 3 * 4;
+    for (; i + 3 <= length; i += 3, dst += 4) {
+        uint32_t v = (src[i] << 16) | (src[i + 1] << 8) | src[i + 2];
+        dst[0] = table.encode[v >> 18];
+        dst[1] = table.encode[(v >> 12) & 0x3F];
+        dst[2] = table.encode[(v >> 6) & 0x3F];
+        dst[3] = table.encode[v & 0x3F];
+    }
+    if (tail > 0) {
+        uint32_t v = src[i] << 16;
+        if (tail == 2) {
+            v |= src[i + 1] << 8;
+        }
+        *dst++ = table.encode[v >> 18];
+        *dst++ = table.encode[(v >> 12) & 0x3F];
+        if (tail == 2) {
+            *dst++ = table.encode[(v >> 6) & 0x3F];
+        }
+        if (padding) {
+            *dst++ = '=';
+            if (tail == 1) {
+                *dst++ = '=';
+            }
         }
     }
-    if (valb > -6)
-        out.push_back(base64_chars[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (out.size() % 4)
-        out.push_back('=');
     return out;
 }
 
@@ -48,24 +325,84 @@ std::string KRBase64Util::Encode(const std::string &data) {
     return KRBase64Util::Encode(std::string_view(data));
 }
 
-std::string KRBase64Util::Decode(std::string_view in) {
+std::string KRBase64Util::Decode(std::string_view data, Alphabet alphabet) {
+    const Base64Alphabet &table = GetAlphabet(alphabet);
+    const auto *src = reinterpret_cast<const uint8_t *>(data.data());
+    const size_t length = data.size();
     std::string out;
-    int val = 0, valb = -6;
-    for (unsigned char c : in) {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0) {
-            out.push_back(base64_chars[(val >> valb) & 0x3F]);
-            valb -= 6;
+    out.resize(length / 4 * 3 + 3 + kDecodeOutputSlack);
+    auto *dst = reinterpret_cast<uint8_t *>(&out[0]);
+
+    size_t i = 0;
+    size_t written = 0;
+    uint32_t val = 0;
+    int sextets = 0;
+    while (i < length) {
+        if (sextets == 0) {
+            size_t consumed = 0;
+            size_t produced = 0;
+            DecodeBlocks(src + i, length - i, dst + written, table, consumed, produced);
+            i += consumed;
+            written += produced;
+            // 标量快路径：连续 4 个合法字符一次查表拼出 3 字节
+            for (; i + 4 <= length; i += 4) {
+                uint32_t d0 = table.decode[src[i]];
+                uint32_t d1 = table.decode[src[i + 1]];
+                uint32_t d2 = table.decode[src[i + 2]];
+                uint32_t d3 = table.decode[src[i + 3]];
+                if ((d0 | d1 | d2 | d3) >= 64) {
+                    break;
+                }
+                uint32_t v = (d0 << 18) | (d1 << 12) | (d2 << 6) | d3;
+                dst[written++] = static_cast<uint8_t>(v >> 16);
+                dst[written++] = static_cast<uint8_t>(v >> 8);
+                dst[written++] = static_cast<uint8_t>(v);
+            }
+            if (i >= length) {
+                break;
+            }
+        }
+        uint8_t d = table.decode[src[i]];
+        if (d == kDecodeWhitespace) {
+            i++;
+            continue;
+        }
+        if (d == kDecodeInvalid) {
+            break;
         }
+        val = (val << 6) | d;
+        sextets++;
+        i++;
+        if (sextets == 4) {
+            dst[written++] = static_cast<uint8_t>(val >> 16);
+            dst[written++] = static_cast<uint8_t>(val >> 8);
+            dst[written++] = static_cast<uint8_t>(val);
+            val = 0;
+            sextets = 0;
+        }
+    }
+    if (sextets == 2) {
+        dst[written++] = static_cast<uint8_t>(val >> 4);
+    } else if (sextets == 3) {
+        dst[written++] = static_cast<uint8_t>(val >> 10);
+        dst[written++] = static_cast<uint8_t>(val >> 2);
     }
-    if (valb > -6)
-        out.push_back(base64_chars[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (out.size() % 4)
-        out.push_back('=');
+    out.resize(written);
     return out;
 }
 
 std::string KRBase64Util::Decode(const std::string &data) {
     return KRBase64Util::Decode(std::string_view(data));
 }
+
+std::string KRBase64Util::HexEncode(const void *data, size_t length, bool upper_case) {
+    const char *digits = upper_case ? HEX_DIGITS_URI : HEX_DIGITS;
+    const auto *src = static_cast<const uint8_t *>(data);
+    std::string out;
+    out.resize(length * 2);
+    for (size_t i = 0; i < length; i++) {
+        out[i * 2] = digits[src[i] >> 4];
+        out[i * 2 + 1] = digits[src[i] & 0x0F];
+    }
+    return out;
+}
@@ -16,14 +16,38 @@
 #ifndef CORE_RENDER_OHOS_KRBASE64UTIL_H
 #define CORE_RENDER_OHOS_KRBASE64UTIL_H
 
+#include <cstddef>
 #include <string>
 #include <string_view>
+
+/**
+ * base64 / hex 编解码。
+ * 大块数据走 SIMD 路径（arm64 NEON，x86 SSSE3/AVX2，按编译目标选择），其余情况走查表的标量实现，结果完全一致。
+ */
 class KRBase64Util {
  public:
-    static std::string Encode(std::string_view data);
+    enum class Alphabet {
+        kStandard,  // RFC 4648 §4，使用 '+' '/'
+        kUrlSafe,   // RFC 4648 §5，使用 '-' '_'
+    };
+
+    /**
+     * base64 编码
+     * @param padding 是否用 '=' 补齐到 4 的倍数，URL-safe 场景通常不补齐
+     */
+    static std::string Encode(std::string_view data, Alphabet alphabet = Alphabet::kStandard, bool padding = true);
     static std::string Encode(const std::string &data);
-    static std::string Decode(std::string_view data);
+
+    /**
+     * base64 解码。忽略空白字符（空格、\t、\r、\n），遇到 '=' 或非法字符时停止，返回此前已解码的部分。
+     */
+    static std::string Decode(std::string_view data, Alphabet alphabet = Alphabet::kStandard);
     static std::string Decode(const std::string &data);
+
+    /**
+     * 十六进制编码，默认小写
+     */
+    static std::string HexEncode(const void *data, size_t length, bool upper_case = false);
 };
 
 #endif  // CORE_RENDER_OHOS_KRBASE64UTIL_H
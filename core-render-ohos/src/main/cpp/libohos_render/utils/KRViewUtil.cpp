@@ -100,8 +100,13 @@ void SetNodeAnimation(std::weak_ptr<IKRRenderViewExport> view, std::string *anim
         return;
     }
 
-    // 新增动画
-    auto animation = std::make_shared<KRNodeAnimation>(animationStr->c_str(), view);
+    // 新增动画，相同配置字符串只解析一次
+    auto spec = KRNodeAnimationSpecCache::GetInstance().Intern(*animationStr);
+    if (spec == nullptr) {
+        KR_LOG_ERROR << "[KRAnimation] invalid animation:" << *animationStr;
+        return;
+    }
+    auto animation = std::make_shared<KRNodeAnimation>(spec, view);
     animation->onAnimationEndCallback = [view](std::shared_ptr<IKRNodeAnimation> animation, bool finished,
                                                const std::string &propKey, const std::string &animationKey) {
         auto strongView = view.lock();
@@ -133,33 +138,53 @@ ArkUINativeNodeAPI *ArkUINativeNodeAPI::GetInstance() {
 void ArkUINativeNodeAPI::unregisterNodeCreatedFromArkTS(ArkUI_NodeHandle node) {
     KREnsureMainThread();
 #if KUIKLY_ENABLE_ARKUI_NODE_VALID_CHECK
-    {
-        std::lock_guard<std::mutex> guard(mutex_);
-        nodesAlive_.erase(node);
-    }
+    nodesAlive_.Remove(node);
 #endif
 }
 
 void ArkUINativeNodeAPI::registerNodeCreatedFromArkTS(ArkUI_NodeHandle node) {
     KREnsureMainThread();
 #if KUIKLY_ENABLE_ARKUI_NODE_VALID_CHECK
-    {
-        std::lock_guard<std::mutex> guard(mutex_);
-        nodesAlive_.emplace(node);
-    }
+    nodesAlive_.Add(node);
 #endif
 }
 #if KUIKLY_ENABLE_ARKUI_NODE_VALID_CHECK
 bool ArkUINativeNodeAPI::IsNodeAlive(ArkUI_NodeHandle node) {
     KREnsureMainThread();
+    return nodesAlive_.Contains(node);
+}
+
+KRNodeId ArkUINativeNodeAPI::GetNodeId(ArkUI_NodeHandle node) {
+    KREnsureMainThread();
+    return nodesAlive_.IdOf(node);
+}
+
+bool ArkUINativeNodeAPI::IsNodeIdAlive(KRNodeId id) {
+    KREnsureMainThread();
+    return nodesAlive_.IsAlive(id);
+}
+
+void ArkUINativeNodeAPI::SetNodeCheckSampleInterval(uint32_t interval) {
+    KREnsureMainThread();
+    nodeCheckSampleInterval_ = interval > 0 ? interval : 1;
+}
 
-    std::lock_guard<std::mutex> guard(mutex_);
-    return nodesAlive_.find(node) != nodesAlive_.end();
+bool ArkUINativeNodeAPI::CheckNodeBeforeCall(ArkUI_NodeHandle node) {
+    if (nodeCheckSampleInterval_ > 1 && ++nodeCheckTick_ % nodeCheckSampleInterval_ != 0) {
+        nodeCheckStats_.skipped++;
+        return true;
+    }
+    nodeCheckStats_.checks++;
+    if (nodesAlive_.Contains(node)) {
+        return true;
+    }
+    nodeCheckStats_.failures++;
+    return false;
 }
 
 #define KUIKLY_CHECK_NODE_OR_RETURN(NODE)                                                                              \
     do {                                                                                                               \
-        if (!IsNodeAlive(NODE)) {                                                                                      \
+        if (!CheckNodeBeforeCall(NODE)) {                                                                              \
             KR_LOG_ERROR << "Node DEAD";                                                                               \
             assert(false);                                                                                             \
             return;                                                                                                    \
@@ -169,7 +194,7 @@ bool ArkUINativeNodeAPI::IsNodeAlive(ArkUI_NodeHandle node) {
 
 #define KUIKLY_CHECK_NODE_OR_RETURN_ERROR(NODE)                                                                        \
     do {                                                                                                               \
-        if (!IsNodeAlive(NODE)) {                                                                                      \
+        if (!CheckNodeBeforeCall(NODE)) {                                                                              \
             KR_LOG_ERROR << "Node DEAD";                                                                               \
             assert(false);                                                                                             \
             return ARKUI_ERROR_CODE_PARAM_INVALID;                                                                     \
@@ -179,7 +204,7 @@ bool ArkUINativeNodeAPI::IsNodeAlive(ArkUI_NodeHandle node) {
 
 #define KUIKLY_CHECK_NODE_OR_RETURN_NULL(NODE)                                                                         \
     do {                                                                                                               \
-        if (!IsNodeAlive(NODE)) {                                                                                      \
+        if (!CheckNodeBeforeCall(NODE)) {                                                                              \
             KR_LOG_ERROR << "Node DEAD";                                                                               \
             assert(false);                                                                                             \
             return nullptr;                                                                                            \
@@ -189,7 +214,7 @@ bool ArkUINativeNodeAPI::IsNodeAlive(ArkUI_NodeHandle node) {
 
 #define KUIKLY_CHECK_NODE_OR_RETURN_ZERO(NODE)                                                                         \
     do {                                                                                                               \
-        if (!IsNodeAlive(NODE)) {                                                                                      \
+        if (!CheckNodeBeforeCall(NODE)) {                                                                              \
             KR_LOG_ERROR << "Node DEAD";                                                                               \
             assert(false);                                                                                             \
             return 0;                                                                                                  \
@@ -209,10 +234,7 @@ ArkUI_NodeHandle ArkUINativeNodeAPI::createNode(ArkUI_NodeType type) {
     KREnsureMainThread();
     ArkUI_NodeHandle node = impl_->createNode(type);
 #if KUIKLY_ENABLE_ARKUI_NODE_VALID_CHECK
-    {
-        std::lock_guard<std::mutex> guard(mutex_);
-        nodesAlive_.emplace(node);
-    }
+    nodesAlive_.Add(node);
 #endif
 
     return node;
@@ -221,12 +243,8 @@ ArkUI_NodeHandle ArkUINativeNodeAPI::createNode(ArkUI_NodeType type) {
 void ArkUINativeNodeAPI::disposeNode(ArkUI_NodeHandle node) {
     KREnsureMainThread();
 #if KUIKLY_ENABLE_ARKUI_NODE_VALID_CHECK
-    {
-        std::lock_guard<std::mutex> guard(mutex_);
-        if (nodesAlive_.find(node) == nodesAlive_.end()) {
-            return;
-        }
-        nodesAlive_.erase(node);
+    if (!nodesAlive_.Remove(node)) {
+        return;
     }
 #endif
     impl_->disposeNode(node);
@@ -33,6 +33,7 @@
 #include "libohos_render/expand/components/base/animation/KRNodeAnimation.h"
 // #include "libohos_render/expand/components/forward/KRForwardArkTSView.h"
 #include "libohos_render/foundation/KRBorderRadiuses.h"
+#include "libohos_render/foundation/KRNodeLivenessTable.h"
 #include "libohos_render/foundation/KRPoint.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/foundation/KRSize.h"
@@ -84,7 +85,26 @@ class ArkUINativeNodeAPI {
     int32_t removeNodeCustomEventReceiver(ArkUI_NodeHandle node, void (*eventReceiver)(ArkUI_NodeCustomEvent *event));
     static ArkUINativeNodeAPI *GetInstance();
 #if KUIKLY_ENABLE_ARKUI_NODE_VALID_CHECK
+    /** 精确校验节点是否存活（不受采样影响） */
     bool IsNodeAlive(ArkUI_NodeHandle node);
+    /** 节点的带代数ID，节点销毁后ID失效，可供异步回调持有后用 IsNodeIdAlive 校验 */
+    KRNodeId GetNodeId(ArkUI_NodeHandle node);
+    bool IsNodeIdAlive(KRNodeId id);
+
+    /** 节点操作前存活校验的统计 */
+    struct NodeCheckStats {
+        uint64_t checks = 0;    // 实际校验次数
+        uint64_t skipped = 0;   // 因采样跳过的次数
+        uint64_t failures = 0;  // 拦截到的已销毁节点调用
+    };
+    /**
+     * 节点操作（setAttribute / addChild 等）每 interval 次校验一次，默认 1 即每次都校验；
+     * disposeNode 与显式的 IsNodeAlive 总是校验
+     */
+    void SetNodeCheckSampleInterval(uint32_t interval);
+    NodeCheckStats GetNodeCheckStats() const {
+        return nodeCheckStats_;
+    }
 #endif
     
  private:
@@ -95,8 +115,12 @@ class ArkUINativeNodeAPI {
     void unregisterNodeCreatedFromArkTS(ArkUI_NodeHandle node);
     void registerNodeCreatedFromArkTS(ArkUI_NodeHandle node);
 #if KUIKLY_ENABLE_ARKUI_NODE_VALID_CHECK
-    std::unordered_set<ArkUI_NodeHandle> nodesAlive_;
-    std::mutex mutex_;
+    bool CheckNodeBeforeCall(ArkUI_NodeHandle node);
+    // 节点接口只允许在主线程调用，存活表同样归主线程所有，无需加锁
+    KRNodeLivenessTable nodesAlive_;
+    uint32_t nodeCheckSampleInterval_ = 1;
+    uint32_t nodeCheckTick_ = 0;
+    NodeCheckStats nodeCheckStats_;
 #endif
 };
 
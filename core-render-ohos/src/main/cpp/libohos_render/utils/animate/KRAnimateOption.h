@@ -17,6 +17,31 @@
 #define CORE_RENDER_OHOS_KRANIMATEOPTION_H
 
 #include <arkui/native_animate.h>
+#include <memory>
+
+/**
+ * 自定义动画曲线句柄，析构时释放。可被多个 KRAnimateOption 共享
+ */
+class KRAnimateCurve {
+ public:
+    explicit KRAnimateCurve(ArkUI_CurveHandle handle) : handle_(handle) {}
+
+    KRAnimateCurve(const KRAnimateCurve &) = delete;
+    KRAnimateCurve &operator=(const KRAnimateCurve &) = delete;
+
+    ArkUI_CurveHandle Get() const {
+        return handle_;
+    }
+
+    ~KRAnimateCurve() {
+        if (handle_) {
+            OH_ArkUI_Curve_DisposeCurve(handle_);
+        }
+    }
+
+ private:
+    ArkUI_CurveHandle handle_ = nullptr;
+};
 
 class KRAnimateOption {
  public:
@@ -40,6 +65,12 @@ class KRAnimateOption {
         OH_ArkUI_AnimateOption_SetICurve(arkui_animate_option_, value);
     }
 
+    // 持有曲线引用，保证 option 存活期间曲线句柄有效
+    void SetSpringCurve(const std::shared_ptr<KRAnimateCurve> &curve) {
+        curve_ = curve;
+        SetSpringCurve(curve ? curve->Get() : nullptr);
+    }
+
     void SetDelay(int32_t value) {
         OH_ArkUI_AnimateOption_SetDelay(arkui_animate_option_, value);
     }
@@ -66,6 +97,7 @@ class KRAnimateOption {
 
  private:
     ArkUI_AnimateOption *arkui_animate_option_ = nullptr;
+    std::shared_ptr<KRAnimateCurve> curve_;
 };
 
 #endif  // CORE_RENDER_OHOS_KRANIMATEOPTION_H
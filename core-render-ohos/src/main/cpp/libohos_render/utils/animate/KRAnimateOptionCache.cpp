@@ -0,0 +1,107 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/animate/KRAnimateOptionCache.h"
+
+#include <cstring>
+#include "libohos_render/utils/KRThreadChecker.h"
+
+namespace {
+
+constexpr int32_t kSpringCurveTag = -1;
+// mass 0.2 / stiffness 1.2 调参对齐iOS 、Android
+constexpr float kSpringMass = 0.2f;
+constexpr float kSpringStiffness = 1.2f;
+
+uint32_t FloatBits(float value) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+}  // namespace
+
+KRAnimateOptionCache &KRAnimateOptionCache::GetInstance() {
+    static KRAnimateOptionCache instance;
+    return instance;
+}
+
+size_t KRAnimateOptionCache::OptionKeyHash::operator()(const OptionKey &key) const {
+    uint64_t h = static_cast<uint32_t>(key.duration_ms);
+    h = h * 0x9E3779B97F4A7C15ULL + static_cast<uint32_t>(key.delay_ms);
+    h = h * 0x9E3779B97F4A7C15ULL + static_cast<uint32_t>(key.iterations);
+    h = h * 0x9E3779B97F4A7C15ULL + static_cast<uint32_t>(key.curve);
+    h = h * 0x9E3779B97F4A7C15ULL + key.velocity_bits;
+    h = h * 0x9E3779B97F4A7C15ULL + key.damping_bits;
+    return static_cast<size_t>(h ^ (h >> 32));
+}
+
+std::shared_ptr<KRAnimateOption> KRAnimateOptionCache::GetPlainOption(int32_t duration_ms, int32_t delay_ms,
+                                                                      int32_t iterations, ArkUI_AnimationCurve curve) {
+    return GetOption({duration_ms, delay_ms, iterations, static_cast<int32_t>(curve), 0, 0}, 0, 0);
+}
+
+std::shared_ptr<KRAnimateOption> KRAnimateOptionCache::GetSpringOption(int32_t duration_ms, int32_t delay_ms,
+                                                                       int32_t iterations, float velocity,
+                                                                       float damping) {
+    return GetOption({duration_ms, delay_ms, iterations, kSpringCurveTag, FloatBits(velocity), FloatBits(damping)},
+                     velocity, damping);
+}
+
+std::shared_ptr<KRAnimateCurve> KRAnimateOptionCache::GetSpringCurve(float velocity, float damping) {
+    KREnsureMainThread();
+    uint64_t key = (static_cast<uint64_t>(FloatBits(velocity)) << 32) | FloatBits(damping);
+    auto it = spring_curves_.find(key);
+    if (it != spring_curves_.end()) {
+        return it->second;
+    }
+    if (spring_curves_.size() >= kMaxEntries) {
+        spring_curves_.clear();
+    }
+    auto curve = std::make_shared<KRAnimateCurve>(
+        OH_ArkUI_Curve_CreateSpringCurve(velocity, kSpringMass, kSpringStiffness, damping));
+    spring_curves_.emplace(key, curve);
+    return curve;
+}
+
+void KRAnimateOptionCache::Clear() {
+    options_.clear();
+    spring_curves_.clear();
+}
+
+std::shared_ptr<KRAnimateOption> KRAnimateOptionCache::GetOption(const OptionKey &key, float velocity,
+                                                                 float damping) {
+    KREnsureMainThread();
+    auto it = options_.find(key);
+    if (it != options_.end()) {
+        return it->second;
+    }
+    if (options_.size() >= kMaxEntries) {
+        options_.clear();
+    }
+    auto option = std::make_shared<KRAnimateOption>();
+    option->SetDuration(key.duration_ms);
+    option->SetDelay(key.delay_ms);
+    option->SetPlayMode(ARKUI_ANIMATION_PLAY_MODE_NORMAL);
+    option->SetTempo(1.0f);
+    option->SetIterations(key.iterations);
+    if (key.curve == kSpringCurveTag) {
+        option->SetSpringCurve(GetSpringCurve(velocity, damping));
+    } else {
+        option->SetCurve(static_cast<ArkUI_AnimationCurve>(key.curve));
+    }
+    options_.emplace(key, option);
+    return option;
+}
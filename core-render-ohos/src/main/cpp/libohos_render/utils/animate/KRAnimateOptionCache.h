@@ -0,0 +1,82 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRANIMATEOPTIONCACHE_H
+#define CORE_RENDER_OHOS_KRANIMATEOPTIONCACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include "libohos_render/utils/animate/KRAnimateOption.h"
+
+/**
+ * 按参数缓存的动画 option 模板与弹簧曲线句柄，跨 view 共享。
+ * 返回的 option 视为只读，调用方不可再修改；animateTo 调用时会拷贝 option 内容，因此可同时被多个动画使用。
+ * 只在主线程访问；超过容量时整体清空，已被动画持有的 option / 曲线随最后一个引用释放。
+ */
+class KRAnimateOptionCache {
+ public:
+    static KRAnimateOptionCache &GetInstance();
+
+    /**
+     * 普通曲线动画 option
+     */
+    std::shared_ptr<KRAnimateOption> GetPlainOption(int32_t duration_ms, int32_t delay_ms, int32_t iterations,
+                                                    ArkUI_AnimationCurve curve);
+
+    /**
+     * 弹簧曲线动画 option，曲线句柄复用 GetSpringCurve
+     */
+    std::shared_ptr<KRAnimateOption> GetSpringOption(int32_t duration_ms, int32_t delay_ms, int32_t iterations,
+                                                     float velocity, float damping);
+
+    /**
+     * 弹簧曲线句柄，mass / stiffness 与 iOS、Android 对齐
+     */
+    std::shared_ptr<KRAnimateCurve> GetSpringCurve(float velocity, float damping);
+
+    void Clear();
+
+    static constexpr size_t kMaxEntries = 64;
+
+ private:
+    struct OptionKey {
+        int32_t duration_ms;
+        int32_t delay_ms;
+        int32_t iterations;
+        int32_t curve;  // 普通曲线为 ArkUI_AnimationCurve，弹簧曲线为 -1
+        uint32_t velocity_bits;
+        uint32_t damping_bits;
+
+        bool operator==(const OptionKey &other) const {
+            return duration_ms == other.duration_ms && delay_ms == other.delay_ms &&
+                   iterations == other.iterations && curve == other.curve &&
+                   velocity_bits == other.velocity_bits && damping_bits == other.damping_bits;
+        }
+    };
+
+    struct OptionKeyHash {
+        size_t operator()(const OptionKey &key) const;
+    };
+
+    KRAnimateOptionCache() = default;
+
+    std::shared_ptr<KRAnimateOption> GetOption(const OptionKey &key, float velocity, float damping);
+
+    std::unordered_map<OptionKey, std::shared_ptr<KRAnimateOption>, OptionKeyHash> options_;
+    std::unordered_map<uint64_t, std::shared_ptr<KRAnimateCurve>> spring_curves_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRANIMATEOPTIONCACHE_H
@@ -80,6 +80,18 @@ class IKRRenderView : public std::enable_shared_from_this<IKRRenderView> {
      */
     virtual void AddContentView(const std::shared_ptr<IKRRenderViewExport> contentView, int index) = 0;
 
+    /**
+     * 添加首帧回放出来的内容View，不触发首帧事件
+     * @param contentView
+     */
+    virtual void AddReplayedContentView(const std::shared_ptr<IKRRenderViewExport> contentView) {}
+
+    /**
+     * 移除内容View
+     * @param contentView
+     */
+    virtual void RemoveContentView(const std::shared_ptr<IKRRenderViewExport> contentView) {}
+
     /**
      * 添加任务到主线程中执行，注意在context线程中调用
      */
@@ -29,35 +29,20 @@ static constexpr char KR_PERFORMANCE_MODULE[] = "KRPerformanceModule";
 static constexpr char NOTIFY_INIT_STATE[] = "notifyInitState";
 
 const unsigned int LOG_PRINT_DOMAIN = 0xFF01;
-static std::string GetIncreaseCallbackId() {
-    static int gCallbackId = 0;
-    gCallbackId++;
-    return NewKRRenderValue(gCallbackId)->toString();
-}
-
 KRRenderView::KRRenderView(ArkUI_NodeContentHandle handle, std::string instance_id) : IKRRenderView(), node_content_handle_((handle)) {
-    unsigned long long id_value = std::atoi(instance_id.c_str());
-    OH_ArkUI_NodeContent_SetUserData(handle, (void*)id_value);
+    // userData 为 KRRenderManager 分配的句柄，注册成功后由 KRRenderManager 设置
     auto cb = [](ArkUI_NodeContentEvent* event){
         auto event_type = OH_ArkUI_NodeContentEvent_GetEventType(event);
         auto handle = OH_ArkUI_NodeContentEvent_GetNodeContentHandle(event);
         void *user_data = OH_ArkUI_NodeContent_GetUserData(handle);
-        unsigned long long id_value = (unsigned long long)user_data;
-        std::string instance_id = std::to_string(id_value);
+        auto render_view = KRRenderManager::GetInstance().GetRenderView(KRHandleFromPointer(user_data));
+        if (!render_view) {
+            return;
+        }
         if(event_type == NODE_CONTENT_EVENT_ON_DETACH_FROM_WINDOW){
-            if (auto instance = KRRenderManager::GetInstance().GetRenderView(instance_id)) {
-                std::shared_ptr<KRRenderView> render_view = std::dynamic_pointer_cast<KRRenderView>(instance);
-                if(render_view){
-                    render_view->OnDetachFromWindow();
-                }
-            }
+            render_view->OnDetachFromWindow();
         } else if(event_type == NODE_CONTENT_EVENT_ON_ATTACH_TO_WINDOW){
-            if (auto instance = KRRenderManager::GetInstance().GetRenderView(instance_id)) {
-                std::shared_ptr<KRRenderView> render_view = std::dynamic_pointer_cast<KRRenderView>(instance);
-                if(render_view){
-                    render_view->OnAttachToWindow(handle);
-                }
-            }
+            render_view->OnAttachToWindow(handle);
         }
     };
     OH_ArkUI_NodeContent_RegisterCallback(handle, cb);
@@ -78,7 +63,7 @@ KRRenderView::~KRRenderView() {
     }
     node_content_handle_ = nullptr;
     native_resources_manager_ = nullptr;
-    method_arg_callback_map_.clear();
+    method_arg_callback_table_.Clear();
 }
 
 void KRRenderView::RemoveRootViewFromContentHandle(bool immediate){
@@ -136,14 +121,23 @@ void KRRenderView::SendEvent(std::string event_name, const std::string &json_dat
 void KRRenderView::SendEvent(std::string event_name, const std::string &json_data, bool sync) {
     if (core_) {
         if (event_name == "viewDidAppear") {
-            DispatchInitState(KRInitState::kStateResume);
+            SetPageVisible(true);
         } else if (event_name == "viewDidDisappear") {
-            DispatchInitState(KRInitState::kStatePause);
+            SetPageVisible(false);
         }
         return core_->SendEvent(event_name, json_data, sync);
     }
 }
 
+void KRRenderView::SetPageVisible(bool visible) {
+    page_visible_ = visible;
+    DispatchInitState(visible ? KRInitState::kStateResume : KRInitState::kStatePause);
+    if (core_) {
+        // 先于可见性事件投递，保证积攒的操作排在页面可见后的更新之前
+        core_->SetPageVisible(visible);
+    }
+}
+
 bool KRRenderView::syncSendEvent(const std::string &event_name) {
     // 与 ETS 侧常量保持一致：'onBackPressed'
     if (event_name == "onBackPressed") {
@@ -201,6 +195,20 @@ void KRRenderView::AddContentView(const std::shared_ptr<IKRRenderViewExport> con
     }
 }
 
+void KRRenderView::AddReplayedContentView(const std::shared_ptr<IKRRenderViewExport> contentView) {
+    if (root_node_ == nullptr) {
+        return;
+    }
+    kuikly::util::GetNodeApi()->addChild(root_node_, contentView->GetNode());
+}
+
+void KRRenderView::RemoveContentView(const std::shared_ptr<IKRRenderViewExport> contentView) {
+    if (root_node_ == nullptr) {
+        return;
+    }
+    kuikly::util::GetNodeApi()->removeChild(root_node_, contentView->GetNode());
+}
+
 /**
  * 添加任务到主线程队列中，注意：调用接口所在线程须是context线程
  * @param task
@@ -302,29 +310,33 @@ void KRRenderView::InitRender(float width, float height) {
 
 /**
  * 注册参数Callback
- * @return 该Callback索引ID, 用于GetArgCallback
+ * @return 该Callback索引ID, 用于GetArgCallback；槽位耗尽时返回0（ArkTS侧不会回调）
  */
-std::string KRRenderView::GenerateArgCallbackId(const KRRenderCallback &callback, bool callback_keep_alive,
-                                                bool arg_prefer_raw_napi_value) {
-    auto callback_id = GetIncreaseCallbackId();
-    method_arg_callback_map_[callback_id] =
-        std::make_shared<KRArkTsCallbackWrapper>(callback, callback_keep_alive, arg_prefer_raw_napi_value);
+int32_t KRRenderView::GenerateArgCallbackId(const KRRenderCallback &callback, bool callback_keep_alive,
+                                            bool arg_prefer_raw_napi_value) {
+    auto callback_id = method_arg_callback_table_.Insert(
+        KRArkTsCallbackWrapper(callback, callback_keep_alive, arg_prefer_raw_napi_value));
+    if (callback_id == 0) {
+        // 同时存活的回调超过槽位上限，通常是 keepAlive 回调未释放
+        KR_LOG_ERROR << "GenerateArgCallbackId failed, callback table is full, instanceId: "
+                     << (context_ ? context_->InstanceId() : "") << ", size: " << method_arg_callback_table_.Size();
+    }
     return callback_id;
 }
 
 /**
  * 根据callbackid获取Callback
  */
-KRRenderCallback KRRenderView::GetArgCallback(std::string callbackId, bool &arg_prefer_raw_napi_value) {
-    if (method_arg_callback_map_.find(callbackId) != method_arg_callback_map_.end()) {
-        auto callback_wrapper = method_arg_callback_map_[callbackId];
-        if (!callback_wrapper->IsKeepAlive()) {
-            method_arg_callback_map_.erase(callbackId);
-        }
-        arg_prefer_raw_napi_value = callback_wrapper->ArgPrefersRawNapiValue();
-        return callback_wrapper->GetCallback();
+KRRenderCallback KRRenderView::GetArgCallback(int32_t callbackId, bool &arg_prefer_raw_napi_value) {
+    KRArkTsCallbackWrapper callback_wrapper;
+    // 非 keepAlive 的回调只会被调用一次，取出即删除
+    if (!method_arg_callback_table_.TakeIf(
+            callbackId, [](const KRArkTsCallbackWrapper &wrapper) { return !wrapper.IsKeepAlive(); },
+            callback_wrapper)) {
+        return nullptr;
     }
-    return nullptr;
+    arg_prefer_raw_napi_value = callback_wrapper.ArgPrefersRawNapiValue();
+    return callback_wrapper.GetCallback();
 }
 
 void KRRenderView::OnFirstFramePaint() {
@@ -22,6 +22,7 @@
 #include "libohos_render/context/KRRenderContextParams.h"
 #include "libohos_render/core/KRRenderCore.h"
 #include "libohos_render/foundation/KRCallbackData.h"
+#include "libohos_render/foundation/KRSlotTable.h"
 #include "libohos_render/manager/KRSnapshotManager.h"
 #include "libohos_render/performance/KRPerformanceManager.h"
 #include "libohos_render/scheduler/IKRScheduler.h"
@@ -49,6 +50,16 @@ class KRRenderView : public IKRRenderView {
      */
     bool syncSendEvent(const std::string &event_name) override;
 
+    /**
+     * 设置页面可见性，viewDidAppear/viewDidDisappear 事件下发前调用
+     * @param visible 是否可见
+     */
+    void SetPageVisible(bool visible);
+
+    bool IsPageVisible() const {
+        return page_visible_;
+    }
+
     /**
      * 获取渲染节点视图（要求在主线程调用）
      * @param tag 所在tag
@@ -74,6 +85,8 @@ class KRRenderView : public IKRRenderView {
     std::shared_ptr<IKRRenderModuleExport> GetModuleOrCreate(const std::string &module_name) override;
 
     void AddContentView(const std::shared_ptr<IKRRenderViewExport> contentView, int index) override;
+    void AddReplayedContentView(const std::shared_ptr<IKRRenderViewExport> contentView) override;
+    void RemoveContentView(const std::shared_ptr<IKRRenderViewExport> contentView) override;
     /**
      * 添加任务到主线程队列中，注意：调用接口所在线程须是context线程
      * @param task
@@ -117,13 +130,13 @@ class KRRenderView : public IKRRenderView {
      * 根据Callback生成callback_id
      * @return 该Callback索引ID, 用于GetArgCallback
      */
-    std::string GenerateArgCallbackId(const KRRenderCallback &callback, bool callback_keep_alive,
-                                      bool arg_prefer_raw_napi_value);
+    int32_t GenerateArgCallbackId(const KRRenderCallback &callback, bool callback_keep_alive,
+                                  bool arg_prefer_raw_napi_value);
 
     /**
-     * 根据callbackid获取Callback
+     * 根据callbackid获取Callback，非keep alive的Callback取出后即删除
      */
-    KRRenderCallback GetArgCallback(std::string callbackId, bool &arg_prefer_raw_napi_value);
+    KRRenderCallback GetArgCallback(int32_t callbackId, bool &arg_prefer_raw_napi_value);
 
     /**
      * 派发页面加载初始化事件
@@ -133,6 +146,7 @@ class KRRenderView : public IKRRenderView {
 
     class KRArkTsCallbackWrapper {
      public:
+        KRArkTsCallbackWrapper() = default;
         KRArkTsCallbackWrapper(const KRRenderCallback &callback, bool callback_keep_alive,
                                bool arg_prefers_raw_napi_value)
             : callback_keep_alive_(callback_keep_alive), callback_(callback),
@@ -151,8 +165,8 @@ class KRRenderView : public IKRRenderView {
         }
 
      private:
-        bool callback_keep_alive_;
-        bool arg_prefers_raw_napi_value_;
+        bool callback_keep_alive_ = false;
+        bool arg_prefers_raw_napi_value_ = false;
         KRRenderCallback callback_;
     };
 
@@ -167,11 +181,12 @@ class KRRenderView : public IKRRenderView {
     NativeResourceManager *native_resources_manager_;
     std::shared_ptr<KRRenderCore> core_;
     // Callback管理索引表
-    std::unordered_map<std::string, std::shared_ptr<KRArkTsCallbackWrapper>> method_arg_callback_map_;
+    KRSlotTable<KRArkTsCallbackWrapper> method_arg_callback_table_;
     KRSnapshotManager snapshot_manager_;
     std::shared_ptr<KRPerformanceManager> performance_manager_ = nullptr;
     bool is_load_finish = false;  //  是否已经初始化过标记
     bool is_detached_ = false;    //  是否因为 detach from window 而移除了 root view
+    bool page_visible_ = true;    //  页面当前是否可见
     void InitRender(float width, float height);
 };
 
@@ -15,11 +15,13 @@
 #include <ark_runtime/jsvm.h>
 #include <arkui/native_node_napi.h>
 #include <cstdint>
+#include "libohos_render/context/KRCallNativeRecorder.h"
 #include "libohos_render/expand/modules/back_press/KRBackPressModule.h"
 #include "libohos_render/foundation/KRCallbackData.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/manager/KRArkTSManager.h"
 #include "libohos_render/manager/KRRenderManager.h"
+#include "libohos_render/manager/KRSnapshotManager.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/NAPIUtil.h"
 #include "napi/native_api.h"
@@ -218,6 +220,59 @@ static napi_value isBackPressConsumed(napi_env env, napi_callback_info info) {
     return result;
 }
 
+// 开始录制 CallNative 轨迹
+static napi_value StartCallNativeRecording(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1] = {nullptr};
+    if (napi_ok != napi_get_cb_info(env, info, &argc, args, nullptr, nullptr)) {
+        napi_throw_error(env, "-1000", "napi_get_cb_info error");
+        return 0;
+    }
+    bool started = KRCallNativeRecorder::GetInstance().Start(kuikly::util::getNApiArgsStdString(env, args[0]));
+    napi_value result = nullptr;
+    napi_get_boolean(env, started, &result);
+    return result;
+}
+
+// 结束录制 CallNative 轨迹
+static napi_value StopCallNativeRecording(napi_env env, napi_callback_info info) {
+    KRCallNativeRecorder::GetInstance().Stop();
+    return 0;
+}
+
+// 回放 CallNative 轨迹到回放宿主页面，结果输出到日志
+static napi_value ReplayCallNative(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4] = {nullptr};
+    if (napi_ok != napi_get_cb_info(env, info, &argc, args, nullptr, nullptr)) {
+        napi_throw_error(env, "-1000", "napi_get_cb_info error");
+        return 0;
+    }
+    std::string path = kuikly::util::getNApiArgsStdString(env, args[0]);
+    std::string instance_id = kuikly::util::getNApiArgsStdString(env, args[1]);
+    bool realtime = kuikly::util::getNApiArgsBool(env, args[2]);
+    std::string source_instance_id = kuikly::util::getNApiArgsStdString(env, args[3]);
+    bool started = KRCallNativeReplayer::Replay(path, instance_id, source_instance_id, realtime, nullptr);
+    napi_value result = nullptr;
+    napi_get_boolean(env, started, &result);
+    return result;
+}
+
+// 设置 cacheKey 快照的内存预算（字节）
+static napi_value SetSnapshotCacheBudget(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1] = {nullptr};
+    if (napi_ok != napi_get_cb_info(env, info, &argc, args, nullptr, nullptr)) {
+        napi_throw_error(env, "-1000", "napi_get_cb_info error");
+        return 0;
+    }
+    int64_t budget_bytes = kuikly::util::getNApiArgsInt64(env, args[0]);
+    if (budget_bytes >= 0) {
+        KRSnapshotManager::SetMemoryBudget(static_cast<size_t>(budget_bytes));
+    }
+    return 0;
+}
+
 EXTERN_C_START
 static napi_value Init(napi_env env, napi_value exports) {
     napi_property_descriptor desc[] = {
@@ -232,10 +287,17 @@ static napi_value Init(napi_env env, napi_value exports) {
         {"OnLaunchStart", nullptr, OnLaunchStart, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"createNativeRoot", nullptr, CreateNativeRoot, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"isBackPressConsumed", nullptr, isBackPressConsumed, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"startCallNativeRecording", nullptr, StartCallNativeRecording, nullptr, nullptr, nullptr, napi_default,
+         nullptr},
+        {"stopCallNativeRecording", nullptr, StopCallNativeRecording, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"replayCallNative", nullptr, ReplayCallNative, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setSnapshotCacheBudget", nullptr, SetSnapshotCacheBudget, nullptr, nullptr, nullptr, napi_default,
+         nullptr},
     };
     napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc);
     KRMainThread::Export(env, exports);                   // 缓存主线程 uv_loop / async 句柄
     KRRenderManager::GetInstance().Export(env, exports);  // 尝试注册RenderView
+    KRCallNativeReplayer::RegisterReplayMode();
     return exports;
 }
 EXTERN_C_END
@@ -23,7 +23,7 @@ type KRValue = number | string | ArrayBuffer | Array<KRAny> | boolean | object
 type KRArray = Array<KRValue | Record<string, KRValue>>
 type KRRecord = Record<string, KRValue | KRArray | Record<string, KRValue | KRArray | Record<string, KRValue>>>
 type KRAny = KRValue | KRArray | KRRecord | null
-export type KRNativeCallback = (instanceId: string, methodId: number, arg0: KRAny, arg1: KRAny, arg2: KRAny, arg3: KRAny, arg4: KRAny, callbackID: string | null) => KRAny | ComponentContent<any>;
+export type KRNativeCallback = (instanceId: string, methodId: number, arg0: KRAny, arg1: KRAny, arg2: KRAny, arg3: KRAny, arg4: KRAny, callbackID: number | null) => KRAny | ComponentContent<any>;
 
 export const onRenderViewSizeChanged: (instanceId: string, width: number, height: number) => number
 export const onDestroyRenderView: (instanceId: string) => number
@@ -79,3 +79,32 @@ export const sendEventSync: (
 export const createNativeRoot: (content: Object, instanceId: string) => void;
 
 export const isBackPressConsumed: (instanceId: string, sendTime: number) => number;
+
+/**
+ * 开始把 Kotlin 侧的 CallNative 调用录制到文件（覆盖已有文件）
+ * @param path 轨迹文件路径
+ * @returns 文件无法创建时返回 false
+ */
+export const startCallNativeRecording: (path: string) => boolean;
+
+/**
+ * 结束 CallNative 录制
+ */
+export const stopCallNativeRecording: () => void;
+
+/**
+ * 在 context 线程回放 CallNative 轨迹，回放统计输出到日志
+ * @param path 轨迹文件路径
+ * @param instanceId 回放宿主页面，必须以 KRCallNativeReplayMode.Replay 创建
+ * @param realtime 是否按录制时的节奏回放，false 时尽可能快
+ * @param sourceInstanceId 回放的录制页面，为空时取轨迹中第一个调用的页面
+ * @returns 轨迹文件无效或宿主页面不是回放模式时返回 false
+ */
+export const replayCallNative: (path: string, instanceId: string, realtime: boolean,
+  sourceInstanceId: string) => boolean;
+
+/**
+ * 设置 cacheKey 类型快照的内存预算（所有页面共享，默认 64MB），超出时按最近最少使用换出
+ * @param budgetBytes 预算字节数
+ */
+export const setSnapshotCacheBudget: (budgetBytes: number) => void;
@@ -0,0 +1,131 @@
+// 在非 arm64 的 host 上用标量代码模拟 KRBase64Util 用到的 NEON intrinsics,
+// 让 NEON 路径的分块/查表/交织逻辑也能在 x86 上与参考实现对比。
+// 只模拟语义, 不代表性能; 由 run_host_tests.sh 以 -DKR_BASE64_NEON_EMULATION 编译引入。
+
+#ifndef CORE_RENDER_OHOS_NEON_EMULATION_H
+#define CORE_RENDER_OHOS_NEON_EMULATION_H
+
+#include <cstdint>
+
+struct uint8x16_t {
+    uint8_t lane[16];
+};
+
+struct uint8x16x3_t {
+    uint8x16_t val[3];
+};
+
+struct uint8x16x4_t {
+    uint8x16_t val[4];
+};
+
+static inline uint8x16_t vdupq_n_u8(uint8_t value) {
+    uint8x16_t r;
+    for (auto &lane : r.lane) {
+        lane = value;
+    }
+    return r;
+}
+
+static inline uint8x16x4_t vld1q_u8_x4(const uint8_t *src) {
+    uint8x16x4_t r;
+    for (int k = 0; k < 4; k++) {
+        for (int j = 0; j < 16; j++) {
+            r.val[k].lane[j] = src[k * 16 + j];
+        }
+    }
+    return r;
+}
+
+// vld3q/vld4q 按通道解交织, vst3q/vst4q 为其逆操作
+static inline uint8x16x3_t vld3q_u8(const uint8_t *src) {
+    uint8x16x3_t r;
+    for (int j = 0; j < 16; j++) {
+        for (int k = 0; k < 3; k++) {
+            r.val[k].lane[j] = src[j * 3 + k];
+        }
+    }
+    return r;
+}
+
+static inline uint8x16x4_t vld4q_u8(const uint8_t *src) {
+    uint8x16x4_t r;
+    for (int j = 0; j < 16; j++) {
+        for (int k = 0; k < 4; k++) {
+            r.val[k].lane[j] = src[j * 4 + k];
+        }
+    }
+    return r;
+}
+
+static inline void vst3q_u8(uint8_t *dst, const uint8x16x3_t &v) {
+    for (int j = 0; j < 16; j++) {
+        for (int k = 0; k < 3; k++) {
+            dst[j * 3 + k] = v.val[k].lane[j];
+        }
+    }
+}
+
+static inline void vst4q_u8(uint8_t *dst, const uint8x16x4_t &v) {
+    for (int j = 0; j < 16; j++) {
+        for (int k = 0; k < 4; k++) {
+            dst[j * 4 + k] = v.val[k].lane[j];
+        }
+    }
+}
+
+// 64 字节查表: 越界下标 vqtbl 得 0, vqtbx 保留原值
+static inline uint8x16_t vqtbx4q_u8(uint8x16_t fallback, const uint8x16x4_t &table, uint8x16_t index) {
+    for (int j = 0; j < 16; j++) {
+        uint8_t i = index.lane[j];
+        if (i < 64) {
+            fallback.lane[j] = table.val[i / 16].lane[i % 16];
+        }
+    }
+    return fallback;
+}
+
+static inline uint8x16_t vqtbl4q_u8(const uint8x16x4_t &table, uint8x16_t index) {
+    return vqtbx4q_u8(vdupq_n_u8(0), table, index);
+}
+
+#define KR_NEON_EMULATION_LANEWISE(name, expr)                  \
+    static inline uint8x16_t name(uint8x16_t a, uint8x16_t b) { \
+        uint8x16_t r;                                           \
+        for (int j = 0; j < 16; j++) {                          \
+            uint8_t x = a.lane[j];                              \
+            uint8_t y = b.lane[j];                              \
+            r.lane[j] = static_cast<uint8_t>(expr);             \
+        }                                                       \
+        return r;                                               \
+    }
+
+KR_NEON_EMULATION_LANEWISE(vorrq_u8, x | y)
+KR_NEON_EMULATION_LANEWISE(vandq_u8, x & y)
+KR_NEON_EMULATION_LANEWISE(vsubq_u8, x - y)
+
+#undef KR_NEON_EMULATION_LANEWISE
+
+static inline uint8x16_t vshlq_n_u8(uint8x16_t a, int n) {
+    for (auto &lane : a.lane) {
+        lane = static_cast<uint8_t>(lane << n);
+    }
+    return a;
+}
+
+static inline uint8x16_t vshrq_n_u8(uint8x16_t a, int n) {
+    for (auto &lane : a.lane) {
+        lane = static_cast<uint8_t>(lane >> n);
+    }
+    return a;
+}
+
+static inline uint8_t vmaxvq_u8(uint8x16_t a) {
+    uint8_t max = 0;
+    for (auto lane : a.lane) {
+        max = lane > max ? lane : max;
+    }
+    return max;
+}
+
+#endif  // CORE_RENDER_OHOS_NEON_EMULATION_H
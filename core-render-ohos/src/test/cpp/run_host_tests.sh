@@ -0,0 +1,130 @@
+#!/usr/bin/env bash
+# 一键编译 + 运行不依赖 OHOS 运行时的 host 单测(直接链接生产代码)
+#
+# 用法:
+#   ./run_host_tests.sh            # 默认 release 构建并运行全部
+#   ./run_host_tests.sh asan       # ASAN/UBSAN 构建并运行
+#
+# 依赖: clang++ 或 g++ (可通过 CXX 环境变量指定)
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+CPP_ROOT="$SCRIPT_DIR/../../main/cpp"
+OUT_DIR="$SCRIPT_DIR/build"
+mkdir -p "$OUT_DIR"
+
+CXX="${CXX:-$(command -v clang++ || command -v g++)}"
+CC="${CC:-$(command -v clang || command -v gcc)}"
+MODE="${1:-release}"
+
+case "$MODE" in
+    release) FLAGS="-O2" ;;
+    asan)    FLAGS="-O1 -g -fsanitize=address,undefined" ;;
+    *)
+        echo "未知模式: $MODE (release|asan)"
+        exit 2
+        ;;
+esac
+
+CJSON_OBJ="$OUT_DIR/cJSON_$MODE.o"
+"$CC" $FLAGS -c "$CPP_ROOT/thirdparty/cJSON/cJSON.c" -o "$CJSON_OBJ"
+
+# build_and_run_variant <test 名> <变体名> <额外编译参数> <生产源文件...>
+build_and_run_variant() {
+    local name="$1"
+    local variant="$2"
+    local extra_flags="$3"
+    shift 3
+    local srcs=()
+    for src in "$@"; do
+        if [[ "$src" == *.c ]]; then
+            # C 源文件用 CC 单独编译, 与生产构建一致
+            local obj="$OUT_DIR/$(basename "$src" .c)_$MODE.o"
+            "$CC" $FLAGS -c "$CPP_ROOT/$src" -o "$obj"
+            srcs+=("$obj")
+        else
+            srcs+=("$CPP_ROOT/$src")
+        fi
+    done
+    local bin="$OUT_DIR/${name}${variant:+_$variant}_$MODE"
+    echo ">>> 编译 $bin"
+    "$CXX" -std=c++17 $FLAGS $extra_flags -Wall -Wextra -pthread -I"$CPP_ROOT" \
+        "$SCRIPT_DIR/$name.cpp" "${srcs[@]}" "$CJSON_OBJ" -o "$bin"
+    echo ">>> 运行 $bin"
+    "$bin"
+}
+
+# build_and_run <test 名> <生产源文件...>
+build_and_run() {
+    local name="$1"
+    shift
+    build_and_run_variant "$name" "" "" "$@"
+}
+
+build_and_run test_frame_histogram \
+    libohos_render/performance/frame/KRFrameHistogram.cpp \
+    libohos_render/performance/frame/KRFrameData.cpp
+
+build_and_run test_move_event_coalescer
+
+build_and_run test_slot_table
+
+build_and_run test_view_op_queue
+
+build_and_run test_gcd_parallel_for
+
+build_and_run test_span_hit_index libohos_render/expand/components/richtext/KRSpanHitIndex.cpp
+
+build_and_run test_render_tree_snapshot \
+    libohos_render/layer/KRRenderTreeSnapshot.cpp \
+    libohos_render/layer/KRRenderTreeReconciler.cpp
+
+build_and_run test_perfect_hash
+
+build_and_run test_handle_table
+
+build_and_run test_node_liveness_table
+
+build_and_run test_slot_id
+
+build_and_run test_external_buffer
+
+build_and_run test_call_native_trace libohos_render/context/KRCallNativeTrace.cpp
+
+build_and_run test_animation_spec
+
+build_and_run test_animation_batch_queue
+
+build_and_run test_styled_span_diff
+
+build_and_run test_scroll_visible_range
+
+build_and_run test_view_flatten_tree libohos_render/layer/KRViewFlattenTree.cpp
+
+build_and_run test_idle_task_queue
+
+build_and_run test_pending_ui_ops libohos_render/scheduler/KRPendingUIOps.cpp
+
+build_and_run test_font_registry_index
+
+build_and_run test_snapshot_cache libohos_render/manager/KRSnapshotLruIndex.cpp
+
+# 默认目标在 x86 上只有 SSE2, 走标量路径; 另外分别编译 SSSE3 / AVX2 路径, 并用模拟的 intrinsics 跑 NEON 路径
+build_and_run test_base64_codec libohos_render/utils/KRBase64Util.cpp
+case "$(uname -m)" in
+    x86_64 | amd64)
+        build_and_run_variant test_base64_codec ssse3 -mssse3 libohos_render/utils/KRBase64Util.cpp
+        if grep -q avx2 /proc/cpuinfo 2>/dev/null; then
+            build_and_run_variant test_base64_codec avx2 -mavx2 libohos_render/utils/KRBase64Util.cpp
+        fi
+        build_and_run_variant test_base64_codec neon_emulated "-DKR_BASE64_NEON_EMULATION -I$SCRIPT_DIR" \
+            libohos_render/utils/KRBase64Util.cpp
+        ;;
+esac
+
+build_and_run test_codec_hash \
+    libohos_render/expand/modules/codec/KRCodec.cpp \
+    libohos_render/expand/modules/codec/md5.c \
+    libohos_render/expand/modules/codec/sha256.c \
+    libohos_render/utils/KRBase64Util.cpp
@@ -0,0 +1,80 @@
+// KRNodeAnimationBatchQueue 的分组须保持动画加入顺序。
+//
+// A. 只与上一组 key 相同时合并, 交替的配置各自成组且顺序不变
+// B. 展开所有分组后的顺序与加入顺序一致(随机序列)
+// C. Contains 只命中同一 view 的同一属性, Take 后清空
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libohos_render/expand/components/base/animation/KRNodeAnimationBatchQueue.h"
+#include "test_common.h"
+
+using Queue = KRNodeAnimationBatchQueue<int, int>;
+
+static std::vector<int> Keys(const std::vector<Queue::Group> &groups) {
+    std::vector<int> keys;
+    for (const auto &group : groups) {
+        keys.push_back(group.key);
+    }
+    return keys;
+}
+
+static void TestGrouping() {
+    int views[4];
+    Queue queue;
+    queue.Push(1, 0, &views[0], "opacity");
+    queue.Push(1, 1, &views[1], "opacity");
+    queue.Push(2, 2, &views[2], "transform");
+    queue.Push(1, 3, &views[3], "opacity");
+    auto groups = queue.Take();
+    CHECK(Keys(groups) == std::vector<int>({1, 2, 1}), "A interleaved keys keep insertion order");
+    CHECK(groups[0].items == std::vector<int>({0, 1}) && groups[1].items == std::vector<int>({2}) &&
+              groups[2].items == std::vector<int>({3}),
+          "A adjacent same key merged");
+}
+
+static void TestRandomOrder() {
+    std::mt19937 rng(42);
+    int views[64];
+    bool ok = true;
+    for (int round = 0; round < 200; round++) {
+        Queue queue;
+        int count = 1 + static_cast<int>(rng() % 64);
+        for (int i = 0; i < count; i++) {
+            queue.Push(static_cast<int>(rng() % 3), i, &views[i], "opacity");
+        }
+        auto groups = queue.Take();
+        std::vector<int> order;
+        for (size_t g = 0; g < groups.size(); g++) {
+            ok = ok && (g == 0 || groups[g].key != groups[g - 1].key);
+            order.insert(order.end(), groups[g].items.begin(), groups[g].items.end());
+        }
+        for (int i = 0; i < count; i++) {
+            ok = ok && i < static_cast<int>(order.size()) && order[i] == i;
+        }
+        ok = ok && static_cast<int>(order.size()) == count;
+    }
+    CHECK(ok, "B flattened groups follow insertion order");
+}
+
+static void TestContains() {
+    int views[2];
+    Queue queue;
+    queue.Push(1, 0, &views[0], "opacity");
+    CHECK(queue.Contains(&views[0], "opacity") && !queue.Contains(&views[0], "transform") &&
+              !queue.Contains(&views[1], "opacity"),
+          "C contains same view and prop only");
+    queue.Take();
+    CHECK(queue.Empty() && !queue.Contains(&views[0], "opacity"), "C take clears pending props");
+}
+
+int main() {
+    std::printf("\n=== Test: KRNodeAnimationBatchQueue ===\n");
+    TestGrouping();
+    TestRandomOrder();
+    TestContains();
+    return TestResult();
+}
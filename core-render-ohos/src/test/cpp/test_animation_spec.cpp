@@ -0,0 +1,136 @@
+// KRNodeAnimationSpec 解析须与原先 ConvertSplit + stoi/stof 的结果逐字段一致;
+// KRNodeAnimationSpecCache 对相同字符串返回同一份配置。
+//
+// A. 完整 8 字段 / 旧版本 5~7 字段
+// B. 字段缺失、空字段、非数字时解析失败而不是抛异常
+// C. 随机配置与原解析方式逐字段对比
+// D. 相同字符串返回同一份配置, 非法字符串不入表
+// E. 超过容量整体清空, 已持有的配置仍有效
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libohos_render/expand/components/base/animation/KRNodeAnimationSpec.h"
+#include "test_common.h"
+
+// 原 KRNodeAnimation::parseAnimation 的实现
+static KRNodeAnimationSpec LegacyParse(const std::string &str) {
+    std::vector<std::string> split;
+    size_t start = 0;
+    size_t end = str.find_first_of(" ");
+    while (end != std::string::npos) {
+        split.push_back(str.substr(start, end - start));
+        start = end + 1;
+        end = str.find_first_of(" ", start);
+    }
+    split.push_back(str.substr(start));
+
+    KRNodeAnimationSpec spec;
+    spec.animationType = std::stoi(split[0]);
+    spec.timingFuncType = std::stoi(split[1]);
+    spec.duration = std::stof(split[2]);
+    spec.damping = std::stof(split[3]);
+    spec.velocity = std::stof(split[4]);
+    if (split.size() > 5) {
+        spec.delay = std::stof(split[5]);
+    }
+    if (split.size() > 6) {
+        spec.repeatForever = std::stoi(split[6]) == 1;
+    }
+    if (split.size() > 7) {
+        spec.animationKey = split[7];
+    }
+    return spec;
+}
+
+static bool SameSpec(const KRNodeAnimationSpec &a, const KRNodeAnimationSpec &b) {
+    return a.animationType == b.animationType && a.timingFuncType == b.timingFuncType && a.duration == b.duration &&
+           a.damping == b.damping && a.velocity == b.velocity && a.delay == b.delay &&
+           a.repeatForever == b.repeatForever && a.animationKey == b.animationKey;
+}
+
+static void TestFields() {
+    KRNodeAnimationSpec spec;
+    bool ok = KRNodeAnimationSpec::Parse("1 2 0.3 0.8 1.5 0.1 1 fadeIn", &spec);
+    CHECK(ok && spec.animationType == 1 && spec.timingFuncType == 2 && spec.duration == 0.3f &&
+              spec.damping == 0.8f && spec.velocity == 1.5f && spec.delay == 0.1f && spec.repeatForever &&
+              spec.animationKey == "fadeIn",
+          "A full spec");
+    ok = KRNodeAnimationSpec::Parse("0 3 0.25 0 0", &spec);
+    CHECK(ok && spec.duration == 0.25f && spec.delay == 0 && !spec.repeatForever && spec.animationKey.empty(),
+          "A legacy five fields");
+    ok = KRNodeAnimationSpec::Parse("0 0 1 0 0 0.5 0", &spec);
+    CHECK(ok && spec.delay == 0.5f && !spec.repeatForever && spec.animationKey.empty(), "A legacy seven fields");
+}
+
+static void TestInvalid() {
+    KRNodeAnimationSpec spec;
+    spec.animationKey = "untouched";
+    CHECK(!KRNodeAnimationSpec::Parse("", &spec), "B empty");
+    CHECK(!KRNodeAnimationSpec::Parse("0 0 1 0", &spec), "B four fields");
+    CHECK(!KRNodeAnimationSpec::Parse("0 0  1 0 0", &spec), "B empty field");
+    CHECK(!KRNodeAnimationSpec::Parse("0 x 1 0 0", &spec), "B not a number");
+    CHECK(!KRNodeAnimationSpec::Parse("0 0 1 0 0 ", &spec), "B trailing space");
+    CHECK(spec.animationKey == "untouched", "B output untouched on failure");
+}
+
+static void TestRandomAgainstLegacy() {
+    std::mt19937 rng(44);
+    bool same = true;
+    for (int i = 0; i < 5000 && same; i++) {
+        std::string str = std::to_string(rng() % 2) + " " + std::to_string(rng() % 4) + " " +
+                          std::to_string((rng() % 3000) / 1000.0) + " " + std::to_string((rng() % 100) / 100.0) +
+                          " " + std::to_string((rng() % 500) / 100.0);
+        int extra = static_cast<int>(rng() % 4);
+        if (extra > 0) {
+            str += " " + std::to_string((rng() % 1000) / 1000.0);
+        }
+        if (extra > 1) {
+            str += " " + std::to_string(rng() % 2);
+        }
+        if (extra > 2) {
+            str += " key" + std::to_string(rng() % 100);
+        }
+        KRNodeAnimationSpec spec;
+        same = KRNodeAnimationSpec::Parse(str, &spec) && SameSpec(spec, LegacyParse(str));
+        if (!same) {
+            std::printf("mismatch: %s\n", str.c_str());
+        }
+    }
+    CHECK(same, "C matches legacy parser");
+}
+
+static void TestIntern() {
+    auto &cache = KRNodeAnimationSpecCache::GetInstance();
+    cache.Clear();
+    auto a = cache.Intern("1 0 0.3 0.8 1 0 0");
+    auto b = cache.Intern(std::string("1 0 0.3 0.8 1 0 0"));
+    auto c = cache.Intern("1 0 0.3 0.8 1 0 0 key");
+    CHECK(a != nullptr && a == b && a != c, "D same string shares spec");
+    CHECK(cache.Intern("bad") == nullptr && cache.Size() == 2, "D invalid not cached");
+    CHECK(cache.Hits() == 1 && cache.Misses() == 3, "D hit/miss counters");
+}
+
+static void TestCapacity() {
+    auto &cache = KRNodeAnimationSpecCache::GetInstance();
+    cache.Clear();
+    auto held = cache.Intern("0 0 1 0 0 0 0 held");
+    for (size_t i = 0; i < KRNodeAnimationSpecCache::kMaxEntries + 10; i++) {
+        cache.Intern("0 0 1 0 0 0 0 k" + std::to_string(i));
+    }
+    CHECK(cache.Size() <= KRNodeAnimationSpecCache::kMaxEntries, "E bounded size %zu", cache.Size());
+    CHECK(held->animationKey == "held", "E held spec survives clear");
+    CHECK(cache.Intern("0 0 1 0 0 0 0 held") != held, "E evicted spec re-parsed");
+}
+
+int main() {
+    std::printf("\n=== Test: KRNodeAnimationSpec ===\n");
+    TestFields();
+    TestInvalid();
+    TestRandomAgainstLegacy();
+    TestIntern();
+    TestCapacity();
+    return TestResult();
+}
@@ -0,0 +1,225 @@
+// KRBase64Util 的 SIMD 路径须与逐字节参考实现完全一致, 并给出吞吐对比。
+// run_host_tests.sh 以默认(标量)、-mssse3、-mavx2 以及模拟 NEON(neon_emulation.h) 四种目标分别编译运行。
+//
+// A. 随机长度/内容 fuzz: 编码结果与参考实现一致, 往返一致(两种字母表, 有/无 padding)
+// B. 随机插入空白后解码结果不变
+// C. '='、非法字符、非 ASCII 字节处截断, 与参考实现一致
+// D. hex 编码
+// E. 0 ~ 3 个 SIMD 整块之后再跟 0~2 字节尾巴的每个长度, 编解码都与参考实现一致
+// F. 吞吐 benchmark(仅打印)
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libohos_render/utils/KRBase64Util.h"
+#include "test_common.h"
+
+using Alphabet = KRBase64Util::Alphabet;
+
+static std::string Chars(Alphabet alphabet) {
+    return std::string("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789") +
+           (alphabet == Alphabet::kUrlSafe ? "-_" : "+/");
+}
+
+// 参考实现: 改造前的逐字节位累加算法(累加器改为无符号, 避免原实现的有符号移位溢出)
+static std::string ReferenceEncode(const std::string &in, Alphabet alphabet, bool padding) {
+    const std::string chars = Chars(alphabet);
+    std::string out;
+    unsigned int val = 0;
+    int valb = -6;
+    for (unsigned char c : in) {
+        val = (val << 8) + c;
+        valb += 8;
+        while (valb >= 0) {
+            out.push_back(chars[(val >> valb) & 0x3F]);
+            valb -= 6;
+        }
+    }
+    if (valb > -6)
+        out.push_back(chars[((val << 8) >> (valb + 8)) & 0x3F]);
+    while (padding && out.size() % 4)
+        out.push_back('=');
+    return out;
+}
+
+static std::string ReferenceDecode(const std::string &in, Alphabet alphabet) {
+    const std::string chars = Chars(alphabet);
+    std::vector<int> T(256, -1);
+    for (int i = 0; i < 64; i++)
+        T[static_cast<unsigned char>(chars[i])] = i;
+    std::string out;
+    unsigned int val = 0;
+    int valb = -8;
+    for (unsigned char c : in) {
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+            continue;
+        if (T[c] == -1)
+            break;
+        val = (val << 6) + T[c];
+        valb += 6;
+        if (valb >= 0) {
+            out.push_back(static_cast<char>((val >> valb) & 0xFF));
+            valb -= 8;
+        }
+    }
+    return out;
+}
+
+static std::string RandomBytes(std::mt19937 &rng, size_t length) {
+    std::string data(length, '\0');
+    for (auto &c : data) {
+        c = static_cast<char>(rng() & 0xFF);
+    }
+    return data;
+}
+
+static size_t RandomLength(std::mt19937 &rng) {
+    switch (rng() % 4) {
+        case 0:
+            return rng() % 8;
+        case 1:
+            return rng() % 200;
+        case 2:
+            return 40 + rng() % 140;  // 覆盖 SIMD 块边界附近
+        default:
+            return rng() % 5000;
+    }
+}
+
+static void TestFuzzRoundTrip(std::mt19937 &rng) {
+    int mismatches = 0;
+    int round_trip_failures = 0;
+    for (int iter = 0; iter < 3000; iter++) {
+        auto alphabet = (iter & 1) ? Alphabet::kUrlSafe : Alphabet::kStandard;
+        bool padding = (iter & 2) == 0;
+        auto data = RandomBytes(rng, RandomLength(rng));
+        auto encoded = KRBase64Util::Encode(data, alphabet, padding);
+        if (encoded != ReferenceEncode(data, alphabet, padding)) {
+            mismatches++;
+        }
+        if (KRBase64Util::Decode(encoded, alphabet) != data) {
+            round_trip_failures++;
+        }
+    }
+    CHECK(mismatches == 0, "A encode matches reference (mismatches=%d)", mismatches);
+    CHECK(round_trip_failures == 0, "A round trip (failures=%d)", round_trip_failures);
+    std::string binary = RandomBytes(rng, 1000);
+    CHECK(KRBase64Util::Decode(KRBase64Util::Encode(binary)) == binary, "A default overloads round trip");
+    CHECK(KRBase64Util::Encode(std::string()).empty() && KRBase64Util::Decode(std::string()).empty(), "A empty input");
+}
+
+static void TestWhitespace(std::mt19937 &rng) {
+    const char whitespace[] = {' ', '\t', '\r', '\n'};
+    int failures = 0;
+    for (int iter = 0; iter < 1000; iter++) {
+        auto data = RandomBytes(rng, RandomLength(rng));
+        auto encoded = KRBase64Util::Encode(data);
+        std::string wrapped;
+        for (size_t i = 0; i < encoded.size(); i++) {
+            // 一半用 MIME 风格每 76 字符换行, 一半随机插入
+            if ((iter & 1) ? (i > 0 && i % 76 == 0) : (rng() % 23 == 0)) {
+                wrapped.push_back(whitespace[rng() % 4]);
+            }
+            wrapped.push_back(encoded[i]);
+        }
+        if (KRBase64Util::Decode(wrapped) != data) {
+            failures++;
+        }
+    }
+    CHECK(failures == 0, "B whitespace tolerated (failures=%d)", failures);
+}
+
+static void TestTruncation(std::mt19937 &rng) {
+    int failures = 0;
+    const char bad_chars[] = {'=', '*', '.', '\0', static_cast<char>(0x80), static_cast<char>(0xFF), '-', '+'};
+    for (int iter = 0; iter < 2000; iter++) {
+        auto alphabet = (iter & 1) ? Alphabet::kUrlSafe : Alphabet::kStandard;
+        auto encoded = KRBase64Util::Encode(RandomBytes(rng, 1 + RandomLength(rng)), alphabet);
+        encoded[rng() % encoded.size()] = bad_chars[rng() % sizeof(bad_chars)];
+        if (KRBase64Util::Decode(encoded, alphabet) != ReferenceDecode(encoded, alphabet)) {
+            failures++;
+        }
+    }
+    CHECK(failures == 0, "C stops at invalid char like reference (failures=%d)", failures);
+    CHECK(KRBase64Util::Decode(std::string("aGVsbG8=ignored")) == "hello", "C stops at padding");
+    CHECK(KRBase64Util::Decode(std::string("-_-_"), Alphabet::kUrlSafe) == "\xfb\xff\xbf" &&
+              KRBase64Util::Decode(std::string("-_-_")).empty(),
+          "C alphabet specific chars");
+}
+
+static void TestHex() {
+    const unsigned char bytes[] = {0x00, 0x01, 0x7f, 0x80, 0xab, 0xff};
+    CHECK(KRBase64Util::HexEncode(bytes, sizeof(bytes)) == "00017f80abff", "D lower hex");
+    CHECK(KRBase64Util::HexEncode(bytes, sizeof(bytes), true) == "00017F80ABFF", "D upper hex");
+    CHECK(KRBase64Util::HexEncode(bytes, 0).empty(), "D empty hex");
+}
+
+static void TestBlockTails(std::mt19937 &rng) {
+    // 最大整块 NEON 编码 48 字节 / 解码 64 字符, 覆盖 3 个整块后的所有尾巴
+    int mismatches = 0;
+    for (size_t length = 0; length <= 3 * 48 + 2; length++) {
+        auto data = RandomBytes(rng, length);
+        for (auto alphabet : {Alphabet::kStandard, Alphabet::kUrlSafe}) {
+            for (bool padding : {true, false}) {
+                auto encoded = KRBase64Util::Encode(data, alphabet, padding);
+                if (encoded != ReferenceEncode(data, alphabet, padding) ||
+                    KRBase64Util::Decode(encoded, alphabet) != data) {
+                    mismatches++;
+                }
+            }
+        }
+    }
+    CHECK(mismatches == 0, "E every length up to 3 blocks + tail 0-2 (mismatches=%d)", mismatches);
+}
+
+template <typename Fn>
+static double MeasureMBps(size_t bytes, Fn fn) {
+    const int rounds = 10;
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        fn();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    return static_cast<double>(bytes) * rounds / seconds / (1024 * 1024);
+}
+
+static void Benchmark(std::mt19937 &rng) {
+    auto data = RandomBytes(rng, 4 * 1024 * 1024);
+    auto encoded = KRBase64Util::Encode(data);
+    size_t sink = 0;
+    double ref_encode = MeasureMBps(data.size(), [&] { sink += ReferenceEncode(data, Alphabet::kStandard, true).size(); });
+    double new_encode = MeasureMBps(data.size(), [&] { sink += KRBase64Util::Encode(data).size(); });
+    double ref_decode = MeasureMBps(encoded.size(), [&] { sink += ReferenceDecode(encoded, Alphabet::kStandard).size(); });
+    double new_decode = MeasureMBps(encoded.size(), [&] { sink += KRBase64Util::Decode(encoded).size(); });
+    std::printf("       encode: reference %.0f MB/s, KRBase64Util %.0f MB/s (%.1fx)\n", ref_encode, new_encode,
+                new_encode / ref_encode);
+    std::printf("       decode: reference %.0f MB/s, KRBase64Util %.0f MB/s (%.1fx)\n", ref_decode, new_decode,
+                new_decode / ref_decode);
+    CHECK(sink > 0, "F benchmark ran");
+}
+
+int main() {
+#if defined(__AVX2__)
+    const char *target = "AVX2";
+#elif defined(__SSSE3__)
+    const char *target = "SSSE3";
+#elif defined(__aarch64__)
+    const char *target = "NEON";
+#elif defined(KR_BASE64_NEON_EMULATION)
+    const char *target = "NEON emulated";
+#else
+    const char *target = "scalar";
+#endif
+    std::printf("\n=== Test: KRBase64Util (%s) ===\n", target);
+    std::mt19937 rng(20250601);
+    TestFuzzRoundTrip(rng);
+    TestWhitespace(rng);
+    TestTruncation(rng);
+    TestHex();
+    TestBlockTails(rng);
+    Benchmark(rng);
+    return TestResult();
+}
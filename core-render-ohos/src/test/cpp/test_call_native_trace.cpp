@@ -0,0 +1,216 @@
+// 验证 CallNative 轨迹编解码(KRCallNativeTraceWriter/Reader)可无损往返。
+//
+// A. 所有 KRRenderCValue 类型往返一致, 含空字符串指针与嵌套数组
+// B. 时间戳/线程/实例ID(字符串表)/方法往返一致
+// C. 分段取走缓冲后拼接仍可解码
+// D. 魔数错误、截断数据返回错误且不越界
+// E. 随机损坏数据不崩溃
+// F. 常见 setViewProp 调用的编码体积
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libohos_render/context/KRCallNativeTrace.h"
+#include "test_common.h"
+
+static KRRenderCValue Int(int32_t v) {
+    KRRenderCValue value;
+    value.type = KRRenderCValue::INT;
+    value.value.intValue = v;
+    return value;
+}
+
+static KRRenderCValue String(const char *v) {
+    KRRenderCValue value;
+    value.type = KRRenderCValue::STRING;
+    value.value.stringValue = const_cast<char *>(v);
+    return value;
+}
+
+static const uint8_t *Data(const std::string &buffer) {
+    return reinterpret_cast<const uint8_t *>(buffer.data());
+}
+
+static void TestAllTypes() {
+    float floats[] = {1.5f, -2.0f};
+    double doubles[] = {3.25, 1e300};
+    int32_t ints[] = {-7, 0, 9};
+    char bytes[] = {0, 1, 2, 'x'};
+    KRRenderCValue inner[3] = {Int(-123456), String("inner"), KRRenderCValue()};
+    KRRenderCValue args[kKRCallNativeTraceArgCount];
+    args[0].type = KRRenderCValue::LONG;
+    args[0].value.longValue = -(1LL << 40);
+    args[1].type = KRRenderCValue::DOUBLE;
+    args[1].value.doubleValue = 0.1;
+    args[2].type = KRRenderCValue::ARRAY;
+    args[2].value.arrayValue = inner;
+    args[2].size = 3;
+    args[3].type = KRRenderCValue::BYTES;
+    args[3].value.bytesValue = bytes;
+    args[3].size = 4;
+    args[4] = String(nullptr);
+
+    std::vector<KRRenderCValue> results(5);
+    results[0].type = KRRenderCValue::FLOAT32_ARRAY;
+    results[0].value.float32ArrayValue = floats;
+    results[0].size = 2;
+    results[1].type = KRRenderCValue::FLOAT64_ARRAY;
+    results[1].value.float64ArrayValue = doubles;
+    results[1].size = 2;
+    results[2].type = KRRenderCValue::INT32_ARRAY;
+    results[2].value.int32ArrayValue = ints;
+    results[2].size = 3;
+    results[3].type = KRRenderCValue::FLOAT;
+    results[3].value.floatValue = 2.5f;
+    results[4].type = KRRenderCValue::BOOL;
+    results[4].value.boolValue = 1;
+
+    KRCallNativeTraceWriter writer;
+    for (size_t i = 0; i < results.size(); i++) {
+        writer.Append(static_cast<int64_t>(i) * 100, static_cast<uint32_t>(i % 2), i < 3 ? "7" : "12",
+                      static_cast<int>(i) + 3, args, results[i]);
+    }
+    auto buffer = writer.TakeBuffer();
+    KRCallNativeTraceReader reader(Data(buffer), buffer.size());
+    KRCallNativeTraceRecord record;
+    bool args_same = true;
+    bool results_same = true;
+    bool meta_same = true;
+    size_t count = 0;
+    while (reader.Next(&record)) {
+        for (int i = 0; i < kKRCallNativeTraceArgCount; i++) {
+            args_same = args_same && KRCallNativeTraceValueEquals(record.args[i], args[i]);
+        }
+        results_same = results_same && KRCallNativeTraceValueEquals(record.result, results[count]);
+        meta_same = meta_same && record.time_us == static_cast<int64_t>(count) * 100 &&
+                    record.thread == count % 2 && record.instance_id == (count < 3 ? "7" : "12") &&
+                    record.method == static_cast<int>(count) + 3;
+        count++;
+    }
+    CHECK(count == 5 && !reader.HasError(), "A all records decoded");
+    CHECK(args_same && results_same, "A values round trip");
+    CHECK(record.args[4].type == KRRenderCValue::STRING && record.args[4].value.stringValue == nullptr,
+          "A null string kept");
+    CHECK(meta_same, "B metadata round trip");
+    KRRenderCValue changed = Int(-123457);
+    CHECK(!KRCallNativeTraceValueEquals(changed, inner[0]) && !KRCallNativeTraceValueEquals(String("a"), String(nullptr)),
+          "A inequality");
+}
+
+static void TestChunkedBuffer() {
+    KRCallNativeTraceWriter writer;
+    KRRenderCValue args[kKRCallNativeTraceArgCount] = {Int(1), String("prop"), Int(2), KRRenderCValue(), KRRenderCValue()};
+    std::string joined;
+    for (int i = 0; i < 100; i++) {
+        args[0] = Int(i);
+        writer.Append(i * 10, 1, "page", 4, args, KRRenderCValue());
+        if (i % 7 == 0) {
+            joined += writer.TakeBuffer();
+        }
+    }
+    joined += writer.TakeBuffer();
+    KRCallNativeTraceReader reader(Data(joined), joined.size());
+    KRCallNativeTraceRecord record;
+    int count = 0;
+    bool same = true;
+    while (reader.Next(&record)) {
+        same = same && record.args[0].value.intValue == count && record.time_us == count * 10;
+        count++;
+    }
+    CHECK(count == 100 && same && !reader.HasError() && writer.RecordCount() == 100, "C chunked buffer");
+}
+
+static void TestCorrupted() {
+    std::string bad = "XXXX";
+    KRCallNativeTraceReader bad_reader(Data(bad), bad.size());
+    KRCallNativeTraceRecord record;
+    CHECK(!bad_reader.IsValid() && !bad_reader.Next(&record), "D bad magic");
+
+    KRCallNativeTraceWriter writer;
+    KRRenderCValue args[kKRCallNativeTraceArgCount] = {String("a long string argument"), Int(1), Int(2), Int(3),
+                                                       Int(4)};
+    writer.Append(0, 1, "1", 4, args, KRRenderCValue());
+    auto buffer = writer.TakeBuffer();
+    size_t boundary = buffer.size();
+    writer.Append(5, 1, "1", 4, args, KRRenderCValue());
+    buffer += writer.TakeBuffer();
+    bool all_detected = true;
+    for (size_t cut = 6; cut < buffer.size(); cut++) {
+        // 截断成独立的堆内存, 方便 ASAN 检查越界
+        std::vector<uint8_t> truncated(buffer.begin(), buffer.begin() + cut);
+        KRCallNativeTraceReader reader(truncated.data(), truncated.size());
+        int count = 0;
+        while (reader.Next(&record)) {
+            count++;
+        }
+        // 恰好截在记录边界时只是少了后面的记录, 其余位置都应报告损坏
+        bool expected_error = cut != boundary;
+        all_detected = all_detected && count == (cut < boundary ? 0 : 1) && reader.HasError() == expected_error;
+    }
+    CHECK(all_detected, "D truncated data detected");
+}
+
+static void TestFuzz() {
+    KRCallNativeTraceWriter writer;
+    KRRenderCValue inner[2] = {String("x"), Int(5)};
+    KRRenderCValue args[kKRCallNativeTraceArgCount] = {Int(1), String("frame"), KRRenderCValue(), Int(3), Int(4)};
+    args[2].type = KRRenderCValue::ARRAY;
+    args[2].value.arrayValue = inner;
+    args[2].size = 2;
+    for (int i = 0; i < 20; i++) {
+        writer.Append(i, 0, std::to_string(i % 3), i, args, Int(i));
+    }
+    auto buffer = writer.TakeBuffer();
+    std::mt19937 rng(11);
+    int decoded = 0;
+    for (int round = 0; round < 2000; round++) {
+        std::vector<uint8_t> data(buffer.begin(), buffer.end());
+        int flips = 1 + static_cast<int>(rng() % 4);
+        for (int i = 0; i < flips; i++) {
+            data[5 + rng() % (data.size() - 5)] = static_cast<uint8_t>(rng());
+        }
+        KRCallNativeTraceReader reader(data.data(), data.size());
+        KRCallNativeTraceRecord record;
+        while (reader.Next(&record)) {
+            decoded++;
+        }
+    }
+    CHECK(decoded > 0, "E random corruption handled (%d records decoded)", decoded);
+}
+
+static void TestSize() {
+    KRCallNativeTraceWriter writer;
+    KRRenderCValue args[kKRCallNativeTraceArgCount] = {Int(42), String("backgroundColor"), String("rgba(0,0,0,1)"),
+                                                       KRRenderCValue(), KRRenderCValue()};
+    writer.Append(0, 1, "1", 4, args, KRRenderCValue());
+    size_t first = writer.TakeBuffer().size();
+    writer.Append(16, 1, "1", 4, args, KRRenderCValue());
+    size_t second = writer.TakeBuffer().size();
+    CHECK(second < 45, "F setViewProp record: %zu bytes (first with header %zu)", second, first);
+}
+
+static void TestReplayStubbed() {
+    // module 调用与 fireFatalException 不回放，view/shadow/timer 等渲染调用照常派发
+    bool ok = KRCallNativeTraceIsReplayStubbed(8) && KRCallNativeTraceIsReplayStubbed(15) &&
+              KRCallNativeTraceIsReplayStubbed(17);
+    for (int method = 1; method <= 18; method++) {
+        if (method != 8 && method != 15 && method != 17 && KRCallNativeTraceIsReplayStubbed(method)) {
+            ok = false;
+        }
+    }
+    CHECK(ok, "G replay stubs module calls only");
+}
+
+int main() {
+    std::printf("\n=== Test: KRCallNativeTrace ===\n");
+    TestAllTypes();
+    TestChunkedBuffer();
+    TestCorrupted();
+    TestFuzz();
+    TestSize();
+    TestReplayStubbed();
+    return TestResult();
+}
@@ -0,0 +1,93 @@
+// 验证 KRCodec 的二进制/增量/文件摘要接口。
+//
+// A. 标准测试向量(md5 / sha256)
+// B. 二进制接口与字符串接口结果一致, 支持含 '\0' 的数据
+// C. 任意分块增量计算与一次性计算一致
+// D. 文件流式摘要与内存摘要一致, 不存在的文件返回 false
+
+#include <cstdio>
+#include <random>
+#include <string>
+
+#include "libohos_render/expand/modules/codec/KRCodec.h"
+#include "test_common.h"
+
+using kuikly::KRHasher;
+
+static const uint8_t *Bytes(const std::string &str) {
+    return reinterpret_cast<const uint8_t *>(str.data());
+}
+
+static void TestVectors() {
+    CHECK(kuikly::KRMd5With32(std::string()) == "d41d8cd98f00b204e9800998ecf8427e", "A md5 empty");
+    CHECK(kuikly::KRMd5With32(std::string("abc")) == "900150983cd24fb0d6963f7d28e17f72", "A md5 abc");
+    CHECK(kuikly::KRMd5(std::string("abc")) == "3cd24fb0d6963f7d", "A md5 16");
+    CHECK(kuikly::KRSha256(std::string("abc")) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+          "A sha256 abc");
+    CHECK(kuikly::KRSha256(std::string()) == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+          "A sha256 empty");
+}
+
+static void TestBinary() {
+    std::string binary("a\0b\0c\xff", 6);
+    CHECK(kuikly::KRMd5With32(Bytes(binary), binary.size()) == kuikly::KRMd5With32(binary), "B md5 bytes == string");
+    CHECK(kuikly::KRSha256(Bytes(binary), binary.size()) == kuikly::KRSha256(binary), "B sha256 bytes == string");
+    CHECK(kuikly::KRSha256(Bytes(binary), binary.size()) != kuikly::KRSha256(std::string("a")),
+          "B embedded NUL is hashed");
+}
+
+static void TestIncremental() {
+    std::mt19937 rng(7);
+    std::string data(300000, '\0');
+    for (auto &c : data) {
+        c = static_cast<char>(rng() & 0xFF);
+    }
+    for (auto algorithm : {KRHasher::Algorithm::kMd5, KRHasher::Algorithm::kSha256}) {
+        auto expected = algorithm == KRHasher::Algorithm::kMd5 ? kuikly::KRMd5With32(data) : kuikly::KRSha256(data);
+        int failures = 0;
+        for (int iter = 0; iter < 20; iter++) {
+            auto hasher = KRHasher::Create(algorithm);
+            size_t offset = 0;
+            while (offset < data.size()) {
+                size_t chunk = std::min<size_t>(data.size() - offset, rng() % (iter < 10 ? 70 : 70000));
+                hasher->Update(data.data() + offset, chunk);
+                offset += chunk;
+            }
+            if (hasher->FinalHex() != expected) {
+                failures++;
+            }
+        }
+        CHECK(failures == 0, "C %s chunked == one shot (failures=%d)",
+              algorithm == KRHasher::Algorithm::kMd5 ? "md5" : "sha256", failures);
+    }
+    KRHasher::Algorithm algorithm;
+    CHECK(KRHasher::ParseAlgorithm("sha256", algorithm) && algorithm == KRHasher::Algorithm::kSha256 &&
+              !KRHasher::ParseAlgorithm("sha1", algorithm),
+          "C parse algorithm");
+}
+
+static void TestFile(const std::string &path) {
+    std::string data(1024 * 1024 + 123, '\0');
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i * 31 + 7);
+    }
+    FILE *file = fopen(path.c_str(), "wb");
+    fwrite(data.data(), 1, data.size(), file);
+    fclose(file);
+    std::string digest;
+    bool ok = kuikly::KRHashFile(path, KRHasher::Algorithm::kSha256, digest);
+    CHECK(ok && digest == kuikly::KRSha256(data), "D sha256 file == memory");
+    ok = kuikly::KRHashFile(path, KRHasher::Algorithm::kMd5, digest);
+    CHECK(ok && digest == kuikly::KRMd5With32(data), "D md5 file == memory");
+    std::remove(path.c_str());
+    CHECK(!kuikly::KRHashFile(path, KRHasher::Algorithm::kMd5, digest), "D missing file");
+}
+
+int main(int, char **argv) {
+    std::printf("\n=== Test: KRCodec hashing ===\n");
+    TestVectors();
+    TestBinary();
+    TestIncremental();
+    TestFile(std::string(argv[0]) + ".hash_input");
+    return TestResult();
+}
@@ -0,0 +1,29 @@
+// host 单测共用的检查宏与结果汇总。
+// 单测直接链接生产代码, 不依赖 OHOS 运行时, 由 run_host_tests.sh 编译运行。
+
+#ifndef CORE_RENDER_OHOS_TEST_COMMON_H
+#define CORE_RENDER_OHOS_TEST_COMMON_H
+
+#include <cstdio>
+
+// 任一 CHECK 失败即置为 false, 每个单测程序只有一个编译单元
+static bool g_ok = true;
+
+#define CHECK(cond, ...)                            \
+    do {                                            \
+        if (cond) {                                 \
+            std::printf("[PASS] " __VA_ARGS__);     \
+        } else {                                    \
+            std::printf("[FAIL] " __VA_ARGS__);     \
+            g_ok = false;                           \
+        }                                           \
+        std::printf("\n");                          \
+    } while (0)
+
+// 打印汇总结果, 返回进程退出码
+static inline int TestResult() {
+    std::printf("%s\n", g_ok ? ">>> ALL PASS <<<" : ">>> FAILED <<<");
+    return g_ok ? 0 : 1;
+}
+
+#endif  // CORE_RENDER_OHOS_TEST_COMMON_H
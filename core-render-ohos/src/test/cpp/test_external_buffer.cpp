@@ -0,0 +1,57 @@
+// 验证 KRShouldShareExternalBuffer 的共享/拷贝判定。
+//
+// A. 长度阈值: 小于 kKRExternalArrayBufferMinSize 一律拷贝
+// B. 独占判定: 存储只被 KRRenderValue 持有时共享, native 侧另持引用时拷贝
+// C. 无 owner 时拷贝; 共享出去的 owner 在原持有者释放后仍保活存储
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "libohos_render/foundation/type/KRExternalBuffer.h"
+#include "test_common.h"
+
+static void TestThreshold() {
+    CHECK(!KRShouldShareExternalBuffer(0, 1), "A empty copies");
+    CHECK(!KRShouldShareExternalBuffer(kKRExternalArrayBufferMinSize - 1, 1), "A below threshold copies");
+    CHECK(KRShouldShareExternalBuffer(kKRExternalArrayBufferMinSize, 1), "A at threshold shares");
+    CHECK(KRShouldShareExternalBuffer(kKRExternalArrayBufferMinSize * 256, 1), "A large shares");
+}
+
+static void TestExclusiveOwner() {
+    // 模拟 KRRenderValue 持有的存储
+    auto stored = std::make_shared<std::vector<uint8_t>>(kKRExternalArrayBufferMinSize);
+    CHECK(KRShouldShareExternalBuffer(stored->size(), stored.use_count()), "B sole holder shares");
+    {
+        // native 侧仍持有可写引用
+        auto native_ref = stored;
+        CHECK(!KRShouldShareExternalBuffer(stored->size(), stored.use_count()), "B native reference copies");
+    }
+    CHECK(KRShouldShareExternalBuffer(stored->size(), stored.use_count()), "B shares again once released");
+
+    // 只读视图同样计入引用
+    std::shared_ptr<const std::vector<uint8_t>> readonly = stored;
+    CHECK(!KRShouldShareExternalBuffer(stored->size(), stored.use_count()), "B readonly view copies");
+}
+
+static void TestOwnerLifetime() {
+    std::shared_ptr<const void> none;
+    CHECK(!KRShouldShareExternalBuffer(kKRExternalArrayBufferMinSize, none.use_count()), "C null owner copies");
+
+    auto stored = std::make_shared<std::vector<uint8_t>>(kKRExternalArrayBufferMinSize, 7);
+    std::weak_ptr<std::vector<uint8_t>> weak = stored;
+    // 与 BufferToNapiValue 一致: finalizer 的 hint 持有 owner 副本
+    auto holder = new std::shared_ptr<const void>(stored);
+    auto data = stored->data();
+    stored.reset();
+    CHECK(!weak.expired() && data[0] == 7, "C shared owner keeps storage alive");
+    delete holder;
+    CHECK(weak.expired(), "C finalizer releases storage");
+}
+
+int main() {
+    TestThreshold();
+    TestExclusiveOwner();
+    TestOwnerLifetime();
+    return TestResult();
+}
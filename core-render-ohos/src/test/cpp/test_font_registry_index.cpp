@@ -0,0 +1,168 @@
+// 验证 KRFontRegistryIndex 的预算与淘汰策略。
+//
+// A. 注册/使用/重复注册的计数与字节数
+// B. 超出预算时按最久未使用淘汰, 直到回到预算内
+// C. 最近用过的字体不淘汰, 允许暂时超出预算
+// D. 被引用的字体不淘汰(即使长期未使用), 释放引用后才可淘汰; 调整预算
+// E. 随机操作与朴素实现对比
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libohos_render/expand/components/richtext/KRFontRegistryIndex.h"
+#include "test_common.h"
+
+static void TestAddTouch() {
+    KRFontRegistryIndex index(100, 10);
+    CHECK(!index.Touch("a", 0) && !index.Contains("a"), "A unknown font");
+    index.Add("a", 40, 0);
+    index.Add("b", 30, 1);
+    index.Add("a", 40, 2);
+    CHECK(index.Count() == 2 && index.TotalBytes() == 70, "A count and bytes");
+    CHECK(index.Touch("a", 3) && index.CollectEvictions(100).empty(), "A within budget");
+}
+
+static void TestEvictLru() {
+    KRFontRegistryIndex index(100, 10);
+    index.Add("a", 40, 0);
+    index.Add("b", 40, 1);
+    index.Add("c", 40, 2);
+    index.Touch("a", 3);
+    // b 最久未用；淘汰 b 后 80 <= 100
+    auto evicted = index.CollectEvictions(100);
+    CHECK(evicted == std::vector<std::string>({"b"}) && index.TotalBytes() == 80, "B evict least recently used");
+    CHECK(index.Contains("a") && index.Contains("c") && !index.Contains("b"), "B survivors");
+}
+
+static void TestRecentlyUsedKept() {
+    KRFontRegistryIndex index(50, 10);
+    index.Add("a", 40, 0);
+    index.Add("b", 40, 5);
+    CHECK(index.CollectEvictions(8).empty() && index.TotalBytes() == 80, "C recent fonts kept over budget");
+    auto evicted = index.CollectEvictions(20);
+    CHECK(evicted == std::vector<std::string>({"a"}) && index.TotalBytes() == 40, "C evicted once idle");
+}
+
+static void TestRetainAndBudget() {
+    KRFontRegistryIndex index(1000, 0);
+    index.Retain("b");  // 注册前引用
+    index.Add("a", 300, 0);
+    index.Add("b", 300, 1);
+    index.Add("c", 300, 2);
+    index.Retain("b");
+    index.Release("b");
+    index.Release("missing");
+    index.SetBudget(100);
+    auto evicted = index.CollectEvictions(1000);
+    CHECK(evicted == std::vector<std::string>({"a", "c"}) && index.Contains("b") && index.TotalBytes() == 300 &&
+              index.Budget() == 100,
+          "D retained font kept while idle");
+    index.Release("b");
+    evicted = index.CollectEvictions(1000);
+    CHECK(evicted == std::vector<std::string>({"b"}) && index.TotalBytes() == 0, "D evicted after last release");
+}
+
+// 朴素实现：每次线性找最久未使用
+struct NaiveIndex {
+    struct Entry {
+        size_t bytes;
+        int64_t last_use;
+        uint64_t order;
+    };
+    std::map<std::string, Entry> entries;
+    std::map<std::string, int> retains;
+    size_t budget;
+    int64_t min_idle;
+    uint64_t order = 0;
+
+    bool Touch(const std::string &family, int64_t now) {
+        auto it = entries.find(family);
+        if (it == entries.end()) {
+            return false;
+        }
+        it->second.last_use = now;
+        it->second.order = order++;
+        return true;
+    }
+    void Add(const std::string &family, size_t bytes, int64_t now) {
+        if (!Touch(family, now)) {
+            entries[family] = {bytes, now, order++};
+        }
+    }
+    size_t Total() const {
+        size_t total = 0;
+        for (const auto &[_, entry] : entries) {
+            total += entry.bytes;
+        }
+        return total;
+    }
+    std::vector<std::string> Evict(int64_t now) {
+        std::vector<std::string> evicted;
+        while (Total() > budget) {
+            auto oldest = entries.end();
+            for (auto it = entries.begin(); it != entries.end(); ++it) {
+                if (retains[it->first] == 0 && (oldest == entries.end() || it->second.order < oldest->second.order)) {
+                    oldest = it;
+                }
+            }
+            if (oldest == entries.end() || now - oldest->second.last_use < min_idle) {
+                break;
+            }
+            evicted.push_back(oldest->first);
+            entries.erase(oldest);
+        }
+        return evicted;
+    }
+};
+
+static void TestRandomAgainstNaive() {
+    std::mt19937 rng(5);
+    bool same = true;
+    size_t total_evicted = 0;
+    for (int round = 0; round < 200 && same; round++) {
+        size_t budget = 100 + rng() % 400;
+        int64_t min_idle = rng() % 20;
+        KRFontRegistryIndex index(budget, min_idle);
+        NaiveIndex naive{{}, {}, budget, min_idle};
+        int64_t now = 0;
+        for (int step = 0; step < 200 && same; step++) {
+            now += rng() % 5;
+            auto family = "f" + std::to_string(rng() % 12);
+            auto roll = rng() % 5;
+            if (roll == 0) {
+                same = index.Touch(family, now) == naive.Touch(family, now);
+            } else if (roll == 1) {
+                index.Retain(family);
+                naive.retains[family]++;
+            } else if (roll == 2) {
+                if (naive.retains[family] > 0) {
+                    index.Release(family);
+                    naive.retains[family]--;
+                }
+            } else {
+                size_t bytes = 10 + rng() % 120;
+                index.Add(family, bytes, now);
+                naive.Add(family, bytes, now);
+                auto evicted = index.CollectEvictions(now);
+                total_evicted += evicted.size();
+                same = evicted == naive.Evict(now);
+            }
+            same = same && index.TotalBytes() == naive.Total() && index.Count() == naive.entries.size();
+        }
+    }
+    CHECK(same && total_evicted > 0, "E random ops match naive index (evicted %zu)", total_evicted);
+}
+
+int main() {
+    std::printf("\n=== Test: KRFontRegistryIndex ===\n");
+    TestAddTouch();
+    TestEvictLru();
+    TestRecentlyUsedKept();
+    TestRetainAndBudget();
+    TestRandomAgainstNaive();
+    return TestResult();
+}
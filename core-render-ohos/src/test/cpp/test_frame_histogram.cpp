@@ -0,0 +1,126 @@
+// 用合成的 VSync 时间戳驱动 KRFrameData / KRFrameHistogram, 验证分桶、分位值与卡顿归因。
+//
+// A. 稳定 60fps 序列: p50/p99/max 精确等于帧间隔, 无卡顿帧
+// B. 单次 200ms 卡顿 vs 多次 20ms 小卡: 均值接近但 max/p99 可区分
+// C. 卡顿帧记录主线程工作量, 且只保留最严重的 kMaxJankFrames 帧(降序)
+// D. 分桶边界单调, 相对误差不超过 1/kSubBucketCount
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "libohos_render/performance/frame/KRFrameData.h"
+#include "libohos_render/performance/frame/KRFrameHistogram.h"
+#include "test_common.h"
+
+static constexpr long long kFrameInterval = 16666667LL;
+static constexpr long long kMs = 1000000LL;
+// 按合成的 VSync 时间戳序列喂数据, 模拟 KRFrameMonitor::OnVSync
+static void FeedVSyncs(KRFrameData &data, const std::vector<long long> &timestamps,
+                       const KRFrameWorkSnapshot &work_per_frame = {}) {
+    for (size_t i = 1; i < timestamps.size(); i++) {
+        data.AddFrame(timestamps[i], timestamps[i] - timestamps[i - 1], kFrameInterval, work_per_frame);
+    }
+}
+
+static std::vector<long long> SteadyVSyncs(int frames, long long start = 0) {
+    std::vector<long long> ts;
+    for (int i = 0; i <= frames; i++) {
+        ts.push_back(start + i * kFrameInterval);
+    }
+    return ts;
+}
+
+static void TestSteady() {
+    KRFrameData data;
+    FeedVSyncs(data, SteadyVSyncs(600));
+    CHECK(data.frame_count == 600, "A steady frame_count=%lld", data.frame_count);
+    CHECK(data.histogram.Percentile(50) == kFrameInterval, "A p50=%lld", data.histogram.Percentile(50));
+    CHECK(data.histogram.Percentile(99) == kFrameInterval, "A p99=%lld", data.histogram.Percentile(99));
+    CHECK(data.histogram.Max() == kFrameInterval, "A max=%lld", data.histogram.Max());
+    CHECK(data.jank_count == 0 && data.jank_frames.empty(), "A no jank (jank_count=%lld)", data.jank_count);
+}
+
+static void TestStallVsSlips() {
+    // 一次 200ms 卡顿
+    KRFrameData stall;
+    auto ts = SteadyVSyncs(100);
+    long long t = ts.back() + 200 * kMs;
+    ts.push_back(t);
+    FeedVSyncs(stall, ts);
+
+    // 10 次约 20ms 的小卡(按 VSync 量化即 2 帧间隔 33ms)
+    KRFrameData slips;
+    ts = SteadyVSyncs(100);
+    for (int i = 0; i < 10; i++) {
+        ts.push_back(ts.back() + 2 * kFrameInterval);
+    }
+    FeedVSyncs(slips, ts);
+
+    CHECK(stall.histogram.Max() == 200 * kMs, "B stall max=%lld", stall.histogram.Max());
+    CHECK(slips.histogram.Max() == 2 * kFrameInterval, "B slips max=%lld", slips.histogram.Max());
+    CHECK(stall.jank_count == 1 && slips.jank_count == 10, "B jank counts stall=%lld slips=%lld",
+          stall.jank_count, slips.jank_count);
+    CHECK(slips.histogram.Percentile(95) == 2 * kFrameInterval, "B slips p95=%lld",
+          slips.histogram.Percentile(95));
+    CHECK(stall.histogram.Percentile(90) == kFrameInterval, "B stall p90=%lld", stall.histogram.Percentile(90));
+}
+
+static void TestJankAttribution() {
+    KRFrameData data;
+    auto ts = SteadyVSyncs(1);
+    // 20 个逐渐变长的卡顿帧, 每帧工作量与耗时挂钩
+    for (int i = 0; i < 20; i++) {
+        long long duration = (2 + i) * kFrameInterval;
+        ts.push_back(ts.back() + duration);
+        KRFrameWorkSnapshot work{static_cast<uint64_t>(i + 1), static_cast<uint64_t>(i * 2),
+                                 static_cast<uint64_t>(i * 10)};
+        data.AddFrame(ts.back(), duration, kFrameInterval, work);
+    }
+    CHECK(data.jank_count == 20, "C jank_count=%lld", data.jank_count);
+    CHECK(data.jank_frames.size() == KRFrameData::kMaxJankFrames, "C kept %zu jank frames", data.jank_frames.size());
+    bool sorted = true;
+    for (size_t i = 1; i < data.jank_frames.size(); i++) {
+        sorted = sorted && data.jank_frames[i - 1].duration_nanos >= data.jank_frames[i].duration_nanos;
+    }
+    CHECK(sorted, "C jank frames sorted by duration desc");
+    CHECK(data.jank_frames.front().work.scheduler_tasks == 20 && data.jank_frames.front().work.props_set == 190,
+          "C worst frame attributed work tasks=%llu props=%llu",
+          (unsigned long long)data.jank_frames.front().work.scheduler_tasks,
+          (unsigned long long)data.jank_frames.front().work.props_set);
+    CHECK(data.jank_work.scheduler_tasks == 210, "C jank work sum=%llu",
+          (unsigned long long)data.jank_work.scheduler_tasks);
+    auto json = data.ToJSONString();
+    CHECK(json.find("\"jankFrames\"") != std::string::npos && json.find("\"p99\"") != std::string::npos,
+          "C JSON contains p99/jankFrames");
+    data.Reset();
+    CHECK(data.frame_count == 0 && data.histogram.Count() == 0 && data.jank_frames.empty(), "C reset");
+}
+
+static void TestBuckets() {
+    bool monotonic = true;
+    for (int i = 1; i < KRFrameHistogram::kBucketCount; i++) {
+        monotonic = monotonic && KRFrameHistogram::BucketLowerBound(i) > KRFrameHistogram::BucketLowerBound(i - 1);
+        monotonic = monotonic && KRFrameHistogram::BucketIndex(KRFrameHistogram::BucketLowerBound(i)) == i;
+    }
+    CHECK(monotonic, "D bucket bounds monotonic and round-trip");
+    bool bounded = true;
+    for (long long d = 1024 * 1000; d < 4000 * kMs; d = d * 21 / 20) {
+        int index = KRFrameHistogram::BucketIndex(d);
+        long long lower = KRFrameHistogram::BucketLowerBound(index);
+        // 分桶以微秒为粒度, 允许额外 1us 的截断误差
+        bounded = bounded && lower <= d && (d - lower - 1000) * KRFrameHistogram::kSubBucketCount <= lower;
+    }
+    CHECK(bounded, "D relative bucket error <= 1/%d", KRFrameHistogram::kSubBucketCount);
+    CHECK(KRFrameHistogram::BucketIndex(500 * 1000) == 0, "D sub-millisecond frames in bucket 0");
+    CHECK(KRFrameHistogram::BucketIndex(100000 * kMs) == KRFrameHistogram::kBucketCount - 1, "D overflow clamps");
+}
+
+int main() {
+    std::printf("\n=== Test: KRFrameHistogram / KRFrameData ===\n");
+    TestSteady();
+    TestStallVsSlips();
+    TestJankAttribution();
+    TestBuckets();
+    return TestResult();
+}
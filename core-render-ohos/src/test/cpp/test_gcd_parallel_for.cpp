@@ -0,0 +1,114 @@
+// 验证 KRGCDQueue::ParallelFor 的分发与等待语义。
+//
+// A. count 为 0 / 1 时不分发, 直接在调用线程完成
+// B. 每个下标恰好执行一次, 返回时全部结果可见
+// C. 任务确实分摊到了多个线程
+// D. 线程池被长任务占满时, 调用线程自己领取完所有下标, 不会死等
+// E. 连续多轮调用互不干扰
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "test_common.h"
+
+static void TestTrivialCounts() {
+    auto &queue = KRGCDQueue::GetInstance();
+    bool called = false;
+    queue.ParallelFor(0, [&called](size_t) { called = true; });
+    CHECK(!called, "A count 0 runs nothing");
+    auto caller = std::this_thread::get_id();
+    std::thread::id runner;
+    queue.ParallelFor(1, [&runner](size_t) { runner = std::this_thread::get_id(); });
+    CHECK(runner == caller, "A count 1 runs inline");
+}
+
+static void TestEachIndexOnce() {
+    const size_t count = 1000;
+    std::vector<int> hits(count, 0);
+    std::vector<size_t> results(count, 0);
+    KRGCDQueue::GetInstance().ParallelFor(count, [&hits, &results](size_t i) {
+        hits[i]++;
+        results[i] = i * i;
+    });
+    bool once = true;
+    bool visible = true;
+    for (size_t i = 0; i < count; i++) {
+        once = once && hits[i] == 1;
+        visible = visible && results[i] == i * i;
+    }
+    CHECK(once, "B every index runs exactly once");
+    CHECK(visible, "B results visible after return");
+}
+
+static void TestSpreadAcrossThreads() {
+    std::mutex mutex;
+    std::set<std::thread::id> ids;
+    KRGCDQueue::GetInstance().ParallelFor(64, [&mutex, &ids](size_t) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        std::lock_guard<std::mutex> lock(mutex);
+        ids.insert(std::this_thread::get_id());
+    });
+    CHECK(ids.size() > 1, "C work spread across %zu threads", ids.size());
+}
+
+static void TestBusyPool() {
+    auto &queue = KRGCDQueue::GetInstance();
+    std::atomic<bool> release{false};
+    std::atomic<int> parked{0};
+    for (int i = 0; i < 4; i++) {
+        queue.DispatchAsync([&release, &parked] {
+            parked++;
+            while (!release) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            parked--;
+        });
+    }
+    while (parked < 4) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::atomic<size_t> sum{0};
+    auto caller = std::this_thread::get_id();
+    std::atomic<bool> all_inline{true};
+    queue.ParallelFor(100, [&sum, &all_inline, caller](size_t i) {
+        sum += i;
+        if (std::this_thread::get_id() != caller) {
+            all_inline = false;
+        }
+    });
+    CHECK(sum == 4950 && all_inline, "D caller drains all indices while pool is busy");
+    release = true;
+    while (parked > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+static void TestRepeatedRounds() {
+    bool ok = true;
+    for (int round = 0; round < 200; round++) {
+        std::atomic<int> sum{0};
+        KRGCDQueue::GetInstance().ParallelFor(17, [&sum](size_t i) { sum += static_cast<int>(i) + 1; });
+        ok = ok && sum == 153;
+    }
+    CHECK(ok, "E repeated rounds");
+}
+
+int main() {
+    std::printf("\n=== Test: KRGCDQueue::ParallelFor ===\n");
+    TestTrivialCounts();
+    TestEachIndexOnce();
+    TestSpreadAcrossThreads();
+    TestBusyPool();
+    TestRepeatedRounds();
+    int result = TestResult();
+    std::fflush(stdout);
+    // 线程池为进程级单例且工作线程常驻, 正常 return 会在静态析构时等待工作线程, 这里直接退出
+    std::_Exit(result);
+}
@@ -0,0 +1,149 @@
+// 验证 KRHandleTable 的句柄语义与多线程读写安全性。
+//
+// A. 插入/查找/删除, 删除返回原值
+// B. 删除后旧句柄失效, 槽位复用后旧句柄不会命中新值
+// C. 句柄与 userData 指针互转无损, 0 / 伪造句柄无效
+// D. 跨块插入大量值
+// E. 多线程并发查找与插入删除, 读到的值始终与句柄匹配
+// F. 无读者时删除的节点随写操作回收, 值的析构可以重入本表
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "libohos_render/foundation/KRHandleTable.h"
+#include "test_common.h"
+
+static void TestBasic() {
+    KRHandleTable<std::shared_ptr<int>> table;
+    auto a = table.Insert(std::make_shared<int>(1));
+    auto b = table.Insert(std::make_shared<int>(2));
+    CHECK(a != kKRInvalidHandle && b != kKRInvalidHandle && a != b, "A distinct handles");
+    CHECK(*table.Get(a) == 1 && *table.Get(b) == 2 && table.Size() == 2, "A get");
+    auto removed = table.Remove(a);
+    CHECK(removed && *removed == 1 && table.Size() == 1, "A remove returns value");
+    CHECK(!table.Remove(a), "A double remove is no-op");
+}
+
+static void TestStaleHandle() {
+    KRHandleTable<std::shared_ptr<int>> table;
+    auto old_handle = table.Insert(std::make_shared<int>(1));
+    table.Remove(old_handle);
+    CHECK(!table.Get(old_handle) && !table.Contains(old_handle), "B removed handle is stale");
+    auto new_handle = table.Insert(std::make_shared<int>(2));
+    CHECK((new_handle & 0xFFFFFFFFu) == (old_handle & 0xFFFFFFFFu), "B slot reused");
+    CHECK(new_handle != old_handle && !table.Get(old_handle) && *table.Get(new_handle) == 2,
+          "B reused slot does not alias old handle");
+}
+
+static void TestPointerRoundTrip() {
+    KRHandleTable<int> table;
+    auto handle = table.Insert(42);
+    CHECK(KRHandleFromPointer(KRHandleToPointer(handle)) == handle, "C pointer round trip");
+    CHECK(table.Get(KRHandleFromPointer(KRHandleToPointer(handle))) == 42, "C get through pointer");
+    CHECK(table.Get(kKRInvalidHandle) == 0 && table.Get(handle + 1) == 0, "C invalid handles");
+    CHECK(table.Get((static_cast<KRHandle>(1) << 32) | 0xFFFFFFFFu) == 0, "C out of range index");
+}
+
+static void TestManyChunks() {
+    KRHandleTable<int> table;
+    std::vector<KRHandle> handles;
+    const int count = KRHandleTable<int>::kChunkSize * 5 + 3;
+    for (int i = 0; i < count; i++) {
+        handles.push_back(table.Insert(i));
+    }
+    bool ok = table.Size() == static_cast<size_t>(count);
+    for (int i = 0; i < count; i++) {
+        ok = ok && table.Get(handles[i]) == i;
+    }
+    CHECK(ok, "D %d values across chunks", count);
+}
+
+static void TestConcurrent() {
+    KRHandleTable<std::shared_ptr<KRHandle>> table;
+    std::vector<std::atomic<KRHandle>> published(64);
+    for (auto &handle : published) {
+        handle = kKRInvalidHandle;
+    }
+    std::atomic<bool> stop{false};
+    std::atomic<bool> mismatch{false};
+    std::atomic<uint64_t> hits{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; t++) {
+        readers.emplace_back([&] {
+            while (!stop) {
+                for (auto &slot : published) {
+                    auto handle = slot.load(std::memory_order_acquire);
+                    if (auto value = table.Get(handle)) {
+                        // 值里存的是插入时拿到的句柄, 读到的值必须属于当前句柄
+                        if (*value != handle) {
+                            mismatch = true;
+                        }
+                        hits.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+    }
+    std::thread writer([&] {
+        for (int round = 0; round < 20000; round++) {
+            auto &slot = published[round % published.size()];
+            auto value = std::make_shared<KRHandle>(kKRInvalidHandle);
+            // 先占位再写入句柄, 读线程在发布前看不到这个值
+            auto handle = table.Insert(value);
+            *value = handle;
+            auto old_handle = slot.exchange(handle, std::memory_order_acq_rel);
+            table.Remove(old_handle);
+        }
+        stop = true;
+    });
+    writer.join();
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    CHECK(!mismatch && hits > 0, "E concurrent readers never see foreign values (%llu hits)",
+          static_cast<unsigned long long>(hits.load()));
+    CHECK(table.Size() == published.size(), "E size after churn");
+}
+
+struct ReentrantValue {
+    KRHandleTable<std::shared_ptr<ReentrantValue>> *table = nullptr;
+    KRHandle other = kKRInvalidHandle;
+    ~ReentrantValue() {
+        if (table != nullptr) {
+            table->Remove(other);
+        }
+    }
+};
+
+static void TestReclaim() {
+    KRHandleTable<std::shared_ptr<int>> table;
+    auto value = std::make_shared<int>(1);
+    std::weak_ptr<int> weak = value;
+    auto handle = table.Insert(value);
+    value.reset();
+    CHECK(*table.Remove(handle) == 1 && table.RetiredCount() == 0, "F node reclaimed without readers");
+    CHECK(weak.expired(), "F value released once the caller drops it");
+
+    KRHandleTable<std::shared_ptr<ReentrantValue>> reentrant;
+    auto inner = reentrant.Insert(std::make_shared<ReentrantValue>());
+    auto outer_value = std::make_shared<ReentrantValue>();
+    outer_value->table = &reentrant;
+    outer_value->other = inner;
+    auto outer = reentrant.Insert(std::move(outer_value));
+    reentrant.Remove(outer);
+    CHECK(!reentrant.Contains(inner) && reentrant.Size() == 0, "F value destructor re-enters the table");
+}
+
+int main() {
+    std::printf("\n=== Test: KRHandleTable ===\n");
+    TestBasic();
+    TestStaleHandle();
+    TestPointerRoundTrip();
+    TestManyChunks();
+    TestConcurrent();
+    TestReclaim();
+    return TestResult();
+}
@@ -0,0 +1,171 @@
+// 验证 KRIdleTaskQueue 的分片策略(时间由测试注入)。
+//
+// A. 同一时刻只申请一次帧, 切片后仍有任务才再次申请
+// B. 切片不超过本帧剩余时间与单片上限, 帧内工作耗尽时间时本帧不执行
+// C. 最短延迟未到期的任务不执行, 执行顺序为到期时间 + 投递顺序
+// D. 任务等待过久时即使没有空闲也强制执行一小片
+// E. 帧间隔跟随 VSync 时间戳, 异常时间戳被忽略
+// F. 没有 VSync 时兜底定时器执行超过截止时间的任务, 同一时刻只申请一个定时器
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "libohos_render/foundation/thread/KRIdleTaskQueue.h"
+#include "test_common.h"
+
+static constexpr int64_t kMs = 1000000;
+
+struct FakeClock {
+    int64_t now = 1000 * kMs;
+    int64_t operator()() const {
+        return now;
+    }
+};
+
+static void TestFrameRequests() {
+    KRIdleTaskQueue queue;
+    CHECK(queue.Enqueue([] {}, 0), "A first post requests a frame");
+    CHECK(!queue.Enqueue([] {}, 0), "A second post does not");
+    FakeClock clock;
+    queue.BeginFrame(clock.now, clock.now);
+    CHECK(queue.Enqueue([] {}, 0), "A post after frame start requests again");
+    CHECK(!queue.NeedsFrame(), "A no duplicate request after slice");
+    queue.BeginFrame(clock.now + 16 * kMs, clock.now + 16 * kMs);
+    clock.now += 16 * kMs;
+    CHECK(queue.RunSlice(clock) == 3 && !queue.NeedsFrame(), "A drained queue needs no frame");
+}
+
+static void TestSliceBudget() {
+    KRIdleTaskQueue queue;
+    FakeClock clock;
+    int ran = 0;
+    for (int i = 0; i < 100; i++) {
+        queue.Enqueue(
+            [&clock, &ran] {
+                clock.now += kMs;
+                ran++;
+            },
+            clock.now);
+    }
+    // 帧刚开始：剩余约 15.6ms，但单片上限 4ms
+    queue.BeginFrame(clock.now, clock.now);
+    auto start = clock.now;
+    auto count = queue.RunSlice(clock);
+    CHECK(count == 4 && clock.now - start <= KRIdleTaskQueue::kMaxSliceNs, "B capped by max slice (%zu)", count);
+    // 下一帧，帧内工作已用掉 13ms：只剩约 2.6ms
+    auto frame = start + KRIdleTaskQueue::kDefaultFrameIntervalNs;
+    clock.now = frame;
+    queue.BeginFrame(frame, clock.now);
+    clock.now += 13 * kMs;
+    count = queue.RunSlice(clock);
+    CHECK(count == 3, "B capped by frame deadline (%zu)", count);
+    // 帧内工作超时：不执行
+    frame += KRIdleTaskQueue::kDefaultFrameIntervalNs;
+    clock.now = frame;
+    queue.BeginFrame(frame, clock.now);
+    clock.now += 20 * kMs;
+    count = queue.RunSlice(clock);
+    CHECK(count == 0 && queue.NeedsFrame(), "B over-budget frame skipped, frame requested");
+}
+
+static void TestDelayAndOrder() {
+    KRIdleTaskQueue queue;
+    FakeClock clock;
+    std::vector<int> order;
+    queue.Enqueue([&order] { order.push_back(1); }, clock.now + 32 * kMs);
+    queue.Enqueue([&order] { order.push_back(2); }, clock.now);
+    queue.Enqueue([&order] { order.push_back(3); }, clock.now + 32 * kMs);
+    queue.Enqueue([&order] { order.push_back(4); }, clock.now);
+    queue.BeginFrame(clock.now, clock.now);
+    queue.RunSlice(clock);
+    CHECK(order == std::vector<int>({2, 4}) && queue.PendingCount() == 2, "C delayed tasks wait");
+    clock.now += 33 * kMs;
+    queue.BeginFrame(clock.now, clock.now);
+    queue.RunSlice(clock);
+    CHECK(order == std::vector<int>({2, 4, 1, 3}), "C eligible then posting order");
+}
+
+static void TestStarvation() {
+    KRIdleTaskQueue queue;
+    FakeClock clock;
+    int ran = 0;
+    for (int i = 0; i < 10; i++) {
+        queue.Enqueue(
+            [&clock, &ran] {
+                clock.now += kMs;
+                ran++;
+            },
+            clock.now);
+    }
+    queue.BeginFrame(clock.now, clock.now);
+    clock.now += 20 * kMs;
+    CHECK(queue.RunSlice(clock) == 0, "D not starving yet");
+    clock.now += KRIdleTaskQueue::kStarvationNs;
+    queue.BeginFrame(clock.now, clock.now);
+    clock.now += 20 * kMs;
+    auto count = queue.RunSlice(clock);
+    CHECK(count == 2, "D starving queue forced a small slice (%zu)", count);
+}
+
+static void TestFrameInterval() {
+    KRIdleTaskQueue queue;
+    FakeClock clock;
+    CHECK(queue.FrameInterval() == KRIdleTaskQueue::kDefaultFrameIntervalNs, "E default 60Hz");
+    queue.BeginFrame(clock.now, clock.now);
+    clock.now += 8333333;
+    queue.BeginFrame(clock.now, clock.now);
+    CHECK(queue.FrameInterval() == 8333333, "E follows 120Hz immediately");
+    clock.now += 100 * kMs;
+    queue.BeginFrame(clock.now, clock.now);
+    CHECK(queue.FrameInterval() == 8333333, "E idle gap ignored");
+    clock.now += 16666667;
+    queue.BeginFrame(clock.now, clock.now);
+    CHECK(queue.FrameInterval() > 8333333 && queue.FrameInterval() < 16666667, "E slows down gradually");
+    auto before = queue.FrameInterval();
+    clock.now += 100 * kMs;
+    queue.BeginFrame(0, clock.now);
+    queue.BeginFrame(clock.now + kMs, clock.now);
+    CHECK(queue.FrameInterval() == before, "E invalid timestamps fall back to now");
+}
+
+static void TestDeadline() {
+    KRIdleTaskQueue queue;
+    FakeClock clock;
+    int64_t fire_at = 0;
+    CHECK(!queue.ArmDeadline(&fire_at), "F empty queue arms no deadline");
+    std::vector<int> order;
+    auto start = clock.now;
+    queue.Enqueue([&order] { order.push_back(1); }, start + 32 * kMs);
+    queue.Enqueue([&order] { order.push_back(2); }, start);
+    CHECK(queue.ArmDeadline(&fire_at) && fire_at == start + KRIdleTaskQueue::kDeadlineNs,
+          "F deadline follows earliest task");
+    CHECK(!queue.ArmDeadline(&fire_at), "F only one deadline at a time");
+    // 没有任何帧：定时器到期只执行已超时的任务
+    clock.now = fire_at;
+    CHECK(queue.RunOverdue(clock) == 1 && order == std::vector<int>({2}), "F overdue task ran without frames");
+    CHECK(queue.ArmDeadline(&fire_at) && fire_at == start + 32 * kMs + KRIdleTaskQueue::kDeadlineNs,
+          "F re-armed for remaining task");
+    clock.now = fire_at;
+    CHECK(queue.RunOverdue(clock) == 1 && queue.PendingCount() == 0 && !queue.ArmDeadline(&fire_at),
+          "F drained queue needs no deadline");
+    // 大量积压时单次兜底不超过 kMaxSliceNs
+    for (int i = 0; i < 10; i++) {
+        queue.Enqueue([&clock] { clock.now += kMs; }, clock.now);
+    }
+    queue.ArmDeadline(&fire_at);
+    clock.now = fire_at;
+    auto count = queue.RunOverdue(clock);
+    CHECK(count == 4 && queue.ArmDeadline(&fire_at) && fire_at < clock.now, "F overdue flush sliced (%zu)", count);
+}
+
+int main() {
+    std::printf("\n=== Test: KRIdleTaskQueue ===\n");
+    TestFrameRequests();
+    TestSliceBudget();
+    TestDelayAndOrder();
+    TestStarvation();
+    TestFrameInterval();
+    TestDeadline();
+    return TestResult();
+}
@@ -0,0 +1,110 @@
+// 验证 KRMoveEventCoalescer 的合并规则。
+//
+// A. 同一帧内多次 move 只投递最后一次, 之前的点作为历史采样按顺序带出
+// B. 每帧只申请一次刷新, OnFrame 后可再次申请
+// C. 指针集合变化时先投递已合并事件
+// D. down/up/cancel 前 Flush 保证顺序; Clear 丢弃未投递事件
+// E. 历史采样数量有上限, 保留最新的点
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "libohos_render/expand/events/KRMoveEventCoalescer.h"
+#include "test_common.h"
+
+struct Delivery {
+    std::string payload;
+    std::vector<KRCoalescedMoveSample> history;
+};
+
+struct Harness {
+    std::vector<std::string> log;  // 投递顺序, 包含模拟的 down/up
+    std::vector<Delivery> deliveries;
+    int frame_requests = 0;
+    KRMoveEventCoalescer<std::string> coalescer{
+        [this](std::string &payload, const std::vector<KRCoalescedMoveSample> &history) {
+            log.push_back(payload);
+            deliveries.push_back({payload, history});
+        }};
+
+    void Move(uint64_t key, float x, int64_t t) {
+        std::string payload = "move" + std::to_string(static_cast<int>(x));
+        if (coalescer.Push(key, {x, x, t}, std::move(payload))) {
+            frame_requests++;
+        }
+    }
+    void NonMove(const std::string &name) {
+        coalescer.Flush();
+        log.push_back(name);
+    }
+};
+
+static void TestCoalesceWithinFrame() {
+    Harness h;
+    for (int i = 1; i <= 4; i++) {
+        h.Move(1, static_cast<float>(i), i * 4);
+    }
+    CHECK(h.deliveries.empty(), "A nothing delivered before frame");
+    CHECK(h.frame_requests == 1, "B one frame request for 4 moves (got %d)", h.frame_requests);
+    h.coalescer.OnFrame();
+    CHECK(h.deliveries.size() == 1 && h.deliveries[0].payload == "move4", "A delivered latest move");
+    const auto &history = h.deliveries[0].history;
+    CHECK(history.size() == 3 && history[0].x == 1 && history[2].x == 3 && history[2].timestamp_ms == 12,
+          "A history keeps previous points in order (size=%zu)", history.size());
+    h.Move(1, 5, 20);
+    CHECK(h.frame_requests == 2, "B new frame requested after OnFrame");
+    h.coalescer.OnFrame();
+    CHECK(h.deliveries.size() == 2 && h.deliveries[1].history.empty(), "A single move has no history");
+    h.coalescer.OnFrame();
+    CHECK(h.deliveries.size() == 2, "A empty frame delivers nothing");
+}
+
+static void TestPointerSetChange() {
+    Harness h;
+    h.Move(1, 1, 1);
+    h.Move(1, 2, 2);
+    h.Move(2, 3, 3);  // 第二指按下后指针集合变化
+    CHECK(h.deliveries.size() == 1 && h.deliveries[0].payload == "move2" && h.deliveries[0].history.size() == 1,
+          "C pointer set change flushes previous group");
+    h.coalescer.OnFrame();
+    CHECK(h.deliveries.size() == 2 && h.deliveries[1].payload == "move3" && h.deliveries[1].history.empty(),
+          "C new group starts fresh history");
+}
+
+static void TestOrderingAndClear() {
+    Harness h;
+    h.NonMove("down");
+    h.Move(1, 1, 1);
+    h.Move(1, 2, 2);
+    h.NonMove("up");
+    h.coalescer.OnFrame();
+    std::vector<std::string> expected{"down", "move2", "up"};
+    CHECK(h.log == expected, "D down/move/up order preserved");
+    h.Move(1, 3, 3);
+    h.coalescer.Clear();
+    h.coalescer.OnFrame();
+    CHECK(h.log.size() == 3 && !h.coalescer.HasPending(), "D clear drops pending move");
+}
+
+static void TestHistoryCap() {
+    Harness h;
+    const int total = static_cast<int>(KRMoveEventCoalescer<std::string>::kMaxHistorySamples) + 10;
+    for (int i = 0; i < total; i++) {
+        h.Move(1, static_cast<float>(i), i);
+    }
+    h.coalescer.OnFrame();
+    const auto &history = h.deliveries[0].history;
+    CHECK(history.size() == KRMoveEventCoalescer<std::string>::kMaxHistorySamples &&
+              history.back().x == static_cast<float>(total - 2) && history.front().x == 9.0f,
+          "E history capped at %zu keeping newest", history.size());
+}
+
+int main() {
+    std::printf("\n=== Test: KRMoveEventCoalescer ===\n");
+    TestCoalesceWithinFrame();
+    TestPointerSetChange();
+    TestOrderingAndClear();
+    TestHistoryCap();
+    return TestResult();
+}
@@ -0,0 +1,328 @@
+// 验证 KRPendingUIOps 合并后的执行结果与逐条执行一致。
+//
+// A. 同一 view 同一 key 的属性只执行最后一次, 事件与属性互不覆盖
+// B. 暂存期间创建又移除的 view 连同其属性、插入一起抵消
+// C. 被保留的子节点插入过的父节点不抵消
+// D. 与 view 无关的操作保持原顺序
+// E. 随机操作序列合并前后, 从根可达的视图树与属性一致, view 方法调用看到的属性一致
+// F. 属性合并保持第一次设置的位置, 不越过同一 view 的方法调用
+// G. 被抵消的 view 方法调用在原位置执行 drop_task, 其他 view 的不受影响
+
+#include <cstdio>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "libohos_render/scheduler/KRPendingUIOps.h"
+#include "test_common.h"
+
+using Kind = KRPendingUIOp::Kind;
+
+static constexpr int kRootTag = -1;
+static constexpr int kPreexisting = 5;  // E 中暂存前已有的 view 数，tag 为 1..kPreexisting
+
+// 简化的渲染层：移除的 view 从父节点摘下，其子节点留在它下面（与真实渲染层一致）
+struct FakeTree {
+    struct Node {
+        int parent = 0;
+        bool has_parent = false;
+        std::vector<int> children;
+        std::map<std::string, int> props;
+    };
+    std::map<int, Node> nodes{{kRootTag, Node()}};
+    std::vector<std::string> log;
+
+    void Detach(int tag) {
+        auto &node = nodes[tag];
+        if (node.has_parent && nodes.count(node.parent)) {
+            auto &siblings = nodes[node.parent].children;
+            for (auto it = siblings.begin(); it != siblings.end(); ++it) {
+                if (*it == tag) {
+                    siblings.erase(it);
+                    break;
+                }
+            }
+        }
+        node.has_parent = false;
+    }
+
+    std::string Dump(int tag) const {
+        auto it = nodes.find(tag);
+        std::string out = "(" + std::to_string(tag);
+        for (const auto &[key, value] : it->second.props) {
+            out += " " + key + "=" + std::to_string(value);
+        }
+        for (int child : it->second.children) {
+            out += Dump(child);
+        }
+        return out + ")";
+    }
+};
+
+struct OpMaker {
+    FakeTree *tree;
+
+    KRPendingUIOp Create(int tag) const {
+        auto t = tree;
+        return {Kind::kCreate, tag, 0, "", [t, tag] { t->nodes[tag] = FakeTree::Node(); }, nullptr};
+    }
+    KRPendingUIOp Remove(int tag) const {
+        auto t = tree;
+        return {Kind::kRemove, tag, 0, "", [t, tag] {
+                    if (t->nodes.count(tag)) {
+                        t->Detach(tag);
+                        t->nodes.erase(tag);
+                    }
+                }, nullptr};
+    }
+    KRPendingUIOp Insert(int parent, int tag) const {
+        auto t = tree;
+        return {Kind::kInsert, tag, parent, "", [t, parent, tag] {
+                    if (!t->nodes.count(parent) || !t->nodes.count(tag)) {
+                        return;
+                    }
+                    t->Detach(tag);
+                    t->nodes[parent].children.push_back(tag);
+                    t->nodes[tag].parent = parent;
+                    t->nodes[tag].has_parent = true;
+                }, nullptr};
+    }
+    KRPendingUIOp Prop(int tag, const std::string &key, int value, Kind kind = Kind::kProp) const {
+        auto t = tree;
+        // 事件与属性由不同的处理器持有，同名也互不覆盖
+        auto slot = kind == Kind::kEvent ? "@" + key : key;
+        return {kind, tag, 0, key, [t, tag, slot, value] {
+                    if (t->nodes.count(tag)) {
+                        t->nodes[tag].props[slot] = value;
+                    }
+                }, nullptr};
+    }
+    // view 方法调用：记录调用时该 view 的属性
+    KRPendingUIOp ViewCall(int tag) const {
+        auto t = tree;
+        return {Kind::kViewCall, tag, 0, "", [t, tag] {
+                    if (t->nodes.count(tag)) {
+                        std::string out = std::to_string(tag);
+                        for (const auto &[key, value] : t->nodes[tag].props) {
+                            out += " " + key + "=" + std::to_string(value);
+                        }
+                        t->log.push_back(out);
+                    }
+                }, nullptr};
+    }
+    KRPendingUIOp Other(const std::string &name) const {
+        auto t = tree;
+        return {Kind::kOther, 0, 0, "", [t, name] { t->log.push_back(name); }, nullptr};
+    }
+};
+
+static void Run(std::vector<std::function<void()>> tasks) {
+    for (auto &task : tasks) {
+        task();
+    }
+}
+
+static void TestPropCoalescing() {
+    FakeTree tree;
+    OpMaker make{&tree};
+    tree.nodes[1] = FakeTree::Node();
+    KRPendingUIOps ops;
+    int runs = 0;
+    for (int i = 0; i < 5; i++) {
+        auto op = make.Prop(1, "opacity", i);
+        auto inner = op.task;
+        op.task = [inner, &runs] {
+            runs++;
+            inner();
+        };
+        ops.Add(std::move(op));
+    }
+    ops.Add(make.Prop(1, "opacity", 9, Kind::kEvent));
+    CHECK(ops.Size() == 2 && ops.CoalescedCount() == 4, "A size after coalescing");
+    Run(ops.Drain());
+    CHECK(runs == 1 && tree.nodes[1].props["opacity"] == 4 && tree.nodes[1].props["@opacity"] == 9,
+          "A only latest prop runs, event kept separately");
+    CHECK(ops.Empty() && ops.Drain().empty(), "A drained");
+}
+
+static void TestCreateRemoveCancel() {
+    FakeTree tree;
+    OpMaker make{&tree};
+    KRPendingUIOps ops;
+    int runs = 0;
+    auto counted = [&runs](KRPendingUIOp op) {
+        auto inner = op.task;
+        op.task = [inner, &runs] {
+            runs++;
+            inner();
+        };
+        return op;
+    };
+    ops.Add(counted(make.Create(2)));
+    ops.Add(counted(make.Create(3)));
+    ops.Add(counted(make.Insert(2, 3)));
+    ops.Add(counted(make.Insert(kRootTag, 2)));
+    ops.Add(counted(make.Prop(2, "frame", 1)));
+    ops.Add(counted(make.Remove(3)));
+    ops.Add(counted(make.Remove(2)));
+    Run(ops.Drain());
+    CHECK(runs == 0 && tree.Dump(kRootTag) == "(-1)", "B created and removed subtree cancelled");
+}
+
+static void TestKeptChildBlocksCancel() {
+    FakeTree tree;
+    OpMaker make{&tree};
+    tree.nodes[1] = FakeTree::Node();
+    KRPendingUIOps ops;
+    ops.Add(make.Create(2));
+    ops.Add(make.Insert(kRootTag, 2));
+    ops.Add(make.Insert(2, 1));  // 暂存前就存在的 view 1 被移到 2 下面
+    ops.Add(make.Remove(2));
+    ops.Add(make.Insert(kRootTag, 1));
+    Run(ops.Drain());
+    CHECK(tree.Dump(kRootTag) == "(-1(1))", "C parent of kept child not cancelled");
+}
+
+static void TestOtherOrder() {
+    FakeTree tree;
+    OpMaker make{&tree};
+    KRPendingUIOps ops;
+    ops.Add(make.Other("a"));
+    ops.Add(make.Create(5));
+    ops.Add(make.Other("b"));
+    ops.Add(make.Remove(5));
+    ops.Add(make.Other("c"));
+    Run(ops.Drain());
+    CHECK(tree.log == std::vector<std::string>({"a", "b", "c"}), "D unrelated ops keep order");
+}
+
+static void TestCoalescedPropPosition() {
+    FakeTree tree;
+    OpMaker make{&tree};
+    tree.nodes[1] = FakeTree::Node();
+    KRPendingUIOps ops;
+    std::vector<std::string> order;
+    auto named = [&order](KRPendingUIOp op, const std::string &name) {
+        auto inner = op.task;
+        op.task = [inner, &order, name] {
+            order.push_back(name);
+            inner();
+        };
+        return op;
+    };
+    ops.Add(named(make.Prop(1, "frame", 1), "frame"));
+    ops.Add(named(make.Prop(1, "opacity", 1), "opacity"));
+    ops.Add(named(make.Prop(1, "frame", 2), "frame"));
+    CHECK(ops.Size() == 2, "F repeated prop coalesced");
+    ops.Add(make.ViewCall(1));
+    ops.Add(make.Prop(1, "frame", 3));
+    ops.Add(make.ViewCall(1));
+    ops.Add(make.Prop(1, "frame", 4));
+    Run(ops.Drain());
+    CHECK(order == std::vector<std::string>({"frame", "opacity"}), "F coalesced prop keeps first position");
+    CHECK(tree.log == std::vector<std::string>({"1 frame=2 opacity=1", "1 frame=3 opacity=1"}),
+          "F view call sees props set before it");
+    CHECK(tree.nodes[1].props["frame"] == 4, "F latest value applied");
+}
+
+static void TestRandomAgainstDirect() {
+    std::mt19937 rng(11);
+    bool same = true;
+    uint64_t coalesced = 0;
+    for (int round = 0; round < 300 && same; round++) {
+        FakeTree direct;
+        FakeTree merged;
+        OpMaker make_direct{&direct};
+        OpMaker make_merged{&merged};
+        std::vector<int> alive;
+        int next_tag = 1;
+        // 暂存前已有的树
+        auto apply_both = [&](auto build) {
+            build(make_direct).task();
+            build(make_merged).task();
+        };
+        for (int i = 0; i < kPreexisting; i++) {
+            int tag = next_tag++;
+            apply_both([tag](const OpMaker &m) { return m.Create(tag); });
+            int parent = alive.empty() || rng() % 3 == 0 ? kRootTag : alive[rng() % alive.size()];
+            apply_both([parent, tag](const OpMaker &m) { return m.Insert(parent, tag); });
+            alive.push_back(tag);
+        }
+        KRPendingUIOps ops;
+        int steps = 1 + static_cast<int>(rng() % 80);
+        for (int i = 0; i < steps; i++) {
+            auto roll = rng() % 11;
+            std::function<KRPendingUIOp(const OpMaker &)> build;
+            if (roll < 2 || alive.empty()) {
+                int tag = next_tag++;
+                alive.push_back(tag);
+                build = [tag](const OpMaker &m) { return m.Create(tag); };
+            } else if (roll < 4) {
+                int tag = alive[rng() % alive.size()];
+                int parent = rng() % 3 == 0 ? kRootTag : alive[rng() % alive.size()];
+                if (parent == tag) {
+                    parent = kRootTag;
+                }
+                build = [parent, tag](const OpMaker &m) { return m.Insert(parent, tag); };
+            } else if (roll < 5) {
+                auto index = rng() % alive.size();
+                int tag = alive[index];
+                alive.erase(alive.begin() + index);
+                build = [tag](const OpMaker &m) { return m.Remove(tag); };
+            } else if (roll == 10 && alive.front() <= kPreexisting) {
+                int tag = alive.front();
+                build = [tag](const OpMaker &m) { return m.ViewCall(tag); };
+            } else {
+                int tag = alive[rng() % alive.size()];
+                std::string key = rng() % 2 ? "frame" : "opacity";
+                int value = static_cast<int>(rng() % 100);
+                auto kind = rng() % 4 == 0 ? Kind::kEvent : Kind::kProp;
+                build = [tag, key, value, kind](const OpMaker &m) { return m.Prop(tag, key, value, kind); };
+            }
+            build(make_direct).task();
+            ops.Add(build(make_merged));
+        }
+        Run(ops.Drain());
+        coalesced += ops.CoalescedCount();
+        same = direct.Dump(kRootTag) == merged.Dump(kRootTag) && direct.log == merged.log;
+        if (!same) {
+            std::printf("round %d\n  direct: %s\n  merged: %s\n", round, direct.Dump(kRootTag).c_str(),
+                        merged.Dump(kRootTag).c_str());
+        }
+    }
+    CHECK(same && coalesced > 0, "E random sequences match direct apply (coalesced %llu)",
+          static_cast<unsigned long long>(coalesced));
+}
+
+static void TestDropTask() {
+    FakeTree tree;
+    OpMaker make{&tree};
+    tree.nodes[1] = FakeTree::Node();
+    KRPendingUIOps ops;
+    auto with_drop = [&tree](KRPendingUIOp op, const std::string &name) {
+        auto t = &tree;
+        op.drop_task = [t, name] { t->log.push_back(name); };
+        return op;
+    };
+    ops.Add(make.Create(2));
+    ops.Add(with_drop(make.ViewCall(2), "drop 2"));
+    ops.Add(make.Other("a"));
+    ops.Add(with_drop(make.ViewCall(1), "drop 1"));
+    ops.Add(make.Remove(2));
+    Run(ops.Drain());
+    CHECK(tree.log == std::vector<std::string>({"drop 2", "a", "1"}), "G dropped view call runs drop_task in place");
+}
+
+int main() {
+    std::printf("\n=== Test: KRPendingUIOps ===\n");
+    TestPropCoalescing();
+    TestCreateRemoveCancel();
+    TestKeptChildBlocksCancel();
+    TestOtherOrder();
+    TestRandomAgainstDirect();
+    TestCoalescedPropPosition();
+    TestDropTask();
+    return TestResult();
+}
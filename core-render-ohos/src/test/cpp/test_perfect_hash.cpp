@@ -0,0 +1,94 @@
+// 验证 KRPerfectHashIndex 的编译期构建与查找语义。
+//
+// A. 编译期即可查找(static_assert), 内置组件名全部命中且下标正确
+// B. 不在表中的名字、前缀/后缀相同的名字、空串都不命中
+// C. 单个条目与大量随机条目都能找到无冲突的种子
+// D. 运行期字符串(std::string)查找结果与编译期一致
+
+#include <cstdio>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "libohos_render/foundation/KRPerfectHash.h"
+#include "test_common.h"
+
+struct NamedEntry {
+    std::string_view name;
+    int value;
+};
+
+static constexpr NamedEntry kViews[] = {
+    {"KRView", 0},          {"KRImageView", 1},          {"KRWrapperImageView", 2},   {"KRRichTextView", 3},
+    {"KRGradientRichTextView", 4}, {"KRListView", 5},    {"KRScrollView", 6},         {"KRScrollContentView", 7},
+    {"KRTextFieldView", 8}, {"KRTextAreaView", 9},       {"KRModalView", 10},         {"KRActivityIndicatorView", 11},
+    {"KRHoverView", 12},    {"KRAPNGView", 13},          {"HRAPNGView", 14},          {"KRCanvasView", 15},
+    {"KRMaskView", 16},
+};
+
+static constexpr KRPerfectHashIndex<17> kViewIndex(kViews, [](const NamedEntry &entry) { return entry.name; });
+
+static_assert(kViewIndex.Find("KRView") == 0, "compile time lookup");
+static_assert(kViewIndex.Find("KRMaskView") == 16, "compile time lookup");
+static_assert(kViewIndex.Find("KRUnknownView") == -1, "compile time miss");
+
+static void TestBuiltinNames() {
+    bool all = true;
+    for (const auto &entry : kViews) {
+        all = all && kViewIndex.Find(entry.name) == entry.value;
+    }
+    CHECK(all, "A all builtin names hit");
+    CHECK(KRPerfectHashIndex<17>::kSlotCount == 64 && KRPerfectHashIndex<17>::kBucketCount == 32, "A table size");
+}
+
+static void TestMisses() {
+    CHECK(kViewIndex.Find("") == -1, "B empty");
+    CHECK(kViewIndex.Find("KRVie") == -1 && kViewIndex.Find("KRViewX") == -1, "B prefix / suffix");
+    CHECK(kViewIndex.Find("krview") == -1, "B case sensitive");
+    CHECK(kViewIndex.Find("FORWARD_ARKTS_VIEW_NAME") == -1, "B forward name not builtin");
+}
+
+static void TestSeedSearch() {
+    static constexpr NamedEntry single[] = {{"only", 0}};
+    constexpr KRPerfectHashIndex<1> single_index(single, [](const NamedEntry &entry) { return entry.name; });
+    CHECK(single_index.Find("only") == 0 && single_index.Find("other") == -1, "C single entry");
+
+    std::mt19937 rng(11);
+    std::set<std::string> unique;
+    while (unique.size() < 200) {
+        std::string name = "KR";
+        int length = 3 + static_cast<int>(rng() % 20);
+        for (int i = 0; i < length; i++) {
+            name.push_back(static_cast<char>('A' + rng() % 52 % 26 + (rng() % 2 ? 32 : 0)));
+        }
+        unique.insert(name);
+    }
+    std::vector<std::string> names(unique.begin(), unique.end());
+    NamedEntry entries[200];
+    for (int i = 0; i < 200; i++) {
+        entries[i] = {names[i], i};
+    }
+    KRPerfectHashIndex<200> index(entries, [](const NamedEntry &entry) { return entry.name; });
+    bool all = true;
+    for (int i = 0; i < 200; i++) {
+        all = all && index.Find(names[i]) == i && index.Find(names[i] + "_") == -1;
+    }
+    CHECK(all, "C 200 random keys, seed %u", index.Seed());
+}
+
+static void TestRuntimeStrings() {
+    std::string name = "KRScroll";
+    name += "View";
+    CHECK(kViewIndex.Find(name) == 6, "D std::string lookup");
+}
+
+int main() {
+    std::printf("\n=== Test: KRPerfectHashIndex ===\n");
+    TestBuiltinNames();
+    TestMisses();
+    TestSeedSearch();
+    TestRuntimeStrings();
+    return TestResult();
+}
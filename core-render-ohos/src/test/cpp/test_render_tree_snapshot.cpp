@@ -0,0 +1,210 @@
+// 验证首帧快照的记录、编解码与对账逻辑。
+//
+// A. 记录: 插入位置、移动、删除后子树不可达、属性按首次顺序覆盖
+// B. 编解码: 往返一致(含 shadow)、key 不一致失败、截断与篡改失败
+// C. 文件: 写入后读出一致, 不存在的文件读取失败
+// D. 对账: 同一棵树回放后所有操作都被跳过, 收尾无差异
+// E. 对账: 名字不一致替换、值变化下发、陈旧属性、未认领节点、顺序变化
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "libohos_render/layer/KRRenderTreeReconciler.h"
+#include "libohos_render/layer/KRRenderTreeSnapshot.h"
+#include "test_common.h"
+
+static const int32_t kRoot = KRRenderTreeSnapshot::kRootTag;
+
+// 根 -> 1(KRView) -> [2(KRRichTextView), 3(KRImageView)]
+static void BuildPage(KRRenderTreeSnapshot &tree) {
+    tree.RecordCreate(1, "KRView");
+    tree.RecordCreate(2, "KRRichTextView");
+    tree.RecordCreate(3, "KRImageView");
+    tree.RecordProp(1, "backgroundColor", KRTreePropValue::String("#ffffff"));
+    tree.RecordProp(1, "frame", KRTreePropValue::Bytes(std::string("\x00\x00\x80\x3f", 4)));
+    tree.RecordProp(2, "opacity", KRTreePropValue::Double(0.5));
+    tree.RecordProp(3, "src", KRTreePropValue::String("https://example.com/a.png"));
+    tree.RecordProp(3, "visibility", KRTreePropValue::Bool(true));
+    tree.RecordProp(3, "zIndex", KRTreePropValue::Int(-3));
+    tree.RecordInsert(kRoot, 1, 0);
+    tree.RecordInsert(1, 2, -1);
+    tree.RecordInsert(1, 3, -1);
+    tree.RecordCreateShadow(2, "KRRichTextView");
+    tree.RecordShadowProp(2, "values", KRTreePropValue::Json("[{\"value\":\"hello\"}]"));
+    tree.RecordShadowProp(2, "lineHeight", KRTreePropValue::Null());
+    tree.RecordShadowConstraint(2, 320, 100000);
+}
+
+static bool SameTree(const KRRenderTreeSnapshot &a, const KRRenderTreeSnapshot &b) {
+    if (a.PreOrder() != b.PreOrder()) {
+        return false;
+    }
+    for (auto tag : a.PreOrder()) {
+        auto na = a.Node(tag);
+        auto nb = b.Node(tag);
+        if (na->view_name != nb->view_name || na->parent_tag != nb->parent_tag || na->props != nb->props) {
+            return false;
+        }
+        auto sa = a.Shadow(tag);
+        auto sb = b.Shadow(tag);
+        if ((sa == nullptr) != (sb == nullptr)) {
+            return false;
+        }
+        if (sa != nullptr && (sa->view_name != sb->view_name || sa->props != sb->props ||
+                              sa->has_constraint != sb->has_constraint ||
+                              sa->constraint_width != sb->constraint_width ||
+                              sa->constraint_height != sb->constraint_height)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void TestRecord() {
+    KRRenderTreeSnapshot tree;
+    BuildPage(tree);
+    CHECK(tree.PreOrder() == std::vector<int32_t>({1, 2, 3}), "A pre-order");
+    tree.RecordCreate(4, "KRView");
+    tree.RecordInsert(1, 4, 1);
+    CHECK(tree.Children(1) == std::vector<int32_t>({2, 4, 3}), "A insert at index");
+    tree.RecordInsert(1, 4, 100);
+    CHECK(tree.Children(1) == std::vector<int32_t>({2, 3, 4}), "A move out of range appends");
+    tree.RecordInsert(4, 1, 0);
+    CHECK(tree.Node(1)->parent_tag == kRoot, "A insert into own subtree ignored");
+    tree.RecordProp(1, "backgroundColor", KRTreePropValue::String("#000000"));
+    tree.RecordProp(1, "borderRadius", KRTreePropValue::Double(4));
+    tree.ForgetProp(1, "frame");
+    const auto &props = tree.Node(1)->props;
+    CHECK(props.size() == 2 && props[0].first == "backgroundColor" && props[0].second.string_value == "#000000" &&
+              props[1].first == "borderRadius",
+          "A props keep first order");
+    tree.RecordCreate(5, "KRView");
+    tree.RecordInsert(4, 5, 0);
+    tree.RecordRemove(4);
+    CHECK(tree.PreOrder() == std::vector<int32_t>({1, 2, 3}) && tree.Node(5) != nullptr &&
+              tree.Node(5)->parent_tag == KRRenderTreeSnapshot::kDetachedTag,
+          "A removed subtree unreachable");
+}
+
+static void TestCodec() {
+    KRRenderTreeSnapshot tree;
+    BuildPage(tree);
+    tree.RecordCreate(9, "KRView");  // 未挂载的节点不落盘
+    auto data = tree.Encode("page|1.0");
+    KRRenderTreeSnapshot decoded;
+    CHECK(decoded.Decode(data, "page|1.0") && SameTree(tree, decoded) && decoded.Node(9) == nullptr,
+          "B round trip (%zu bytes)", data.size());
+    CHECK(!decoded.Decode(data, "page|1.1") && decoded.Empty(), "B key mismatch rejected");
+    bool truncated_rejected = true;
+    for (size_t length = 0; length < data.size(); length++) {
+        truncated_rejected = truncated_rejected && !decoded.Decode(data.substr(0, length), "page|1.0");
+    }
+    CHECK(truncated_rejected, "B every truncation rejected");
+    CHECK(!decoded.Decode(data + "x", "page|1.0"), "B trailing bytes rejected");
+    auto corrupted = data;
+    corrupted[0] = 'X';
+    CHECK(!decoded.Decode(corrupted, "page|1.0"), "B bad magic rejected");
+    bool no_crash = true;
+    for (size_t i = 0; i < data.size(); i++) {
+        auto flipped = data;
+        flipped[i] = static_cast<char>(flipped[i] ^ 0x5A);
+        if (decoded.Decode(flipped, "page|1.0")) {
+            no_crash = no_crash && decoded.PreOrder().size() <= 3;
+        }
+    }
+    CHECK(no_crash, "B flipped bytes never produce a larger tree");
+}
+
+static void TestFile() {
+    KRRenderTreeSnapshot tree;
+    BuildPage(tree);
+    auto data = tree.Encode("k");
+    const std::string path = "/tmp/kr_render_tree_snapshot_test.bin";
+    std::string read_back;
+    CHECK(KRRenderTreeSnapshot::WriteFile(path, data) && KRRenderTreeSnapshot::ReadFile(path, read_back) &&
+              read_back == data,
+          "C write then read");
+    std::remove(path.c_str());
+    CHECK(!KRRenderTreeSnapshot::ReadFile(path, read_back), "C missing file");
+}
+
+static void TestReconcileSameTree() {
+    auto replayed = std::make_shared<KRRenderTreeSnapshot>();
+    BuildPage(*replayed);
+    KRRenderTreeReconciler reconciler(replayed);
+    KRRenderTreeSnapshot live;
+    bool all_reused = true;
+    bool all_props_skipped = true;
+    for (auto tag : replayed->PreOrder()) {
+        auto node = replayed->Node(tag);
+        all_reused = all_reused && reconciler.OnCreate(tag, node->view_name) == KRRenderTreeReconciler::CreateAction::kReuse;
+        live.RecordCreate(tag, node->view_name);
+        for (const auto &prop : node->props) {
+            all_props_skipped = all_props_skipped && reconciler.ShouldSkipProp(tag, prop.first, prop.second);
+            live.RecordProp(tag, prop.first, prop.second);
+        }
+    }
+    CHECK(all_reused && all_props_skipped, "D creates reused, props skipped");
+    CHECK(!reconciler.ShouldSkipProp(1, "backgroundColor", KRTreePropValue::String("#ffffff")),
+          "D second set of same key applied");
+    CHECK(!reconciler.ShouldSkipInsert(kRoot, 1), "D root insert never skipped");
+    CHECK(reconciler.ShouldSkipInsert(1, 2) && reconciler.ShouldSkipInsert(1, 3), "D inserts skipped");
+    CHECK(!reconciler.ShouldSkipInsert(1, 3), "D second insert applied");
+    live.RecordInsert(kRoot, 1, 0);
+    live.RecordInsert(1, 2, -1);
+    live.RecordInsert(1, 3, -1);
+    auto result = reconciler.Finish(live);
+    CHECK(result.unclaimed_tags.empty() && result.stale_props.empty() && result.reorder_parents.empty(),
+          "D nothing left to fix");
+}
+
+static void TestReconcileDiff() {
+    auto replayed = std::make_shared<KRRenderTreeSnapshot>();
+    BuildPage(*replayed);
+    KRRenderTreeReconciler reconciler(replayed);
+    using Action = KRRenderTreeReconciler::CreateAction;
+    CHECK(reconciler.OnCreate(1, "KRView") == Action::kReuse, "E reuse");
+    CHECK(reconciler.OnCreate(1, "KRView") == Action::kCreate, "E second create not reused");
+    CHECK(reconciler.OnCreate(3, "KRTextFieldView") == Action::kReplace && !reconciler.IsClaimed(3),
+          "E name mismatch replaced");
+    CHECK(reconciler.OnCreate(7, "KRView") == Action::kCreate, "E unknown tag created");
+    CHECK(!reconciler.ShouldSkipProp(1, "backgroundColor", KRTreePropValue::String("#eeeeee")), "E changed value applied");
+    CHECK(!reconciler.ShouldSkipProp(1, "frame", KRTreePropValue::String(std::string("\x00\x00\x80\x3f", 4))),
+          "E same bytes different type applied");
+    CHECK(!reconciler.ShouldSkipProp(3, "src", KRTreePropValue::String("https://example.com/a.png")),
+          "E replaced view props applied");
+    KRRenderTreeSnapshot live;
+    live.RecordCreate(1, "KRView");
+    live.RecordCreate(3, "KRTextFieldView");
+    live.RecordCreate(7, "KRView");
+    live.RecordInsert(kRoot, 1, 0);
+    live.RecordInsert(1, 7, -1);
+    live.RecordInsert(1, 3, -1);
+    CHECK(!reconciler.ShouldSkipInsert(1, 7) && !reconciler.ShouldSkipInsert(1, 3), "E new children inserted");
+    auto result = reconciler.Finish(live);
+    CHECK(result.unclaimed_tags == std::vector<int32_t>({2}), "E unclaimed view removed");
+    CHECK(result.stale_props.empty(), "E confirmed keys not stale");
+    CHECK(result.reorder_parents == std::vector<int32_t>({1}), "E reorder parent with new children");
+
+    KRRenderTreeReconciler partial(replayed);
+    partial.OnCreate(1, "KRView");
+    partial.ShouldSkipProp(1, "backgroundColor", KRTreePropValue::String("#ffffff"));
+    partial.OnCreate(2, "KRRichTextView");
+    partial.OnRemove(2);
+    auto partial_result = partial.Finish(live);
+    CHECK(partial_result.stale_props.size() == 1 && partial_result.stale_props[0].first == 1 &&
+              partial_result.stale_props[0].second == "frame",
+          "E stale prop reported");
+    CHECK(partial_result.unclaimed_tags == std::vector<int32_t>({3}), "E removed view not reported");
+}
+
+int main() {
+    std::printf("\n=== Test: KRRenderTreeSnapshot ===\n");
+    TestRecord();
+    TestCodec();
+    TestFile();
+    TestReconcileSameTree();
+    TestReconcileDiff();
+    return TestResult();
+}
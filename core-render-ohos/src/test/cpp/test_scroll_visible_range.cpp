@@ -0,0 +1,144 @@
+// 验证 KRScrollVisibleRangeTracker 的区间计算与变化通知。
+//
+// A. fling 停止位置预测: 静止/无摩擦时不变, 方向与速度同号, 位移与速度成正比
+// B. 区间查询: 左闭右开边界, 乱序输入, 空输入, 视口外
+// C. 可见区间只在变化时通知, 预取区间沿速度方向扩展并覆盖预测停止位置
+// D. 静止时预取区间向两侧扩展, 默认预取距离为一屏
+// E. 随机排版与线性扫描逐点对比
+// F. Reset 之后重新上报
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "libohos_render/expand/components/scroller/KRScrollVisibleRangeTracker.h"
+#include "test_common.h"
+
+// 100 个高度 50 的纵向列表项，tag 为下标 + 1000
+static std::vector<KRScrollItemExtent> MakeList(int count, float height) {
+    std::vector<KRScrollItemExtent> items;
+    for (int i = 0; i < count; i++) {
+        items.push_back({i * height, (i + 1) * height, i + 1000});
+    }
+    return items;
+}
+
+static void TestPredict() {
+    CHECK(KRScrollVisibleRangeTracker::PredictFlingStop(100, 0) == 100, "A zero velocity");
+    CHECK(KRScrollVisibleRangeTracker::PredictFlingStop(100, 500, 0) == 100, "A no friction");
+    float forward = KRScrollVisibleRangeTracker::PredictFlingStop(100, 2520);
+    float backward = KRScrollVisibleRangeTracker::PredictFlingStop(100, -2520);
+    CHECK(forward > 1099 && forward < 1101 && backward > -901 && backward < -899, "A distance = v / (friction * 4.2)");
+}
+
+static void TestRangeQuery() {
+    KRScrollVisibleRangeTracker tracker;
+    CHECK(tracker.RangeIntersecting(0, 100).IsEmpty(), "B empty items");
+    tracker.SetItems({{100, 150, 2}, {0, 50, 0}, {50, 100, 1}});
+    auto range = tracker.RangeIntersecting(0, 50);
+    CHECK(range.first == 0 && range.last == 0 && tracker.ItemAt(0).tag == 0, "B end exclusive, sorted");
+    range = tracker.RangeIntersecting(49, 101);
+    CHECK(range.first == 0 && range.last == 2, "B spans three");
+    CHECK(tracker.RangeIntersecting(150, 300).IsEmpty() && tracker.RangeIntersecting(-50, 0).IsEmpty(),
+          "B outside content");
+    CHECK(tracker.RangeIntersecting(60, 60).IsEmpty(), "B empty window");
+}
+
+static void TestFlingPrefetch() {
+    KRScrollVisibleRangeTracker tracker;
+    tracker.SetItems(MakeList(100, 50));
+    int changed = tracker.Update(0, 500, 0, 200);
+    CHECK((changed & KRScrollVisibleRangeTracker::kVisibleChanged) && tracker.VisibleRange().first == 0 &&
+              tracker.VisibleRange().last == 9,
+          "C first visible range");
+    CHECK(tracker.Update(0, 500, 0, 200) == KRScrollVisibleRangeTracker::kNoneChanged, "C unchanged not reported");
+    CHECK((tracker.Update(10, 500, 0, 200) & KRScrollVisibleRangeTracker::kVisibleChanged) &&
+              tracker.VisibleRange().last == 10,
+          "C visible grows by one item");
+    // 2520 px/s 预测停在 +1000，预取区间覆盖到预测位置的整个视口
+    changed = tracker.Update(10, 500, 2520, 200);
+    CHECK((changed & KRScrollVisibleRangeTracker::kPrefetchChanged) && tracker.PrefetchRange().first == 0 &&
+              tracker.PrefetchRange().last == 30,
+          "C fling prefetch covers predicted stop (%d-%d)", tracker.PrefetchRange().first,
+          tracker.PrefetchRange().last);
+    // 慢速滚动时仅按 lookahead 扩展
+    tracker.Update(10, 500, 252, 200);
+    CHECK(tracker.PrefetchRange().first == 0 && tracker.PrefetchRange().last == 14, "C slow scroll uses lookahead");
+    tracker.Update(2000, 500, -2520, 200);
+    CHECK(tracker.PrefetchRange().first == 20 && tracker.PrefetchRange().last == 49 &&
+              tracker.PredictedStop() == 1000,
+          "C backward fling");
+}
+
+static void TestIdlePrefetch() {
+    KRScrollVisibleRangeTracker tracker;
+    tracker.SetItems(MakeList(100, 50));
+    tracker.Update(1000, 500, 0, -1);
+    CHECK(tracker.VisibleRange().first == 20 && tracker.VisibleRange().last == 29, "D visible");
+    CHECK(tracker.PrefetchRange().first == 10 && tracker.PrefetchRange().last == 39, "D default lookahead one viewport");
+    tracker.Update(100, 500, 0, -1);
+    CHECK(tracker.PrefetchStart() == 0 && tracker.PrefetchRange().first == 0, "D prefetch clamped at content start");
+}
+
+static void TestRandomAgainstLinear() {
+    std::mt19937 rng(11);
+    bool same = true;
+    for (int round = 0; round < 50 && same; round++) {
+        std::vector<KRScrollItemExtent> items;
+        int count = static_cast<int>(rng() % 150);
+        for (int i = 0; i < count; i++) {
+            float start = static_cast<float>(rng() % 5000);
+            items.push_back({start, start + 1 + static_cast<float>(rng() % 300), i});
+        }
+        KRScrollVisibleRangeTracker tracker;
+        tracker.SetItems(items);
+        for (int i = 0; i < 200 && same; i++) {
+            float lo = static_cast<float>(rng() % 5500) - 100;
+            float hi = lo + 1 + static_cast<float>(rng() % 800);
+            auto range = tracker.RangeIntersecting(lo, hi);
+            // 线性扫描: 每个与窗口相交的节点都必须落在区间内，区间两端的节点必须相交
+            bool any = false;
+            for (size_t k = 0; k < tracker.ItemCount() && same; k++) {
+                const auto &item = tracker.ItemAt(static_cast<int>(k));
+                bool hit = item.end > lo && item.start < hi;
+                any = any || hit;
+                if (hit) {
+                    same = !range.IsEmpty() && static_cast<int>(k) >= range.first && static_cast<int>(k) <= range.last;
+                }
+            }
+            if (same && !range.IsEmpty()) {
+                const auto &first = tracker.ItemAt(range.first);
+                const auto &last = tracker.ItemAt(range.last);
+                same = first.end > lo && first.start < hi && last.end > lo && last.start < hi;
+            }
+            same = same && (any != range.IsEmpty());
+        }
+    }
+    CHECK(same, "E matches linear scan");
+}
+
+static void TestReset() {
+    KRScrollVisibleRangeTracker tracker;
+    tracker.SetItems(MakeList(10, 50));
+    tracker.Update(0, 100, 0, 0);
+    CHECK(tracker.Update(0, 100, 0, 0) == KRScrollVisibleRangeTracker::kNoneChanged, "F steady");
+    tracker.Reset();
+    int changed = tracker.Update(0, 100, 0, 0);
+    CHECK(changed == (KRScrollVisibleRangeTracker::kVisibleChanged | KRScrollVisibleRangeTracker::kPrefetchChanged),
+          "F reported again after reset");
+    tracker.SetItems({});
+    CHECK(tracker.Update(0, 100, 0, 0) != KRScrollVisibleRangeTracker::kNoneChanged &&
+              tracker.VisibleRange().IsEmpty(),
+          "F range cleared when content empties");
+}
+
+int main() {
+    std::printf("\n=== Test: KRScrollVisibleRangeTracker ===\n");
+    TestPredict();
+    TestRangeQuery();
+    TestFlingPrefetch();
+    TestIdlePrefetch();
+    TestRandomAgainstLinear();
+    TestReset();
+    return TestResult();
+}
@@ -0,0 +1,81 @@
+// 验证 KRSlotIdCodec 的编解码规则, 以及三张槽位表都使用这一编码。
+//
+// A. 编码后可解回代数与槽位下标, 0 / 负数 / 低位为 0 的 ID 无效
+// B. 32 位有符号 ID 在最大代数、最大下标时仍为正数, 代数回绕到起始值
+// C. 64 位句柄为 (代数 << 32) | (下标 + 1)
+// D. KRSlotTable / KRHandleTable / KRNodeLivenessTable 分配的 ID 都能被同一编码解出
+
+#include <cstdio>
+#include <memory>
+
+#include "libohos_render/foundation/KRHandleTable.h"
+#include "libohos_render/foundation/KRNodeLivenessTable.h"
+#include "libohos_render/foundation/KRSlotId.h"
+#include "libohos_render/foundation/KRSlotTable.h"
+#include "test_common.h"
+
+using Codec32 = KRSlotIdCodec<int32_t, 20>;
+using Codec64 = KRSlotIdCodec<uint64_t, 32>;
+
+static void TestRoundTrip() {
+    uint32_t generation = 0;
+    uint32_t index = 0;
+    auto id = Codec32::Encode(5, 7);
+    CHECK(Codec32::Decode(id, &generation, &index) && generation == 5 && index == 7, "A round trip");
+    CHECK(!Codec32::Decode(0, &generation, &index), "A zero invalid");
+    CHECK(!Codec32::Decode(-3, &generation, &index), "A negative invalid");
+    CHECK(!Codec32::Decode(5 << 20, &generation, &index), "A empty low bits invalid");
+    CHECK(!Codec64::Decode(uint64_t(9) << 32, &generation, &index), "A empty low bits invalid (64)");
+}
+
+static void TestSignedLimits() {
+    auto id = Codec32::Encode(Codec32::kMaxGeneration, Codec32::kMaxSlots - 1);
+    uint32_t generation = 0;
+    uint32_t index = 0;
+    CHECK(id > 0, "B max id positive");
+    CHECK(Codec32::Decode(id, &generation, &index) && generation == Codec32::kMaxGeneration &&
+              index == Codec32::kMaxSlots - 1,
+          "B max id round trip");
+    CHECK(Codec32::kGenerationBits == 11 && Codec32::kMaxGeneration == 2047, "B generation bits");
+    CHECK(Codec32::NextGeneration(Codec32::kMaxGeneration) == 1 && Codec32::NextGeneration(3) == 4,
+          "B generation wraps to first");
+    CHECK(Codec64::kMaxGeneration == UINT32_MAX, "B 64-bit generation is 32 bits");
+}
+
+static void TestHandleLayout() {
+    CHECK(Codec64::Encode(3, 0) == ((uint64_t(3) << 32) | 1), "C handle layout");
+    CHECK(Codec64::Encode(UINT32_MAX, UINT32_MAX - 1) == UINT64_MAX, "C handle max");
+}
+
+static void TestTablesShareEncoding() {
+    uint32_t generation = 0;
+    uint32_t index = 0;
+
+    KRSlotTable<int> slots;
+    slots.Insert(1);
+    auto slot_id = slots.Insert(2);
+    CHECK(KRSlotTable<int>::Codec::Decode(slot_id, &generation, &index) && index == 1 && generation == 1,
+          "D slot table id");
+
+    KRHandleTable<std::shared_ptr<int>> handles;
+    handles.Insert(std::make_shared<int>(1));
+    auto handle = handles.Insert(std::make_shared<int>(2));
+    CHECK(KRHandleCodec::Decode(handle, &generation, &index) && index == 1 && (generation & 1) == 1,
+          "D handle table id");
+
+    KRNodeLivenessTable nodes;
+    int a = 0;
+    int b = 0;
+    nodes.Add(&a);
+    auto node_id = nodes.Add(&b);
+    CHECK(KRNodeIdCodec::Decode(node_id, &generation, &index) && index == 1 && generation == 1, "D liveness id");
+}
+
+int main() {
+    std::printf("\n=== Test: KRSlotIdCodec ===\n");
+    TestRoundTrip();
+    TestSignedLimits();
+    TestHandleLayout();
+    TestTablesShareEncoding();
+    return TestResult();
+}
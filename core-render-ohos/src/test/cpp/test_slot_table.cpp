@@ -0,0 +1,99 @@
+// 验证 KRSlotTable 的整数ID分配与回收规则。
+//
+// A. 插入后可查找, ID 恒为正数
+// B. Take 取出即删除, 重复 Take 失败; TakeIf 按条件取出, 条件不满足时拷贝且保留
+// C. 槽位复用后旧ID失效(代数校验), 不会命中新值
+// D. Clear 后所有ID失效, 槽位可继续复用
+// E. 代数回绕后ID仍为正数
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "libohos_render/foundation/KRSlotTable.h"
+#include "test_common.h"
+
+static void TestInsertFind() {
+    KRSlotTable<std::string> table;
+    auto a = table.Insert("a");
+    auto b = table.Insert("b");
+    CHECK(a > 0 && b > 0 && a != b, "A ids positive and distinct");
+    CHECK(table.Find(a) && *table.Find(a) == "a" && *table.Find(b) == "b", "A find");
+    CHECK(table.Find(0) == nullptr && table.Find(-1) == nullptr && table.Find(12345) == nullptr, "A invalid ids");
+    CHECK(table.Size() == 2, "A size");
+}
+
+static void TestTake() {
+    KRSlotTable<std::shared_ptr<int>> table;
+    auto value = std::make_shared<int>(7);
+    auto id = table.Insert(value);
+    std::shared_ptr<int> out;
+    CHECK(table.Take(id, out) && out && *out == 7, "B take");
+    CHECK(value.use_count() == 2, "B slot releases its reference");
+    CHECK(!table.Take(id, out) && table.Find(id) == nullptr && table.Size() == 0, "B take twice");
+
+    auto keep = table.Insert(std::make_shared<int>(1));
+    auto once = table.Insert(std::make_shared<int>(2));
+    auto is_once = [](const std::shared_ptr<int> &v) { return *v == 2; };
+    out.reset();
+    CHECK(table.TakeIf(keep, is_once, out) && out && *out == 1 && table.Find(keep) && *table.Find(keep) == out,
+          "B take-if false copies and keeps");
+    CHECK(table.TakeIf(once, is_once, out) && *out == 2 && table.Find(once) == nullptr && table.Size() == 1,
+          "B take-if true removes");
+    CHECK(!table.TakeIf(once, is_once, out), "B take-if stale id");
+}
+
+static void TestStaleId() {
+    KRSlotTable<int> table;
+    auto first = table.Insert(1);
+    CHECK(table.Erase(first), "C erase");
+    auto second = table.Insert(2);
+    CHECK((first & KRSlotTable<int>::kIndexMask) == (second & KRSlotTable<int>::kIndexMask), "C slot reused");
+    CHECK(first != second && table.Find(first) == nullptr && *table.Find(second) == 2, "C stale id rejected");
+    CHECK(!table.Erase(first) && table.Size() == 1, "C stale erase is a no-op");
+}
+
+static void TestClear() {
+    KRSlotTable<int> table;
+    std::vector<int32_t> ids;
+    for (int i = 0; i < 100; i++) {
+        ids.push_back(table.Insert(i));
+    }
+    table.Clear();
+    bool all_gone = table.Size() == 0;
+    for (auto id : ids) {
+        all_gone = all_gone && table.Find(id) == nullptr;
+    }
+    CHECK(all_gone, "D clear invalidates ids");
+    auto id = table.Insert(42);
+    uint32_t generation = 0;
+    uint32_t index = 0;
+    CHECK(*table.Find(id) == 42 && KRSlotTable<int>::Codec::Decode(id, &generation, &index) && index < 100,
+          "D slots reused after clear");
+}
+
+static void TestGenerationWrap() {
+    KRSlotTable<int> table;
+    bool positive = true;
+    int32_t previous = 0;
+    bool distinct = true;
+    for (uint32_t i = 0; i < KRSlotTable<int>::kMaxGeneration + 10; i++) {
+        auto id = table.Insert(static_cast<int>(i));
+        positive = positive && id > 0;
+        distinct = distinct && id != previous;
+        previous = id;
+        table.Erase(id);
+    }
+    CHECK(positive && distinct, "E ids stay positive across generation wrap");
+}
+
+int main() {
+    std::printf("\n=== Test: KRSlotTable ===\n");
+    TestInsertFind();
+    TestTake();
+    TestStaleId();
+    TestClear();
+    TestGenerationWrap();
+    return TestResult();
+}
@@ -0,0 +1,65 @@
+// 验证快照缓存的 LRU 内存预算索引 (与 OHOS 无关的部分)。
+//
+// A. 超出预算按最近最少使用顺序换出, Touch 会刷新顺序, 刚放入的条目不会被换出
+// B. RemoveOwner / Remove / SetBudget 正确维护常驻字节数
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "libohos_render/manager/KRSnapshotLruIndex.h"
+#include "test_common.h"
+
+static std::string Keys(const std::vector<KRSnapshotLruIndex::Entry> &entries) {
+    std::string keys;
+    for (const auto &entry : entries) {
+        keys += entry.key;
+    }
+    return keys;
+}
+
+static void TestLruEviction() {
+    int page_a = 0;
+    int page_b = 0;
+    KRSnapshotLruIndex index(100);
+    CHECK(index.Put(&page_a, "a", 40).empty(), "A under budget no eviction");
+    CHECK(index.Put(&page_b, "b", 40).empty(), "A second entry fits");
+    index.Touch(&page_a, "a");
+    auto evicted = index.Put(&page_a, "c", 40);
+    CHECK(Keys(evicted) == "b" && evicted[0].owner == &page_b, "A evicts least recently used across pages (%s)",
+          Keys(evicted).c_str());
+    CHECK(index.ResidentBytes() == 80 && index.Size() == 2, "A resident bytes after eviction (%zu)",
+          index.ResidentBytes());
+    evicted = index.Put(&page_b, "huge", 500);
+    CHECK(Keys(evicted) == "ac" && index.Contains(&page_b, "huge"), "A oversized entry keeps itself, evicts others");
+    evicted = index.Put(&page_b, "huge", 10);
+    CHECK(evicted.empty() && index.ResidentBytes() == 10, "A re-put updates size");
+}
+
+static void TestLruBookkeeping() {
+    int page_a = 0;
+    int page_b = 0;
+    KRSnapshotLruIndex index(1000);
+    index.Put(&page_a, "x", 100);
+    index.Put(&page_b, "x", 200);
+    index.Put(&page_a, "y", 300);
+    CHECK(index.Contains(&page_a, "x") && index.Contains(&page_b, "x"), "B same key on different pages is distinct");
+    index.RemoveOwner(&page_a);
+    CHECK(index.Size() == 1 && index.ResidentBytes() == 200, "B remove owner");
+    index.Remove(&page_b, "x");
+    index.Remove(&page_b, "missing");
+    CHECK(index.Size() == 0 && index.ResidentBytes() == 0, "B remove entry");
+    index.Put(&page_a, "1", 100);
+    index.Put(&page_a, "2", 100);
+    index.Put(&page_a, "3", 100);
+    auto evicted = index.SetBudget(150);
+    CHECK(Keys(evicted) == "12" && index.ResidentBytes() == 100, "B shrinking budget evicts oldest (%s)",
+          Keys(evicted).c_str());
+}
+
+int main() {
+    std::printf("\n=== Test: KRSnapshotLruIndex ===\n");
+    TestLruEviction();
+    TestLruBookkeeping();
+    return TestResult();
+}
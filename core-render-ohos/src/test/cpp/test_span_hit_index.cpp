@@ -0,0 +1,151 @@
+// 验证 KRSpanHitIndex 与原先线性扫描结果一致。
+//
+// A. offset -> span: 区间左闭右开, 空区间忽略, 乱序输入
+// B. 点 -> span: 跨行 span、行间空隙、矩形边界
+// C. 同一行高度不同的矩形(占位 span)合并为一行
+// D. 随机排版(含跨两行的行内图片)与线性扫描逐点对比
+// E. Clear 之后查询为空
+// F. 高矩形把两行合并成一行后, 下一行的矩形仍能命中
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "libohos_render/expand/components/richtext/KRSpanHitIndex.h"
+#include "test_common.h"
+
+using SpanOffsets = std::vector<std::tuple<int, int, int>>;
+
+static int LinearSpanAtOffset(const SpanOffsets &offsets, int offset) {
+    for (const auto &[span, begin, end] : offsets) {
+        if (offset >= begin && offset < end) {
+            return span;
+        }
+    }
+    return -1;
+}
+
+static int LinearSpanAt(const std::vector<KRSpanBox> &boxes, float x, float y) {
+    for (const auto &box : boxes) {
+        if (x < box.left || x >= box.right || y < box.top || y >= box.bottom) {
+            continue;
+        }
+        return box.span_index;
+    }
+    return -1;
+}
+
+static void TestOffsets() {
+    KRSpanHitIndex index;
+    SpanOffsets offsets = {{2, 10, 15}, {0, 0, 4}, {1, 4, 4}, {3, 4, 10}};
+    index.Build(offsets, {});
+    int begin = -1;
+    int end = -1;
+    CHECK(index.SpanAtOffset(0, &begin, &end) == 0 && begin == 0 && end == 4, "A first span");
+    CHECK(index.SpanAtOffset(4) == 3 && index.SpanAtOffset(9) == 3, "A empty span skipped");
+    CHECK(index.SpanAtOffset(14) == 2 && index.SpanAtOffset(15) == -1, "A end exclusive");
+    CHECK(index.SpanAtOffset(-1) == -1, "A before first");
+}
+
+static void TestPoints() {
+    KRSpanHitIndex index;
+    // span 0 从第一行末尾折到第二行开头，两行之间留 2 的空隙
+    std::vector<KRSpanBox> boxes = {
+        {0, 60, 0, 100, 20}, {0, 0, 22, 30, 42}, {1, 0, 0, 60, 20}, {2, 30, 22, 80, 42},
+    };
+    index.Build({{1, 0, 6}, {0, 6, 13}, {2, 13, 18}}, boxes);
+    CHECK(index.LineCount() == 2, "B two lines");
+    CHECK(index.SpanAt(10, 10) == 1 && index.SpanAt(70, 10) == 0 && index.SpanAt(10, 30) == 0, "B hits");
+    CHECK(index.SpanAt(60, 0) == 0 && index.SpanAt(100, 10) == -1 && index.SpanAt(50, 20) == -1, "B edges");
+    CHECK(index.SpanAt(50, 21) == -1 && index.SpanAt(90, 30) == -1 && index.SpanAt(-1, 10) == -1, "B gaps");
+}
+
+static void TestMixedHeights() {
+    KRSpanHitIndex index;
+    std::vector<KRSpanBox> boxes = {{0, 0, 10, 40, 30}, {1, 40, 0, 60, 40}, {2, 60, 10, 90, 30}};
+    index.Build({{0, 0, 3}, {1, 3, 4}, {2, 4, 7}}, boxes);
+    CHECK(index.LineCount() == 1, "C merged into one line");
+    CHECK(index.SpanAt(50, 2) == 1 && index.SpanAt(20, 2) == -1 && index.SpanAt(70, 20) == 2, "C per-box vertical test");
+}
+
+static void TestRandomAgainstLinear() {
+    std::mt19937 rng(7);
+    bool same = true;
+    for (int round = 0; round < 50 && same; round++) {
+        SpanOffsets offsets;
+        std::vector<KRSpanBox> boxes;
+        int offset = 0;
+        float x = 0;
+        float y = 0;
+        const float width = 300;
+        const float line_height = 20 + static_cast<float>(rng() % 10);
+        int span_count = 1 + static_cast<int>(rng() % 200);
+        for (int span = 0; span < span_count; span++) {
+            int length = static_cast<int>(rng() % 12);
+            offsets.emplace_back(span, offset, offset + length);
+            offset += length;
+            float remain = static_cast<float>(length) * 7;
+            // 偶尔插入跨两行高度的行内图片，把相邻两行合并成一行
+            if (rng() % 15 == 0) {
+                float image_width = std::min(24.0f, width - x);
+                boxes.push_back({span, x, y, x + image_width, y + line_height * 2 + 2});
+                x += image_width;
+                remain = 0;
+            }
+            while (remain > 0) {
+                float take = std::min(remain, width - x);
+                boxes.push_back({span, x, y, x + take, y + line_height});
+                x += take;
+                remain -= take;
+                if (x >= width) {
+                    x = 0;
+                    y += line_height + 2;
+                }
+            }
+        }
+        KRSpanHitIndex index;
+        index.Build(offsets, boxes);
+        for (int i = -2; i < offset + 2 && same; i++) {
+            same = index.SpanAtOffset(i) == LinearSpanAtOffset(offsets, i);
+        }
+        for (int i = 0; i < 2000 && same; i++) {
+            float px = static_cast<float>(rng() % 3200) / 10 - 10;
+            float py = static_cast<float>(rng() % static_cast<unsigned>((y + 40) * 10)) / 10 - 10;
+            same = index.SpanAt(px, py) == LinearSpanAt(boxes, px, py);
+        }
+    }
+    CHECK(same, "D matches linear scan");
+}
+
+static void TestTallBoxAcrossRows() {
+    KRSpanHitIndex index;
+    // 第一行: span 0 [10, 50)，图片 span 1 高两行；第二行: span 2 [0, 40)
+    std::vector<KRSpanBox> boxes = {
+        {0, 10, 0, 50, 20}, {1, 50, 0, 80, 42}, {2, 0, 22, 40, 42},
+    };
+    index.Build({{0, 0, 5}, {1, 5, 6}, {2, 6, 10}}, boxes);
+    CHECK(index.LineCount() == 1, "F tall box merges two rows");
+    CHECK(index.SpanAt(20, 30) == 2, "F lower-row box behind an upper-row box with greater left");
+    CHECK(index.SpanAt(20, 10) == 0 && index.SpanAt(60, 30) == 1 && index.SpanAt(45, 30) == -1, "F other hits");
+}
+
+static void TestClear() {
+    KRSpanHitIndex index;
+    index.Build({{0, 0, 3}}, {{0, 0, 0, 10, 10}});
+    CHECK(index.IsBuilt() && index.SpanAt(5, 5) == 0, "E built");
+    index.Clear();
+    CHECK(!index.IsBuilt() && index.SpanAt(5, 5) == -1 && index.SpanAtOffset(1) == -1, "E cleared");
+}
+
+int main() {
+    std::printf("\n=== Test: KRSpanHitIndex ===\n");
+    TestOffsets();
+    TestPoints();
+    TestMixedHeights();
+    TestRandomAgainstLinear();
+    TestClear();
+    TestTallBoxAcrossRows();
+    return TestResult();
+}
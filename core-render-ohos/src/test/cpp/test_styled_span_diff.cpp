@@ -0,0 +1,217 @@
+// 验证输入框增量写入使用的 DiffStyledSpans / DiffText / MapOffset。
+//
+// A. span 完全相同
+// B. 长文本 span 内键入 / 删除一个字符, 变化区间只覆盖该字符
+// C. 多字节字符: 区间不拆分 UTF-8 字符, 4 字节字符按 2 个 UTF-16 计
+// D. 插入 / 删除 image span, 首尾 span 复用数量
+// E. 随机 span 序列与展开后的 flat 文本逐一校验前后缀
+// F. DiffText + MapOffset 光标映射
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libohos_render/expand/components/input/KRStyledSpanDiff.h"
+#include "test_common.h"
+
+using kuikly::text::KRTextPostProcessSpan;
+using kuikly::text_editor::DiffStyledSpans;
+using kuikly::text_editor::DiffText;
+using kuikly::text_editor::KRStyledSpanDiff;
+using kuikly::text_editor::KRTextEditRange;
+
+static KRTextPostProcessSpan Text(const std::string &text) {
+    KRTextPostProcessSpan span;
+    span.text_or_src = text;
+    return span;
+}
+
+static KRTextPostProcessSpan Image(const std::string &src) {
+    KRTextPostProcessSpan span;
+    span.type = KRTextPostProcessSpan::Type::kImage;
+    span.text_or_src = src;
+    span.raw_literal = "[" + src + "]";
+    return span;
+}
+
+// 展开为 UTF-16 flat 文本，image 用 U+FFFC 占 1 个单位
+static std::u16string Flatten(const std::vector<KRTextPostProcessSpan> &spans) {
+    std::u16string out;
+    for (const auto &span : spans) {
+        if (span.type == KRTextPostProcessSpan::Type::kImage) {
+            out.push_back(u'\uFFFC');
+            continue;
+        }
+        const std::string &s = span.text_or_src;
+        for (size_t i = 0; i < s.size();) {
+            unsigned char c = static_cast<unsigned char>(s[i]);
+            char32_t cp;
+            int n;
+            if (c < 0x80) {
+                cp = c, n = 1;
+            } else if ((c & 0xE0) == 0xC0) {
+                cp = c & 0x1F, n = 2;
+            } else if ((c & 0xF0) == 0xE0) {
+                cp = c & 0x0F, n = 3;
+            } else {
+                cp = c & 0x07, n = 4;
+            }
+            for (int k = 1; k < n; k++) {
+                cp = (cp << 6) | (static_cast<unsigned char>(s[i + k]) & 0x3F);
+            }
+            if (cp >= 0x10000) {
+                cp -= 0x10000;
+                out.push_back(static_cast<char16_t>(0xD800 + (cp >> 10)));
+                out.push_back(static_cast<char16_t>(0xDC00 + (cp & 0x3FF)));
+            } else {
+                out.push_back(static_cast<char16_t>(cp));
+            }
+            i += n;
+        }
+    }
+    return out;
+}
+
+static bool RangeConsistent(const std::vector<KRTextPostProcessSpan> &a, const std::vector<KRTextPostProcessSpan> &b,
+                            const KRTextEditRange &r) {
+    std::u16string fa = Flatten(a);
+    std::u16string fb = Flatten(b);
+    if (r.start > r.old_end || r.start > r.new_end || r.old_end > fa.size() || r.new_end > fb.size()) {
+        return false;
+    }
+    return fa.compare(0, r.start, fb, 0, r.start) == 0 &&
+           fa.substr(r.old_end) == fb.substr(r.new_end) &&
+           fa.size() - r.old_end == fb.size() - r.new_end;
+}
+
+static void TestIdentical() {
+    std::vector<KRTextPostProcessSpan> spans = {Text("hi "), Image("smile"), Text(" there")};
+    auto diff = DiffStyledSpans(spans, spans);
+    CHECK(diff.identical && diff.head_spans == 3 && diff.range.IsEmpty() && diff.range.start == 10, "A identical");
+}
+
+static void TestTypeOneChar() {
+    std::string body(5000, 'x');
+    std::vector<KRTextPostProcessSpan> old_spans = {Image("a"), Text(body), Image("b")};
+    std::string typed = body;
+    typed.insert(2500, "y");
+    std::vector<KRTextPostProcessSpan> new_spans = {Image("a"), Text(typed), Image("b")};
+    auto diff = DiffStyledSpans(old_spans, new_spans);
+    // 'x' 串中插入 'y'：公共前缀止于 2500，区间为纯插入
+    CHECK(!diff.identical && diff.head_spans == 1 && diff.tail_spans == 1, "B reuse image spans");
+    CHECK(diff.range.start == 2501 && diff.range.old_end == 2501 && diff.range.new_end == 2502,
+          "B insert range [%u,%u)->[%u,%u)", diff.range.start, diff.range.old_end, diff.range.start,
+          diff.range.new_end);
+    auto back = DiffStyledSpans(new_spans, old_spans);
+    CHECK(back.range.start == 2501 && back.range.old_end == 2502 && back.range.new_end == 2501, "B delete range");
+    std::string repeated = "abab";
+    auto dup = DiffStyledSpans({Text(repeated)}, {Text("ababab")});
+    CHECK(RangeConsistent({Text(repeated)}, {Text("ababab")}, dup.range) &&
+              dup.range.new_end - dup.range.start == 2 && dup.range.old_end == dup.range.start,
+          "B repeated pattern does not double count");
+}
+
+static void TestMultiByte() {
+    // "你" 与 "们" 首字节相同，前缀不能停在字符中间
+    auto diff = DiffStyledSpans({Text("a\xE4\xBD\xA0" "b")}, {Text("a\xE4\xBB\xAC" "b")});
+    CHECK(diff.range.start == 1 && diff.range.old_end == 2 && diff.range.new_end == 2, "C CJK replace");
+    // U+1F600 占 2 个 UTF-16
+    std::string emoji = "\xF0\x9F\x98\x80";
+    auto em = DiffStyledSpans({Text("ok" + emoji)}, {Text("ok" + emoji + "!")});
+    CHECK(em.range.start == 4 && em.range.new_end == 5, "C surrogate pair length");
+    // 后缀同样不能从续字节开始："好" 与 "她" 末字节相同
+    auto tail = DiffStyledSpans({Text("x\xE5\xA5\xBD")}, {Text("x\xE5\xA5\xB9\xE5\xA5\xBD")});
+    CHECK(RangeConsistent({Text("x\xE5\xA5\xBD")}, {Text("x\xE5\xA5\xB9\xE5\xA5\xBD")}, tail.range), "C suffix aligned");
+}
+
+static void TestImages() {
+    std::vector<KRTextPostProcessSpan> old_spans = {Text("hello "), Text("world")};
+    std::vector<KRTextPostProcessSpan> new_spans = {Text("hello "), Image("smile"), Text("world")};
+    auto diff = DiffStyledSpans(old_spans, new_spans);
+    CHECK(diff.head_spans == 1 && diff.tail_spans == 1, "D insert image reuses both neighbours");
+    CHECK(diff.range.start == 6 && diff.range.old_end == 6 && diff.range.new_end == 7, "D insert image range");
+    auto removed = DiffStyledSpans(new_spans, old_spans);
+    CHECK(removed.range.start == 6 && removed.range.old_end == 7 && removed.range.new_end == 6, "D remove image");
+    auto swapped = DiffStyledSpans({Text("a"), Image("x"), Text("b")}, {Text("a"), Image("y"), Text("b")});
+    CHECK(swapped.head_spans == 1 && swapped.tail_spans == 1 && swapped.range.start == 1 &&
+              swapped.range.old_end == 2 && swapped.range.new_end == 2,
+          "D swap image");
+}
+
+static void TestRandom() {
+    std::mt19937 rng(45);
+    const char *pieces[] = {"a", "b", " ", "\xE4\xBD\xA0", "\xE4\xBB\xAC", "\xF0\x9F\x98\x80"};
+    auto random_text = [&](int max_len) {
+        std::string s;
+        int len = static_cast<int>(rng() % (max_len + 1));
+        for (int i = 0; i < len; i++) {
+            s += pieces[rng() % 6];
+        }
+        return s;
+    };
+    auto random_spans = [&]() {
+        std::vector<KRTextPostProcessSpan> spans;
+        int count = static_cast<int>(rng() % 6);
+        for (int i = 0; i < count; i++) {
+            if (rng() % 3 == 0) {
+                spans.push_back(Image(std::string(1, static_cast<char>('p' + rng() % 3))));
+            } else {
+                spans.push_back(Text(random_text(6)));
+            }
+        }
+        return spans;
+    };
+    bool consistent = true;
+    bool reuse_ok = true;
+    for (int round = 0; round < 20000 && consistent && reuse_ok; round++) {
+        auto a = random_spans();
+        auto b = a;
+        // 在随机位置做一次编辑：替换一个 span / 插入 / 删除 / 改写 text
+        int op = static_cast<int>(rng() % 4);
+        size_t pos = b.empty() ? 0 : rng() % b.size();
+        if (op == 0 || b.empty()) {
+            b.insert(b.begin() + static_cast<long>(b.empty() ? 0 : pos), Text(random_text(3)));
+        } else if (op == 1) {
+            b.erase(b.begin() + static_cast<long>(pos));
+        } else if (op == 2) {
+            b[pos] = Image("q");
+        } else if (b[pos].type == KRTextPostProcessSpan::Type::kText) {
+            b[pos].text_or_src = random_text(2) + b[pos].text_or_src + random_text(2);
+        }
+        auto diff = DiffStyledSpans(a, b);
+        consistent = RangeConsistent(a, b, diff.range);
+        for (size_t i = 0; i < diff.head_spans && reuse_ok; i++) {
+            reuse_ok = a[i].text_or_src == b[i].text_or_src && a[i].type == b[i].type;
+        }
+        for (size_t i = 0; i < diff.tail_spans && reuse_ok; i++) {
+            const auto &x = a[a.size() - 1 - i];
+            const auto &y = b[b.size() - 1 - i];
+            reuse_ok = x.text_or_src == y.text_or_src && x.type == y.type;
+        }
+        reuse_ok = reuse_ok && diff.head_spans + diff.tail_spans <= std::min(a.size(), b.size());
+    }
+    CHECK(consistent, "E flat prefix/suffix outside range unchanged");
+    CHECK(reuse_ok, "E reused spans are equal and disjoint");
+}
+
+static void TestCaretMapping() {
+    KRTextEditRange r = DiffText("hello world", "hello @Tom world");
+    CHECK(r.start == 6 && r.old_end == 6 && r.new_end == 11, "F insertion range");
+    CHECK(r.MapOffset(3) == 3 && r.MapOffset(6) == 11 && r.MapOffset(11) == 16, "F map before/at/after");
+    KRTextEditRange rep = DiffText("abcdef", "abXYef");
+    CHECK(rep.MapOffset(3) == 4 && rep.MapOffset(5) == 5 && rep.MapOffset(1) == 1, "F map inside replaced range");
+    KRTextEditRange same = DiffText("same", "same");
+    CHECK(same.IsEmpty() && same.MapOffset(2) == 2, "F no change");
+}
+
+int main() {
+    std::printf("\n=== Test: KRStyledSpanDiff ===\n");
+    TestIdentical();
+    TestTypeOneChar();
+    TestMultiByte();
+    TestImages();
+    TestRandom();
+    TestCaretMapping();
+    return TestResult();
+}
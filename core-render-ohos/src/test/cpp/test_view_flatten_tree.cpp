@@ -0,0 +1,347 @@
+// 验证 KRViewFlattenTree 拍平后的真实节点树与不拍平时的绘制顺序、绝对位置一致。
+//
+// A. 虚拟容器的子节点挂到最近的真实祖先上, frame 叠加虚拟祖先偏移
+// B. 真实子节点在祖先中的下标按先序展开计算, 兄弟节点交错插入时顺序正确
+// C. 虚拟容器 frame 原点变化时只重新下发受影响的子孙 frame
+// D. 物化: 子孙节点收回到新节点下, 新节点挂到原位置
+// E. 直接挂到根容器或不可承载的组件下时立即物化
+// F. 删除虚拟容器时子孙节点一起离屏, 先插子节点后挂链路同样生效
+// G. 随机操作序列与逻辑树逐节点对比
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "libohos_render/layer/KRViewFlattenTree.h"
+#include "test_common.h"
+
+constexpr int32_t kRoot = KRViewFlattenTree::kRootTag;
+
+/**
+ * 模拟 ArkUI 节点树：插入时会先从旧父节点上摘下
+ */
+class FakeNodeTree : public IKRViewFlattenDelegate {
+ public:
+    std::map<int32_t, std::vector<int32_t>> children;
+    std::map<int32_t, int32_t> parent;
+    std::map<int32_t, KRRect> frames;
+    std::set<int32_t> created;
+    std::set<int32_t> fail_create;
+    int frame_calls = 0;
+    int attach_calls = 0;
+
+    void AttachRealView(int32_t host_tag, int32_t child_tag, int index) override {
+        attach_calls++;
+        Remove(child_tag);
+        auto &list = children[host_tag];
+        if (index < 0 || index > static_cast<int>(list.size())) {
+            index = static_cast<int>(list.size());
+        }
+        list.insert(list.begin() + index, child_tag);
+        parent[child_tag] = host_tag;
+    }
+    void DetachRealView(int32_t child_tag) override {
+        Remove(child_tag);
+    }
+    void ApplyRealFrame(int32_t tag, const KRRect &frame) override {
+        frame_calls++;
+        frames[tag] = frame;
+    }
+    bool CreateRealView(int32_t tag) override {
+        if (fail_create.count(tag)) {
+            return false;
+        }
+        created.insert(tag);
+        return true;
+    }
+    void Remove(int32_t tag) {
+        auto it = parent.find(tag);
+        if (it == parent.end()) {
+            return;
+        }
+        auto &list = children[it->second];
+        list.erase(std::find(list.begin(), list.end(), tag));
+        parent.erase(it);
+    }
+    const std::vector<int32_t> &ChildrenOf(int32_t tag) {
+        return children[tag];
+    }
+};
+
+static KRRect Rect(float x, float y) {
+    return KRRect(x, y, 10, 10);
+}
+
+static void TestHoist() {
+    FakeNodeTree fake;
+    KRViewFlattenTree tree(&fake);
+    tree.AddNode(1, false, true);  // 真实容器
+    tree.AddNode(2, true, true);   // 虚拟容器
+    tree.AddNode(3, true, true);   // 嵌套虚拟容器
+    tree.AddNode(4, false, false);
+    tree.Insert(kRoot, 1, 0);
+    tree.SetFrame(2, Rect(10, 20));
+    tree.SetFrame(3, Rect(1, 2));
+    tree.SetFrame(4, Rect(100, 100));
+    tree.Insert(1, 2, 0);
+    tree.Insert(2, 3, 0);
+    tree.Insert(3, 4, 0);
+    CHECK(fake.ChildrenOf(1) == std::vector<int32_t>{4} && tree.VirtualCount() == 2, "A hoisted into real ancestor");
+    CHECK(fake.frames[4].x == 111 && fake.frames[4].y == 122, "A offset accumulated");
+    CHECK(fake.created.empty(), "A no node created for virtual containers");
+}
+
+static void TestOrder() {
+    FakeNodeTree fake;
+    KRViewFlattenTree tree(&fake);
+    tree.AddNode(1, false, true);
+    tree.Insert(kRoot, 1, 0);
+    for (int32_t tag = 10; tag <= 15; tag++) {
+        tree.AddNode(tag, false, false);
+    }
+    tree.AddNode(2, true, true);
+    tree.AddNode(3, true, true);
+    tree.Insert(1, 10, 0);
+    tree.Insert(1, 2, 1);
+    tree.Insert(1, 11, 2);
+    tree.Insert(2, 12, 0);
+    tree.Insert(2, 3, 1);
+    tree.Insert(3, 13, 0);
+    tree.Insert(2, 14, 0);
+    tree.Insert(1, 15, 0);
+    CHECK(fake.ChildrenOf(1) == (std::vector<int32_t>{15, 10, 14, 12, 13, 11}), "B preorder indexes");
+}
+
+static void TestOffsetChange() {
+    FakeNodeTree fake;
+    KRViewFlattenTree tree(&fake);
+    tree.AddNode(1, false, true);
+    tree.AddNode(2, true, true);
+    tree.AddNode(3, false, false);
+    tree.Insert(kRoot, 1, 0);
+    tree.Insert(1, 2, 0);
+    tree.Insert(2, 3, 0);
+    tree.SetFrame(2, Rect(5, 5));
+    tree.SetFrame(3, Rect(1, 1));
+    int calls = fake.frame_calls;
+    tree.SetFrame(2, KRRect(5, 5, 300, 300));
+    CHECK(fake.frame_calls == calls, "C size-only change skips descendants");
+    tree.SetFrame(2, Rect(7, 5));
+    CHECK(fake.frame_calls == calls + 1 && fake.frames[3].x == 8, "C origin change re-applies descendant frame");
+}
+
+static void TestMaterialize() {
+    FakeNodeTree fake;
+    KRViewFlattenTree tree(&fake);
+    tree.AddNode(1, false, true);
+    tree.AddNode(2, true, true);
+    tree.AddNode(3, false, false);
+    tree.AddNode(4, false, false);
+    tree.AddNode(5, false, false);
+    tree.Insert(kRoot, 1, 0);
+    tree.Insert(1, 5, 0);
+    tree.Insert(1, 2, 0);
+    tree.Insert(2, 3, 0);
+    tree.Insert(2, 4, 1);
+    tree.SetFrame(2, Rect(10, 10));
+    tree.SetFrame(3, Rect(1, 1));
+    CHECK(fake.ChildrenOf(1) == (std::vector<int32_t>{3, 4, 5}), "D before materialize");
+    CHECK(tree.Materialize(2) && !tree.IsVirtual(2) && tree.VirtualCount() == 0, "D materialized");
+    CHECK(fake.ChildrenOf(1) == (std::vector<int32_t>{2, 5}) && fake.ChildrenOf(2) == (std::vector<int32_t>{3, 4}),
+          "D children moved under new node");
+    CHECK(fake.frames[2].x == 10 && fake.frames[3].x == 1, "D frames rebased");
+    fake.fail_create.insert(6);
+    tree.AddNode(6, true, true);
+    tree.Insert(1, 6, 0);
+    CHECK(!tree.Materialize(6) && tree.IsVirtual(6), "D failed create keeps node virtual");
+}
+
+static void TestNonHost() {
+    FakeNodeTree fake;
+    KRViewFlattenTree tree(&fake);
+    tree.AddNode(1, true, true);
+    tree.AddNode(2, false, false);  // 例如滚动容器
+    tree.AddNode(3, true, true);
+    tree.AddNode(4, false, false);
+    tree.Insert(1, 4, 0);
+    tree.Insert(kRoot, 1, 0);
+    CHECK(!tree.IsVirtual(1) && fake.ChildrenOf(kRoot) == std::vector<int32_t>{1} &&
+              fake.ChildrenOf(1) == std::vector<int32_t>{4},
+          "E virtual under root materialized");
+    tree.Insert(kRoot, 2, 1);
+    tree.Insert(2, 3, 0);
+    CHECK(!tree.IsVirtual(3) && fake.ChildrenOf(2) == std::vector<int32_t>{3}, "E virtual under non-host materialized");
+}
+
+static void TestRemoveAndLateAttach() {
+    FakeNodeTree fake;
+    KRViewFlattenTree tree(&fake);
+    tree.AddNode(1, false, true);
+    tree.AddNode(2, true, true);
+    tree.AddNode(3, true, true);
+    tree.AddNode(4, false, false);
+    tree.Insert(kRoot, 1, 0);
+    // 自底向上构建：链路接通前不挂载
+    tree.Insert(3, 4, 0);
+    tree.Insert(2, 3, 0);
+    CHECK(fake.parent.count(4) == 0, "F pending until chain attached");
+    tree.SetFrame(3, Rect(3, 3));
+    tree.Insert(1, 2, 0);
+    CHECK(fake.ChildrenOf(1) == std::vector<int32_t>{4} && fake.frames.count(4) == 0, "F attached when chain connects");
+    tree.SetFrame(4, Rect(1, 1));
+    CHECK(fake.frames[4].x == 4, "F frame after attach");
+    tree.RemoveNode(2);
+    CHECK(fake.ChildrenOf(1).empty() && tree.VirtualCount() == 1, "F removing virtual detaches descendants");
+    tree.Insert(1, 3, 0);
+    CHECK(fake.ChildrenOf(1) == std::vector<int32_t>{4} && fake.frames[4].x == 4, "F re-insert orphan subtree");
+}
+
+/**
+ * 参照模型：不拍平时的逻辑树
+ */
+struct RefTree {
+    std::map<int32_t, int32_t> parent;
+    std::map<int32_t, std::vector<int32_t>> children;
+    std::map<int32_t, KRRect> frames;
+
+    bool IsAncestor(int32_t ancestor, int32_t tag) {
+        for (auto it = parent.find(tag); it != parent.end(); it = parent.find(it->second)) {
+            if (it->second == ancestor) {
+                return true;
+            }
+        }
+        return false;
+    }
+    bool Connected(int32_t tag) {
+        return tag == kRoot || IsAncestor(kRoot, tag);
+    }
+    KRPoint Absolute(int32_t tag, std::map<int32_t, int32_t> &parents, std::map<int32_t, KRRect> &rects) {
+        KRPoint point;
+        for (auto t = tag; t != kRoot; t = parents[t]) {
+            point.x += rects[t].x;
+            point.y += rects[t].y;
+        }
+        return point;
+    }
+};
+
+static void CollectExpected(RefTree &ref, KRViewFlattenTree &tree, int32_t tag, std::vector<int32_t> &out) {
+    for (auto child : ref.children[tag]) {
+        if (tree.IsVirtual(child)) {
+            CollectExpected(ref, tree, child, out);
+        } else {
+            out.push_back(child);
+        }
+    }
+}
+
+static void TestRandomAgainstLogical() {
+    std::mt19937 rng(47);
+    bool same = true;
+    for (int round = 0; round < 200 && same; round++) {
+        FakeNodeTree fake;
+        KRViewFlattenTree tree(&fake);
+        RefTree ref;
+        std::vector<int32_t> live;
+        int32_t next_tag = 1;
+        for (int step = 0; step < 300 && same; step++) {
+            auto op = rng() % 10;
+            if (op < 3 || live.empty()) {
+                auto kind = rng() % 10;
+                auto tag = next_tag++;
+                tree.AddNode(tag, kind < 6, kind < 8);
+                live.push_back(tag);
+                // kotlin 侧每个节点都会下发 frame
+                auto frame = KRRect(static_cast<float>(rng() % 100), static_cast<float>(rng() % 100), 10, 10);
+                tree.SetFrame(tag, frame);
+                ref.frames[tag] = frame;
+            } else if (op < 6) {
+                auto child = live[rng() % live.size()];
+                auto parent = rng() % 8 == 0 ? kRoot : live[rng() % live.size()];
+                if (parent == child || ref.IsAncestor(child, parent)) {
+                    continue;
+                }
+                if (ref.parent.count(child)) {
+                    auto &list = ref.children[ref.parent[child]];
+                    list.erase(std::find(list.begin(), list.end(), child));
+                }
+                auto &list = ref.children[parent];
+                int index = static_cast<int>(rng() % (list.size() + 2)) - 1;
+                tree.Insert(parent, child, index);
+                if (index < 0 || index > static_cast<int>(list.size())) {
+                    index = static_cast<int>(list.size());
+                }
+                list.insert(list.begin() + index, child);
+                ref.parent[child] = parent;
+            } else if (op < 8) {
+                auto tag = live[rng() % live.size()];
+                auto frame = KRRect(static_cast<float>(rng() % 100), static_cast<float>(rng() % 100), 10, 10);
+                tree.SetFrame(tag, frame);
+                ref.frames[tag] = frame;
+            } else if (op < 9) {
+                tree.Materialize(live[rng() % live.size()]);
+            } else {
+                auto pos = rng() % live.size();
+                auto tag = live[pos];
+                live.erase(live.begin() + pos);
+                if (!tree.IsVirtual(tag)) {
+                    fake.DetachRealView(tag);  // 真实节点由 layer 层回收时自行摘下
+                }
+                tree.RemoveNode(tag);
+                if (ref.parent.count(tag)) {
+                    auto &list = ref.children[ref.parent[tag]];
+                    list.erase(std::find(list.begin(), list.end(), tag));
+                    ref.parent.erase(tag);
+                }
+                for (auto child : ref.children[tag]) {
+                    ref.parent.erase(child);
+                }
+                ref.children.erase(tag);
+                ref.frames.erase(tag);
+            }
+            // 与根连通的真实节点：子节点顺序按先序展开，绝对位置与逻辑树一致
+            std::vector<int32_t> hosts = {kRoot};
+            for (auto tag : live) {
+                if (!tree.IsVirtual(tag) && ref.Connected(tag)) {
+                    hosts.push_back(tag);
+                }
+            }
+            for (auto host : hosts) {
+                std::vector<int32_t> expected;
+                CollectExpected(ref, tree, host, expected);
+                if (fake.ChildrenOf(host) != expected) {
+                    same = false;
+                    std::printf("round %d step %d host %d order mismatch\n", round, step, host);
+                    break;
+                }
+                if (host == kRoot) {
+                    continue;
+                }
+                auto a = ref.Absolute(host, ref.parent, ref.frames);
+                auto b = ref.Absolute(host, fake.parent, fake.frames);
+                if (std::fabs(a.x - b.x) > 1e-3f || std::fabs(a.y - b.y) > 1e-3f) {
+                    same = false;
+                    std::printf("round %d step %d tag %d position mismatch\n", round, step, host);
+                    break;
+                }
+            }
+        }
+    }
+    CHECK(same, "G random ops match logical tree");
+}
+
+int main() {
+    std::printf("\n=== Test: KRViewFlattenTree ===\n");
+    TestHoist();
+    TestOrder();
+    TestOffsetChange();
+    TestMaterialize();
+    TestNonHost();
+    TestRemoveAndLateAttach();
+    TestRandomAgainstLogical();
+    return TestResult();
+}
@@ -0,0 +1,107 @@
+// 验证 KRViewOpQueue 的跨实例下发顺序。
+//
+// A. 按实例首次出现顺序分组, 同实例内保持记录顺序
+// B. 三个实例的批次按 A, B, C 顺序到达 ArkTS
+// C. 发送期间的嵌套调用先下发剩余实例, 再执行自身
+// D. 发送期间新记录的变更在本轮剩余实例之后下发
+
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "libohos_render/manager/KRViewOpQueue.h"
+#include "test_common.h"
+
+using Queue = KRViewOpQueue<int>;
+
+static void TestGrouping() {
+    Queue queue;
+    queue.Enqueue("a", 1, 4, 10, 0);
+    queue.Enqueue("b", 2, 4, 20, 0);
+    queue.Enqueue("a", 3, 5, 30, 0);
+    std::vector<std::string> instances;
+    std::vector<int> tags;
+    queue.Flush([&](const Queue::Batch &batch) {
+        instances.push_back(batch.first);
+        for (const auto &op : batch.second) {
+            tags.push_back(op.tag);
+        }
+    });
+    CHECK(instances == std::vector<std::string>({"a", "b"}), "A instances in first-seen order");
+    CHECK(tags == std::vector<int>({1, 3, 2}), "A ops keep order within instance");
+    CHECK(queue.Empty(), "A empty after flush");
+}
+
+// 与 KRArkTSManager 相同的调用结构：公开调用先下发待处理变更，FlushViewOps 经直接发送路径下发批次
+struct FakeArkTSManager {
+    Queue pending;
+    std::vector<std::string> delivered;
+    std::function<void(const std::string &)> on_deliver;
+
+    void Call(const std::string &name) {
+        if (!pending.Empty()) {
+            FlushViewOps();
+        }
+        CallDirectly(name);
+    }
+    void CallDirectly(const std::string &name) {
+        delivered.push_back(name);
+        if (on_deliver) {
+            on_deliver(name);
+        }
+    }
+    void FlushViewOps() {
+        pending.Flush([this](const Queue::Batch &batch) { CallDirectly(batch.first); });
+    }
+};
+
+static void TestFlushKeepsInstanceOrder() {
+    FakeArkTSManager manager;
+    manager.pending.Enqueue("a", 1, 4, 0, 0);
+    manager.pending.Enqueue("b", 2, 4, 0, 0);
+    manager.pending.Enqueue("c", 3, 4, 0, 0);
+    manager.FlushViewOps();
+    CHECK(manager.delivered == std::vector<std::string>({"a", "b", "c"}), "B delivered as a, b, c");
+    CHECK(manager.pending.Empty(), "B empty after flush");
+}
+
+static void TestNestedCallFlushesRemainingFirst() {
+    FakeArkTSManager manager;
+    manager.pending.Enqueue("a", 1, 4, 0, 0);
+    manager.pending.Enqueue("b", 2, 4, 0, 0);
+    manager.pending.Enqueue("c", 3, 4, 0, 0);
+    manager.on_deliver = [&manager](const std::string &name) {
+        if (name == "a") {
+            // ArkTS 处理 a 时同步回调 native，native 又发起一次普通调用
+            manager.Call("nested");
+        }
+    };
+    manager.Call("later");
+    CHECK(manager.delivered == std::vector<std::string>({"a", "b", "c", "nested", "later"}),
+          "C nested call runs after remaining instances");
+    CHECK(manager.pending.Empty(), "C empty after flush");
+}
+
+static void TestEnqueueDuringFlush() {
+    Queue queue;
+    queue.Enqueue("a", 1, 4, 0, 0);
+    queue.Enqueue("b", 2, 4, 0, 0);
+    std::vector<std::string> delivered;
+    queue.Flush([&](const Queue::Batch &batch) {
+        delivered.push_back(batch.first);
+        if (delivered.size() == 1) {
+            queue.Enqueue("a", 9, 4, 0, 0);
+        }
+    });
+    CHECK(delivered == std::vector<std::string>({"a", "b", "a"}), "D late ops go after remaining instances");
+}
+
+int main() {
+    std::printf("\n=== Test: KRViewOpQueue ===\n");
+    TestGrouping();
+    TestFlushKeepsInstanceOrder();
+    TestNestedCallFlushesRemainingFirst();
+    TestEnqueueDuringFlush();
+    return TestResult();
+}
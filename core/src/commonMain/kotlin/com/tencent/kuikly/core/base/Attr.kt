@@ -680,6 +680,20 @@ open class Attr : Props(), IStyleAttr, ILayoutAttr {
         StyleConst.SUPER_TOUCH with enable
     }
 
+    /**
+     * 同一帧内的 touchMove 合并为一次投递，被合并掉的采样点通过 [TouchParams.historicalPoints] 回传（目前仅 ohos 支持）
+     */
+    fun coalesceTouchMove(enable: Boolean) {
+        StyleConst.COALESCE_TOUCH_MOVE with enable
+    }
+
+    /**
+     * 同一帧内 pan 的 move 状态合并为一次投递，被合并掉的采样点通过 [PanGestureParams.historicalPoints] 回传（目前仅 ohos 支持）
+     */
+    fun coalescePan(enable: Boolean) {
+        StyleConst.COALESCE_PAN with enable
+    }
+
     object StyleConst {
         const val ACCESSIBILITY_INFO = "accessibilityInfo"
         const val BACKGROUND_COLOR = "backgroundColor"
@@ -717,6 +731,8 @@ open class Attr : Props(), IStyleAttr, ILayoutAttr {
         const val PREVENT_TOUCH = "preventTouch"
         const val CONSUME_DOWN = "consumeDown"
         const val SUPER_TOUCH = "superTouch"
+        const val COALESCE_TOUCH_MOVE = "coalesceTouchMove"
+        const val COALESCE_PAN = "coalescePan"
         
         // glass effect
         const val GLASS_EFFECT_ENABLE = "glassEffectEnable"
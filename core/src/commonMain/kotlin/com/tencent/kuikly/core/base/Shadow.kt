@@ -27,7 +27,7 @@ class Size(val width: Float, val height: Float) {
     }
 }
 
-open class Shadow(private val pagerId: String, private val viewRef: Int, viewName: String) {
+open class Shadow(protected val pagerId: String, internal val viewRef: Int, viewName: String) {
 
     init {
         BridgeManager.createShadow(pagerId, viewRef, viewName)
@@ -16,6 +16,7 @@
 package com.tencent.kuikly.core.base.event
 
 import com.tencent.kuikly.core.collection.fastArrayListOf
+import com.tencent.kuikly.core.nvi.serialization.json.JSONArray
 import com.tencent.kuikly.core.nvi.serialization.json.JSONObject
 
 /**
@@ -49,7 +50,8 @@ data class TouchParams(
     val pointerId: Int, // 触摸点的ID
     val action: String, // 事件类型, 该属性从1.1.86版本开始支持，之前的版本获取为空
     val touches: List<Touch>, // 包含所有多指触摸信息
-    val consumed: Boolean // 是否已经被消费了，来自渲染层的消费状态，目前用于滑动中
+    val consumed: Boolean, // 是否已经被消费了，来自渲染层的消费状态，目前用于滑动中
+    val historicalPoints: List<HistoricalPoint> = emptyList() // 本次事件合并掉的主指针采样点，需开启 coalesceTouchMove
 ) {
     companion object {
         fun decode(params: Any?): TouchParams {
@@ -68,7 +70,8 @@ data class TouchParams(
                     touches.add(Touch.decode(it.opt(i)))
                 }
             }
-            return TouchParams(x, y, pageX, pageY, timestamp, pointerId, action, touches, consumed)
+            val historicalPoints = HistoricalPoint.decodeList(tempParams.optJSONArray(HistoricalPoint.PARAM_KEY))
+            return TouchParams(x, y, pageX, pageY, timestamp, pointerId, action, touches, consumed, historicalPoints)
         }
     }
 }
@@ -99,6 +102,41 @@ data class Touch(
     }
 }
 
+/**
+ * move 事件合并后被合并掉的主指针采样点（当前view坐标系），按时间先后排列，不含本次事件自身的坐标
+ */
+data class HistoricalPoint(
+    val x: Float,
+    val y: Float,
+    val timestamp: Long // 采样时距离系统启动的毫秒数
+) {
+    companion object {
+        internal const val PARAM_KEY = "historicalPoints"
+
+        /**
+         * 渲染层按 [x, y, timestamp] 平铺传递
+         */
+        fun decodeList(array: JSONArray?): List<HistoricalPoint> {
+            if (array == null || array.length() < 3) {
+                return emptyList()
+            }
+            val points = fastArrayListOf<HistoricalPoint>()
+            var i = 0
+            while (i + 2 < array.length()) {
+                points.add(
+                    HistoricalPoint(
+                        array.optDouble(i).toFloat(),
+                        array.optDouble(i + 1).toFloat(),
+                        array.optDouble(i + 2).toLong()
+                    )
+                )
+                i += 3
+            }
+            return points
+        }
+    }
+}
+
 /**
  * 长按事件的参数定义，并且提供了面向JSON的decode方法
  */
@@ -147,7 +185,8 @@ data class PanGestureParams(
     val y: Float,    // 当前view坐标系下的触摸点y
     val state: String, // "start" | "move" | "end"
     val pageX: Float,
-    val pageY: Float
+    val pageY: Float,
+    val historicalPoints: List<HistoricalPoint> = emptyList() // 本次 move 合并掉的采样点，需开启 coalescePan
 ) {
     companion object {
         fun decode(params: Any?): PanGestureParams {
@@ -157,7 +196,8 @@ data class PanGestureParams(
             val state = tempParams.optString("state")
             val pageX = tempParams.optDouble("pageX").toFloat()
             val pageY = tempParams.optDouble("pageY").toFloat()
-            return PanGestureParams(x, y, state, pageX, pageY)
+            val historicalPoints = HistoricalPoint.decodeList(tempParams.optJSONArray(HistoricalPoint.PARAM_KEY))
+            return PanGestureParams(x, y, state, pageX, pageY, historicalPoints)
         }
     }
     inline val isStart get() = state == "start"
@@ -306,7 +306,8 @@ class FlexNode {
 
     fun measure(
         measureOutput: MeasureOutput,
-        width: Float
+        width: Float,
+        measureCollector: MeasureCollector? = null
     ): MeasureOutput {
         if (measureFunction == null) {
             throw RuntimeException("Measure function isn't defined!")
@@ -320,7 +321,11 @@ class FlexNode {
         } else {
             Float.undefined
         }
-        measureFunction?.measure(this, width, height, measureOutput)
+        if (measureCollector != null) {
+            measureCollector.collect(this, width, height, measureOutput)
+        } else {
+            measureFunction?.measure(this, width, height, measureOutput)
+        }
         return measureOutput
     }
     // ===== 自定义测量函数 end =====
@@ -391,18 +396,53 @@ class FlexNode {
     fun calculateLayout(layoutContext: FlexLayoutContext?) {
         flexLayout.resetResult()
         val dirtyList = fastMutableSetOf<FlexNode>()
-        val maxWidth = if (!styleMaxWidth.isUndefined()) {
-            styleMaxWidth
-        } else {
-            styleWidth
-        }
-        LayoutImpl.layoutNode(this, maxWidth, layoutContext, dirtyList = dirtyList)
+        LayoutImpl.layoutNode(this, rootMaxWidth(), layoutContext, dirtyList = dirtyList)
         dirtyList.forEach {
             it.updateLastLayout()
             it.markNotDirty()
         }
     }
 
+    /**
+     * 试算布局：按当前样式完整走一遍布局，测量交给 [FlexLayoutContext.measureCollector] 登记，
+     * 不调用 measureFunction，也不提交 layoutFrame。
+     * 试算会改写各节点的布局结果与 lastLayout 缓存，结束后全部恢复，
+     * 紧随其后的 [calculateLayout] 与未试算时的重算范围、结果一致
+     */
+    fun dryRunLayout(layoutContext: FlexLayoutContext) {
+        val nodes = fastMutableListOf<FlexNode>()
+        collectSubtree(nodes)
+        val savedLayouts = nodes.map { node -> FlexLayout().also { it.copy(node.flexLayout) } }
+        val savedLastLayouts = nodes.map { node ->
+            FlexLayoutCache().also {
+                it.copy(node.lastLayout)
+                it.parentMaxWidth = node.lastLayout.parentMaxWidth
+            }
+        }
+        flexLayout.resetResult()
+        LayoutImpl.layoutNode(this, rootMaxWidth(), layoutContext, dirtyList = fastMutableSetOf())
+        nodes.forEachIndexed { index, node ->
+            node.flexLayout.copy(savedLayouts[index])
+            node.lastLayout.copy(savedLastLayouts[index])
+            node.lastLayout.parentMaxWidth = savedLastLayouts[index].parentMaxWidth
+        }
+    }
+
+    private fun collectSubtree(out: MutableList<FlexNode>) {
+        out.add(this)
+        children?.forEach {
+            it.collectSubtree(out)
+        }
+    }
+
+    private fun rootMaxWidth(): Float {
+        return if (!styleMaxWidth.isUndefined()) {
+            styleMaxWidth
+        } else {
+            styleWidth
+        }
+    }
+
     fun resetLayout() {
         flexLayout.resetResult()
     }
@@ -503,8 +543,25 @@ class MeasureOutput {
     var height = 0f
 }
 
+/**
+ * 试算布局（[FlexNode.dryRunLayout]）中代替 [MeasureFunction] 执行
+ */
+interface MeasureCollector {
+    /**
+     * 登记本次测量请求并把估算尺寸写入 measureOutput，不得产生副作用
+     */
+    fun collect(
+        node: FlexNode,
+        width: Float,
+        height: Float,
+        measureOutput: MeasureOutput
+    )
+}
+
 class FlexLayoutContext {
     val measureOutput = MeasureOutput()
+    // 非空时为试算布局
+    var measureCollector: MeasureCollector? = null
 }
 
 class MutableFrame(var x: Float,
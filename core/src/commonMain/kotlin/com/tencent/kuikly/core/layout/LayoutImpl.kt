@@ -1372,7 +1372,8 @@ object LayoutImpl {
         // 宽高都被计算出来的时候，其实不需要执行measure方法了
         val measureDim = measure(
             layoutContext?.measureOutput ?: MeasureOutput(),
-            width
+            width,
+            layoutContext?.measureCollector
         )
         setLayoutWidth(measureDim.width + paddingAndBorderAxisResolvedRow)
         setLayoutHeight(measureDim.height + paddingAndBorderDimension(FlexDirection.COLUMN))
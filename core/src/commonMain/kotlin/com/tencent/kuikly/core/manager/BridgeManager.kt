@@ -236,6 +236,29 @@ object BridgeManager {
         }
     }
 
+    /**
+     * 批量测量多个 shadow 的尺寸（目前仅鸿蒙渲染层支持，不支持时返回 null）
+     * @param tags 视图 ID 列表
+     * @param constraints 测量约束，按 [width0, height0, width1, height1, ...] 排列
+     * @return 测量结果，按 [width0, height0, width1, height1, ...] 排列
+     */
+    fun calculateRenderViewSizes(
+        instanceId: String,
+        tags: IntArray,
+        constraints: FloatArray
+    ): FloatArray? {
+        // 方法 18 只有鸿蒙渲染层实现，其他平台直接返回 null 由调用方逐个测量
+        if (!PagerManager.getPager(instanceId).pageData.isOhOs) {
+            return null
+        }
+        return callNativeMethod(
+            NativeMethod.CALCULATE_RENDER_VIEW_SIZES,
+            instanceId,
+            tags,
+            constraints
+        ) as? FloatArray
+    }
+
     fun callViewMethod(
         instanceId: String,
         tag: Int,
@@ -371,4 +394,5 @@ object NativeMethod {
     const val FIRE_FATAL_EXCEPTION = 15 // "fireFatalException" 方法
     const val SYNC_FLUSH_UI = 16 // "syncFlushUI" 方法
     const val CALL_TDF_MODULE_METHOD = 17 // "callTDFModuleMethod" 方法
+    const val CALCULATE_RENDER_VIEW_SIZES = 18 // "calculateRenderViewSizes" 批量测量方法
 }
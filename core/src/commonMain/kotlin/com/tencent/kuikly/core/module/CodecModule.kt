@@ -15,6 +15,8 @@
 
 package com.tencent.kuikly.core.module
 
+import com.tencent.kuikly.core.nvi.serialization.json.JSONObject
+
 /*
  * @brief 提供常用的字符串编解码api
  */
@@ -40,6 +42,16 @@ class CodecModule : Module() {
         return toNative(false, METHOD_BASE64_DECODE, string, null, true).toString()
     }
 
+    // 将字符串进行 URL-safe Base64 编码（'-' '_' 字母表，不补 '='），目前仅鸿蒙端支持
+    fun base64UrlEncode(string: String): String {
+        return toNative(false, METHOD_BASE64_URL_ENCODE, string, null, true).toString()
+    }
+
+    // 对 URL-safe Base64 编码的字符串进行解码（有无 '=' 均可），目前仅鸿蒙端支持
+    fun base64UrlDecode(string: String): String {
+        return toNative(false, METHOD_BASE64_URL_DECODE, string, null, true).toString()
+    }
+
     // 计算字符串的 MD5 散列值（16位）
     fun md5(string: String): String {
         return toNative(false, METHOD_MD5, string, null, true).toString()
@@ -55,6 +67,83 @@ class CodecModule : Module() {
         return toNative(false, METHOD_SHA256, string, null, true).toString()
     }
 
+    // 计算二进制数据的 MD5 散列值（与 md5(String) 同格式），目前仅鸿蒙端支持
+    fun md5(bytes: ByteArray): String {
+        return hashBytes(METHOD_MD5, bytes)
+    }
+
+    // 计算二进制数据的 MD5 散列值（32位），目前仅鸿蒙端支持
+    fun md5With32(bytes: ByteArray): String {
+        return hashBytes(METHOD_MD5_32, bytes)
+    }
+
+    // 计算二进制数据的 SHA256 散列值，目前仅鸿蒙端支持
+    fun sha256(bytes: ByteArray): String {
+        return hashBytes(METHOD_SHA256, bytes)
+    }
+
+    /**
+     * 创建流式散列计算，配合 [hashUpdate] 分段输入、[hashFinal] 取结果，目前仅鸿蒙端支持
+     * @param algorithm [HASH_ALGORITHM_MD5] 或 [HASH_ALGORITHM_SHA256]
+     * @return 散列句柄，算法不支持时返回 -1；句柄在 [hashFinal] 后失效，不再使用时也需调用 [hashFinal] 释放
+     */
+    fun hashCreate(algorithm: String): Int {
+        val handle = syncToNativeMethod(METHOD_HASH_CREATE, arrayOf(algorithm), null)
+        return (handle as? Number)?.toInt() ?: handle?.toString()?.toIntOrNull() ?: -1
+    }
+
+    // 向散列句柄追加二进制数据，句柄无效时返回 false
+    fun hashUpdate(handle: Int, bytes: ByteArray): Boolean {
+        return isTrue(syncToNativeMethod(METHOD_HASH_UPDATE, arrayOf(handle, bytes), null))
+    }
+
+    // 向散列句柄追加字符串（按 UTF-8），句柄无效时返回 false
+    fun hashUpdate(handle: Int, string: String): Boolean {
+        return isTrue(syncToNativeMethod(METHOD_HASH_UPDATE, arrayOf(handle, string), null))
+    }
+
+    // 结束散列计算并释放句柄，返回小写十六进制的散列值，句柄无效时返回空字符串
+    fun hashFinal(handle: Int): String {
+        return syncToNativeMethod(METHOD_HASH_FINAL, arrayOf(handle), null)?.toString() ?: ""
+    }
+
+    /**
+     * 在后台线程计算文件的散列值，不占用 Kotlin 线程，目前仅鸿蒙端支持
+     * @param path 文件绝对路径
+     * @param algorithm [HASH_ALGORITHM_MD5] 或 [HASH_ALGORITHM_SHA256]
+     * @param callback 成功时 digest 为小写十六进制的散列值，失败时 digest 为 null、errorMsg 为失败原因
+     */
+    fun hashFile(
+        path: String,
+        algorithm: String = HASH_ALGORITHM_MD5,
+        callback: (digest: String?, errorMsg: String) -> Unit
+    ) {
+        asyncToNativeMethod(METHOD_HASH_FILE, arrayOf(path, algorithm)) { res ->
+            val result = when (res) {
+                is JSONObject -> res
+                is String -> try {
+                    JSONObject(res)
+                } catch (e: Throwable) {
+                    null
+                }
+                else -> null
+            }
+            if (result != null && result.optInt("code", -1) == 0) {
+                callback(result.optString("digest"), "")
+            } else {
+                callback(null, result?.optString("message") ?: "invalid result")
+            }
+        }
+    }
+
+    private fun hashBytes(method: String, bytes: ByteArray): String {
+        return syncToNativeMethod(method, arrayOf(bytes), null)?.toString() ?: ""
+    }
+
+    private fun isTrue(value: Any?): Boolean {
+        return value == true || (value as? Number)?.toInt() == 1
+    }
+
     override fun moduleName(): String {
         return MODULE_NAME
     }
@@ -65,8 +154,17 @@ class CodecModule : Module() {
         const val METHOD_URL_DECODE = "urlDecode"
         const val METHOD_BASE64_ENCODE = "base64Encode"
         const val METHOD_BASE64_DECODE = "base64Decode"
+        const val METHOD_BASE64_URL_ENCODE = "base64UrlEncode"
+        const val METHOD_BASE64_URL_DECODE = "base64UrlDecode"
         const val METHOD_MD5 = "md5"
         const val METHOD_MD5_32 = "md5With32"
         const val METHOD_SHA256 = "sha256"
+        const val METHOD_HASH_CREATE = "hashCreate"
+        const val METHOD_HASH_UPDATE = "hashUpdate"
+        const val METHOD_HASH_FINAL = "hashFinal"
+        const val METHOD_HASH_FILE = "hashFile"
+
+        const val HASH_ALGORITHM_MD5 = "md5"
+        const val HASH_ALGORITHM_SHA256 = "sha256"
     }
 }
\ No newline at end of file
@@ -33,6 +33,7 @@ import com.tencent.kuikly.core.module.*
 import com.tencent.kuikly.core.nvi.serialization.json.JSONObject
 import com.tencent.kuikly.core.timer.setTimeout
 import com.tencent.kuikly.core.utils.verifyFailedHandler
+import com.tencent.kuikly.core.views.shadow.ShadowMeasureBatch
 import kotlin.math.roundToInt
 
 abstract class Pager : ComposeView<ComposeAttr, ComposeEvent>(), IPager {
@@ -68,6 +69,9 @@ abstract class Pager : ComposeView<ComposeAttr, ComposeEvent>(), IPager {
         BackPressHandler()
     }
     override var pageLayoutTracer = PageLayoutTracer()
+    internal val shadowMeasureBatch by lazy(LazyThreadSafetyMode.NONE) {
+        ShadowMeasureBatch(this)
+    }
 
     override fun createAttr(): ComposeAttr = ComposeAttr()
 
@@ -432,6 +436,7 @@ abstract class Pager : ComposeView<ComposeAttr, ComposeEvent>(), IPager {
         var maxLoopTimes = 3
         while (flexNode.isDirty && (--maxLoopTimes) >= 0) {
             notifyPagerWillCalculateLayoutObservers()
+            shadowMeasureBatch.prefetch(flexNode)
             flexNode.calculateLayout(null)
             notifyPagerCalculateLayoutFinishObservers()
             performDidCalculateLayoutTasks()
@@ -49,6 +49,8 @@ import com.tencent.kuikly.core.nvi.serialization.serialization
 import com.tencent.kuikly.core.reactive.ReactiveObserver
 import com.tencent.kuikly.core.reactive.handler.observable
 import com.tencent.kuikly.core.views.shadow.RichTextShadow
+import com.tencent.kuikly.core.views.shadow.ShadowBatchMeasurable
+import com.tencent.kuikly.core.views.shadow.ShadowMeasureBatch
 
 fun ViewContainer<*, *>.RichText(init: RichTextView.() -> Unit) {
     var richTextView = createViewFromRegister(ViewConst.TYPE_RICH_TEXT_CLASS_NAME) as? RichTextView
@@ -96,7 +98,7 @@ fun RichTextView.ImageSpan(spanInit: ImageSpan.() -> Unit) {
 }
 
 open class RichTextView : DeclarativeBaseView<RichTextAttr, RichTextEvent>(),
-    MeasureFunction {
+    MeasureFunction, ShadowBatchMeasurable {
     var shadow: RichTextShadow? = null
     private var didLayout = false
     internal var attrInitBlock: (RichTextAttr.() -> Unit)? = null
@@ -208,9 +210,37 @@ open class RichTextView : DeclarativeBaseView<RichTextAttr, RichTextEvent>(),
         val cHeight = measureHeightToFloat(height)
         val cWidth = measureWidthToFloat(width)
         shadow?.setValuesProp(buildValuesPropValue())
-        var size = shadow?.calculateRenderViewSize(cWidth, cHeight) ?: Size(0f, 0f)
+        val size = fitStyleSize(shadow?.calculateRenderViewSize(cWidth, cHeight) ?: Size(0f, 0f), width, height)
+        didLayout = true
+        if (shadow?.calculateFromCache != true) {
+            renderView?.setShadow()
+        }
+        measureOutput.width = size.width
+        measureOutput.height = size.height
+        dispatchPlaceholderSpanLayoutEventIfNeed()
+        tryFireLineBreakMarginEvent()
+    }
+
+    override fun collectShadowMeasure(
+        width: Float,
+        height: Float,
+        batch: ShadowMeasureBatch,
+        measureOutput: MeasureOutput
+    ) {
+        // 批量测量前渲染层需拿到最新的 spans，setValuesProp 对相同内容去重，正式测量时不会重复下发
+        val shadowSize = shadow?.let {
+            it.setValuesProp(buildValuesPropValue())
+            batch.enqueue(it, measureWidthToFloat(width), measureHeightToFloat(height))
+        } ?: Size(0f, 0f)
+        val size = fitStyleSize(shadowSize, width, height)
+        measureOutput.width = size.width
+        measureOutput.height = size.height
+    }
+
+    private fun fitStyleSize(shadowSize: Size, width: Float, height: Float): Size {
+        var size = shadowSize
         if (flexNode.flex != 0f && flexNode.positionType == FlexPositionType.RELATIVE) {
-            size = flexLayoutSize(size ?: Size(0f, 0f), width, height)
+            size = flexLayoutSize(size, width, height)
         }
         if (!flexNode.styleWidth.isUndefined()) {
             size = Size(flexNode.styleWidth, size.height)
@@ -224,14 +254,7 @@ open class RichTextView : DeclarativeBaseView<RichTextAttr, RichTextEvent>(),
         if (!flexNode.styleMinHeight.isUndefined()) {
             size = heightLayoutSize(size, width, flexNode.styleMinHeight)
         }
-        didLayout = true
-        if (shadow?.calculateFromCache != true) {
-            renderView?.setShadow()
-        }
-        measureOutput.width = size!!.width
-        measureOutput.height = size!!.height
-        dispatchPlaceholderSpanLayoutEventIfNeed()
-        tryFireLineBreakMarginEvent()
+        return size
     }
 
     private fun tryFireLineBreakMarginEvent() {
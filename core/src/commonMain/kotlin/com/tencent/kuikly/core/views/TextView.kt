@@ -34,9 +34,11 @@ import com.tencent.kuikly.core.layout.MeasureFunction
 import com.tencent.kuikly.core.layout.MeasureOutput
 import com.tencent.kuikly.core.layout.isUndefined
 import com.tencent.kuikly.core.module.FontModule
+import com.tencent.kuikly.core.views.shadow.ShadowBatchMeasurable
+import com.tencent.kuikly.core.views.shadow.ShadowMeasureBatch
 import com.tencent.kuikly.core.views.shadow.TextShadow
 
-open class TextView : DeclarativeBaseView<TextAttr, TextEvent>(), MeasureFunction {
+open class TextView : DeclarativeBaseView<TextAttr, TextEvent>(), MeasureFunction, ShadowBatchMeasurable {
 
     var shadow: TextShadow? = null
     private var didLayout = false
@@ -116,9 +118,33 @@ open class TextView : DeclarativeBaseView<TextAttr, TextEvent>(), MeasureFunctio
     ) {
         val cHeight = measureHeightToFloat(height)
         val cWidth = measureWidthToFloat(width)
-        var size = shadow?.calculateRenderViewSize(cWidth, cHeight) ?: Size(0f, 0f)
+        val size = fitStyleSize(shadow?.calculateRenderViewSize(cWidth, cHeight) ?: Size(0f, 0f), width, height)
+        didLayout = true
+
+        updateShadow()
+        measureOutput.width = size.width
+        measureOutput.height = size.height
+        tryFireLineBreakMarginEvent()
+    }
+
+    override fun collectShadowMeasure(
+        width: Float,
+        height: Float,
+        batch: ShadowMeasureBatch,
+        measureOutput: MeasureOutput
+    ) {
+        val shadowSize = shadow?.let {
+            batch.enqueue(it, measureWidthToFloat(width), measureHeightToFloat(height))
+        } ?: Size(0f, 0f)
+        val size = fitStyleSize(shadowSize, width, height)
+        measureOutput.width = size.width
+        measureOutput.height = size.height
+    }
+
+    private fun fitStyleSize(shadowSize: Size, width: Float, height: Float): Size {
+        var size = shadowSize
         if (flexNode.flex != 0f && flexNode.positionType == FlexPositionType.RELATIVE) {
-            size = flexLayoutSize(size ?: Size(0f, 0f), width, height)
+            size = flexLayoutSize(size, width, height)
         }
         if (!flexNode.styleWidth.isUndefined()) {
             size = Size(flexNode.styleWidth, size.height)
@@ -132,12 +158,7 @@ open class TextView : DeclarativeBaseView<TextAttr, TextEvent>(), MeasureFunctio
         if (!flexNode.styleMinHeight.isUndefined()) {
             size = heightLayoutSize(size, width, flexNode.styleMinHeight)
         }
-        didLayout = true
-
-        updateShadow()
-        measureOutput.width = size?.width ?: 0f
-        measureOutput.height = size?.height ?: 0f
-        tryFireLineBreakMarginEvent()
+        return size
     }
 
     private fun tryFireLineBreakMarginEvent() {
@@ -0,0 +1,149 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.tencent.kuikly.core.views.shadow
+
+import com.tencent.kuikly.core.base.Size
+import com.tencent.kuikly.core.collection.fastArrayListOf
+import com.tencent.kuikly.core.collection.fastHashSetOf
+import com.tencent.kuikly.core.layout.FlexLayoutContext
+import com.tencent.kuikly.core.layout.FlexNode
+import com.tencent.kuikly.core.layout.MeasureCollector
+import com.tencent.kuikly.core.layout.MeasureOutput
+import com.tencent.kuikly.core.manager.BridgeManager
+import com.tencent.kuikly.core.pager.Pager
+
+/**
+ * 依赖 shadow 测量的视图实现该接口，参与试算布局中的批量测量
+ */
+interface ShadowBatchMeasurable {
+    /**
+     * 试算布局中代替 measure 执行：通过 [ShadowMeasureBatch.enqueue] 登记测量，
+     * 把估算尺寸写入 measureOutput，不得产生副作用
+     */
+    fun collectShadowMeasure(
+        width: Float,
+        height: Float,
+        batch: ShadowMeasureBatch,
+        measureOutput: MeasureOutput
+    )
+}
+
+/**
+ * 页面级 shadow 批量测量（目前仅鸿蒙渲染层支持）。
+ * 待测量的 shadow 不少于 [MIN_BATCH_SIZE] 个时，正式布局前先试算一遍布局收集各 shadow 的测量约束，
+ * 通过 calculateRenderViewSizes 一次交给渲染层并行测量，结果写入 shadow 的测量缓存；
+ * 正式布局中约束与试算一致的测量直接命中缓存，不一致的（如依赖兄弟节点尺寸的 flex 行）仍逐个测量
+ */
+class ShadowMeasureBatch(private val pager: Pager) : MeasureCollector {
+
+    private class Request(val shadow: TextShadow, val width: Float, val height: Float)
+
+    // 上次布局以来被标脏的 shadow
+    private val pendingShadows = fastHashSetOf<TextShadow>()
+    private val requests = fastArrayListOf<Request>()
+    private val requestedShadows = fastHashSetOf<TextShadow>()
+
+    internal fun markPending(shadow: TextShadow) {
+        pendingShadows.add(shadow)
+    }
+
+    internal fun markDone(shadow: TextShadow) {
+        pendingShadows.remove(shadow)
+    }
+
+    /**
+     * 正式布局前调用，待测量的 shadow 足够多时试算布局并批量测量
+     */
+    fun prefetch(root: FlexNode) {
+        val pendingCount = pendingShadows.size
+        pendingShadows.clear()
+        if (pendingCount < MIN_BATCH_SIZE || !root.isDirty || !pager.pageData.isOhOs) {
+            return
+        }
+        val context = FlexLayoutContext()
+        context.measureCollector = this
+        root.dryRunLayout(context)
+        flush()
+    }
+
+    override fun collect(node: FlexNode, width: Float, height: Float, measureOutput: MeasureOutput) {
+        val measurable = node.measureFunction
+        if (measurable is ShadowBatchMeasurable) {
+            measurable.collectShadowMeasure(width, height, this, measureOutput)
+        } else {
+            // 其他测量函数不在试算中执行，以上次布局尺寸估算
+            measureOutput.width = node.layoutFrame.width
+            measureOutput.height = node.layoutFrame.height
+        }
+    }
+
+    /**
+     * 登记一次测量，返回估算尺寸：缓存命中时为准确值，否则为上次测量结果（首次测量为 0）。
+     * 同一 shadow 只登记首次请求，与正式布局中首次测量的约束对应
+     */
+    fun enqueue(shadow: TextShadow, width: Float, height: Float): Size {
+        shadow.cachedSize(width, height)?.also {
+            return it
+        }
+        if (shadow.isDirty && requestedShadows.add(shadow)) {
+            requests.add(Request(shadow, width, height))
+        }
+        return shadow.estimatedSize ?: Size(0f, 0f)
+    }
+
+    private fun flush() {
+        if (requests.size < MIN_BATCH_SIZE) {
+            clearRequests()
+            return
+        }
+        val tags = IntArray(requests.size)
+        val constraints = FloatArray(requests.size * 2)
+        requests.forEachIndexed { index, request ->
+            tags[index] = request.shadow.viewRef
+            constraints[index * 2] = request.width
+            constraints[index * 2 + 1] = request.height
+        }
+        val debugLogEnable = pager.isDebugLogEnable()
+        if (debugLogEnable) {
+            pager.pageLayoutTracer.shadowCalculateStart()
+        }
+        val sizes = BridgeManager.calculateRenderViewSizes(pager.pagerId, tags, constraints)
+        if (debugLogEnable) {
+            pager.pageLayoutTracer.shadowCalculateFinish()
+        }
+        // 不支持批量测量或结果不完整时不写缓存，正式布局逐个测量
+        if (sizes != null && sizes.size == constraints.size) {
+            requests.forEachIndexed { index, request ->
+                request.shadow.applyBatchSize(
+                    request.width,
+                    request.height,
+                    Size(sizes[index * 2], sizes[index * 2 + 1])
+                )
+            }
+        }
+        clearRequests()
+    }
+
+    private fun clearRequests() {
+        requests.clear()
+        requestedShadows.clear()
+    }
+
+    companion object {
+        // 少于该数量时批量收益抵不过试算布局的开销
+        const val MIN_BATCH_SIZE = 4
+    }
+}
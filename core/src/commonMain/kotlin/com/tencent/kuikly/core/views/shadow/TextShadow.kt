@@ -17,6 +17,8 @@ package com.tencent.kuikly.core.views.shadow
 
 import com.tencent.kuikly.core.base.Shadow
 import com.tencent.kuikly.core.base.Size
+import com.tencent.kuikly.core.manager.PagerManager
+import com.tencent.kuikly.core.pager.Pager
 
 open class TextShadow(pagerId: String, viewRef: Int, viewName: String) : Shadow(
     pagerId, viewRef,
@@ -29,6 +31,18 @@ open class TextShadow(pagerId: String, viewRef: Int, viewName: String) : Shadow(
     private var lastSize: Size? = null
     internal var calculateFromCache = false
         private set
+    // 缓存由批量测量写入、尚未被 measure 取用，取用时仍视为新测量结果
+    private var fromBatch = false
+    // 最近一次测量结果，标脏后保留，供试算布局估算尺寸
+    internal var estimatedSize: Size? = null
+        private set
+    private val measureBatch: ShadowMeasureBatch? by lazy(LazyThreadSafetyMode.NONE) {
+        (PagerManager.getPager(pagerId) as? Pager)?.shadowMeasureBatch
+    }
+
+    init {
+        measureBatch?.markPending(this)
+    }
 
     override fun setProp(key: String, value: Any) {
         super.setProp(key, value)
@@ -41,19 +55,41 @@ open class TextShadow(pagerId: String, viewRef: Int, viewName: String) : Shadow(
             && lastHeight == height
             && lastSize != null
         ) {
-            calculateFromCache = true
+            calculateFromCache = !fromBatch
+            fromBatch = false
             return lastSize!!
         }
         calculateFromCache = false
+        fromBatch = false
         val size = super.calculateRenderViewSize(width, height)
+        updateCache(width, height, size)
+        return size
+    }
+
+    override fun removeFromParentComponent() {
+        super.removeFromParentComponent()
+        measureBatch?.markDone(this)
+    }
+
+    internal fun cachedSize(width: Float, height: Float): Size? {
+        return if (!isDirty && lastWidth == width && lastHeight == height) lastSize else null
+    }
+
+    internal fun applyBatchSize(width: Float, height: Float, size: Size) {
+        updateCache(width, height, size)
+        fromBatch = true
+    }
+
+    private fun updateCache(width: Float, height: Float, size: Size) {
         markNotDirty()
         lastWidth = width
         lastHeight = height
         lastSize = size
-        return size
+        estimatedSize = size
     }
 
     fun markDirty() {
+        measureBatch?.markPending(this)
         if (isDirty) {
             return
         }
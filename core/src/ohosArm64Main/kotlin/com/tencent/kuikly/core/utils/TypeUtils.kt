@@ -76,6 +76,27 @@ fun Any?.toKRRenderCValue(memScope: MemScope, renderCValue: KRRenderCValue): KRR
                 renderCValue.value.bytesValue = this.usePinned { it.addressOf(0) }
             }
         }
+        is FloatArray -> {
+            renderCValue.type = Type.FLOAT32_ARRAY
+            renderCValue.size = this.size
+            if (renderCValue.size > 0) {
+                renderCValue.value.float32ArrayValue = this.usePinned { it.addressOf(0) }
+            }
+        }
+        is DoubleArray -> {
+            renderCValue.type = Type.FLOAT64_ARRAY
+            renderCValue.size = this.size
+            if (renderCValue.size > 0) {
+                renderCValue.value.float64ArrayValue = this.usePinned { it.addressOf(0) }
+            }
+        }
+        is IntArray -> {
+            renderCValue.type = Type.INT32_ARRAY
+            renderCValue.size = this.size
+            if (renderCValue.size > 0) {
+                renderCValue.value.int32ArrayValue = this.usePinned { it.addressOf(0) }
+            }
+        }
         is Array<*> -> {
             renderCValue.type = Type.ARRAY
             renderCValue.size = this.size
@@ -111,6 +132,9 @@ fun KRRenderCValue.toAny(): Any? {
         Type.STRING -> value.stringValue?.toKString()
         Type.BYTES -> toByteArray()
         Type.ARRAY -> value.arrayValue?.arrayToAny(size)
+        Type.FLOAT32_ARRAY -> toFloatArray()
+        Type.FLOAT64_ARRAY -> toDoubleArray()
+        Type.INT32_ARRAY -> toIntArray()
         else -> null
     }
 }
@@ -137,6 +161,42 @@ private fun KRRenderCValue.toByteArray(): Any {
     return byteArray
 }
 
+@OptIn(ExperimentalForeignApi::class)
+private fun KRRenderCValue.toFloatArray(): FloatArray {
+    val array = FloatArray(size)
+    val source = value.float32ArrayValue
+    if (size > 0 && source != null) {
+        array.usePinned { pinned ->
+            platform.posix.memcpy(pinned.addressOf(0), source, (size * Float.SIZE_BYTES).convert<platform.posix.size_t>())
+        }
+    }
+    return array
+}
+
+@OptIn(ExperimentalForeignApi::class)
+private fun KRRenderCValue.toDoubleArray(): DoubleArray {
+    val array = DoubleArray(size)
+    val source = value.float64ArrayValue
+    if (size > 0 && source != null) {
+        array.usePinned { pinned ->
+            platform.posix.memcpy(pinned.addressOf(0), source, (size * Double.SIZE_BYTES).convert<platform.posix.size_t>())
+        }
+    }
+    return array
+}
+
+@OptIn(ExperimentalForeignApi::class)
+private fun KRRenderCValue.toIntArray(): IntArray {
+    val array = IntArray(size)
+    val source = value.int32ArrayValue
+    if (size > 0 && source != null) {
+        array.usePinned { pinned ->
+            platform.posix.memcpy(pinned.addressOf(0), source, (size * Int.SIZE_BYTES).convert<platform.posix.size_t>())
+        }
+    }
+    return array
+}
+
 @OptIn(ExperimentalForeignApi::class)
 fun CValue<KRRenderCValue>.toAny(): Any? {
     return useContents {